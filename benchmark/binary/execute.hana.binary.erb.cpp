@@ -0,0 +1,34 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/binary.hpp>
+
+#include "measure.hpp"
+#include "binary/record.hpp"
+#include <cstddef>
+#include <vector>
+
+
+int main () {
+    auto trades = make_trades(<%= input_size %> * 100);
+    std::vector<char> buffer(trades.size() * 128);
+    Trade trade{};
+    std::size_t total = 0;
+
+    boost::hana::benchmark::measure([&] {
+        char* out = buffer.data();
+        for (auto const& t : trades)
+            out = boost::hana::to_binary(t, out);
+
+        char const* in = buffer.data();
+        while (in != out) {
+            in = boost::hana::from_binary(in, out, trade);
+            total += trade.fills.size();
+        }
+    });
+
+    return total == 0;
+}
@@ -0,0 +1,119 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include "measure.hpp"
+#include "binary/record.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+
+// Writes and reads the members one by one, like one would without
+// introspection. The representation is the same as hana::to_binary's.
+template <typename T>
+char* put(char* out, T const& x) {
+    std::memcpy(out, &x, sizeof(T));
+    return out + sizeof(T);
+}
+
+char* put_size(char* out, std::uint64_t n) {
+    do {
+        *out++ = static_cast<char>((n & 0x7F) | (n > 0x7F ? 0x80 : 0));
+        n >>= 7;
+    } while (n != 0);
+    return out;
+}
+
+char* encode(Trade const& t, char* out) {
+    out = put(out, t.id);
+    out = put(out, t.timestamp);
+    out = put(out, t.price);
+    out = put(out, t.quantity);
+    out = put(out, t.venue);
+    out = put(out, t.quote.bid);
+    out = put(out, t.quote.ask);
+    out = put(out, t.quote.bid_size);
+    out = put(out, t.quote.ask_size);
+    out = put(out, t.side);
+    out = put_size(out, t.symbol.size());
+    std::memcpy(out, t.symbol.data(), t.symbol.size());
+    out += t.symbol.size();
+    out = put_size(out, t.fills.size());
+    std::memcpy(out, t.fills.data(), t.fills.size() * sizeof(double));
+    return out + t.fills.size() * sizeof(double);
+}
+
+template <typename T>
+char const* get(char const* in, char const* last, T& x) {
+    if (in == nullptr || static_cast<std::size_t>(last - in) < sizeof(T))
+        return nullptr;
+    std::memcpy(&x, in, sizeof(T));
+    return in + sizeof(T);
+}
+
+char const* get_size(char const* in, char const* last, std::uint64_t& n) {
+    if (in == nullptr)
+        return nullptr;
+    n = 0;
+    for (unsigned shift = 0; shift < 64 && in != last; shift += 7) {
+        std::uint64_t const byte = static_cast<unsigned char>(*in++);
+        n |= (byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0)
+            return in;
+    }
+    return nullptr;
+}
+
+char const* decode(char const* in, char const* last, Trade& t) {
+    in = get(in, last, t.id);
+    in = get(in, last, t.timestamp);
+    in = get(in, last, t.price);
+    in = get(in, last, t.quantity);
+    in = get(in, last, t.venue);
+    in = get(in, last, t.quote.bid);
+    in = get(in, last, t.quote.ask);
+    in = get(in, last, t.quote.bid_size);
+    in = get(in, last, t.quote.ask_size);
+    in = get(in, last, t.side);
+
+    std::uint64_t n;
+    in = get_size(in, last, n);
+    if (in == nullptr || n > static_cast<std::size_t>(last - in))
+        return nullptr;
+    t.symbol.assign(in, n);
+    in += n;
+
+    in = get_size(in, last, n);
+    if (in == nullptr || n > static_cast<std::size_t>(last - in) / sizeof(double))
+        return nullptr;
+    t.fills.resize(n);
+    std::memcpy(t.fills.data(), in, n * sizeof(double));
+    return in + n * sizeof(double);
+}
+
+
+int main () {
+    auto trades = make_trades(<%= input_size %> * 100);
+    std::vector<char> buffer(trades.size() * 128);
+    Trade trade{};
+    std::size_t total = 0;
+
+    boost::hana::benchmark::measure([&] {
+        char* out = buffer.data();
+        for (auto const& t : trades)
+            out = encode(t, out);
+
+        char const* in = buffer.data();
+        while (in != out) {
+            in = decode(in, out, trade);
+            total += trade.fills.size();
+        }
+    });
+
+    return total == 0;
+}
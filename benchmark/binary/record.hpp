@@ -0,0 +1,55 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_BENCHMARK_BINARY_RECORD_HPP
+#define BOOST_HANA_BENCHMARK_BINARY_RECORD_HPP
+
+#include <boost/hana/struct.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+enum class Side : std::uint8_t { buy, sell };
+
+struct Quote {
+    BOOST_HANA_DEFINE_STRUCT(Quote,
+        (double, bid),
+        (double, ask),
+        (std::int32_t, bid_size),
+        (std::int32_t, ask_size)
+    );
+};
+
+struct Trade {
+    BOOST_HANA_DEFINE_STRUCT(Trade,
+        (std::uint64_t, id),
+        (std::int64_t, timestamp),
+        (double, price),
+        (std::int32_t, quantity),
+        (std::int32_t, venue),
+        (Quote, quote),
+        (Side, side),
+        (std::string, symbol),
+        (std::vector<double>, fills)
+    );
+};
+
+inline std::vector<Trade> make_trades(std::size_t n) {
+    std::vector<Trade> trades;
+    for (std::size_t i = 0; i != n; ++i) {
+        auto k = static_cast<std::int32_t>(i);
+        trades.push_back(Trade{i, 1000000 + k, k * 0.25, k % 100, k % 7,
+                               Quote{k * 0.25 - 0.01, k * 0.25 + 0.01, 100, 200},
+                               i % 2 == 0 ? Side::buy : Side::sell,
+                               "SYM" + std::to_string(i % 1000), {k * 0.5, k * 0.75}});
+    }
+    return trades;
+}
+
+#endif
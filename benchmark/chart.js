@@ -8,7 +8,105 @@ Distributed under the Boost Software License, Version 1.0.
   'use strict';
 
   var Hana = {};
-  Hana.initChart = function(div, options) {
+
+  // The title of the y axis and the unit of the values for each aspect
+  // measured by measure.rb. The aspect of a chart is given by its "aspect"
+  // option, and it defaults to a time in seconds.
+  Hana.aspects = {
+    execution_time:   { title: "Time (s)", unit: "s" },
+    compilation_time: { title: "Time (s)", unit: "s" },
+    bloat:            { title: "Executable size (kb)", unit: "kb" },
+    memory:           { title: "Peak memory usage of the compiler (MB)", unit: "MB" },
+    instantiations:   { title: "Template instantiations", unit: "" },
+    frontend_time:    { title: "Time spent in the frontend (s)", unit: "s" },
+    tokens:           { title: "Tokens after preprocessing", unit: "" }
+  };
+
+  // Returns whether some point of the chart holds the breakdown of the
+  // size of an executable, which measure.rb computes for the bloat aspect.
+  var hasBreakdown = function(options) {
+    return $.grep(options.series, function(series) {
+      return $.grep(series.data || [], function(point) {
+        return point.breakdown != undefined;
+      }).length > 0;
+    }).length > 0;
+  };
+
+  // Symbol names are full of '<' and '>', which must not be taken as markup.
+  var escape = function(text) {
+    return String(text).replace(/&/g, "&amp;").replace(/</g, "&lt;").replace(/>/g, "&gt;");
+  };
+
+  // Shows the size of each group of symbols in a breakdown as a column
+  // chart in `div`. Clicking on a column shows the largest instantiations
+  // of that group, and clicking on an instantiation goes back to the
+  // groups.
+  Hana.initBreakdown = function(div, title, breakdown) {
+    var showGroups, showInstantiations;
+
+    showGroups = function() {
+      div.highcharts({
+        chart: { type: 'column' },
+        title: { text: title },
+        subtitle: { text: "Click on a column to see the instantiations" },
+        xAxis: { type: 'category' },
+        yAxis: { title: { text: "Size of the symbols (kb)" }, floor: 0 },
+        legend: { enabled: false },
+        tooltip: { valueSuffix: "kb" },
+        series: [{
+          name: "Size of the symbols",
+          data: $.map(breakdown.symbols, function(group) {
+            return { name: group.name, y: group.size, group: group };
+          }),
+          point: { events: { click: function() {
+            showInstantiations(this.group);
+          }}}
+        }]
+      });
+    };
+
+    showInstantiations = function(group) {
+      div.highcharts({
+        chart: { type: 'bar' },
+        title: { text: title + " (" + group.name + ")" },
+        subtitle: { text: "Click on a bar to go back" },
+        xAxis: {
+          type: 'category',
+          labels: { formatter: function() {
+            var name = String(this.value);
+            return escape(name.length > 60 ? name.substr(0, 60) + "..." : name);
+          }}
+        },
+        yAxis: { title: { text: "Size of the symbol (kb)" }, floor: 0 },
+        legend: { enabled: false },
+        tooltip: {
+          headerFormat: "",
+          pointFormatter: function() {
+            return escape(this.name) + "<br/><b>" + this.y + "kb</b>";
+          }
+        },
+        series: [{
+          name: group.name,
+          data: $.map(group.instantiations, function(instantiation) {
+            return [{ name: instantiation[0], y: instantiation[1] }];
+          }),
+          point: { events: { click: showGroups } }
+        }]
+      });
+    };
+
+    if (div.highcharts())
+      div.highcharts().destroy();
+    showGroups();
+  };
+
+  // When the points of the chart hold the breakdown of the size of an
+  // executable, the size of its sections is shown in the tooltip, and
+  // clicking on a point shows its symbols in the `breakdown` div, if any.
+  Hana.initChart = function(div, options, breakdown) {
+    var aspect = Hana.aspects[options.aspect] || Hana.aspects.execution_time;
+    delete options.aspect;
+
     if (options.xAxis == undefined) {
       options.xAxis = {
         title: { text: "Number of elements" },
@@ -18,7 +116,7 @@ Distributed under the Boost Software License, Version 1.0.
 
     if (options.yAxis == undefined) {
       options.yAxis = {
-        title: { text: "Time (s)" },
+        title: { text: aspect.title },
         floor: 0
       };
     }
@@ -44,7 +142,33 @@ Distributed under the Boost Software License, Version 1.0.
     }
 
     options.tooltip = options.tooltip || {};
-    options.tooltip.valueSuffix = options.tooltip.valueSuffix || 's';
+    if (options.tooltip.valueSuffix == undefined) {
+      options.tooltip.valueSuffix = aspect.unit;
+    }
+
+    if (hasBreakdown(options)) {
+      options.tooltip.pointFormatter = function() {
+        var suffix = options.tooltip.valueSuffix;
+        var text = '<span style="color:' + this.color + '">\u25CF</span> ' +
+                   this.series.name + ': <b>' + this.y + suffix + '</b><br/>';
+        if (this.breakdown != undefined) {
+          $.each(this.breakdown.sections, function(section, size) {
+            text += section + ': ' + size + suffix + '<br/>';
+          });
+        }
+        return text;
+      };
+
+      if (breakdown != undefined) {
+        options.plotOptions.series.cursor = 'pointer';
+        options.plotOptions.series.point = { events: { click: function() {
+          if (this.breakdown != undefined) {
+            Hana.initBreakdown(breakdown, options.title.text + " with " +
+              this.series.name + " (n = " + this.x + ")", this.breakdown);
+          }
+        }}};
+      }
+    }
 
     if (options.legend == undefined) {
       options.legend = {
@@ -0,0 +1,38 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/binary.hpp>
+
+#include "measure.hpp"
+#include "columnar/record.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+
+int main () {
+    char const* path = "execute.hana.binary.<%= input_size %>.tmp";
+    {
+        std::ofstream out{path, std::ios::binary};
+        boost::hana::to_binary(make_trades(<%= input_size %> * 1000),
+                               std::ostreambuf_iterator<char>{out});
+    }
+    std::int64_t total = 0;
+
+    boost::hana::benchmark::measure([&] {
+        std::ifstream in{path, std::ios::binary};
+        std::vector<char> bytes{std::istreambuf_iterator<char>{in}, {}};
+        std::vector<Trade> trades;
+        boost::hana::from_binary(bytes.data(), bytes.data() + bytes.size(), trades);
+        for (Trade const& trade : trades)
+            total += trade.quantity;
+    });
+
+    std::remove(path);
+    return total == 0;
+}
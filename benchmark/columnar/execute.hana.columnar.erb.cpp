@@ -0,0 +1,35 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/columnar.hpp>
+#include <boost/hana/string.hpp>
+
+#include "measure.hpp"
+#include "columnar/record.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+
+
+int main () {
+    char const* path = "execute.hana.columnar.<%= input_size %>.tmp";
+    {
+        std::ofstream out{path, std::ios::binary};
+        boost::hana::write_columnar(out, make_trades(<%= input_size %> * 1000));
+    }
+    std::int64_t total = 0;
+
+    boost::hana::benchmark::measure([&] {
+        boost::hana::columnar_file<Trade> file;
+        if (file.open(path) != boost::hana::columnar_status::ok)
+            return;
+        for (std::int32_t quantity : file.column(BOOST_HANA_STRING("quantity")))
+            total += quantity;
+    });
+
+    std::remove(path);
+    return total == 0;
+}
@@ -0,0 +1,41 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_BENCHMARK_COLUMNAR_RECORD_HPP
+#define BOOST_HANA_BENCHMARK_COLUMNAR_RECORD_HPP
+
+#include <boost/hana/struct.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+struct Trade {
+    BOOST_HANA_DEFINE_STRUCT(Trade,
+        (std::uint64_t, id),
+        (std::int64_t, timestamp),
+        (double, price),
+        (double, fees),
+        (std::int32_t, quantity),
+        (std::int32_t, account),
+        (std::int32_t, venue),
+        (char, side),
+        (bool, cancelled)
+    );
+};
+
+inline std::vector<Trade> make_trades(std::size_t n) {
+    std::vector<Trade> trades;
+    for (std::size_t i = 0; i != n; ++i) {
+        auto k = static_cast<std::int32_t>(i);
+        trades.push_back(Trade{i, 1431554400 + k, k * 0.25, 0.01, k % 100,
+                               k % 17, k % 5, k % 2 ? 'b' : 's', k % 50 == 0});
+    }
+    return trades;
+}
+
+#endif
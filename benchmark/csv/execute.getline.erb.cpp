@@ -0,0 +1,59 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include "measure.hpp"
+#include "csv/record.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+
+// Splits each line at the commas outside of quotes, and converts the fields
+// with the C library. The columns are assumed to be in the order of the
+// members.
+int main () {
+    char const* path = "execute.getline.<%= input_size %>.csv";
+    make_csv(path, <%= input_size %>);
+    std::vector<Trade> trades;
+    bool ok = true;
+
+    boost::hana::benchmark::measure([&] {
+        trades.clear();
+        std::ifstream in{path, std::ios::binary};
+        std::string line;
+        std::getline(in, line);
+        std::vector<std::string> fields;
+        while (std::getline(in, line)) {
+            fields.clear();
+            std::string field;
+            bool quoted = false;
+            for (char c : line) {
+                if (c == '"')
+                    quoted = !quoted;
+                else if (c == ',' && !quoted)
+                    fields.push_back(std::move(field)), field.clear();
+                else
+                    field += c;
+            }
+            fields.push_back(std::move(field));
+            if (fields.size() != 6) {
+                ok = false;
+                return;
+            }
+            trades.push_back(Trade{
+                std::strtoll(fields[0].c_str(), nullptr, 10), fields[1],
+                std::strtod(fields[2].c_str(), nullptr),
+                static_cast<std::int32_t>(std::strtol(fields[3].c_str(), nullptr, 10)),
+                std::strtoll(fields[4].c_str(), nullptr, 10), fields[5] == "true"
+            });
+        }
+    }, 3);
+
+    std::remove(path);
+    return !ok;
+}
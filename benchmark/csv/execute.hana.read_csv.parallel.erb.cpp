@@ -0,0 +1,28 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/csv.hpp>
+
+#include "measure.hpp"
+#include "csv/record.hpp"
+#include <cstdio>
+#include <vector>
+
+
+int main () {
+    char const* path = "execute.hana.read_csv.parallel.<%= input_size %>.csv";
+    make_csv(path, <%= input_size %>);
+    std::vector<Trade> trades;
+    bool ok = true;
+
+    boost::hana::benchmark::measure([&] {
+        trades.clear();
+        ok = ok && boost::hana::read_csv(path, trades, boost::hana::csv_options{',', 0});
+    }, 3);
+
+    std::remove(path);
+    return !ok;
+}
@@ -0,0 +1,46 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_BENCHMARK_CSV_RECORD_HPP
+#define BOOST_HANA_BENCHMARK_CSV_RECORD_HPP
+
+#include <boost/hana/struct.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+
+struct Trade {
+    BOOST_HANA_DEFINE_STRUCT(Trade,
+        (std::int64_t, id),
+        (std::string, symbol),
+        (double, price),
+        (std::int32_t, quantity),
+        (std::int64_t, timestamp),
+        (bool, buy)
+    );
+};
+
+// Writes a CSV file of about `megabytes` megabytes of trades.
+inline void make_csv(char const* path, std::size_t megabytes) {
+    char const* symbols[] = {"AAPL", "MSFT", "GOOG", "\"BRK, B\"", "IBM"};
+    std::ofstream out{path, std::ios::binary};
+    out << "id,symbol,price,quantity,timestamp,buy\n";
+    std::string line;
+    std::size_t size = 0;
+    for (std::int64_t i = 0; size < megabytes * 1000000; ++i) {
+        line = std::to_string(i) + ',' + symbols[i % 5] + ','
+             + std::to_string(i % 10000) + '.' + std::to_string(i % 100) + ','
+             + std::to_string(i % 1000) + ',' + std::to_string(1431554400 + i) + ','
+             + (i % 2 ? "true" : "false") + '\n';
+        out << line;
+        size += line.size();
+    }
+}
+
+#endif
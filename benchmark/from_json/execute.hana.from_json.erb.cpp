@@ -0,0 +1,30 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/json.hpp>
+
+#include "measure.hpp"
+#include "from_json/record.hpp"
+#include <cstddef>
+#include <string>
+
+
+int main () {
+    std::string const input = make_input(<%= input_size %> * 100);
+    char const* const last = input.data() + input.size();
+    long long total = 0;
+
+    boost::hana::benchmark::measure([&] {
+        Record record;
+        for (char const* first = input.data(); first && first != last; ) {
+            first = boost::hana::from_json(first, last, record);
+            first = boost::hana::json_detail::skip_whitespace(first, last);
+            total += record.id;
+        }
+    });
+
+    return total == 0;
+}
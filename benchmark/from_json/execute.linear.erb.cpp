@@ -0,0 +1,78 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/json.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/struct.hpp>
+
+#include "measure.hpp"
+#include "from_json/record.hpp"
+#include <cstddef>
+#include <cstring>
+#include <string>
+namespace hana = boost::hana;
+namespace json = boost::hana::json_detail;
+
+
+// Reads a Record like hana::from_json does, except the member corresponding
+// to a key is found by comparing the key with the name of each member.
+char const* read(char const* first, char const* last, Record& r) {
+    first = json::skip_whitespace(first, last);
+    if (first == last || *first++ != '{')
+        return nullptr;
+    while (true) {
+        first = json::skip_whitespace(first, last);
+        char const* key = json::find_string_end(first, last);
+        if (!key)
+            return nullptr;
+        std::size_t const size = static_cast<std::size_t>(key - first - 1);
+        char const* name = first + 1;
+        first = json::skip_whitespace(key + 1, last);
+        if (first == last || *first++ != ':')
+            return nullptr;
+
+        bool found = false;
+        hana::for_each(hana::accessors<Record>(), [&](auto member) {
+            char const* candidate = hana::to<char const*>(hana::first(member));
+            if (!found && std::strlen(candidate) == size &&
+                std::memcmp(candidate, name, size) == 0)
+            {
+                found = true;
+                first = hana::from_json(first, last, hana::second(member)(r));
+            }
+        });
+        if (!found)
+            first = json::skip_value(first, last);
+        if (!first)
+            return nullptr;
+
+        first = json::skip_whitespace(first, last);
+        if (first == last)
+            return nullptr;
+        if (*first == '}')
+            return first + 1;
+        if (*first++ != ',')
+            return nullptr;
+    }
+}
+
+int main () {
+    std::string const input = make_input(<%= input_size %> * 100);
+    char const* const last = input.data() + input.size();
+    long long total = 0;
+
+    boost::hana::benchmark::measure([&] {
+        Record record;
+        for (char const* first = input.data(); first && first != last; ) {
+            first = read(first, last, record);
+            first = json::skip_whitespace(first, last);
+            total += record.id;
+        }
+    });
+
+    return total == 0;
+}
@@ -0,0 +1,57 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_BENCHMARK_FROM_JSON_RECORD_HPP
+#define BOOST_HANA_BENCHMARK_FROM_JSON_RECORD_HPP
+
+#include <boost/hana/json.hpp>
+#include <boost/hana/struct.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <string>
+
+
+struct Record {
+    BOOST_HANA_DEFINE_STRUCT(Record,
+        (int, id),
+        (std::string, name),
+        (std::string, email),
+        (int, age),
+        (double, height),
+        (double, weight),
+        (bool, active),
+        (double, score),
+        (int, rank),
+        (int, level),
+        (std::string, country),
+        (std::string, city),
+        (std::string, street),
+        (int, zip),
+        (std::string, phone),
+        (double, balance)
+    );
+};
+
+// Returns `n` records written one after the other, with their members in
+// reverse order so that finding them by trying each name in order is not
+// unrealistically fast.
+inline std::string make_input(std::size_t n) {
+    std::string input;
+    for (std::size_t i = 0; i != n; ++i) {
+        int k = static_cast<int>(i);
+        input += "{\"balance\":" + std::to_string(k * 1.5) + ",\"phone\":\"555-0100\","
+                 "\"zip\":" + std::to_string(k % 100000) + ",\"street\":\"Main Street\","
+                 "\"city\":\"Springfield\",\"country\":\"US\",\"level\":3,"
+                 "\"rank\":" + std::to_string(k) + ",\"score\":98.25,\"active\":true,"
+                 "\"weight\":72.5,\"height\":1.8,\"age\":" + std::to_string(k % 90) + ","
+                 "\"email\":\"someone@example.com\",\"name\":\"Some One\","
+                 "\"id\":" + std::to_string(k) + "}\n";
+    }
+    return input;
+}
+
+#endif
@@ -0,0 +1,27 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/hash.hpp>
+
+#include "measure.hpp"
+#include "hash/record.hpp"
+#include <cstddef>
+
+
+int main () {
+    auto keys = make_keys(<%= input_size %> * 100);
+    auto records = make_records(<%= input_size %> * 100);
+    std::size_t total = 0;
+
+    boost::hana::benchmark::measure([&] {
+        for (auto const& key : keys)
+            total += boost::hana::hash(key);
+        for (auto const& record : records)
+            total += boost::hana::hash(record);
+    });
+
+    return total == 0;
+}
@@ -0,0 +1,51 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include "measure.hpp"
+#include "hash/record.hpp"
+#include <cstddef>
+#include <functional>
+#include <string>
+
+
+// The classic boost::hash_combine, applied to each member by hand.
+template <typename T>
+void hash_combine(std::size_t& seed, T const& x)
+{ seed ^= std::hash<T>{}(x) + 0x9e3779b9 + (seed << 6) + (seed >> 2); }
+
+std::size_t hash(Key const& key) {
+    std::size_t seed = 0;
+    hash_combine(seed, key.tenant);
+    hash_combine(seed, key.shard);
+    hash_combine(seed, key.id);
+    hash_combine(seed, key.version);
+    hash_combine(seed, key.kind);
+    return seed;
+}
+
+std::size_t hash(Record const& record) {
+    std::size_t seed = 0;
+    hash_combine(seed, record.name);
+    hash_combine(seed, record.age);
+    hash_combine(seed, record.score);
+    return seed;
+}
+
+
+int main () {
+    auto keys = make_keys(<%= input_size %> * 100);
+    auto records = make_records(<%= input_size %> * 100);
+    std::size_t total = 0;
+
+    boost::hana::benchmark::measure([&] {
+        for (auto const& key : keys)
+            total += hash(key);
+        for (auto const& record : records)
+            total += hash(record);
+    });
+
+    return total == 0;
+}
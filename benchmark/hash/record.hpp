@@ -0,0 +1,55 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_BENCHMARK_HASH_RECORD_HPP
+#define BOOST_HANA_BENCHMARK_HASH_RECORD_HPP
+
+#include <boost/hana/struct.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+// Made only of integers, without padding.
+struct Key {
+    BOOST_HANA_DEFINE_STRUCT(Key,
+        (std::uint32_t, tenant),
+        (std::uint32_t, shard),
+        (std::uint64_t, id),
+        (std::int32_t, version),
+        (std::int32_t, kind)
+    );
+};
+
+struct Record {
+    BOOST_HANA_DEFINE_STRUCT(Record,
+        (std::string, name),
+        (int, age),
+        (double, score)
+    );
+};
+
+inline std::vector<Key> make_keys(std::size_t n) {
+    std::vector<Key> keys;
+    for (std::size_t i = 0; i != n; ++i) {
+        auto k = static_cast<std::uint32_t>(i);
+        keys.push_back(Key{k % 16, k % 7, i * 31, static_cast<std::int32_t>(k % 3), 1});
+    }
+    return keys;
+}
+
+inline std::vector<Record> make_records(std::size_t n) {
+    std::vector<Record> records;
+    for (std::size_t i = 0; i != n; ++i) {
+        int k = static_cast<int>(i);
+        records.push_back(Record{"record " + std::to_string(i), k % 90, k * 0.5});
+    }
+    return records;
+}
+
+#endif
@@ -0,0 +1,57 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana.hpp>
+
+#include <iostream>
+#include <string>
+namespace hana = boost::hana;
+
+
+// A translation unit doing what typical users of Hana do: introspecting a
+// struct, looking up things in a map and running a few algorithms on a
+// heterogeneous tuple.
+
+struct Person {
+    BOOST_HANA_DEFINE_STRUCT(Person,
+        (std::string, name),
+        (int, age),
+        (double, height)
+    );
+};
+
+template <typename T>
+void print(std::ostream& os, T const& x) {
+    hana::for_each(hana::keys(x), [&](auto key) {
+        os << hana::to<char const*>(key) << ": " << hana::at_key(x, key) << '\n';
+    });
+}
+
+int main() {
+    Person john{"John", 30, 1.80};
+    print(std::cout, john);
+
+    auto defaults = hana::make_map(
+        hana::make_pair(hana::type<int>, 0),
+        hana::make_pair(hana::type<double>, 0.0),
+        hana::make_pair(hana::type<char>, 'a')
+    );
+
+    auto xs = hana::make_tuple(1, 2.2, 'c', hana::int_<3>);
+    auto numbers = hana::filter(xs, [](auto x) {
+        return hana::bool_<std::is_arithmetic<decltype(x)>::value>;
+    });
+    auto sum = hana::fold_left(hana::transform(numbers, [](auto x) {
+        return x * 2;
+    }), 0.0, [](auto state, auto x) { return state + x; });
+
+    auto types = hana::transform(numbers, hana::decltype_);
+    auto found = hana::find(defaults, hana::type<<%= ["int", "double", "char"][input_size % 3] %>>);
+
+    std::cout << sum << ' ' << hana::length(types) << ' '
+              << hana::maybe(0, [](auto x) { return static_cast<int>(x); }, found)
+              << '\n';
+}
@@ -0,0 +1,66 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/functional/placeholder.hpp>
+#include <boost/hana/sequence.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/struct.hpp>
+
+#include "measure.hpp"
+#include "json/record.hpp"
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <vector>
+using namespace boost::hana;
+
+
+// This is the approach of example/tutorial/introspection.json.cpp.
+template <typename Xs>
+std::string join(Xs&& xs, std::string sep)
+{ return fold(intersperse(static_cast<Xs&&>(xs), sep), "", _ + _); }
+
+std::string quote(std::string s) { return "\"" + s + "\""; }
+
+template <typename T>
+auto to_json(T const& x) -> decltype(std::to_string(x))
+{ return std::to_string(x); }
+
+std::string to_json(bool b) { return b ? "true" : "false"; }
+std::string to_json(std::string s) { return quote(s); }
+
+template <typename T>
+std::string to_json(std::vector<T> const& xs) {
+    std::string json = "[";
+    for (std::size_t i = 0; i != xs.size(); ++i)
+        json += (i == 0 ? "" : ",") + to_json(xs[i]);
+    return json + "]";
+}
+
+template <typename T>
+    std::enable_if_t<models<Struct, T>(),
+std::string> to_json(T const& x) {
+    auto json = transform(keys(x), [&](auto name) {
+        auto const& member = at_key(x, name);
+        return quote(to<char const*>(name)) + ":" + to_json(member);
+    });
+
+    return "{" + join(std::move(json), ",") + "}";
+}
+
+
+int main () {
+    auto records = make_records(<%= input_size %> * 100);
+    std::size_t total = 0;
+
+    boost::hana::benchmark::measure([&] {
+        for (auto const& record : records)
+            total += to_json(record).size();
+    });
+
+    return total == 0;
+}
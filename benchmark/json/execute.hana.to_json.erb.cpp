@@ -0,0 +1,30 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/json.hpp>
+
+#include "measure.hpp"
+#include "json/record.hpp"
+#include <cstddef>
+#include <iterator>
+#include <string>
+
+
+int main () {
+    auto records = make_records(<%= input_size %> * 100);
+    std::string out;
+    std::size_t total = 0;
+
+    boost::hana::benchmark::measure([&] {
+        for (auto const& record : records) {
+            out.clear();
+            boost::hana::to_json(record, std::back_inserter(out));
+            total += out.size();
+        }
+    });
+
+    return total == 0;
+}
@@ -0,0 +1,44 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_BENCHMARK_JSON_RECORD_HPP
+#define BOOST_HANA_BENCHMARK_JSON_RECORD_HPP
+
+#include <boost/hana/struct.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+
+struct Position {
+    BOOST_HANA_DEFINE_STRUCT(Position,
+        (double, latitude),
+        (double, longitude)
+    );
+};
+
+struct Record {
+    BOOST_HANA_DEFINE_STRUCT(Record,
+        (int, id),
+        (std::string, name),
+        (bool, active),
+        (Position, position),
+        (std::vector<int>, tags)
+    );
+};
+
+inline std::vector<Record> make_records(std::size_t n) {
+    std::vector<Record> records;
+    for (std::size_t i = 0; i != n; ++i) {
+        int k = static_cast<int>(i);
+        records.push_back(Record{k, "record " + std::to_string(i), i % 2 == 0,
+                                 Position{k * 0.25, k * -0.5}, {k, k + 1, k + 2}});
+    }
+    return records;
+}
+
+#endif
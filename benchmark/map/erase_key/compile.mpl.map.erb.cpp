@@ -0,0 +1,23 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/mpl/erase_key.hpp>
+#include <boost/mpl/insert.hpp>
+#include <boost/mpl/int.hpp>
+#include <boost/mpl/map.hpp>
+#include <boost/mpl/pair.hpp>
+namespace mpl = boost::mpl;
+
+
+template <int>
+struct x;
+
+using map = <%= mpl_map((1..input_size).map { |n| "mpl::pair<x<#{n}>, mpl::int_<#{n}>>" }) %>;
+
+using result = mpl::erase_key<map, x<1>>::type;
+
+
+int main() { }
@@ -0,0 +1,30 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/type.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+namespace hana = boost::hana;
+
+
+template <int>
+struct x { };
+
+int main () {
+    auto map = hana::make_map(
+        <%= (1..input_size).map { |n| "hana::make_pair(hana::type<x<#{n}>>, std::rand())" }.join(', ') %>
+    );
+
+    hana::benchmark::measure([&] {
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            auto result = hana::erase_key(map, hana::type<x<1>>);
+            hana::benchmark::do_not_optimize(result);
+        }
+    });
+}
@@ -0,0 +1,27 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+<% if input_size > 10 %>
+    #define FUSION_MAX_MAP_SIZE <%= ((input_size + 9) / 10) * 10 %>
+    #define FUSION_MAX_VECTOR_SIZE <%= ((input_size + 9) / 10) * 10 %>
+<% end %>
+
+#include <boost/fusion/include/as_map.hpp>
+#include <boost/fusion/include/make_map.hpp>
+#include <boost/fusion/include/push_back.hpp>
+namespace fusion = boost::fusion;
+
+
+template <int>
+struct x { };
+
+int main() {
+    auto map = fusion::make_map<<%= (1..input_size).map { |n| "x<#{n}>" }.join(', ') %>>(
+        <%= (1..input_size).map { |n| n }.join(', ') %>
+    );
+    auto result = fusion::as_map(fusion::push_back(map, fusion::make_pair<x<0>>(0)));
+    (void)result;
+}
@@ -0,0 +1,32 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+<% if input_size > 10 %>
+    #define FUSION_MAX_MAP_SIZE <%= ((input_size + 9) / 10) * 10 %>
+    #define FUSION_MAX_VECTOR_SIZE <%= ((input_size + 9) / 10) * 10 %>
+<% end %>
+
+#include <boost/fusion/include/make_map.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+namespace fusion = boost::fusion;
+namespace hana = boost::hana;
+
+
+template <int>
+struct x { };
+
+int main () {
+    hana::benchmark::measure([] {
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            auto map = fusion::make_map<<%= (1..input_size).map { |n| "x<#{n}>" }.join(', ') %>>(
+                <%= input_size.times.map { 'std::rand()' }.join(', ') %>
+            );
+            hana::benchmark::do_not_optimize(map);
+        }
+    });
+}
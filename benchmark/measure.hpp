@@ -7,35 +7,250 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef BOOST_HANA_BENCHMARK_MEASURE_HPP
 #define BOOST_HANA_BENCHMARK_MEASURE_HPP
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
-#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined(__linux__) && !defined(BOOST_HANA_BENCHMARK_NO_COUNTERS)
+#   include <cstring>
+#   include <linux/perf_event.h>
+#   include <sys/ioctl.h>
+#   include <sys/syscall.h>
+#   include <unistd.h>
+#   define BOOST_HANA_BENCHMARK_HAS_COUNTERS
+#endif
 
 
 namespace boost { namespace hana { namespace benchmark {
-    template <int i>
-    struct object {
-        constexpr object() = default;
+    //! Forces the compiler to assume that `value` is read, so that the
+    //! computation of `value` can't be optimized away.
+    template <typename T>
+    inline void do_not_optimize(T const& value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static char const volatile* sink;
+        sink = reinterpret_cast<char const volatile*>(&value);
+#endif
+    }
+
+    //! Forces the compiler to assume that all memory may have been read and
+    //! written, so that stores can't be optimized away or moved around.
+    inline void clobber_memory() {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : : "memory");
+#endif
+    }
+
+    namespace measure_detail {
+        using clock = std::chrono::steady_clock;
+
+        // A sample must last at least this long for the resolution of the
+        // clock not to matter.
+        constexpr std::chrono::milliseconds min_sample_time{10};
+
+        template <typename F>
+        void call(F& f, std::true_type) { f(); }
+
+        template <typename F>
+        void call(F& f, std::false_type) { do_not_optimize(f()); }
+
+        template <typename F>
+        void call(F& f) {
+            call(f, std::is_void<decltype(f())>{});
+            clobber_memory();
+        }
+
+        template <typename F>
+        double run(F& f, std::size_t iterations) {
+            auto start = clock::now();
+            for (std::size_t i = 0; i != iterations; ++i)
+                call(f);
+            auto stop = clock::now();
+            return std::chrono::duration<double>(stop - start).count();
+        }
+
+        // The `p`th percentile of sorted samples, interpolating linearly
+        // between the closest samples.
+        inline double percentile(std::vector<double> const& sorted, double p) {
+            double const rank = p * static_cast<double>(sorted.size() - 1);
+            std::size_t const below = static_cast<std::size_t>(rank);
+            if (below + 1 >= sorted.size())
+                return sorted.back();
+            double const weight = rank - static_cast<double>(below);
+            return sorted[below] + weight * (sorted[below + 1] - sorted[below]);
+        }
 
-        object(object const&) {
-            std::this_thread::sleep_for(std::chrono::nanoseconds(1));
+#ifdef BOOST_HANA_BENCHMARK_HAS_COUNTERS
+        // Hardware counters read with `perf_event_open`. The counters which
+        // can't be opened, because the kernel or the permissions don't
+        // allow it, are simply not reported.
+        struct counters {
+            static constexpr std::size_t count = 3;
+            int fds[count];
+
+            static char const* name(std::size_t i) {
+                static char const* const names[count] = {
+                    "instructions", "cache_misses", "branch_misses"
+                };
+                return names[i];
+            }
+
+            counters() {
+                static std::uint64_t const configs[count] = {
+                    PERF_COUNT_HW_INSTRUCTIONS,
+                    PERF_COUNT_HW_CACHE_MISSES,
+                    PERF_COUNT_HW_BRANCH_MISSES
+                };
+                for (std::size_t i = 0; i != count; ++i) {
+                    perf_event_attr attr;
+                    std::memset(&attr, 0, sizeof(attr));
+                    attr.type = PERF_TYPE_HARDWARE;
+                    attr.size = sizeof(attr);
+                    attr.config = configs[i];
+                    attr.disabled = 1;
+                    attr.exclude_kernel = 1;
+                    attr.exclude_hv = 1;
+                    fds[i] = static_cast<int>(
+                        ::syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+                }
+            }
+
+            counters(counters const&) = delete;
+            counters& operator=(counters const&) = delete;
+
+            ~counters() {
+                for (int fd : fds)
+                    if (fd >= 0)
+                        ::close(fd);
+            }
+
+            void start() {
+                for (int fd : fds) {
+                    if (fd >= 0) {
+                        ::ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                        ::ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+                    }
+                }
+            }
+
+            void stop() {
+                for (int fd : fds)
+                    if (fd >= 0)
+                        ::ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+            }
+
+            bool read(std::size_t i, std::uint64_t& value) const {
+                return fds[i] >= 0 &&
+                    ::read(fds[i], &value, sizeof(value)) == sizeof(value);
+            }
+        };
+#endif
+    }
+
+    //! Measures the execution time of `f()` and writes statistics about it
+    //! to standard output.
+    //!
+    //! `f` is first called repeatedly for a short time to warm up the caches
+    //! and the branch predictors, which also tells how many calls make up a
+    //! sample lasting at least 10 milliseconds. Then, `samples` samples are
+    //! timed. If `f` returns a value, it is passed to `do_not_optimize`, and
+    //! `clobber_memory` is called after each call.
+    //!
+    //! Two lines are written. The first one is `[execution time: t]`, where
+    //! `t` is the median time of a call in seconds. The second one is
+    //! `[statistics: {...}]`, where `{...}` is a JSON object holding the
+    //! number of samples and of calls per sample, the median, mean, standard
+    //! deviation, minimum, maximum and 95th percentile of the time of a call
+    //! in seconds, and the number of outliers, which are the samples outside
+    //! of 1.5 times the interquartile range. On Linux, the instructions, cache
+    //! misses and branch misses per call are also included, when they can be
+    //! read with `perf_event_open`.
+    template <typename F>
+    void measure(F f, std::size_t samples = 30) {
+        using namespace measure_detail;
+        if (samples == 0)
+            samples = 1;
+
+        // Warm up, and calibrate the number of calls per sample.
+        std::size_t iterations = 1;
+        double const min_time =
+            std::chrono::duration<double>(min_sample_time).count();
+        double elapsed = 0;
+        double warmup = 0;
+        std::size_t calls = 0;
+        while (warmup < min_time) {
+            elapsed = run(f, iterations);
+            warmup += elapsed;
+            calls += iterations;
+            if (elapsed < min_time / 10)
+                iterations *= 10;
         }
-    };
+        double const per_call = warmup / static_cast<double>(calls);
+        iterations = per_call >= min_time ? 1 : static_cast<std::size_t>(
+            std::ceil(min_time / per_call));
 
-    auto measure = [](auto f) {
-        constexpr auto repetitions = 500ull;
-        auto start = std::chrono::steady_clock::now();
-        for (auto i = repetitions; i > 0; --i) {
-            f();
+#ifdef BOOST_HANA_BENCHMARK_HAS_COUNTERS
+        counters hardware;
+        hardware.start();
+#endif
+        std::vector<double> times(samples);
+        for (double& t : times)
+            t = run(f, iterations) / static_cast<double>(iterations);
+#ifdef BOOST_HANA_BENCHMARK_HAS_COUNTERS
+        hardware.stop();
+#endif
+
+        std::vector<double> sorted = times;
+        std::sort(sorted.begin(), sorted.end());
+        double const median = percentile(sorted, 0.5);
+        double const q1 = percentile(sorted, 0.25);
+        double const q3 = percentile(sorted, 0.75);
+        double mean = 0;
+        for (double t : times)
+            mean += t;
+        mean /= static_cast<double>(samples);
+        double variance = 0;
+        for (double t : times)
+            variance += (t - mean) * (t - mean);
+        if (samples > 1)
+            variance /= static_cast<double>(samples - 1);
+        std::size_t outliers = 0;
+        for (double t : times)
+            if (t < q1 - 1.5 * (q3 - q1) || t > q3 + 1.5 * (q3 - q1))
+                ++outliers;
+
+        std::cout.precision(9);
+        std::cout << "[execution time: " << median << "]" << std::endl;
+        std::cout << std::scientific;
+        std::cout << "[statistics: {"
+                  << "\"samples\": " << samples
+                  << ", \"iterations\": " << iterations
+                  << ", \"median\": " << median
+                  << ", \"mean\": " << mean
+                  << ", \"stddev\": " << std::sqrt(variance)
+                  << ", \"min\": " << sorted.front()
+                  << ", \"max\": " << sorted.back()
+                  << ", \"p95\": " << percentile(sorted, 0.95)
+                  << ", \"outliers\": " << outliers;
+#ifdef BOOST_HANA_BENCHMARK_HAS_COUNTERS
+        for (std::size_t i = 0; i != counters::count; ++i) {
+            std::uint64_t value;
+            if (hardware.read(i, value)) {
+                std::cout << ", \"" << counters::name(i) << "\": "
+                          << static_cast<double>(value) /
+                             static_cast<double>(samples * iterations);
+            }
         }
-        auto stop = std::chrono::steady_clock::now();
-
-        auto time = std::chrono::duration_cast<std::chrono::duration<float>>(
-            (stop - start) / repetitions
-        );
-        std::cout << std::fixed;
-        std::cout << "[execution time: " << time.count() << "]" << std::endl;
-    };
+#endif
+        std::cout << "}]" << std::endl;
+        std::cout.unsetf(std::ios_base::floatfield);
+    }
 }}}
 
 #endif
@@ -7,7 +7,12 @@
 #
 # When called as a program, this script runs the command line given in
 # arguments and returns the total time. This is similar to the `time`
-# command from Bash.
+# command from Bash. It also returns the peak memory usage of the command
+# and, when the BOOST_HANA_MEASURE_TRACE environment variable is set, the
+# number of template instantiations and the time spent in the frontend of
+# the compiler, as reported by Clang's `-ftime-trace` or GCC's
+# `-ftime-report`. When the BOOST_HANA_MEASURE_TOKENS environment variable
+# is set, it also returns the number of tokens of the preprocessed file.
 #
 # This file can also be required as a Ruby module to gain access to the
 # methods defined below.
@@ -16,6 +21,7 @@
 # This file must not be used as-is. It must be processed by CMake first.
 
 require 'benchmark'
+require 'json'
 require 'open3'
 require 'pathname'
 require 'ruby-progressbar'
@@ -50,6 +56,28 @@ def mpl_list(types)
   }
 end
 
+# pairs : A sequence of strings representing mpl::pairs to put in the mpl::map.
+# Using this method requires including
+#   - <boost/mpl/map.hpp>
+#   - <boost/mpl/insert.hpp>
+def mpl_map(pairs)
+  fast, rest = split_at(20, pairs)
+  rest.inject("boost::mpl::map#{fast.length}<#{fast.join(', ')}>") { |m, p|
+    "boost::mpl::insert<#{m}, #{p}>::type"
+  }
+end
+
+# types : A sequence of strings to put in the mpl::set.
+# Using this method requires including
+#   - <boost/mpl/set.hpp>
+#   - <boost/mpl/insert.hpp>
+def mpl_set(types)
+  fast, rest = split_at(20, types)
+  rest.inject("boost::mpl::set#{fast.length}<#{fast.join(', ')}>") { |s, t|
+    "boost::mpl::insert<#{s}, #{t}>::type"
+  }
+end
+
 # values : A sequence of strings representing values to put in the fusion::vector.
 # Using this method requires including
 #   - <boost/fusion/include/make_vector.hpp>
@@ -74,13 +102,282 @@ end
 
 # Turns a CMake-style boolean into a Ruby boolean.
 def cmake_bool(b)
-  return true if b.is_a? String and ["true", "yes", "1"].include?(b.downcase)
+  return true if b.is_a? String and ["true", "on", "yes", "y", "1"].include?(b.downcase)
   return true if b.is_a? Integer and b > 0
   return false # otherwise
 end
 
-# aspect must be one of :compilation_time, :bloat, :execution_time
-def measure(aspect, template_relative, range)
+def clang?
+  ["Clang", "AppleClang"].include?("@CMAKE_CXX_COMPILER_ID@")
+end
+
+def gcc?
+  "@CMAKE_CXX_COMPILER_ID@" == "GNU"
+end
+
+# Whether the compiler supports `-ftime-trace`, which appeared in Clang 9.
+def time_trace?
+  minimum = "@CMAKE_CXX_COMPILER_ID@" == "AppleClang" ? "11" : "9"
+  clang? && Gem::Version.new("@CMAKE_CXX_COMPILER_VERSION@") >= Gem::Version.new(minimum)
+end
+
+# Whether the :instantiations aspect can be measured with the compiler.
+# GCC does not report the number of template instantiations.
+def instantiations_available?
+  time_trace?
+end
+
+# Whether the :frontend_time aspect can be measured with the compiler.
+def frontend_time_available?
+  time_trace? || gcc?
+end
+
+# Whether the :tokens aspect can be measured with the compiler, which must
+# be able to preprocess a file with `-E`.
+def tokens_available?
+  clang? || gcc?
+end
+
+# Returns the public headers measured by the per-header benchmarks, relative
+# to the include directory. These are the umbrella header and the headers
+# at the top of `boost/hana/`, sorted by name.
+def hana_headers
+  include = File.expand_path("../include", "@CMAKE_CURRENT_SOURCE_DIR@")
+  headers = Dir[File.join(include, "boost/hana.hpp"), File.join(include, "boost/hana/*.hpp")]
+  headers.map { |h| Pathname.new(h).relative_path_from(Pathname.new(include)).to_s }.sort
+end
+
+# Returns the peak resident set size in kilobytes of the largest child
+# process that was waited for, including their own children, or nil if
+# `getrusage` can't be called.
+def children_peak_memory
+  require 'fiddle'
+  getrusage = Fiddle::Function.new(Fiddle::Handle::DEFAULT['getrusage'],
+                                   [Fiddle::TYPE_INT, Fiddle::TYPE_VOIDP],
+                                   Fiddle::TYPE_INT)
+  usage = Fiddle::Pointer.malloc(256, Fiddle::RUBY_FREE)
+  rusage_children = -1
+  return nil if getrusage.call(rusage_children, usage) != 0
+
+  # ru_maxrss follows ru_utime and ru_stime, which are two `struct timeval`s.
+  maxrss = usage[4 * Fiddle::SIZEOF_LONG, Fiddle::SIZEOF_LONG].unpack1('l!')
+  RUBY_PLATFORM =~ /darwin/ ? maxrss / 1024 : maxrss
+rescue LoadError, Fiddle::DLError
+  nil
+end
+
+# Returns the number of template instantiations and the frontend time in
+# seconds from the trace written by Clang's `-ftime-trace` for the given
+# compiler command line, and removes the trace.
+def read_time_trace(argv)
+  output = argv.each_cons(2).find { |flag, _| flag == "-o" }
+  return [nil, nil] if output.nil?
+  trace = output[1].sub(/\.[^.\/]*\z/, '') + ".json"
+  return [nil, nil] if not File.exist?(trace)
+
+  events = JSON.parse(File.read(trace))["traceEvents"] || []
+  File.delete(trace)
+  instantiations = events.count { |e|
+    ["InstantiateClass", "InstantiateFunction"].include?(e["name"])
+  }
+  frontend = events.find { |e| e["name"] == "Total Frontend" }
+  [instantiations, frontend && frontend["dur"] / 1e6]
+end
+
+# Splits the output of GCC on stderr into the report of `-ftime-report` and
+# the rest, and returns the frontend time in seconds from the report along
+# with the rest of the output.
+def read_time_report(stderr)
+  report, rest = stderr.lines.partition { |line|
+    line =~ /:\s+\d+\.\d+\s*\(/ || line =~ /^\s*(Time variable|Execution times|TOTAL)/
+  }
+  phases = ["phase setup", "phase parsing", "phase lang. deferred"]
+  frontend = report.map { |line|
+    name, times = line.split(":", 2)
+    next 0 if not phases.include?(name.strip)
+    # usr, sys and wall times, each followed by a percentage
+    times = times.scan(/(\d+\.\d+)\s*\(\s*\d+%\)/).flatten.map(&:to_f)
+    times.length >= 3 ? times[2] : times.last.to_f
+  }.sum
+  [report.empty? ? nil : frontend, rest.join]
+end
+
+# A preprocessing token, roughly: string and character literals, identifiers,
+# numbers, multi-character punctuators and any other non-blank character.
+TOKEN = %r{
+  "(?:\\.|[^"\\])*" | '(?:\\.|[^'\\])*' |
+  [A-Za-z_]\w* | \.?\d(?:[eEpP][+-]|[\w.'])* |
+  \.\.\. | :: | ->\*? | \.\* | <<= | >>= | << | >> | \+\+ | -- | && | \|\| |
+  [-+*/%&|^!=<>]= | \#\# | \S
+}x
+
+# Returns the number of tokens of the file compiled by the given compiler
+# command line, which is preprocessed with `-E` instead of being compiled,
+# or nil if it can't be preprocessed.
+def count_tokens(argv)
+  argv = argv.dup
+  output = argv.index("-o")
+  argv.slice!(output, 2) if output
+  code = capture(*argv.map { |arg| arg == "-c" ? "-E" : arg }, "-P")
+  code && code.scan(TOKEN).size
+end
+
+# Returns the path of the given binutils program, looking next to the `nm`
+# used by CMake so that the same toolchain is used.
+def binutil(program)
+  nm = "@CMAKE_NM@"
+  return program if nm.empty?
+  File.join(File.dirname(nm), File.basename(nm).sub(/nm(\.exe)?\z/, "#{program}\\1"))
+end
+
+# Runs the given command and returns its stdout, or nil if it failed.
+def capture(*command)
+  stdout, _, status = Open3.capture3(*command)
+  status.success? ? stdout : nil
+rescue SystemCallError
+  nil
+end
+
+# Returns the size in kilobytes of the text, data and debug sections of the
+# given executable, along with the size of all the other sections, or nil
+# if the sections can't be read.
+def section_sizes(executable)
+  output = capture(binutil("size"), "-A", "-d", executable)
+  return nil if output.nil?
+  sizes = { text: 0, data: 0, debug: 0, other: 0 }
+  output.lines.each do |line|
+    name, size = line.split
+    next if name.nil? || !name.start_with?(".") || size !~ /\A\d+\z/
+    kind = case name
+      when /\A\.z?debug/ then :debug
+      when /\A\.(text|init|fini|plt)/ then :text
+      when /\A\.(t?data|t?bss|rodata|got|init_array|fini_array|eh_frame|gcc_except_table)/ then :data
+      else :other
+    end
+    sizes[kind] += size.to_i
+  end
+  sizes.transform_values { |s| (s / 1000.0).round(3) }
+end
+
+# Returns the qualified name of the entity defined by a demangled symbol,
+# without its template arguments, function parameters and return type. For
+# example, `decltype(auto) boost::hana::_transform::operator()<...>(...) const`
+# gives `boost::hana::_transform::operator`.
+def qualified_name(symbol)
+  name = symbol.sub(/\A(?:(?:non-)?virtual thunk to |[\w ]+ for )/, '')
+  name = name.gsub(/\boperator\s*(?:\(\)|\[\]|[^\w\s(]+)/, 'operator')
+  nil while name.gsub!(/\{[^{}]*\}/, 'lambda')
+  nil while name.gsub!(/<[^<>]*>/, '')
+  nil while name.gsub!(/\([^()]*\)/, '')
+  qualifiers = ["const", "volatile", "&", "&&", "*", "decltype", "auto"]
+  name.split.reject { |token| qualifiers.include?(token) }.last || symbol
+end
+
+# Returns the name of the group a demangled symbol is attributed to when
+# breaking down the size of an executable. Symbols defined by Hana are
+# attributed to the algorithm or the data type that generated them, which
+# is the `xxx` of `xxx_impl` or of `_xxx` in their name. Helpers wrapping
+# the implementation of an algorithm, like `overload_linearly`, are
+# attributed to that algorithm. Other symbols are attributed to their
+# outermost namespace or class, like `std` or `main` for the lambdas
+# defined in `main`.
+def symbol_group(symbol)
+  parts = qualified_name(symbol).split("::")
+  if parts[0..1] == ["boost", "hana"]
+    impl = parts.find { |part| part.end_with?("_impl") }
+    return impl.chomp("_impl").sub(/\A_+/, '') if impl
+    namespaces = ["detail", "variadic", "constexpr_"]
+    group = parts[2..-1].find { |part|
+      !namespaces.include?(part) && !part.end_with?("_detail")
+    } || "detail"
+    group = group.sub(/\A_+(?=.)/, '')
+    wrappers = ["overload_linearly", "make_overload_linearly"]
+    wrapped = symbol.match(/boost::hana::(?:\w+::)*(\w+?)_impl</)
+    return wrapped[1].sub(/\A_+/, '') if wrappers.include?(group) && wrapped
+    group
+  elsif parts.size > 1
+    parts[0] == "boost" ? parts[0..1].join("::") : parts[0]
+  else
+    parts[0].nil? || parts[0] =~ /\A_|\./ ? "(runtime)" : parts[0]
+  end
+end
+
+# Returns the size in kilobytes of the symbols defined in the given
+# executable, grouped with `symbol_group`, or nil if the symbols can't be
+# read. Each group holds its total size and its largest instantiations,
+# and the groups are sorted by decreasing size. Only the largest groups
+# are kept, and the other ones are merged together. Aliases of a symbol,
+# like the complete and base object constructors, are counted once.
+def symbol_sizes(executable, max_groups = 30, max_instantiations = 20)
+  output = capture(binutil("nm"), "--defined-only", "--print-size", "--size-sort", "-C", executable)
+  return nil if output.nil?
+  groups = Hash.new { |h, name| h[name] = Hash.new(0) }
+  seen = {}
+  output.lines.each do |line|
+    address, size, _type, symbol = line.chomp.split(" ", 4)
+    next if symbol.nil? || seen[address]
+    seen[address] = true
+    groups[symbol_group(symbol)][symbol] += size.to_i(16)
+  end
+
+  kb = -> (bytes) { (bytes / 1000.0).round(3) }
+  sorted = groups.sort_by { |_, symbols| -symbols.values.sum }
+  largest, rest = split_at(max_groups, sorted)
+  largest << ["(#{rest.size} others)", rest.map(&:last).inject({}, :merge)] if not rest.empty?
+  largest.map { |name, symbols|
+    instantiations, others = split_at(max_instantiations, symbols.sort_by { |_, size| -size })
+    instantiations << ["(#{others.size} others)", others.map(&:last).sum] if not others.empty?
+    {
+      name: name,
+      size: kb[symbols.values.sum],
+      instantiations: instantiations.map { |symbol, size| [symbol, kb[size]] }
+    }
+  }
+end
+
+# Returns the breakdown of the size of the given executable by section and
+# by symbol, or nil if it can't be computed with the available binutils.
+def bloat_breakdown(executable)
+  sections, symbols = section_sizes(executable), symbol_sizes(executable)
+  return nil if sections.nil? || symbols.nil?
+  { sections: sections, symbols: symbols }
+end
+
+# The data of a series, which is rendered as JSON in the templates.
+class Series < Array
+  def to_s
+    to_json
+  end
+end
+
+# The samples of every point measured so far, indexed by the name of the
+# template and the input size.
+$benchmark_samples = {}
+
+def median(xs)
+  sorted = xs.sort
+  (sorted[(sorted.size - 1) / 2] + sorted[sorted.size / 2]) / 2.0
+end
+
+# Writes the samples measured so far to the given file, in JSON. This is
+# what `regress.rb` compares between two runs of the benchmarks.
+def save_samples(path)
+  File.write(path, JSON.generate($benchmark_samples))
+end
+
+# aspect must be one of :compilation_time, :bloat, :execution_time, :memory,
+# :instantiations, :frontend_time or :tokens
+#
+# The data of the series is returned as [n, value] points, except for the
+# :bloat aspect when the executable can be inspected with binutils. Then,
+# the points are objects holding the `bloat_breakdown` of the executable,
+# so that the charts can show what the bytes are made of.
+#
+# variant may be :pch or :header_unit to compile the file with the
+# precompiled umbrella header or with the umbrella header unit, when they
+# are available. Since the file is then compiled but not linked, it can't be
+# used with the :execution_time and :bloat aspects.
+def measure(aspect, template_relative, range, variant = nil)
   measure_file = Pathname.new("@CMAKE_CURRENT_SOURCE_DIR@/measure.cpp")
   template = Pathname.new(template_relative).expand_path
   range = range.to_a
@@ -89,56 +386,94 @@ def measure(aspect, template_relative, range)
     range = [range[0], range[-1]]
   end
 
+  # The number of template instantiations and the frontend time are only
+  # reported when the compiler is asked to trace itself, which is slower.
+  env = {}
+  env["BOOST_HANA_MEASURE_TRACE"] = "1" if [:instantiations, :frontend_time].include?(aspect)
+  env["BOOST_HANA_MEASURE_TOKENS"] = "1" if aspect == :tokens
   make = -> (target) {
     command = "@CMAKE_COMMAND@ --build @CMAKE_BINARY_DIR@ --target #{target}"
-    stdout, stderr, status = Open3.capture3(command)
+    stdout, stderr, status = Open3.capture3(env, command)
   }
 
+  # Each point can be measured several times, in which case the median of
+  # the samples is reported and all the samples are kept for `save_samples`.
+  samples = Integer(ENV["BOOST_HANA_BENCHMARK_SAMPLES"] || 1)
+
   progress = ProgressBar.create(format: '%p%% %t | %B |',
                                 title: template_relative,
-                                total: range.size,
+                                total: range.size * samples,
                                 output: STDERR)
-  range.map do |n|
-    # Evaluate the ERB template with the given environment, and save
-    # the result in the `measure.cpp` file.
-    code = Tilt::ERBTemplate.new(template).render(nil, input_size: n)
-    measure_file.write(code)
-
-    # Compile the file and get timing statistics. The timing statistics
-    # are output to stdout when we compile the file because of the way
-    # the `compile.benchmark.measure` CMake target is setup.
-    stdout, stderr, status = make["compile.benchmark.measure"]
-    raise "compilation error: #{stderr}\n\n#{code}" if not status.success?
-    ctime = stdout.match(/\[compilation time: (.+)\]/i)
-    # Size of the generated executable in KB
-    size = File.size("@CMAKE_CURRENT_BINARY_DIR@/compile.benchmark.measure").to_f / 1000
-
-    # If we didn't match anything, that's because we went too fast, CMake
-    # did not have the time to see the changes to the measure file and
-    # the target was not rebuilt. So we sleep for a bit and then retry
-    # this iteration.
-    (sleep 0.2; redo) if ctime.nil?
-    stat = ctime.captures[0].to_f if aspect == :compilation_time
-    stat = size if aspect == :bloat
-
-    # Run the resulting program and get timing statistics. The statistics
-    # should be written to stdout by the `measure` function of the
-    # `measure.hpp` header.
-    if aspect == :execution_time
-      stdout, stderr, status = make["run.benchmark.measure"]
-      raise "runtime error: #{stderr}\n\n#{code}" if not status.success?
-      match = stdout.match(/\[execution time: (.+)\]/i)
-      if match.nil?
-        raise ("Could not find [execution time: ...] bit in the output. " +
-               "Did you use the `measure` function in the `measure.hpp` header? " +
-               "stdout follows:\n#{stdout}")
+  target = ["compile.benchmark.measure", variant].compact.join(".")
+  executable = "@CMAKE_CURRENT_BINARY_DIR@/#{target}"
+  points = range.map do |n|
+    breakdown = nil
+    stats = (1..samples).map do
+      # Evaluate the ERB template with the given environment, and save
+      # the result in the `measure.cpp` file.
+      code = Tilt::ERBTemplate.new(template).render(nil, input_size: n)
+      measure_file.write(code)
+
+      # Compile the file and get timing statistics. The timing statistics
+      # are output to stdout when we compile the file because of the way
+      # the `compile.benchmark.measure` CMake targets are setup.
+      stdout, stderr, status = make[target]
+      raise "compilation error: #{stderr}\n\n#{code}" if not status.success?
+      ctime = stdout.match(/\[compilation time: (.+)\]/i)
+      # Size of the generated executable in KB. The variants are not linked,
+      # so there is no executable to measure for them.
+      size = File.size(executable).to_f / 1000 if variant.nil?
+
+      # If we didn't match anything, that's because we went too fast, CMake
+      # did not have the time to see the changes to the measure file and
+      # the target was not rebuilt. So we sleep for a bit and then retry
+      # this iteration.
+      (sleep 0.2; redo) if ctime.nil?
+      stat = ctime.captures[0].to_f if aspect == :compilation_time
+      stat = size if aspect == :bloat
+      breakdown = bloat_breakdown(executable) if aspect == :bloat
+
+      # Peak memory usage of the compiler in MB, number of template
+      # instantiations, time spent in the frontend of the compiler and
+      # number of tokens after preprocessing.
+      compiler_stat = {
+        memory: [/\[memory usage: (.+)\]/i, -> (kb) { kb.to_f / 1024 }],
+        instantiations: [/\[instantiations: (.+)\]/i, -> (n) { n.to_i }],
+        frontend_time: [/\[frontend time: (.+)\]/i, -> (t) { t.to_f }],
+        tokens: [/\[tokens: (.+)\]/i, -> (n) { n.to_i }]
+      }[aspect]
+      if compiler_stat
+        regex, convert = compiler_stat
+        match = stdout.match(regex)
+        raise "#{aspect} is not available with this compiler; stdout follows:\n#{stdout}" if match.nil?
+        stat = convert[match.captures[0]]
       end
-      stat = match.captures[0].to_f
+
+      # Run the resulting program and get timing statistics. The statistics
+      # should be written to stdout by the `measure` function of the
+      # `measure.hpp` header.
+      if aspect == :execution_time
+        stdout, stderr, status = make["run.benchmark.measure"]
+        raise "runtime error: #{stderr}\n\n#{code}" if not status.success?
+        match = stdout.match(/\[execution time: (.+)\]/i)
+        if match.nil?
+          raise ("Could not find [execution time: ...] bit in the output. " +
+                 "Did you use the `measure` function in the `measure.hpp` header? " +
+                 "stdout follows:\n#{stdout}")
+        end
+        stat = match.captures[0].to_f
+      end
+
+      progress.increment
+      stat
     end
 
-    progress.increment
-    [n, stat]
+    name = [template_relative, variant].compact.join(":")
+    ($benchmark_samples[name] ||= {})[n] = stats
+    next [n, median(stats)] if breakdown.nil?
+    { x: n, y: median(stats), breakdown: breakdown }
   end
+  Series.new(points)
 ensure
   measure_file.write("")
   progress.finish if progress
@@ -152,10 +487,42 @@ def time_compilation(erb_file, range)
   measure(:compilation_time, erb_file, range)
 end
 
+# Measures the given aspect for each header of `headers`, and returns a
+# series with one point named after each header. The template is rendered
+# with the index of the header in `hana_headers` as its input size. When
+# the benchmarks are only checked, only the first and the last headers are
+# measured.
+def measure_headers(aspect, template_relative, headers = hana_headers)
+  headers = [headers[0], headers[-1]].uniq if ENV["check.benchmarks"]
+  Series.new(headers.map { |header|
+    point = measure(aspect, template_relative, [hana_headers.index(header)]).first
+    { name: header, y: point.is_a?(Hash) ? point[:y] : point[1] }
+  })
+end
+
 if __FILE__ == $0
-  command = ARGV.join(' ')
-  time = Benchmark.realtime { `#{command}` }
+  trace = ENV["BOOST_HANA_MEASURE_TRACE"]
+  flags = []
+  flags = ["-ftime-trace", "-ftime-trace-granularity=0"] if trace && time_trace?
+  flags = ["-ftime-report"] if trace && gcc?
+  command = (ARGV + flags).join(' ')
+
+  stdout, stderr, status = nil
+  time = Benchmark.realtime { stdout, stderr, status = Open3.capture3(command) }
+  memory = children_peak_memory
+  instantiations, frontend = read_time_trace(ARGV) if trace && time_trace?
+  frontend, stderr = read_time_report(stderr) if trace && gcc?
+  STDOUT.write(stdout)
+  STDERR.write(stderr)
 
   puts "[command line: #{command}]"
   puts "[compilation time: #{time}]"
+  puts "[memory usage: #{memory}]" if memory
+  puts "[instantiations: #{instantiations}]" if instantiations
+  puts "[frontend time: #{frontend}]" if frontend
+  if ENV["BOOST_HANA_MEASURE_TOKENS"] && tokens_available?
+    tokens = count_tokens(ARGV)
+    puts "[tokens: #{tokens}]" if tokens
+  end
+  exit status.success?
 end
@@ -0,0 +1,41 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/parallel.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include "measure.hpp"
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+
+
+// Independent CPU-bound job; the elements alternate between integers and
+// floating points to make the tuple heterogeneous.
+struct job {
+    std::atomic<double>& result;
+
+    template <typename T>
+    void operator()(T seed) const {
+        double x = static_cast<double>(seed);
+        for (int i = 0; i < 20000; ++i)
+            x = std::sqrt(x + i);
+        double expected = result.load();
+        while (!result.compare_exchange_weak(expected, expected + x))
+            ;
+    }
+};
+
+int main () {
+    boost::hana::benchmark::measure([] {
+        std::atomic<double> result{0};
+        auto jobs = boost::hana::make_tuple(
+            <%= input_size.times.map { |i| i.even? ? 'std::rand()' : 'static_cast<double>(std::rand())' }.join(', ') %>
+        );
+
+        boost::hana::parallel_for_each(jobs, job{result});
+    });
+}
@@ -0,0 +1,33 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/binary.hpp>
+
+#include "measure.hpp"
+#include "patch/record.hpp"
+#include <cstddef>
+#include <vector>
+
+
+int main () {
+    auto snapshots = make_snapshots(<%= input_size %> * 1000);
+    std::vector<char> buffer(snapshots.size() * 1024);
+    Record replica{};
+    std::size_t total = 0;
+
+    boost::hana::benchmark::measure([&] {
+        char* out = buffer.data();
+        for (auto const& s : snapshots)
+            out = boost::hana::to_binary(s, out);
+
+        char const* in = buffer.data();
+        while (in != out)
+            in = boost::hana::from_binary(in, out, replica);
+        total += static_cast<std::size_t>(out - buffer.data());
+    });
+
+    return total == 0 && !snapshots.empty();
+}
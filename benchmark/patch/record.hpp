@@ -0,0 +1,101 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_BENCHMARK_PATCH_RECORD_HPP
+#define BOOST_HANA_BENCHMARK_PATCH_RECORD_HPP
+
+#include <boost/hana/struct.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+// A wide record, of which only a few members change between snapshots.
+struct Record {
+    BOOST_HANA_DEFINE_STRUCT(Record,
+        (double, f0),
+        (std::int64_t, f1),
+        (std::int32_t, f2),
+        (double, f3),
+        (std::int64_t, f4),
+        (std::int32_t, f5),
+        (double, f6),
+        (std::int64_t, f7),
+        (std::int32_t, f8),
+        (double, f9),
+        (std::int64_t, f10),
+        (std::int32_t, f11),
+        (double, f12),
+        (std::int64_t, f13),
+        (std::int32_t, f14),
+        (double, f15),
+        (std::int64_t, f16),
+        (std::int32_t, f17),
+        (double, f18),
+        (std::int64_t, f19),
+        (std::int32_t, f20),
+        (double, f21),
+        (std::int64_t, f22),
+        (std::int32_t, f23),
+        (double, f24),
+        (std::int64_t, f25),
+        (std::int32_t, f26),
+        (double, f27),
+        (std::int64_t, f28),
+        (std::int32_t, f29),
+        (double, f30),
+        (std::int64_t, f31),
+        (std::int32_t, f32),
+        (double, f33),
+        (std::int64_t, f34),
+        (std::int32_t, f35),
+        (double, f36),
+        (std::int64_t, f37),
+        (std::int32_t, f38),
+        (double, f39),
+        (std::int64_t, f40),
+        (std::int32_t, f41),
+        (double, f42),
+        (std::int64_t, f43),
+        (std::int32_t, f44),
+        (double, f45),
+        (std::int64_t, f46),
+        (std::int32_t, f47),
+        (double, f48),
+        (std::int64_t, f49),
+        (std::int32_t, f50),
+        (double, f51),
+        (std::int64_t, f52),
+        (std::int32_t, f53),
+        (double, f54),
+        (std::int64_t, f55),
+        (std::int32_t, f56),
+        (double, f57),
+        (std::int64_t, f58),
+        (std::string, f59)
+    );
+};
+
+// Makes `n` successive snapshots of a record, each of which changes two or
+// three members of the previous one.
+inline std::vector<Record> make_snapshots(std::size_t n) {
+    std::vector<Record> snapshots;
+    snapshots.reserve(n);
+    Record r{};
+    r.f59 = "instrument";
+    for (std::size_t i = 0; i != n; ++i) {
+        r.f0 = static_cast<double>(i);
+        r.f10 = static_cast<std::int64_t>(i * 3);
+        if (i % 4 == 0)
+            r.f32 = static_cast<std::int32_t>(i);
+        snapshots.push_back(r);
+    }
+    return snapshots;
+}
+
+#endif
@@ -0,0 +1,36 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/pipeline.hpp>
+
+#include "measure.hpp"
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <vector>
+
+
+// A CPU-bound stage; each stage does the same amount of work.
+template <int i>
+struct stage {
+    double operator()(double x) const {
+        for (int k = 0; k < 100; ++k)
+            x = std::sqrt(x + k + i);
+        return x;
+    }
+};
+
+int main () {
+    std::vector<double> input(<%= input_size %>), output(input.size());
+    for (double& x : input)
+        x = std::rand();
+
+    boost::hana::benchmark::measure([&] {
+        boost::hana::pipeline(stage<0>{}, stage<1>{}, stage<2>{})(
+            input.begin(), input.end(), output.begin()
+        );
+    });
+}
@@ -0,0 +1,224 @@
+#!/usr/bin/env ruby
+#
+# Copyright Louis Dionne 2015
+# Distributed under the Boost Software License, Version 1.0.
+# (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+#
+#
+# This script compares the results of two runs of the benchmarks, in order
+# to catch regressions before they are merged. It is used as follows:
+#
+#   regress.rb save <build-dir> <baseline-dir> [pattern]
+#     Copies the results of the benchmarks in <build-dir> (the `benchmark`
+#     subdirectory of the CMake build directory) to <baseline-dir>.
+#
+#   regress.rb compare <build-dir> <baseline-dir> [pattern]
+#     Compares the results of the benchmarks in <build-dir> against those
+#     saved in <baseline-dir>, prints a report and exits with a nonzero
+#     status if any benchmark regressed.
+#
+# Only the benchmarks whose name matches the optional shell pattern (like
+# `benchmark.map.*`) are considered. The results of a benchmark are the
+# `<name>.json` file generated for chart.html and the `<name>.samples.json`
+# file holding all the samples of each point, which are written when the
+# benchmark is generated. Several samples per point are measured when the
+# BOOST_HANA_BENCHMARK_SAMPLES environment variable is set.
+#
+# A point regressed when its median grew by more than the threshold of its
+# benchmark, and when the samples of both runs are different according to
+# a two-sided Mann-Whitney U test. When there are too few samples for the
+# test to ever be significant, or when the samples of both runs don't vary
+# at all (like executable sizes), only the threshold is used. The thresholds
+# and the significance level are read from `thresholds.json`, next to this
+# script, or from the file given in the BOOST_HANA_BENCHMARK_THRESHOLDS
+# environment variable.
+
+require 'fileutils'
+require 'json'
+
+
+# Returns the number of ways of choosing k elements amongst n.
+def choose(n, k)
+  (1..k).inject(1) { |c, i| c * (n - k + i) / i }
+end
+
+def median(xs)
+  sorted = xs.sort
+  (sorted[(sorted.size - 1) / 2] + sorted[sorted.size / 2]) / 2.0
+end
+
+# Returns the two-sided p-value of the Mann-Whitney U test for the samples
+# `xs` and `ys`. The exact distribution of U is used when there are no ties
+# and few samples, and the normal approximation otherwise.
+def mann_whitney(xs, ys)
+  n1, n2 = xs.size, ys.size
+  values = (xs.map { |x| [x, 0] } + ys.map { |y| [y, 1] }).sort_by(&:first)
+
+  # Assign the average rank to tied values.
+  ranks = Array.new(values.size)
+  ties = []
+  i = 0
+  while i < values.size
+    j = i
+    j += 1 while j + 1 < values.size && values[j + 1][0] == values[i][0]
+    (i..j).each { |k| ranks[k] = (i + j) / 2.0 + 1 }
+    ties << j - i + 1 if j > i
+    i = j + 1
+  end
+
+  r1 = (0...values.size).select { |k| values[k][1] == 0 }.map { |k| ranks[k] }.sum
+  u1 = r1 - n1 * (n1 + 1) / 2.0
+  u = [u1, n1 * n2 - u1].min
+
+  if ties.empty? && n1 + n2 <= 40
+    # counts[n][m][k] is the number of arrangements of n and m samples
+    # for which U = k.
+    counts = Hash.new { |h, (n, m)|
+      h[[n, m]] = if n == 0 || m == 0
+        [1]
+      else
+        a, b = h[[n - 1, m]], h[[n, m - 1]]
+        Array.new(n * m + 1) { |k| (k >= m ? a[k - m] || 0 : 0) + (b[k] || 0) }
+      end
+    }
+    tail = counts[[n1, n2]][0..u.floor].sum
+    [1.0, 2.0 * tail / choose(n1 + n2, n1)].min
+  else
+    n = n1 + n2
+    correction = ties.map { |t| t ** 3 - t }.sum / (n * (n - 1.0))
+    sigma = Math.sqrt(n1 * n2 / 12.0 * ((n + 1) - correction))
+    return 1.0 if sigma == 0
+    z = [(u1 - n1 * n2 / 2.0).abs - 0.5, 0].max / sigma
+    Math.erfc(z / Math.sqrt(2))
+  end
+end
+
+# Returns the smallest p-value that the test can produce for samples of the
+# given sizes.
+def smallest_p_value(n1, n2)
+  2.0 / choose(n1 + n2, n1)
+end
+
+class Thresholds
+  def initialize(file)
+    config = JSON.parse(File.read(file))
+    @alpha = config["alpha"] || 0.05
+    @default = config["default"] || 0.1
+    @aspects = config["aspects"] || {}
+    @benchmarks = config["benchmarks"] || {}
+  end
+
+  attr_reader :alpha
+
+  # The aspect of a benchmark is the last component of its name, like
+  # `compile` in `benchmark.at.compile`.
+  def self.aspect(benchmark)
+    benchmark.split(".").last
+  end
+
+  def compared?(benchmark)
+    @aspects.key?(Thresholds.aspect(benchmark))
+  end
+
+  # The threshold of a benchmark is given by the longest pattern matching
+  # its name in the "benchmarks" section, if any. It is either a relative
+  # threshold or an object mapping aspects to relative thresholds. The
+  # threshold of the aspect is used otherwise.
+  def for(benchmark)
+    aspect = Thresholds.aspect(benchmark)
+    pattern = @benchmarks.keys.select { |p| File.fnmatch(p, benchmark) }.max_by(&:length)
+    specific = pattern && @benchmarks[pattern]
+    specific = specific[aspect] if specific.is_a?(Hash)
+    specific || @aspects[aspect] || @default
+  end
+end
+
+def benchmarks_in(dir, pattern)
+  Dir.glob(File.join(dir, "*.samples.json")).map { |file|
+    File.basename(file, ".samples.json")
+  }.select { |name| File.fnmatch(pattern, name) }.sort
+end
+
+def save(build_dir, baseline_dir, pattern)
+  benchmarks = benchmarks_in(build_dir, pattern)
+  raise "No benchmark results were found in #{build_dir}" if benchmarks.empty?
+  FileUtils.mkdir_p(baseline_dir)
+  benchmarks.each do |name|
+    ["#{name}.json", "#{name}.samples.json"].each do |file|
+      source = File.join(build_dir, file)
+      FileUtils.cp(source, baseline_dir) if File.exist?(source)
+    end
+  end
+  puts "Saved #{benchmarks.size} benchmarks to #{baseline_dir}"
+  0
+end
+
+def format_change(before, after)
+  return "n/a" if before == 0
+  "%+.1f%%" % (100 * (after / before - 1))
+end
+
+def compare(build_dir, baseline_dir, pattern, thresholds)
+  regressions, improvements, unchanged, missing = [], [], 0, []
+
+  benchmarks_in(baseline_dir, pattern).each do |name|
+    next if not thresholds.compared?(name)
+    current_file = File.join(build_dir, "#{name}.samples.json")
+    if not File.exist?(current_file)
+      missing << name
+      next
+    end
+    baseline = JSON.parse(File.read(File.join(baseline_dir, "#{name}.samples.json")))
+    current = JSON.parse(File.read(current_file))
+    threshold = thresholds.for(name)
+
+    baseline.each do |series, points|
+      next if not current.key?(series)
+      points.each do |n, before_samples|
+        after_samples = current[series][n]
+        next if after_samples.nil? || before_samples.empty? || after_samples.empty?
+
+        before, after = median(before_samples), median(after_samples)
+        exact = before_samples.uniq.size == 1 && after_samples.uniq.size == 1
+        testable = smallest_p_value(before_samples.size, after_samples.size) <= thresholds.alpha
+        p = exact || !testable ? nil : mann_whitney(before_samples, after_samples)
+        significant = p.nil? || p < thresholds.alpha
+
+        line = "%-40s %-40s n=%-6s %12.6g -> %-12.6g (%s%s, threshold %g%%)" % [
+          name, series, n, before, after, format_change(before, after),
+          p ? ", p=%.3g" % p : "", 100 * threshold
+        ]
+        if significant && after > before * (1 + threshold)
+          regressions << line
+        elsif significant && after < before * (1 - threshold)
+          improvements << line
+        else
+          unchanged += 1
+        end
+      end
+    end
+  end
+
+  puts "Regressions:", regressions.map { |l| "  " + l } if not regressions.empty?
+  puts "Improvements:", improvements.map { |l| "  " + l } if not improvements.empty?
+  puts "Missing from the current run:", missing.map { |l| "  " + l } if not missing.empty?
+  puts "#{regressions.size} regressions, #{improvements.size} improvements, " +
+       "#{unchanged} unchanged points (compared against #{baseline_dir})"
+  regressions.empty? ? 0 : 1
+end
+
+if __FILE__ == $0
+  mode, build_dir, baseline_dir, pattern = ARGV
+  if !["save", "compare"].include?(mode) || build_dir.nil? || baseline_dir.nil?
+    STDERR.puts "usage: #{$0} (save|compare) <build-dir> <baseline-dir> [pattern]"
+    exit 2
+  end
+  pattern ||= "*"
+
+  if mode == "save"
+    exit save(build_dir, baseline_dir, pattern)
+  else
+    file = ENV["BOOST_HANA_BENCHMARK_THRESHOLDS"] || File.join(__dir__, "thresholds.json")
+    exit compare(build_dir, baseline_dir, pattern, Thresholds.new(file))
+  end
+end
@@ -0,0 +1,26 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+<% if input_size > 10 %>
+    #define FUSION_MAX_SET_SIZE <%= ((input_size + 9) / 10) * 10 %>
+<% end %>
+
+#include <boost/fusion/include/has_key.hpp>
+#include <boost/fusion/include/set.hpp>
+namespace fusion = boost::fusion;
+
+
+template <int>
+struct x { };
+
+using set = fusion::set<<%= (1..input_size).map { |n| "x<#{n}>" }.join(', ') %>>;
+
+<% (1..input_size).each { |n| %>
+    static_assert(fusion::result_of::has_key<set, x<<%= n %>>>::type::value, "");
+<% } %>
+
+
+int main() { }
@@ -0,0 +1,25 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/searchable.hpp>
+#include <boost/hana/set.hpp>
+#include <boost/hana/type.hpp>
+namespace hana = boost::hana;
+
+
+template <int>
+struct x { };
+
+int main() {
+    constexpr auto set = hana::make_set(
+        <%= (1..input_size).map { |n| "hana::type<x<#{n}>>" }.join(', ') %>
+    );
+
+    <% (1..input_size).each { |n| %>
+        static_assert(decltype(hana::contains(set, hana::type<x<<%= n %>>>))::value, "");
+    <% } %>
+    (void)set;
+}
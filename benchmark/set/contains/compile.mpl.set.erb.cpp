@@ -0,0 +1,23 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/mpl/has_key.hpp>
+#include <boost/mpl/insert.hpp>
+#include <boost/mpl/set.hpp>
+namespace mpl = boost::mpl;
+
+
+template <int>
+struct x;
+
+using set = <%= mpl_set((1..input_size).map { |n| "x<#{n}>" }) %>;
+
+<% (1..input_size).each { |n| %>
+    static_assert(mpl::has_key<set, x<<%= n %>>>::type::value, "");
+<% } %>
+
+
+int main() { }
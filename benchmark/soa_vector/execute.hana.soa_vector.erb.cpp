@@ -0,0 +1,28 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/soa_vector.hpp>
+#include <boost/hana/string.hpp>
+
+#include "measure.hpp"
+#include "soa_vector/record.hpp"
+#include <cstddef>
+#include <cstdint>
+
+
+int main () {
+    boost::hana::soa_vector<Record> records;
+    for (std::size_t i = 0; i != <%= input_size %> * 1000; ++i)
+        records.push_back(make_record(i));
+    std::int64_t total = 0;
+
+    boost::hana::benchmark::measure([&] {
+        for (std::int32_t x : records.column(BOOST_HANA_STRING("f1")))
+            total += x;
+    });
+
+    return total == 0;
+}
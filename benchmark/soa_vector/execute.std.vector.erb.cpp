@@ -0,0 +1,26 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include "measure.hpp"
+#include "soa_vector/record.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+int main () {
+    std::vector<Record> records;
+    for (std::size_t i = 0; i != <%= input_size %> * 1000; ++i)
+        records.push_back(make_record(i));
+    std::int64_t total = 0;
+
+    boost::hana::benchmark::measure([&] {
+        for (Record const& record : records)
+            total += record.f1;
+    });
+
+    return total == 0;
+}
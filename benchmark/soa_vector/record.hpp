@@ -0,0 +1,69 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_BENCHMARK_SOA_VECTOR_RECORD_HPP
+#define BOOST_HANA_BENCHMARK_SOA_VECTOR_RECORD_HPP
+
+#include <boost/hana/struct.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+
+// A wide record, of which only one member is scanned.
+struct Record {
+    BOOST_HANA_DEFINE_STRUCT(Record,
+        (double, f0),
+        (std::int32_t, f1),
+        (double, f2),
+        (std::int32_t, f3),
+        (double, f4),
+        (std::int32_t, f5),
+        (double, f6),
+        (std::int32_t, f7),
+        (double, f8),
+        (std::int32_t, f9),
+        (double, f10),
+        (std::int32_t, f11),
+        (double, f12),
+        (std::int32_t, f13),
+        (double, f14),
+        (std::int32_t, f15),
+        (double, f16),
+        (std::int32_t, f17),
+        (double, f18),
+        (std::int32_t, f19),
+        (double, f20),
+        (std::int32_t, f21),
+        (double, f22),
+        (std::int32_t, f23),
+        (double, f24),
+        (std::int32_t, f25),
+        (double, f26),
+        (std::int32_t, f27),
+        (double, f28),
+        (std::int32_t, f29),
+        (double, f30),
+        (std::int32_t, f31),
+        (double, f32),
+        (std::int32_t, f33),
+        (double, f34),
+        (std::int32_t, f35),
+        (double, f36),
+        (std::int32_t, f37),
+        (double, f38),
+        (std::int32_t, f39)
+    );
+};
+
+inline Record make_record(std::size_t i) {
+    Record r{};
+    r.f0 = static_cast<double>(i);
+    r.f1 = static_cast<std::int32_t>(i % 100);
+    return r;
+}
+
+#endif
@@ -0,0 +1,19 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/searchable.hpp>
+#include <boost/hana/string.hpp>
+namespace hana = boost::hana;
+
+
+// The strings are made of `input_size` characters, of which only the last
+// one is a '!'.
+int main() {
+    constexpr auto string = hana::string<<%= ((1...input_size).map { |n| "'#{('a'.ord + n % 26).chr}'" } + ["'!'"]).join(', ') %>>;
+    constexpr auto result = hana::find(string, hana::char_<'!'>);
+    (void)result;
+}
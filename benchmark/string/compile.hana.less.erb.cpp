@@ -0,0 +1,20 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/orderable.hpp>
+#include <boost/hana/string.hpp>
+namespace hana = boost::hana;
+
+
+// The strings are made of `input_size` characters, and they only differ by
+// their last character.
+int main() {
+    constexpr auto string1 = hana::string<<%= ((1...input_size).map { |n| "'#{('a'.ord + n % 26).chr}'" } + ["'!'"]).join(', ') %>>;
+    constexpr auto string2 = hana::string<<%= ((1...input_size).map { |n| "'#{('a'.ord + n % 26).chr}'" } + ["'?'"]).join(', ') %>>;
+    static_assert(decltype(hana::less(string1, string2))::value, "");
+    (void)string1;
+    (void)string2;
+}
@@ -0,0 +1,20 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+
+
+struct Record {
+    <%= (1..input_size).map { |n| "int member#{n};" }.join(' ') %>
+};
+
+int main() {
+    Record record{};
+    int result = 0;
+    <% (1..input_size).each { |n| %>
+        result += record.member<%= n %>;
+    <% } %>
+    (void)result;
+}
@@ -0,0 +1,24 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/string.hpp>
+#include <boost/hana/struct.hpp>
+
+
+struct Record {
+    BOOST_HANA_DEFINE_STRUCT(Record,
+        <%= (1..input_size).map { |n| "(int, member#{n})" }.join(', ') %>
+    );
+};
+
+int main() {
+    Record record{};
+    int result = 0;
+    <% (1..input_size).each { |n| %>
+        result += boost::hana::at_key(record, BOOST_HANA_STRING("member<%= n %>"));
+    <% } %>
+    (void)result;
+}
@@ -0,0 +1,21 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/struct.hpp>
+
+
+struct Record {
+    <%= (1..input_size).map { |n| "int member#{n};" }.join(' ') %>
+};
+
+BOOST_HANA_ADAPT_STRUCT(Record,
+    <%= (1..input_size).map { |n| "(int, member#{n})" }.join(', ') %>
+);
+
+int main() {
+    auto accessors = boost::hana::accessors<Record>();
+    (void)accessors;
+}
@@ -0,0 +1,30 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/struct.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+
+
+struct Record {
+    BOOST_HANA_DEFINE_STRUCT(Record,
+        <%= (1..input_size).map { |n| "(int, member#{n})" }.join(', ') %>
+    );
+};
+
+int main () {
+    Record record{};
+    <% (1..input_size).each { |n| %>
+        record.member<%= n %> = std::rand();
+    <% } %>
+
+    boost::hana::benchmark::measure([&] {
+        auto members = boost::hana::members(record);
+        boost::hana::benchmark::do_not_optimize(members);
+        boost::hana::benchmark::clobber_memory();
+    });
+}
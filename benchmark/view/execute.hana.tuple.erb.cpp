@@ -0,0 +1,37 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/bool.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+#include <string>
+
+
+int main () {
+    auto values = boost::hana::make_tuple(
+        <%= input_size.times.map { 'std::to_string(std::rand())' }.join(', ') %>
+    );
+
+    boost::hana::benchmark::measure([&] {
+        std::size_t result = 0;
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            auto chain = boost::hana::reverse(
+                boost::hana::filter(
+                    boost::hana::transform(values, [](std::string const& s) {
+                        return s;
+                    }),
+                    [](auto const&) { return boost::hana::true_; }
+                )
+            );
+
+            boost::hana::for_each(chain, [&](std::string const& s) {
+                result += s.size();
+            });
+        }
+    });
+}
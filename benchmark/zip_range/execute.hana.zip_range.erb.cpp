@@ -0,0 +1,32 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/zip_range.hpp>
+
+#include "measure.hpp"
+#include <cstddef>
+#include <vector>
+
+
+int main () {
+    std::size_t rows = <%= input_size %> * 1000;
+    auto columns = boost::hana::make_tuple(
+        std::vector<float>(rows, 1.0f),
+        std::vector<double>(rows, 1.0),
+        std::vector<int>(rows, 1)
+    );
+
+    boost::hana::benchmark::measure([&] {
+        for (int iteration = 0; iteration < 1 << 6; ++iteration) {
+            for (auto row : boost::hana::zip_range(columns)) {
+                boost::hana::at_c<0>(row) *= 2;
+                boost::hana::at_c<1>(row) *= 2;
+                boost::hana::at_c<2>(row) *= 2;
+            }
+        }
+    });
+}
@@ -0,0 +1,81 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/binary.hpp>
+#include <boost/hana/struct.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <vector>
+using namespace boost::hana;
+
+
+int main() {
+
+{
+
+//! [to_binary]
+struct Point {
+    BOOST_HANA_DEFINE_STRUCT(Point,
+        (std::int32_t, x),
+        (std::int32_t, y)
+    );
+};
+
+struct Polygon {
+    BOOST_HANA_DEFINE_STRUCT(Polygon,
+        (std::string, name),
+        (std::vector<Point>, points)
+    );
+};
+
+Polygon triangle{"triangle", {{0, 0}, {2, 0}, {0, 1}}};
+
+// The name is written with its length (1 byte) and its characters, and the
+// points with their number (1 byte) and the bytes of all of their members.
+BOOST_HANA_RUNTIME_CHECK(binary_size(triangle) == 1 + 8 + 1 + 3 * 8);
+
+std::vector<char> out;
+to_binary(triangle, std::back_inserter(out));
+BOOST_HANA_RUNTIME_CHECK(out.size() == binary_size(triangle));
+
+// Any output iterator can be used, including a plain buffer.
+char buffer[16];
+char* end = to_binary(make_tuple(std::int16_t{1}, std::string{"ab"}), buffer);
+BOOST_HANA_RUNTIME_CHECK(end == buffer + 2 + 1 + 2);
+//! [to_binary]
+
+}{
+
+//! [from_binary]
+struct Reading {
+    BOOST_HANA_DEFINE_STRUCT(Reading,
+        (std::string, sensor),
+        (double, value),
+        (std::int64_t, timestamp)
+    );
+};
+
+Reading const reading{"thermometer", 21.5, 1431554400};
+std::vector<char> bytes;
+to_binary(reading, std::back_inserter(bytes));
+
+Reading copy;
+char const* last = bytes.data() + bytes.size();
+BOOST_HANA_RUNTIME_CHECK(from_binary(bytes.data(), last, copy) == last);
+BOOST_HANA_RUNTIME_CHECK(copy.sensor == "thermometer");
+BOOST_HANA_RUNTIME_CHECK(copy.value == 21.5 && copy.timestamp == 1431554400);
+
+// A null pointer is returned when the input is truncated.
+BOOST_HANA_RUNTIME_CHECK(from_binary(bytes.data(), last - 1, copy) == nullptr);
+//! [from_binary]
+
+}
+
+}
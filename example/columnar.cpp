@@ -0,0 +1,62 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/columnar.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/struct.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <vector>
+using namespace boost::hana;
+
+
+//! [columnar]
+struct Reading {
+    BOOST_HANA_DEFINE_STRUCT(Reading,
+        (std::int64_t, timestamp),
+        (std::int32_t, sensor),
+        (double, value)
+    );
+};
+
+int main() {
+    std::vector<Reading> readings{
+        {1431554400, 1, 21.5}, {1431554400, 2, 19.0}, {1431554460, 1, 21.75}
+    };
+    {
+        std::ofstream out{"readings.columnar", std::ios::binary};
+        write_columnar(out, readings);
+    }
+
+    // Opening the file maps it in memory and checks its header.
+    columnar_file<Reading> file;
+    BOOST_HANA_RUNTIME_CHECK(file.open("readings.columnar") == columnar_status::ok);
+    BOOST_HANA_RUNTIME_CHECK(file.size() == 3);
+
+    // The columns point directly into the mapped file.
+    double total = 0;
+    for (double value : file.column(BOOST_HANA_STRING("value")))
+        total += value;
+    BOOST_HANA_RUNTIME_CHECK(total == 62.25);
+
+    // A file written for another layout is rejected when it is opened.
+    struct Other {
+        BOOST_HANA_DEFINE_STRUCT(Other,
+            (std::int64_t, timestamp),
+            (std::int64_t, sensor),
+            (double, value)
+        );
+    };
+    columnar_file<Other> other;
+    BOOST_HANA_RUNTIME_CHECK(other.open("readings.columnar") == columnar_status::layout_mismatch);
+
+    file.close();
+    std::remove("readings.columnar");
+}
+//! [columnar]
@@ -0,0 +1,80 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/csv.hpp>
+#include <boost/hana/struct.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+using namespace boost::hana;
+
+
+//! [read_csv]
+struct Quote {
+    BOOST_HANA_DEFINE_STRUCT(Quote,
+        (std::string, symbol),
+        (double, price),
+        (long, volume)
+    );
+};
+
+void read() {
+    {
+        std::ofstream out{"quotes.tsv"};
+        out << "symbol\tvolume\tprice\n"
+            << "AAPL\t1200\t126.5\n"
+            << "MSFT\t800\t47.25\n";
+    }
+
+    // The file is mapped in memory and split into one chunk per thread.
+    std::vector<Quote> quotes;
+    BOOST_HANA_RUNTIME_CHECK(read_csv("quotes.tsv", quotes, csv_options{'\t', 0}));
+    BOOST_HANA_RUNTIME_CHECK(quotes.size() == 2);
+    BOOST_HANA_RUNTIME_CHECK(quotes[1].symbol == "MSFT" && quotes[1].volume == 800);
+    std::remove("quotes.tsv");
+}
+//! [read_csv]
+
+int main() {
+
+{
+
+//! [from_csv]
+struct Person {
+    BOOST_HANA_DEFINE_STRUCT(Person,
+        (std::string, name),
+        (int, age)
+    );
+};
+
+// Columns are matched with members by name, and unknown columns are ignored.
+std::string const csv =
+    "age,city,name\n"
+    "30,Montreal,John\n"
+    "25,\"Paris, France\",\"Jane \"\"JD\"\" Doe\"\n";
+
+std::vector<Person> people;
+char const* last = csv.data() + csv.size();
+BOOST_HANA_RUNTIME_CHECK(from_csv(csv.data(), last, people) == last);
+BOOST_HANA_RUNTIME_CHECK(people.size() == 2);
+BOOST_HANA_RUNTIME_CHECK(people[0].name == "John" && people[0].age == 30);
+BOOST_HANA_RUNTIME_CHECK(people[1].name == "Jane \"JD\" Doe");
+
+// Invalid data is reported with a null pointer.
+std::string const invalid = "name,age\nJohn,thirty\n";
+BOOST_HANA_RUNTIME_CHECK(
+    from_csv(invalid.data(), invalid.data() + invalid.size(), people) == nullptr
+);
+//! [from_csv]
+
+}
+
+read();
+
+}
@@ -8,6 +8,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/config.hpp>
 #include <boost/hana/ext/std/integral_constant.hpp>
 #include <boost/hana/functional/always.hpp>
+#include <boost/hana/functional/placeholder.hpp>
 #include <boost/hana/integral_constant.hpp>
 #include <boost/hana/optional.hpp>
 #include <boost/hana/range.hpp>
@@ -91,6 +92,41 @@ BOOST_HANA_RUNTIME_CHECK(
 
 }{
 
+//! [fold_balanced]
+auto to_string = [](auto x) {
+    std::ostringstream ss;
+    ss << x;
+    return ss.str();
+};
+
+auto f = [=](auto x, auto y) {
+    return "f(" + to_string(x) + ", " + to_string(y) + ")";
+};
+
+// with an initial state
+BOOST_HANA_RUNTIME_CHECK(
+    fold_balanced(make_tuple(2, '3', 4), 1, f)
+        ==
+    "f(f(1, 2), f(3, 4))"
+);
+
+// without initial state
+BOOST_HANA_RUNTIME_CHECK(
+    fold_balanced(make_tuple(1, '2', 3, 4.0, 5), f)
+        ==
+    "f(f(1, 2), f(3, f(4, 5)))"
+);
+
+// with an associative operation, the result is the same as fold_left
+BOOST_HANA_CONSTANT_CHECK(
+    fold_balanced(tuple_c<int, 1, 2, 3, 4, 5, 6, 7, 8>, plus)
+        ==
+    fold_left(tuple_c<int, 1, 2, 3, 4, 5, 6, 7, 8>, plus)
+);
+//! [fold_balanced]
+
+}{
+
 //! [fold]
 auto to_string = [](auto x) {
     std::ostringstream ss;
@@ -0,0 +1,71 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/hash.hpp>
+#include <boost/hana/struct.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+using namespace boost::hana;
+
+
+//! [std_hash]
+namespace shop {
+    struct Item {
+        BOOST_HANA_DEFINE_STRUCT(Item,
+            (std::string, name),
+            (int, size)
+        );
+    };
+}
+
+BOOST_HANA_SPECIALIZE_STD_HASH(shop::Item)
+
+void std_hash() {
+    std::unordered_map<shop::Item, int> stock;
+    stock[shop::Item{"shirt", 40}] += 3;
+    stock[shop::Item{"shirt", 42}] += 1;
+    stock[shop::Item{"shirt", 40}] += 2;
+    BOOST_HANA_RUNTIME_CHECK(stock.size() == 2);
+    BOOST_HANA_RUNTIME_CHECK((stock.at(shop::Item{"shirt", 40}) == 5));
+
+    // Tuples and pairs can be used as keys directly.
+    std::unordered_set<_tuple<int, std::string>> seen{
+        make_tuple(1, std::string{"a"}), make_tuple(1, std::string{"a"})
+    };
+    BOOST_HANA_RUNTIME_CHECK(seen.size() == 1);
+}
+//! [std_hash]
+
+int main() {
+
+{
+
+//! [hash]
+struct Point {
+    BOOST_HANA_DEFINE_STRUCT(Point,
+        (int, x),
+        (int, y)
+    );
+};
+
+// Equal objects have equal hash values.
+BOOST_HANA_RUNTIME_CHECK(hash(Point{1, 2}) == hash(Point{1, 2}));
+BOOST_HANA_RUNTIME_CHECK(hash(make_tuple(1, 'x', std::string{"abc"})) ==
+                         hash(make_tuple(1, 'x', std::string{"abc"})));
+
+// Different objects have different hash values, most of the time.
+BOOST_HANA_RUNTIME_CHECK(hash(Point{1, 2}) != hash(Point{2, 1}));
+//! [hash]
+
+}
+
+std_hash();
+
+}
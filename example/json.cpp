@@ -0,0 +1,95 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/json.hpp>
+#include <boost/hana/struct.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <iterator>
+#include <string>
+#include <vector>
+using namespace boost::hana;
+
+
+int main() {
+
+{
+
+//! [to_json]
+struct Car {
+    BOOST_HANA_DEFINE_STRUCT(Car,
+        (std::string, brand),
+        (std::string, model)
+    );
+};
+
+struct Person {
+    BOOST_HANA_DEFINE_STRUCT(Person,
+        (std::string, name),
+        (int, age),
+        (std::vector<Car>, cars)
+    );
+};
+
+Person john{"John \"Johnny\" Doe", 30, {{"Audi", "A4"}, {"BMW", "Z3"}}};
+
+std::string out;
+to_json(john, std::back_inserter(out));
+BOOST_HANA_RUNTIME_CHECK(out ==
+    R"({"name":"John \"Johnny\" Doe","age":30,)"
+    R"("cars":[{"brand":"Audi","model":"A4"},{"brand":"BMW","model":"Z3"}]})"
+);
+
+// Any output iterator can be used, including a plain buffer.
+char buffer[32];
+char* end = to_json(make_tuple(1, 2.5, "three", true, nullptr), buffer);
+BOOST_HANA_RUNTIME_CHECK(std::string(buffer, end) == R"([1,2.5,"three",true,null])");
+//! [to_json]
+
+}{
+
+//! [from_json]
+struct Point {
+    BOOST_HANA_DEFINE_STRUCT(Point,
+        (double, x),
+        (double, y)
+    );
+};
+
+struct Polygon {
+    BOOST_HANA_DEFINE_STRUCT(Polygon,
+        (std::string, name),
+        (std::vector<Point>, points)
+    );
+};
+
+std::string const input = R"({
+    "points": [{"x": 0, "y": 0}, {"y": 1.5, "x": 2}, {"x": -1e2, "y": 0.25}],
+    "color": "red",
+    "name": "triangle"
+})";
+char const* const last = input.data() + input.size();
+
+Polygon triangle;
+char const* end = from_json(input.data(), last, triangle);
+BOOST_HANA_RUNTIME_CHECK(end == last);
+
+BOOST_HANA_RUNTIME_CHECK(triangle.name == "triangle");
+BOOST_HANA_RUNTIME_CHECK(triangle.points.size() == 3);
+BOOST_HANA_RUNTIME_CHECK(triangle.points[1].x == 2 && triangle.points[1].y == 1.5);
+BOOST_HANA_RUNTIME_CHECK(triangle.points[2].x == -100 && triangle.points[2].y == 0.25);
+
+// A null pointer is returned when the input is invalid.
+std::string const invalid = R"({"name": "triangle", "points": 3})";
+BOOST_HANA_RUNTIME_CHECK(
+    from_json(invalid.data(), invalid.data() + invalid.size(), triangle) == nullptr
+);
+//! [from_json]
+
+}
+
+}
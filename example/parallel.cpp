@@ -0,0 +1,55 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/parallel.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <atomic>
+#include <string>
+#include <vector>
+using namespace boost::hana;
+
+
+int main() {
+
+{
+
+//! [parallel_for_each]
+std::atomic<std::size_t> loaded{0};
+auto load = [&](auto const& shard) {
+    // pretend we're loading the shard from disk
+    loaded += shard.size();
+};
+
+auto shards = make_tuple(
+    std::vector<int>(10), std::string(20, 'x'), std::vector<double>(30)
+);
+
+// the shards are loaded concurrently
+parallel_for_each(shards, load);
+BOOST_HANA_RUNTIME_CHECK(loaded == 60);
+
+// each thread loads two consecutive shards at once
+parallel_for_each(shards, load, 2);
+BOOST_HANA_RUNTIME_CHECK(loaded == 120);
+//! [parallel_for_each]
+
+}{
+
+//! [parallel_transform]
+auto square = [](auto x) { return x * x; };
+
+BOOST_HANA_RUNTIME_CHECK(
+    parallel_transform(make_tuple(1, 2.5, 3u), square)
+        ==
+    make_tuple(1, 6.25, 9u)
+);
+//! [parallel_transform]
+
+}
+
+}
@@ -0,0 +1,48 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/patch.hpp>
+#include <boost/hana/struct.hpp>
+
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <vector>
+using namespace boost::hana;
+
+
+int main() {
+
+//! [diff]
+struct Account {
+    BOOST_HANA_DEFINE_STRUCT(Account,
+        (std::string, owner),
+        (std::int32_t, id),
+        (std::int64_t, balance),
+        (std::int32_t, transactions)
+    );
+};
+
+Account before{"Alice", 1, 100, 3};
+Account after = before;
+after.balance = 250;
+after.transactions = 4;
+
+// The patch holds a bitmask of the changed members (1 byte), followed by
+// the bytes of the changed members of `after`.
+std::vector<char> patch;
+diff(before, after, std::back_inserter(patch));
+BOOST_HANA_RUNTIME_CHECK(patch.size() == 1 + 8 + 4);
+BOOST_HANA_RUNTIME_CHECK(patch[0] == 0b1100);
+
+Account replica = before;
+char const* end = apply_patch(patch.data(), patch.data() + patch.size(), replica);
+BOOST_HANA_RUNTIME_CHECK(end == patch.data() + patch.size());
+BOOST_HANA_RUNTIME_CHECK(replica.balance == 250 && replica.transactions == 4);
+//! [diff]
+
+}
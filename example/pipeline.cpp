@@ -0,0 +1,52 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/pipeline.hpp>
+
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+using namespace boost::hana;
+
+
+int main() {
+
+//! [pipeline]
+auto parse = [](std::string const& line) {
+    return std::stoi(line);
+};
+
+auto square = [](int x) {
+    return static_cast<long long>(x) * x;
+};
+
+auto format = [](long long x) {
+    std::ostringstream ss;
+    ss << '[' << x << ']';
+    return ss.str();
+};
+
+std::vector<std::string> lines = {"1", "2", "3", "4"};
+std::vector<std::string> results;
+
+// each stage runs on its own thread; the queue between parse and square
+// holds ints, and the one between square and format holds long longs
+auto p = pipeline(parse, square, format);
+p(lines.begin(), lines.end(), std::back_inserter(results));
+
+BOOST_HANA_RUNTIME_CHECK(
+    results == std::vector<std::string>{"[1]", "[4]", "[9]", "[16]"}
+);
+
+// use smaller queues, and publish elements to the next stage in batches of 8
+results.clear();
+p.with_buffer(64, 8)(lines.begin(), lines.end(), std::back_inserter(results));
+BOOST_HANA_RUNTIME_CHECK(results.size() == 4);
+//! [pipeline]
+
+}
@@ -0,0 +1,56 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/soa_vector.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/struct.hpp>
+
+#include <string>
+using namespace boost::hana;
+
+
+//! [soa_vector]
+namespace shop {
+    struct Order {
+        int id;
+        std::string customer;
+        double amount;
+    };
+}
+
+BOOST_HANA_ADAPT_STRUCT(shop::Order,
+    (int, id),
+    (std::string, customer),
+    (double, amount)
+);
+
+int main() {
+    soa_vector<shop::Order> orders;
+    orders.push_back(shop::Order{1, "John", 12.5});
+    orders.push_back(shop::Order{2, "Jane", 30.0});
+    orders.push_back(shop::Order{3, "John", 7.5});
+
+    // Scanning a column only touches the memory of that column.
+    double total = 0;
+    for (double amount : orders.column(BOOST_HANA_STRING("amount")))
+        total += amount;
+    BOOST_HANA_RUNTIME_CHECK(total == 50.0);
+
+    // Elements are accessed through a proxy, which is a Struct whose
+    // members refer to the elements of the columns.
+    BOOST_HANA_RUNTIME_CHECK(at_key(orders[1], BOOST_HANA_STRING("customer")) == "Jane");
+    at_key(orders[1], BOOST_HANA_STRING("amount")) = 35.0;
+    orders[2] = shop::Order{3, "Kevin", 7.5};
+
+    std::size_t columns = 0;
+    orders.for_each_column([&](auto /*key*/, auto column) {
+        BOOST_HANA_RUNTIME_CHECK(column.size() == 3);
+        ++columns;
+    });
+    BOOST_HANA_RUNTIME_CHECK(columns == 3);
+}
+//! [soa_vector]
@@ -141,6 +141,25 @@ BOOST_HANA_RUNTIME_CHECK(members(john) == make_tuple("John", 30));
 
 }{
 
+//! [members_ref]
+struct Person {
+    BOOST_HANA_DEFINE_STRUCT(Person,
+        (std::string, name),
+        (unsigned short, age)
+    );
+};
+
+Person john{"John", 30};
+auto refs = members_ref(john);
+BOOST_HANA_RUNTIME_CHECK(&at_c<0>(refs) == &john.name);
+
+// Modifying the members through the references modifies `john`.
+at_c<1>(refs) = 31;
+BOOST_HANA_RUNTIME_CHECK(john.age == 31);
+//! [members_ref]
+
+}{
+
 //! [keys]
 struct Person {
     BOOST_HANA_DEFINE_STRUCT(Person,
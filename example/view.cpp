@@ -0,0 +1,112 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/ext/std/integral_constant.hpp>
+#include <boost/hana/functional/placeholder.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+#include <boost/hana/view.hpp>
+
+#include <sstream>
+#include <string>
+#include <type_traits>
+using namespace boost::hana;
+
+
+int main() {
+
+using boost::hana::size_t; // disambiguate with ::size_t on GCC
+
+{
+
+//! [foldable]
+auto xs = make_tuple(1, 2.5, 3, 4.5);
+auto halves = view::transform(xs, [](auto x) { return x / 2; });
+
+// The elements are computed as they are folded; no tuple is created.
+BOOST_HANA_RUNTIME_CHECK(fold_left(halves, 0.0, _ + _) == 0 + 1.25 + 1 + 2.25);
+
+std::ostringstream ss;
+for_each(view::reverse(xs), [&](auto x) { ss << x << ' '; });
+BOOST_HANA_RUNTIME_CHECK(ss.str() == "4.5 3 2.5 1 ");
+//! [foldable]
+
+}{
+
+//! [iterable]
+auto xs = make_tuple(1, '2', std::string{"345"}, 6.0);
+auto v = view::reverse(xs);
+
+BOOST_HANA_RUNTIME_CHECK(head(v) == 6.0);
+BOOST_HANA_RUNTIME_CHECK(v[size_t<1>] == "345");
+BOOST_HANA_RUNTIME_CHECK(last(tail(v)) == 1);
+BOOST_HANA_CONSTANT_CHECK(length(tail(v)) == size_t<3>);
+
+// Elements are accessed without being copied.
+BOOST_HANA_RUNTIME_CHECK(&at_c<1>(v) == &at_c<2>(xs));
+//! [iterable]
+
+}{
+
+//! [transform]
+auto xs = make_tuple(1, '2', std::string{"345"});
+auto to_string = [](auto const& x) {
+    std::ostringstream ss;
+    ss << x;
+    return ss.str();
+};
+
+BOOST_HANA_RUNTIME_CHECK(
+    to<Tuple>(view::transform(xs, to_string)) == make_tuple("1", "2", "345")
+);
+//! [transform]
+
+}{
+
+//! [filter]
+auto xs = make_tuple(1, 2.0, 3, 4.0f, 'x');
+auto integers = view::filter(xs, [](auto x) {
+    return trait<std::is_integral>(decltype_(x));
+});
+
+BOOST_HANA_RUNTIME_CHECK(to<Tuple>(integers) == make_tuple(1, 3, 'x'));
+
+// The transformation is only applied to the elements that are kept.
+int calls = 0;
+auto squares = view::filter(
+    view::transform(xs, [&](auto x) { ++calls; return x * x; }),
+    [](auto x) { return trait<std::is_floating_point>(decltype_(x)); }
+);
+BOOST_HANA_RUNTIME_CHECK(to<Tuple>(squares) == make_tuple(4.0, 16.0f));
+BOOST_HANA_RUNTIME_CHECK(calls == 2);
+//! [filter]
+
+}{
+
+//! [reverse]
+auto xs = make_tuple(1, '2', 3.3);
+BOOST_HANA_RUNTIME_CHECK(to<Tuple>(view::reverse(xs)) == make_tuple(3.3, '2', 1));
+//! [reverse]
+
+}{
+
+//! [slice]
+auto xs = make_tuple(0, '1', 2.2, 3u, 4l);
+BOOST_HANA_RUNTIME_CHECK(
+    to<Tuple>(view::slice(xs, size_t<1>, size_t<4>)) == make_tuple('1', 2.2, 3u)
+);
+
+// Views of views are views over the original tuple.
+auto v = view::slice(view::reverse(xs), size_t<0>, size_t<2>);
+BOOST_HANA_RUNTIME_CHECK(to<Tuple>(v) == make_tuple(4l, 3u));
+BOOST_HANA_RUNTIME_CHECK(&v.base == &xs);
+//! [slice]
+
+}
+
+}
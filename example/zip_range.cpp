@@ -0,0 +1,65 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/zip_range.hpp>
+
+#include <cmath>
+#include <string>
+#include <vector>
+using namespace boost::hana;
+
+
+int main() {
+
+{
+
+//! [zip_range]
+auto columns = make_tuple(
+    std::vector<std::string>{"apple", "pear", "plum"},
+    std::vector<double>{1.25, 0.75, 0.5},
+    std::vector<int>{3, 10, 4}
+);
+
+double total = 0;
+for (auto row : zip_range(columns))
+    total += at_c<1>(row) * at_c<2>(row);
+BOOST_HANA_RUNTIME_CHECK(total == 3.75 + 7.5 + 2.0);
+
+// Rows hold references to the elements of the columns
+auto z = zip_range(columns);
+at_c<2>(z[1]) = 0;
+BOOST_HANA_RUNTIME_CHECK(at_c<2>(columns)[1] == 0);
+BOOST_HANA_RUNTIME_CHECK(z[0] == make_tuple("apple", 1.25, 3));
+//! [zip_range]
+
+}{
+
+//! [for_each_column]
+auto columns = make_tuple(std::vector<int>{3, 1, 2}, std::vector<double>{0.5, 2.5, 1.5});
+
+double sum = 0;
+for_each_column(zip_range(columns), [&](auto first, auto last) {
+    for (; first != last; ++first)
+        sum += *first;
+});
+BOOST_HANA_RUNTIME_CHECK(sum == 6 + 4.5);
+//! [for_each_column]
+
+}{
+
+//! [transform_columns]
+auto columns = make_tuple(std::vector<float>{1, 4, 9}, std::vector<double>{16, 25, 36});
+
+transform_columns(zip_range(columns), [](auto x) { return std::sqrt(x); });
+BOOST_HANA_RUNTIME_CHECK(at_c<0>(columns) == std::vector<float>{1, 2, 3});
+BOOST_HANA_RUNTIME_CHECK(at_c<1>(columns) == std::vector<double>{4, 5, 6});
+//! [transform_columns]
+
+}
+
+}
@@ -46,6 +46,8 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/string.hpp>
 #include <boost/hana/tuple.hpp>
 #include <boost/hana/type.hpp>
+#include <boost/hana/view.hpp>
+#include <boost/hana/zip_range.hpp>
 
 // Misc
 #include <boost/hana/assert.hpp>
@@ -78,6 +80,11 @@ namespace boost { namespace hana {
 //! @defgroup group-core Core
 //! Core utilities of the library.
 
+//! @defgroup group-concurrency Concurrency
+//! Facilities to process the elements of heterogeneous structures on
+//! several threads. These are not included by `boost/hana.hpp` and they
+//! require linking with the platform's threading library.
+
 //! @defgroup group-ext External adapters
 //! Adapters for external libraries.
 //!
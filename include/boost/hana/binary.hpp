@@ -0,0 +1,583 @@
+/*!
+@file
+Defines `boost::hana::to_binary`, `boost::hana::from_binary` and
+`boost::hana::binary_size`.
+
+This header is not included by `boost/hana.hpp`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_BINARY_HPP
+#define BOOST_HANA_BINARY_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/datatype.hpp>
+#include <boost/hana/core/default.hpp>
+#include <boost/hana/core/models.hpp>
+#include <boost/hana/core/when.hpp>
+#include <boost/hana/detail/wrong.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/sequence.hpp>
+#include <boost/hana/struct.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace boost { namespace hana {
+    namespace binary_detail {
+        // Accumulates the bytes of consecutive raw members and writes them
+        // with a single copy when they are adjacent in memory. Since the
+        // addresses of the members of an object are at constant offsets
+        // from the object, the checks for adjacency are folded away by the
+        // compiler, leaving one copy per run of adjacent raw members.
+        template <typename Out>
+        struct writer {
+            Out out;
+            char const* run;
+            std::size_t size;
+
+            void add(void const* p, std::size_t n) {
+                char const* const bytes = static_cast<char const*>(p);
+                if (bytes != run + size) {
+                    this->flush();
+                    run = bytes;
+                }
+                size += n;
+            }
+
+            void flush() {
+                out = std::copy(run, run + size, static_cast<Out&&>(out));
+                size = 0;
+            }
+
+            void write(char const* p, std::size_t n) {
+                this->flush();
+                out = std::copy(p, p + n, static_cast<Out&&>(out));
+            }
+
+            void write_varint(std::uint64_t n) {
+                char bytes[10];
+                std::size_t k = 0;
+                do {
+                    bytes[k] = static_cast<char>(n & 0x7F);
+                    n >>= 7;
+                    if (n != 0)
+                        bytes[k] = static_cast<char>(bytes[k] | 0x80);
+                    ++k;
+                } while (n != 0);
+                this->write(bytes, k);
+            }
+        };
+
+        // The counterpart of `writer`, copying runs of raw bytes from the
+        // buffer directly into adjacent members.
+        struct reader {
+            char const* first;
+            char const* last;
+            char* run;
+            std::size_t size;
+
+            void add(void* p, std::size_t n) {
+                char* const bytes = static_cast<char*>(p);
+                if (bytes != run + size) {
+                    if (!this->flush())
+                        return;
+                    run = bytes;
+                }
+                size += n;
+            }
+
+            bool flush() {
+                if (first == nullptr || static_cast<std::size_t>(last - first) < size) {
+                    first = nullptr;
+                    return false;
+                }
+                if (size != 0)
+                    std::memcpy(run, first, size);
+                first += size;
+                size = 0;
+                return true;
+            }
+
+            std::size_t remaining() const
+            { return static_cast<std::size_t>(last - first); }
+
+            bool read_varint(std::uint64_t& n) {
+                if (!this->flush())
+                    return false;
+                n = 0;
+                for (unsigned shift = 0; shift < 64 && first != last; shift += 7) {
+                    std::uint64_t const byte = static_cast<unsigned char>(*first++);
+                    n |= (byte & 0x7F) << shift;
+                    if ((byte & 0x80) == 0)
+                        return shift < 63 || byte <= 1;
+                }
+                first = nullptr;
+                return false;
+            }
+        };
+
+        inline std::size_t varint_size(std::uint64_t n) {
+            std::size_t k = 1;
+            while (n >>= 7)
+                ++k;
+            return k;
+        }
+
+        // The maximum length of a vector whose elements are encoded with no
+        // bytes at all, like empty `Struct`s. The length of such a vector is
+        // not bounded by the size of the input, so it needs a hard limit.
+        constexpr std::size_t max_empty_elements = 1 << 16;
+
+        // Types whose object representation is written as is.
+        template <typename T>
+        struct is_raw
+            : std::integral_constant<bool,
+                std::is_arithmetic<T>{} || std::is_enum<T>{}
+            >
+        { };
+
+        template <typename T, std::size_t n>
+        struct is_raw<std::array<T, n>> : is_raw<T> { };
+
+        template <typename T, typename = void>
+        struct codec : codec<T, when<true>> { };
+
+        template <typename T, bool condition>
+        struct codec<T, when<condition>> : default_ {
+            static_assert(detail::wrong<codec<T>>{},
+            "hana::to_binary and hana::from_binary require the object to be "
+            "a Struct, a Sequence, a std::array, a std::vector, a std::string, "
+            "a number or an enumeration");
+        };
+
+        template <std::size_t ...n>
+        constexpr std::size_t sum() {
+            std::size_t const sizes[] = {n..., 0};
+            std::size_t result = 0;
+            for (std::size_t size : sizes)
+                result += size;
+            return result;
+        }
+
+        //////////////////////////////////////////////////////////////////////
+        // Raw members
+        //////////////////////////////////////////////////////////////////////
+        template <typename T>
+        struct codec<T, when<is_raw<T>{}()>> {
+            static constexpr std::size_t min_size = sizeof(T);
+
+            template <typename W>
+            static void write(T const& x, W& w) { w.add(&x, sizeof(T)); }
+
+            static bool read(T& x, reader& r)
+            { r.add(&x, sizeof(T)); return r.first != nullptr; }
+
+            static std::size_t size(T const&) { return sizeof(T); }
+        };
+
+        //////////////////////////////////////////////////////////////////////
+        // Strings and vectors
+        //////////////////////////////////////////////////////////////////////
+        template <typename Traits, typename Allocator>
+        struct codec<std::basic_string<char, Traits, Allocator>> {
+            using String = std::basic_string<char, Traits, Allocator>;
+            static constexpr std::size_t min_size = 1;
+
+            template <typename W>
+            static void write(String const& s, W& w) {
+                w.write_varint(s.size());
+                w.write(s.data(), s.size());
+            }
+
+            static bool read(String& s, reader& r) {
+                std::uint64_t n;
+                if (!r.read_varint(n) || n > r.remaining())
+                    return false;
+                s.assign(r.first, static_cast<std::size_t>(n));
+                r.first += n;
+                return true;
+            }
+
+            static std::size_t size(String const& s)
+            { return binary_detail::varint_size(s.size()) + s.size(); }
+        };
+
+        template <typename T, typename Allocator>
+        struct codec<std::vector<T, Allocator>> {
+            using Vector = std::vector<T, Allocator>;
+            static constexpr std::size_t min_size = 1;
+
+            template <typename W>
+            static void write(Vector const& xs, W& w, std::true_type) {
+                w.write(reinterpret_cast<char const*>(xs.data()), xs.size() * sizeof(T));
+            }
+
+            template <typename W>
+            static void write(Vector const& xs, W& w, std::false_type) {
+                for (T const& x : xs)
+                    codec<T>::write(x, w);
+            }
+
+            template <typename W>
+            static void write(Vector const& xs, W& w) {
+                w.write_varint(xs.size());
+                codec::write(xs, w, is_raw<T>{});
+            }
+
+            static bool read(Vector& xs, reader& r, std::true_type) {
+                if (xs.empty())
+                    return true;
+                std::memcpy(static_cast<void*>(xs.data()), r.first, xs.size() * sizeof(T));
+                r.first += xs.size() * sizeof(T);
+                return true;
+            }
+
+            static bool read(Vector& xs, reader& r, std::false_type) {
+                for (T& x : xs)
+                    if (!codec<T>::read(x, r))
+                        return false;
+                return r.flush();
+            }
+
+            static bool read(Vector& xs, reader& r) {
+                std::uint64_t n;
+                if (!r.read_varint(n))
+                    return false;
+                // Elements encoded with at least one byte can not be more
+                // numerous than the remaining bytes; this prevents invalid
+                // input from requesting absurd amounts of memory.
+                if (codec<T>::min_size == 0 ? n > max_empty_elements
+                                            : n > r.remaining() / codec<T>::min_size)
+                    return false;
+                xs.clear();
+                xs.resize(static_cast<std::size_t>(n));
+                return codec::read(xs, r, is_raw<T>{});
+            }
+
+            static std::size_t size(Vector const& xs, std::true_type)
+            { return xs.size() * sizeof(T); }
+
+            static std::size_t size(Vector const& xs, std::false_type) {
+                std::size_t result = 0;
+                for (T const& x : xs)
+                    result += codec<T>::size(x);
+                return result;
+            }
+
+            static std::size_t size(Vector const& xs) {
+                return binary_detail::varint_size(xs.size())
+                     + codec::size(xs, is_raw<T>{});
+            }
+        };
+
+        // The elements of a `std::vector<bool>` are packed bits, which have
+        // no address, so they are written and read one byte per element.
+        template <typename Allocator>
+        struct codec<std::vector<bool, Allocator>> {
+            using Vector = std::vector<bool, Allocator>;
+            static constexpr std::size_t min_size = 1;
+
+            template <typename W>
+            static void write(Vector const& xs, W& w) {
+                w.write_varint(xs.size());
+                char bytes[64];
+                std::size_t k = 0;
+                for (bool x : xs) {
+                    bytes[k++] = static_cast<char>(x);
+                    if (k == sizeof(bytes)) {
+                        w.write(bytes, k);
+                        k = 0;
+                    }
+                }
+                w.write(bytes, k);
+            }
+
+            static bool read(Vector& xs, reader& r) {
+                std::uint64_t n;
+                if (!r.read_varint(n) || n > r.remaining())
+                    return false;
+                xs.clear();
+                xs.reserve(static_cast<std::size_t>(n));
+                for (std::uint64_t i = 0; i != n; ++i) {
+                    char const byte = *r.first++;
+                    if (byte != 0 && byte != 1)
+                        return false;
+                    xs.push_back(byte != 0);
+                }
+                return true;
+            }
+
+            static std::size_t size(Vector const& xs)
+            { return binary_detail::varint_size(xs.size()) + xs.size(); }
+        };
+
+        //////////////////////////////////////////////////////////////////////
+        // Arrays and Sequences
+        //////////////////////////////////////////////////////////////////////
+        template <typename T, std::size_t n>
+        struct codec<std::array<T, n>, when<!is_raw<T>{}()>> {
+            static constexpr std::size_t min_size = n * codec<T>::min_size;
+
+            template <typename W>
+            static void write(std::array<T, n> const& xs, W& w) {
+                for (T const& x : xs)
+                    codec<T>::write(x, w);
+            }
+
+            static bool read(std::array<T, n>& xs, reader& r) {
+                for (T& x : xs)
+                    if (!codec<T>::read(x, r))
+                        return false;
+                return true;
+            }
+
+            static std::size_t size(std::array<T, n> const& xs) {
+                std::size_t result = 0;
+                for (T const& x : xs)
+                    result += codec<T>::size(x);
+                return result;
+            }
+        };
+
+        template <typename Xs, typename Indices = std::make_index_sequence<
+            decltype(hana::length(std::declval<Xs&>()))::value
+        >>
+        struct sequence_codec;
+
+        template <typename Xs, std::size_t ...k>
+        struct sequence_codec<Xs, std::index_sequence<k...>> {
+            template <std::size_t i>
+            using element = typename std::decay<decltype(
+                hana::at_c<i>(std::declval<Xs&>())
+            )>::type;
+
+            static constexpr std::size_t min_size =
+                binary_detail::sum<codec<element<k>>::min_size...>();
+
+            template <typename W>
+            static void write(Xs const& xs, W& w) {
+                using Swallow = int[];
+                (void)Swallow{0, ((void)codec<element<k>>::write(hana::at_c<k>(xs), w), 0)...};
+            }
+
+            static bool read(Xs& xs, reader& r) {
+                bool ok = true;
+                using Swallow = int[];
+                (void)Swallow{0, ((void)(ok = ok && codec<element<k>>::read(hana::at_c<k>(xs), r)), 0)...};
+                return ok;
+            }
+
+            static std::size_t size(Xs const& xs) {
+                std::size_t result = 0;
+                using Swallow = int[];
+                (void)Swallow{0, ((void)(result += codec<element<k>>::size(hana::at_c<k>(xs))), 0)...};
+                return result;
+            }
+        };
+
+        template <typename T>
+        struct codec<T, when<
+            _models<Sequence, typename datatype<T>::type>{}() &&
+            !_models<Struct, T>{}()
+        >> : sequence_codec<T> { };
+
+        //////////////////////////////////////////////////////////////////////
+        // Structs
+        //////////////////////////////////////////////////////////////////////
+        template <typename S, typename Indices = std::make_index_sequence<
+            decltype(hana::length(hana::accessors<S>()))::value
+        >>
+        struct struct_codec;
+
+        template <typename S, std::size_t ...k>
+        struct struct_codec<S, std::index_sequence<k...>> {
+            template <std::size_t i>
+            static decltype(auto) member(S& s)
+            { return hana::second(hana::at_c<i>(hana::accessors<S>()))(s); }
+
+            template <std::size_t i>
+            static decltype(auto) member(S const& s)
+            { return hana::second(hana::at_c<i>(hana::accessors<S>()))(s); }
+
+            template <std::size_t i>
+            using member_t = typename std::decay<decltype(member<i>(std::declval<S&>()))>::type;
+
+            static constexpr std::size_t min_size =
+                binary_detail::sum<codec<member_t<k>>::min_size...>();
+
+            // A member returned by value can not be part of a run, since the
+            // temporary holding it dies before the run is written.
+            template <std::size_t i, typename W>
+            static void write_member(S const& s, W& w, std::true_type)
+            { codec<member_t<i>>::write(member<i>(s), w); }
+
+            template <std::size_t i, typename W>
+            static void write_member(S const& s, W& w, std::false_type) {
+                member_t<i> const value = member<i>(s);
+                codec<member_t<i>>::write(value, w);
+                w.flush();
+            }
+
+            template <typename W>
+            static void write(S const& s, W& w) {
+                using Swallow = int[];
+                (void)Swallow{0, ((void)write_member<k>(s, w, std::is_lvalue_reference<
+                    decltype(member<k>(s))
+                >{}), 0)...};
+            }
+
+            static bool read(S& s, reader& r) {
+                bool ok = true;
+                using Swallow = int[];
+                (void)Swallow{0, ((void)(ok = ok && codec<member_t<k>>::read(member<k>(s), r)), 0)...};
+                return ok;
+            }
+
+            static std::size_t size(S const& s) {
+                std::size_t result = 0;
+                using Swallow = int[];
+                (void)Swallow{0, ((void)(result += codec<member_t<k>>::size(member<k>(s))), 0)...};
+                return result;
+            }
+        };
+
+        template <typename S>
+        struct codec<S, when<_models<Struct, S>{}()>> : struct_codec<S> { };
+    }
+
+    //! @ingroup group-datatypes
+    //! Writes a compact binary representation of an object to an output
+    //! iterator.
+    //!
+    //! Given an object `x` and an output iterator `out` accepting `char`s,
+    //! `to_binary(x, out)` writes the binary representation of `x` to `out`
+    //! and returns the iterator past the last byte written. The object can
+    //! be read back with `from_binary`. The representation is defined
+    //! recursively:
+    //!
+    //! - Numbers, enumerations and `std::array`s of those are raw members,
+    //!   represented by their bytes, in the byte order of the platform.
+    //! - A `std::string` is represented by its length, encoded as a varint
+    //!   (7 bits per byte, least significant group first), followed by its
+    //!   characters. A `std::vector` is represented by its length encoded as
+    //!   a varint, followed by its elements. The elements of a vector of raw
+    //!   members are copied all at once.
+    //! - A `Struct` is represented by its members, a `Sequence` like a
+    //!   `Tuple` by its elements, and a `std::array` whose elements are not
+    //!   raw members by its elements, all in order and without separators.
+    //!
+    //! Adjacent raw members are not written one by one. Instead, as long as
+    //! the raw members of a `Struct` are laid out one after the other in
+    //! memory, with no padding between them, their bytes are written with a
+    //! single copy. This also works across nested `Struct`s and `Tuple`s.
+    //! Since the offsets of members are known to the compiler, deciding how
+    //! to group the members has no runtime cost, and a `Struct` made only of
+    //! raw members without padding is written like a single `memcpy`.
+    //!
+    //! @note
+    //! This function is not included by `boost/hana.hpp`; it must be
+    //! included with `boost/hana/binary.hpp`. The representation of raw
+    //! members depends on the platform, so it should only be read on a
+    //! platform with the same sizes and byte order. When writing to a
+    //! `char*`, `binary_size(x)` gives the size of the buffer to provide.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/binary.cpp to_binary
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto to_binary = [](auto const& x, auto out) {
+        return output iterator past the representation of x;
+    };
+#else
+    struct _to_binary {
+        template <typename X, typename Out>
+        Out operator()(X const& x, Out out) const {
+            binary_detail::writer<Out> w{static_cast<Out&&>(out), nullptr, 0};
+            binary_detail::codec<X>::write(x, w);
+            w.flush();
+            return static_cast<Out&&>(w.out);
+        }
+    };
+
+    constexpr _to_binary to_binary{};
+#endif
+
+    //! @ingroup group-datatypes
+    //! Reads an object from the binary representation written by
+    //! `to_binary`.
+    //!
+    //! Given a buffer `[first, last)` and an object `x`, `from_binary(first,
+    //! last, x)` reads the binary representation of an object of the type
+    //! of `x` from the beginning of the buffer into `x`, and returns a
+    //! pointer past the representation. If the buffer is too short or a
+    //! varint is invalid, a null pointer is returned instead, and `x` may
+    //! have been modified. A `std::vector` of elements represented with no
+    //! bytes, like empty `Struct`s, is rejected if it has more than 65536
+    //! elements. Adjacent raw members are read with a single copy,
+    //! like they are written by `to_binary`. Nothing is read past `last`.
+    //!
+    //! @note
+    //! The bytes of raw members are not validated, so reading a `bool` or
+    //! an enumeration from bytes that were not written by `to_binary` may
+    //! produce invalid values.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/binary.cpp from_binary
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto from_binary = [](char const* first, char const* last, auto& x) {
+        return pointer past the representation of x, or nullptr;
+    };
+#else
+    struct _from_binary {
+        template <typename X>
+        char const* operator()(char const* first, char const* last, X& x) const {
+            binary_detail::reader r{first, last, nullptr, 0};
+            if (!binary_detail::codec<X>::read(x, r) || !r.flush())
+                return nullptr;
+            return r.first;
+        }
+    };
+
+    constexpr _from_binary from_binary{};
+#endif
+
+    //! @ingroup group-datatypes
+    //! Returns the number of bytes written by `to_binary` for an object.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/binary.cpp to_binary
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto binary_size = [](auto const& x) -> std::size_t {
+        return number of bytes written by to_binary(x, out);
+    };
+#else
+    struct _binary_size {
+        template <typename X>
+        std::size_t operator()(X const& x) const
+        { return binary_detail::codec<X>::size(x); }
+    };
+
+    constexpr _binary_size binary_size{};
+#endif
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_BINARY_HPP
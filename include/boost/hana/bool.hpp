@@ -18,7 +18,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/core/datatype.hpp>
 #include <boost/hana/core/models.hpp>
 #include <boost/hana/core/operators.hpp>
-#include <boost/hana/lazy.hpp>
+#include <boost/hana/detail/eval.hpp>
 
 // provided models; the rest is included in <boost/hana/integral_constant.hpp>
 #include <boost/hana/logical.hpp>
@@ -0,0 +1,402 @@
+/*!
+@file
+Defines `boost::hana::write_columnar` and `boost::hana::columnar_file`.
+
+This header is not included by `boost/hana.hpp`. It requires POSIX
+`mmap`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_COLUMNAR_HPP
+#define BOOST_HANA_COLUMNAR_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/models.hpp>
+#include <boost/hana/detail/constexpr/array.hpp>
+#include <boost/hana/detail/mapped_file.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/iterable.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/soa_vector.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/struct.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+
+
+namespace boost { namespace hana {
+    namespace columnar_detail {
+        // Joins the names of the members, separated by commas.
+        template <typename ...Names>
+        struct join {
+            static_assert(sizeof...(Names) == 0,
+            "hana::write_columnar requires the keys of the Struct to be "
+            "compile-time hana::strings");
+            using type = _string<>;
+        };
+
+        template <char ...s>
+        struct join<_string<s...>> {
+            using type = _string<s...>;
+        };
+
+        template <char ...s1, char ...s2, typename ...Names>
+        struct join<_string<s1...>, _string<s2...>, Names...>
+            : join<_string<s1..., ',', s2...>, Names...>
+        { };
+
+        // Describes the representation of a member, so that changing the
+        // type of a member also changes the layout hash.
+        template <typename T>
+        constexpr std::uint64_t type_code() {
+            return static_cast<std::uint64_t>(sizeof(T))
+                 | static_cast<std::uint64_t>(alignof(T)) << 32
+                 | static_cast<std::uint64_t>(std::is_floating_point<T>{}) << 48
+                 | static_cast<std::uint64_t>(std::is_signed<T>{}) << 49;
+        }
+
+        template <char ...s, typename ...T>
+        constexpr std::uint64_t layout_hash(_string<s...>, T const* ...) {
+            constexpr detail::constexpr_::array<std::uint64_t, sizeof...(s) + sizeof...(T)> input{{
+                static_cast<std::uint64_t>(static_cast<unsigned char>(s))...,
+                type_code<T>()...
+            }};
+            // 64 bits FNV-1a over the bytes of the input
+            std::uint64_t h = 0xcbf29ce484222325ull;
+            for (std::uint64_t x : input) {
+                for (int byte = 0; byte != 8; ++byte) {
+                    h = (h ^ ((x >> (8 * byte)) & 0xFF)) * 0x100000001b3ull;
+                }
+            }
+            return h;
+        }
+
+        template <typename Member>
+        struct check_member {
+            static_assert(std::is_trivially_copyable<Member>{},
+            "hana::write_columnar requires the members of the Struct to be "
+            "trivially copyable");
+
+            static_assert(!std::is_pointer<Member>{} &&
+                          !std::is_member_pointer<Member>{},
+            "hana::write_columnar requires the members of the Struct not to "
+            "be pointers, which are meaningless when read in another process");
+
+            static_assert(alignof(Member) <= 64,
+            "hana::write_columnar requires the members of the Struct to be "
+            "aligned on at most 64 bytes");
+
+            using type = Member;
+        };
+
+        template <typename S>
+        struct make_schema {
+            template <typename ...Accessor>
+            auto operator()(Accessor&& ...accessor) const -> _pair<
+                typename join<typename std::decay<
+                    decltype(hana::first(accessor))
+                >::type...>::type,
+                _tuple<typename check_member<typename std::decay<
+                    decltype(hana::second(accessor)(std::declval<S&>()))
+                >::type>::type const*...>
+            >;
+        };
+
+        template <typename Names, typename Members>
+        struct schema_impl;
+
+        template <char ...s, typename ...T>
+        struct schema_impl<_string<s...>, _tuple<T const*...>> {
+            static constexpr std::uint32_t names_size = sizeof...(s);
+            static constexpr std::uint64_t hash = columnar_detail::layout_hash(
+                _string<s...>{}, static_cast<T const*>(nullptr)...
+            );
+
+            static char const* names()
+            { return hana::to<char const*>(_string<s...>{}); }
+        };
+
+        // The names of the members and the layout hash of a Struct.
+        template <typename S, typename Schema = decltype(
+            hana::unpack(hana::accessors<S>(), make_schema<S>{})
+        )>
+        struct schema;
+
+        template <typename S, typename Names, typename Members>
+        struct schema<S, _pair<Names, Members>>
+            : schema_impl<Names, Members>
+        { };
+
+        constexpr char magic[8] = {'H', 'A', 'N', 'A', 'C', 'O', 'L', '\1'};
+        constexpr std::uint32_t byte_order = 0x01020304;
+        constexpr std::size_t alignment = 64;
+
+        // The header at the beginning of the file, followed by the names
+        // of the members and by the columns, each aligned on `alignment`
+        // bytes from the beginning of the file.
+        struct header {
+            char magic[8];
+            std::uint64_t layout_hash;
+            std::uint64_t rows;
+            std::uint32_t byte_order;
+            std::uint32_t names_size;
+        };
+
+        constexpr std::size_t align(std::size_t n)
+        { return (n + alignment - 1) / alignment * alignment; }
+
+        struct writer {
+            std::ostream& out;
+            std::size_t offset;
+
+            void write(void const* p, std::size_t n) {
+                out.write(static_cast<char const*>(p), static_cast<std::streamsize>(n));
+                offset += n;
+            }
+
+            void pad() {
+                char const zeros[alignment] = {};
+                this->write(zeros, align(offset) - offset);
+            }
+        };
+
+        // Writes the columns of a `soa_vector` directly.
+        template <typename S>
+        void write_columns(writer& w, soa_vector<S> const& xs) {
+            xs.for_each_column([&](auto const&, auto column) {
+                w.pad();
+                w.write(column.data(), column.size() * sizeof(column[0]));
+            });
+        }
+
+        // Gathers the members of the objects of a container into a buffer,
+        // column by column.
+        template <typename Xs>
+        void write_columns(writer& w, Xs const& xs) {
+            hana::for_each(hana::accessors<typename Xs::value_type>(),
+            [&](auto const& accessor) {
+                using Member = typename std::decay<
+                    decltype(hana::second(accessor)(*xs.begin()))
+                >::type;
+                constexpr std::size_t chunk = 4096 / sizeof(Member) + 1;
+                alignas(Member) char buffer[chunk * sizeof(Member)];
+                std::size_t n = 0;
+
+                w.pad();
+                for (auto const& x : xs) {
+                    std::memcpy(buffer + n * sizeof(Member),
+                                &hana::second(accessor)(x), sizeof(Member));
+                    if (++n == chunk) {
+                        w.write(buffer, sizeof(buffer));
+                        n = 0;
+                    }
+                }
+                w.write(buffer, n * sizeof(Member));
+            });
+        }
+    }
+
+    //! @ingroup group-datatypes
+    //! Writes a sequence of `Struct`s to a stream in a columnar format.
+    //!
+    //! Given an output stream and either a `soa_vector<S>` or a container
+    //! of objects of the `Struct` `S`, `write_columnar(out, xs)` writes a
+    //! file which can be mapped in memory by `columnar_file<S>`. The file
+    //! starts with a small header holding the number of objects, the names
+    //! of the members of `S` and a hash of the layout of `S`, followed by
+    //! one column per member, in the order of `accessors<S>()`. Each column
+    //! holds the object representations of the member for all the objects,
+    //! contiguously, and it is aligned on 64 bytes from the beginning of
+    //! the file. The names of the members are joined into a `hana::string`
+    //! at compile-time, and the layout hash is computed at compile-time
+    //! from the names and from the size, the alignment and the kind of the
+    //! type of each member.
+    //!
+    //! The members of `S` must be trivially copyable, and its keys must be
+    //! compile-time `hana::string`s, as those defined by the macros. The
+    //! return value is `out`, whose state tells whether writing failed.
+    //!
+    //! @note
+    //! This function is not included by `boost/hana.hpp`; it must be
+    //! included with `boost/hana/columnar.hpp`. The representation of the
+    //! members depends on the platform, and a file written on a platform
+    //! with a different byte order is rejected by `columnar_file`. Writing
+    //! a `soa_vector` writes each column with a single call; writing any
+    //! other container reads it once per member.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/columnar.cpp columnar
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto write_columnar = [](std::ostream& out, auto const& xs) -> std::ostream& {
+        return out after writing xs in the columnar format;
+    };
+#else
+    struct _write_columnar {
+        template <typename Xs>
+        std::ostream& operator()(std::ostream& out, Xs const& xs) const {
+            using Schema = columnar_detail::schema<typename Xs::value_type>;
+
+            columnar_detail::header h{};
+            std::memcpy(h.magic, columnar_detail::magic, sizeof(h.magic));
+            h.layout_hash = Schema::hash;
+            h.rows = static_cast<std::uint64_t>(xs.size());
+            h.byte_order = columnar_detail::byte_order;
+            h.names_size = Schema::names_size;
+
+            columnar_detail::writer w{out, 0};
+            w.write(&h, sizeof(h));
+            w.write(Schema::names(), Schema::names_size);
+            columnar_detail::write_columns(w, xs);
+            return out;
+        }
+    };
+
+    constexpr _write_columnar write_columnar{};
+#endif
+
+    //! @ingroup group-datatypes
+    //! The result of opening a `columnar_file`.
+    enum class columnar_status {
+        ok,              //!< The file was opened and mapped.
+        cannot_open,     //!< The file could not be opened or mapped.
+        bad_format,      //!< The file was not written by `write_columnar`,
+                         //!< on a platform with the same byte order.
+        layout_mismatch, //!< The file was written for another layout.
+        truncated        //!< The file is shorter than its header says.
+    };
+
+    //! @ingroup group-datatypes
+    //! A file written by `write_columnar`, mapped in memory.
+    //!
+    //! `columnar_file<S>` maps a file written by `write_columnar` for the
+    //! `Struct` `S` in memory, and gives access to its columns without
+    //! parsing or copying anything. `open(path)` maps the file and checks
+    //! its header, which only involves comparing a few integers. In
+    //! particular, the layout hash in the header is compared to the layout
+    //! hash of `S`, which is a compile-time constant, so a file written for
+    //! a different version of `S` is rejected right away. Then,
+    //! `column(key)` returns a read-only span over the column of the member
+    //! with the given key, which points directly into the mapped memory.
+    //!
+    //! @note
+    //! This class is not included by `boost/hana.hpp`; it must be included
+    //! with `boost/hana/columnar.hpp`. The spans returned by `column` are
+    //! invalidated when the file is closed.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/columnar.cpp columnar
+    template <typename S>
+    struct columnar_file {
+    private:
+        using Schema = columnar_detail::schema<S>;
+        using columns_type = soa_detail::columns<S>;
+
+        static constexpr std::size_t member_count =
+            decltype(hana::length(hana::accessors<S>()))::value;
+
+        static_assert(member_count > 0,
+        "hana::columnar_file<S> requires S to have at least one member");
+
+        template <typename Key>
+        using index_of = decltype(hana::unpack(hana::accessors<S>(),
+                                               soa_detail::find_key<Key>{}));
+
+        template <std::size_t i>
+        using member = typename std::decay<decltype(
+            hana::at_c<i>(std::declval<columns_type&>())
+        )>::type::value_type;
+
+        detail::mapped_file file_;
+        std::size_t rows_ = 0;
+        std::size_t offsets_[member_count] = {};
+
+        template <std::size_t ...i>
+        bool compute_offsets(std::index_sequence<i...>) {
+            std::size_t const size = file_.size();
+            std::size_t offset = columnar_detail::align(
+                sizeof(columnar_detail::header) + Schema::names_size);
+            std::size_t const sizes[] = {sizeof(member<i>)...};
+            for (std::size_t k = 0; k != member_count; ++k) {
+                offset = columnar_detail::align(offset);
+                if (offset > size || rows_ > (size - offset) / sizes[k])
+                    return false;
+                offsets_[k] = offset;
+                offset += rows_ * sizes[k];
+            }
+            return true;
+        }
+
+    public:
+        static constexpr std::uint64_t layout_hash = Schema::hash;
+
+        columnar_status open(char const* path) {
+            this->close();
+            if (!file_.open(path))
+                return columnar_status::cannot_open;
+
+            columnar_status status = columnar_status::ok;
+            columnar_detail::header h{};
+            if (file_.size() >= sizeof(h))
+                std::memcpy(&h, file_.data(), sizeof(h));
+
+            if (file_.size() < sizeof(h) ||
+                std::memcmp(h.magic, columnar_detail::magic, sizeof(h.magic)) != 0 ||
+                h.byte_order != columnar_detail::byte_order) {
+                status = columnar_status::bad_format;
+            }
+            else if (h.layout_hash != layout_hash ||
+                     h.names_size != Schema::names_size) {
+                status = columnar_status::layout_mismatch;
+            }
+            else {
+                rows_ = h.rows <= file_.size() ? static_cast<std::size_t>(h.rows)
+                                               : file_.size() + 1;
+                if (!this->compute_offsets(std::make_index_sequence<member_count>{}))
+                    status = columnar_status::truncated;
+            }
+
+            if (status != columnar_status::ok)
+                this->close();
+            return status;
+        }
+
+        void close() {
+            file_.close();
+            rows_ = 0;
+        }
+
+        bool is_open() const
+        { return file_.is_open(); }
+
+        //! Returns the number of objects in the file.
+        std::size_t size() const
+        { return rows_; }
+
+        //! Returns a span over the column of the member with the given key.
+        template <typename Key>
+        auto column(Key const&) const {
+            static_assert(index_of<Key>::value != member_count,
+            "hana::columnar_file<S>::column(key) requires key to be the key "
+            "of a member of S");
+            using T = member<index_of<Key>::value>;
+            return soa_detail::span<T const>{
+                reinterpret_cast<T const*>(file_.data() + offsets_[index_of<Key>::value]),
+                rows_
+            };
+        }
+    };
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_COLUMNAR_HPP
@@ -0,0 +1,487 @@
+/*!
+@file
+Defines `boost::hana::from_csv` and `boost::hana::read_csv`.
+
+This header is not included by `boost/hana.hpp`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_CSV_HPP
+#define BOOST_HANA_CSV_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/default.hpp>
+#include <boost/hana/core/models.hpp>
+#include <boost/hana/core/when.hpp>
+#include <boost/hana/detail/key_dispatch.hpp>
+#include <boost/hana/detail/mapped_file.hpp>
+#include <boost/hana/detail/thread_pool.hpp>
+#include <boost/hana/detail/wrong.hpp>
+#include <boost/hana/iterable.hpp>
+#include <boost/hana/json.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/struct.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace boost { namespace hana {
+    //! @ingroup group-datatypes
+    //! Options for parsing CSV and TSV files with `from_csv` and `read_csv`.
+    struct csv_options {
+        //! The character separating the fields of a line, which is `','` for
+        //! CSV and `'\t'` for TSV.
+        char delimiter = ',';
+
+        //! The number of chunks parsed in parallel, or 0 for one chunk per
+        //! hardware thread.
+        std::size_t chunks = 1;
+    };
+
+    namespace csv_detail {
+        // The characters of a field. For a quoted field, these are the
+        // characters between the quotes, and `escaped` is set when they
+        // contain doubled quotes.
+        struct field {
+            char const* first;
+            char const* last;
+            bool escaped;
+        };
+
+        // Scans the field starting at `first`, and returns a pointer past
+        // it, or a null pointer if it is a quoted field without its closing
+        // quote. The caller checks that the field is followed by the end of
+        // the input, a delimiter or the end of the line.
+        inline char const*
+        scan_field(char const* first, char const* last, char delimiter, field& f) {
+            f.escaped = false;
+            if (first != last && *first == '"') {
+                f.first = ++first;
+                while (true) {
+                    first = static_cast<char const*>(std::memchr(
+                        first, '"', static_cast<std::size_t>(last - first)));
+                    if (first == nullptr)
+                        return nullptr;
+                    if (first + 1 != last && first[1] == '"') {
+                        f.escaped = true;
+                        first += 2;
+                        continue;
+                    }
+                    f.last = first;
+                    return first + 1;
+                }
+            }
+
+            f.first = first;
+            while (first != last && *first != delimiter &&
+                   *first != '\n' && *first != '\r')
+                ++first;
+            f.last = first;
+            return first;
+        }
+
+        // Calls `append(s, n)` for each run of characters of the field,
+        // with its doubled quotes replaced by single quotes.
+        template <typename Append>
+        void unescape(field const& f, Append append) {
+            char const* first = f.first;
+            while (first != f.last) {
+                char const* quote = static_cast<char const*>(std::memchr(
+                    first, '"', static_cast<std::size_t>(f.last - first)));
+                if (quote == nullptr)
+                    quote = f.last;
+                else
+                    ++quote;
+                append(first, static_cast<std::size_t>(quote - first));
+                first = quote == f.last ? quote : quote + 1;
+            }
+        }
+
+        template <typename T>
+        bool parse_integer(char const* first, char const* last, T& x) {
+            using U = typename std::make_unsigned<T>::type;
+            bool negative = false;
+            if (first != last && (*first == '-' || *first == '+')) {
+                negative = *first++ == '-';
+                if (negative && !std::is_signed<T>{})
+                    return false;
+            }
+            if (first == last)
+                return false;
+
+            U const max = negative
+                ? static_cast<U>(U{0} - static_cast<U>(std::numeric_limits<T>::min()))
+                : static_cast<U>(std::numeric_limits<T>::max());
+            U value = 0;
+            for (; first != last; ++first) {
+                unsigned const d = static_cast<unsigned>(*first - '0');
+                if (d > 9 || value > (max - d) / 10)
+                    return false;
+                value = static_cast<U>(value * 10 + d);
+            }
+            x = negative ? static_cast<T>(U{0} - value) : static_cast<T>(value);
+            return true;
+        }
+
+        // The parse routine of the type of a member. Empty fields leave the
+        // member as it is.
+        template <typename T, typename = void>
+        struct parser : parser<T, when<true>> { };
+
+        template <typename T, bool condition>
+        struct parser<T, when<condition>> : default_ {
+            static_assert(detail::wrong<parser<T>>{},
+            "hana::from_csv does not know how to parse a member of this type");
+        };
+
+        template <typename T>
+        struct parser<T, when<std::is_integral<T>{}()>> {
+            static bool apply(field const& f, T& x)
+            { return csv_detail::parse_integer(f.first, f.last, x); }
+        };
+
+        template <>
+        struct parser<bool> {
+            static bool apply(field const& f, bool& x) {
+                std::size_t const n = static_cast<std::size_t>(f.last - f.first);
+                if ((n == 4 && std::memcmp(f.first, "true", 4) == 0) ||
+                    (n == 1 && *f.first == '1'))
+                    x = true;
+                else if ((n == 5 && std::memcmp(f.first, "false", 5) == 0) ||
+                         (n == 1 && *f.first == '0'))
+                    x = false;
+                else
+                    return false;
+                return true;
+            }
+        };
+
+        template <>
+        struct parser<char> {
+            static bool apply(field const& f, char& x) {
+                if (f.last - f.first != (f.escaped ? 2 : 1))
+                    return false;
+                x = *f.first;
+                return true;
+            }
+        };
+
+        template <typename T>
+        struct parser<T, when<std::is_floating_point<T>{}()>> {
+            static bool apply(field const& f, T& x)
+            { return json_detail::read_floating(f.first, f.last, x) == f.last; }
+        };
+
+        template <typename Traits, typename Allocator>
+        struct parser<std::basic_string<char, Traits, Allocator>> {
+            static bool apply(field const& f, std::basic_string<char, Traits, Allocator>& x) {
+                if (!f.escaped) {
+                    x.assign(f.first, f.last);
+                    return true;
+                }
+                x.clear();
+                csv_detail::unescape(f, [&](char const* s, std::size_t n) {
+                    x.append(s, n);
+                });
+                return true;
+            }
+        };
+
+        // The parse routines of the members of a Struct, indexed by the
+        // position of the member. The last one skips an unknown column.
+        template <typename S, typename Indices = std::make_index_sequence<
+            decltype(hana::length(hana::accessors<S>()))::value
+        >>
+        struct members;
+
+        template <typename S, std::size_t ...k>
+        struct members<S, std::index_sequence<k...>> {
+            using reader = bool (*)(field const&, S&);
+
+            using keys = detail::key_dispatch<
+                typename std::decay<decltype(hana::first(
+                    hana::at_c<k>(hana::accessors<S>())
+                ))>::type...
+            >;
+
+            template <std::size_t i>
+            static bool read(field const& f, S& s) {
+                auto& member = hana::second(hana::at_c<i>(hana::accessors<S>()))(s);
+                using Member = typename std::decay<decltype(member)>::type;
+                return f.first == f.last || parser<Member>::apply(f, member);
+            }
+
+            static bool skip(field const&, S&)
+            { return true; }
+
+            static constexpr reader readers[sizeof...(k) + 1] = {&read<k>..., &skip};
+
+            // Returns the index of the member whose name is in the field.
+            static std::size_t find(field const& f) {
+                if (!f.escaped)
+                    return keys::find(f.first, static_cast<std::size_t>(f.last - f.first));
+                std::string name;
+                csv_detail::unescape(f, [&](char const* s, std::size_t n) {
+                    name.append(s, n);
+                });
+                return keys::find(name.data(), name.size());
+            }
+        };
+
+        template <typename S, std::size_t ...k>
+        constexpr typename members<S, std::index_sequence<k...>>::reader
+        members<S, std::index_sequence<k...>>::readers[sizeof...(k) + 1];
+
+        // Moves `first` past the end of the line at `first`, if any, and
+        // returns whether there was one.
+        inline bool end_of_line(char const*& first, char const* last) {
+            if (first != last && *first == '\r')
+                ++first;
+            if (first != last && *first == '\n') {
+                ++first;
+                return true;
+            }
+            return false;
+        }
+
+        // Parses the header line, and stores the index of the member of
+        // each column in `columns`. Returns a pointer past the line.
+        template <typename S>
+        char const* parse_header(char const* first, char const* last, char delimiter,
+                                 std::vector<std::size_t>& columns)
+        {
+            while (true) {
+                field f;
+                first = csv_detail::scan_field(first, last, delimiter, f);
+                if (first == nullptr)
+                    return nullptr;
+                columns.push_back(members<S>::find(f));
+                if (first == last || csv_detail::end_of_line(first, last))
+                    return first;
+                if (*first++ != delimiter)
+                    return nullptr;
+            }
+        }
+
+        // Parses the lines in `[first, last)` and appends an object to `out`
+        // for each of them. Empty lines are ignored.
+        template <typename S, typename Out>
+        char const* parse_rows(char const* first, char const* last, char delimiter,
+                               std::vector<std::size_t> const& columns, Out& out)
+        {
+            using Members = members<S>;
+            while (first != last) {
+                if (csv_detail::end_of_line(first, last))
+                    continue;
+
+                S s{};
+                for (std::size_t c = 0; ; ++c) {
+                    field f;
+                    first = csv_detail::scan_field(first, last, delimiter, f);
+                    if (first == nullptr || c == columns.size() ||
+                        !Members::readers[columns[c]](f, s))
+                        return nullptr;
+
+                    if (first != last && *first == delimiter) {
+                        ++first;
+                        continue;
+                    }
+                    if (c + 1 != columns.size() ||
+                        !(first == last || csv_detail::end_of_line(first, last)))
+                        return nullptr;
+                    break;
+                }
+                out.push_back(static_cast<S&&>(s));
+            }
+            return last;
+        }
+
+        // Parses chunks of lines on the threads of the pool, each into its
+        // own vector, and appends the objects to `out` in order.
+        template <typename S, typename Out>
+        struct parallel_rows {
+            char const* first;
+            char const* last;
+            char delimiter;
+            std::vector<std::size_t> const& columns;
+            std::vector<char const*> bounds;
+            std::vector<std::vector<S>> results;
+            std::vector<char> failed;
+
+            static void run(void* self_, std::size_t chunk) {
+                parallel_rows& self = *static_cast<parallel_rows*>(self_);
+                self.failed[chunk] = csv_detail::parse_rows<S>(
+                    self.bounds[chunk], self.bounds[chunk + 1],
+                    self.delimiter, self.columns, self.results[chunk]
+                ) == nullptr;
+            }
+
+            char const* operator()(std::size_t chunks, Out& out) {
+                // Chunks end after a newline, so a chunk may only start in
+                // the middle of a line when a quoted field contains a
+                // newline. Then, some chunk fails to parse, and we parse the
+                // whole input again on this thread.
+                bounds.push_back(first);
+                std::size_t const size = static_cast<std::size_t>(last - first);
+                for (std::size_t i = 1; i < chunks; ++i) {
+                    char const* bound = first + size / chunks * i;
+                    if (bound < bounds.back())
+                        continue;
+                    bound = static_cast<char const*>(std::memchr(
+                        bound, '\n', static_cast<std::size_t>(last - bound)));
+                    if (bound == nullptr)
+                        break;
+                    bounds.push_back(bound + 1);
+                }
+                bounds.push_back(last);
+
+                std::size_t const n = bounds.size() - 1;
+                results.resize(n);
+                failed.resize(n);
+                detail::thread_pool::instance().run(n, &run, this);
+
+                for (char f : failed)
+                    if (f)
+                        return csv_detail::parse_rows<S>(first, last, delimiter, columns, out);
+
+                for (std::vector<S>& result : results)
+                    for (S& s : result)
+                        out.push_back(static_cast<S&&>(s));
+                return last;
+            }
+        };
+    }
+
+    //! @ingroup group-datatypes
+    //! Parses CSV or TSV data into a container of `Struct`s.
+    //!
+    //! Given a buffer `[first, last)` holding a header line followed by
+    //! data lines, and a container `out` of a `Struct` type `S`, like a
+    //! `std::vector<S>` or a `soa_vector<S>`, `from_csv(first, last, out)`
+    //! creates an object of type `S` for each data line and appends it to
+    //! `out` with `push_back`. It returns `last` on success, and a null
+    //! pointer if the data is invalid, in which case some objects may have
+    //! been appended to `out`.
+    //!
+    //! The columns are matched with the members of `S` through the names in
+    //! the header line, using a perfect hash table generated at compile-time
+    //! from the keys of `S`. Columns without a matching member are ignored,
+    //! and members without a matching column are value-initialized, like
+    //! those whose field is empty. The parse routine of each member is
+    //! selected at compile-time from its type, and numeric fields are parsed
+    //! in place, without any allocation. Integers, floating point numbers,
+    //! `bool`s (`true`, `false`, `1` or `0`), `char`s and `std::string`s
+    //! are supported.
+    //!
+    //! Fields are separated by `options.delimiter` and lines end with
+    //! `"\n"` or `"\r\n"`. Fields may be quoted with `"`, in which case they
+    //! may contain delimiters, newlines and doubled quotes standing for
+    //! single quotes. Empty lines are ignored.
+    //!
+    //! When `options.chunks` is not 1, the data lines are split into chunks
+    //! at newlines, which are parsed in parallel on a pool of threads and
+    //! appended to `out` in order. If a chunk boundary falls inside a quoted
+    //! field containing a newline, the data is parsed again sequentially.
+    //!
+    //! @note
+    //! This function is not included by `boost/hana.hpp`; it must be
+    //! included with `boost/hana/csv.hpp`.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/csv.cpp from_csv
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto from_csv = [](char const* first, char const* last, auto& out,
+                                 csv_options const& options = csv_options{}) {
+        return last, or nullptr if the data is invalid;
+    };
+#else
+    struct _from_csv {
+        template <typename Out>
+        char const* operator()(char const* first, char const* last, Out& out,
+                               csv_options const& options = csv_options{}) const
+        {
+            using S = typename Out::value_type;
+
+        #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+            static_assert(_models<Struct, S>{},
+            "hana::from_csv(first, last, out) requires the elements of out "
+            "to be Structs");
+        #endif
+
+            // skip the UTF-8 byte order mark, if any
+            if (last - first >= 3 && std::memcmp(first, "\xEF\xBB\xBF", 3) == 0)
+                first += 3;
+            if (first == last)
+                return last;
+
+            std::vector<std::size_t> columns;
+            first = csv_detail::parse_header<S>(first, last, options.delimiter, columns);
+            if (first == nullptr)
+                return nullptr;
+
+            std::size_t const chunks = options.chunks != 0
+                ? options.chunks
+                : detail::thread_pool::instance().concurrency();
+            if (chunks == 1)
+                return csv_detail::parse_rows<S>(first, last, options.delimiter,
+                                                 columns, out);
+
+            return csv_detail::parallel_rows<S, Out>{
+                first, last, options.delimiter, columns, {}, {}, {}
+            }(chunks, out);
+        }
+    };
+
+    constexpr _from_csv from_csv{};
+#endif
+
+    //! @ingroup group-datatypes
+    //! Parses a CSV or TSV file into a container of `Struct`s.
+    //!
+    //! `read_csv(path, out, options)` maps the file at `path` in memory and
+    //! parses it with `from_csv`, without copying it. It returns whether the
+    //! file could be mapped and parsed.
+    //!
+    //! @note
+    //! This function is not included by `boost/hana.hpp`; it must be
+    //! included with `boost/hana/csv.hpp`. It requires POSIX `mmap`.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/csv.cpp read_csv
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto read_csv = [](char const* path, auto& out,
+                                 csv_options const& options = csv_options{}) {
+        return whether the file was read;
+    };
+#else
+    struct _read_csv {
+        template <typename Out>
+        bool operator()(char const* path, Out& out,
+                        csv_options const& options = csv_options{}) const
+        {
+            detail::mapped_file file;
+            if (!file.open(path))
+                return false;
+            return hana::from_csv(file.data(), file.data() + file.size(),
+                                  out, options) != nullptr;
+        }
+    };
+
+    constexpr _read_csv read_csv{};
+#endif
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_CSV_HPP
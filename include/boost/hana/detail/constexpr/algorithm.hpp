@@ -10,13 +10,25 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef BOOST_HANA_DETAIL_CONSTEXPR_ALGORITHM_HPP
 #define BOOST_HANA_DETAIL_CONSTEXPR_ALGORITHM_HPP
 
-#include <boost/hana/functional/placeholder.hpp>
-
 #include <cstddef>
 #include <utility>
 
 
 namespace boost { namespace hana { namespace detail { namespace constexpr_ {
+    // We don't use `hana::_` for the default predicates, because including
+    // the placeholders is much more expensive than these two structs.
+    struct less {
+        template <typename T, typename U>
+        constexpr bool operator()(T const& t, U const& u) const
+        { return t < u; }
+    };
+
+    struct equal_to {
+        template <typename T, typename U>
+        constexpr bool operator()(T const& t, U const& u) const
+        { return t == u; }
+    };
+
     template <typename T>
     constexpr void swap(T& x, T& y) {
         auto tmp = x;
@@ -60,7 +72,7 @@ namespace boost { namespace hana { namespace detail { namespace constexpr_ {
 
     template <typename BidirIter>
     constexpr bool next_permutation(BidirIter first, BidirIter last)
-    { return next_permutation(first, last, _ < _); }
+    { return next_permutation(first, last, constexpr_::less{}); }
 
 
     template <typename InputIter1, typename InputIter2, typename BinaryPred>
@@ -80,7 +92,7 @@ namespace boost { namespace hana { namespace detail { namespace constexpr_ {
     template <typename InputIter1, typename InputIter2>
     constexpr bool lexicographical_compare(InputIter1 first1, InputIter1 last1,
                                            InputIter2 first2, InputIter2 last2)
-    { return lexicographical_compare(first1, last1, first2, last2, _ < _); }
+    { return lexicographical_compare(first1, last1, first2, last2, constexpr_::less{}); }
 
 
     template <typename InputIter1, typename InputIter2, typename BinaryPred>
@@ -97,7 +109,7 @@ namespace boost { namespace hana { namespace detail { namespace constexpr_ {
     template <typename InputIter1, typename InputIter2>
     constexpr bool equal(InputIter1 first1, InputIter1 last1,
                          InputIter2 first2, InputIter2 last2)
-    { return equal(first1, last1, first2, last2, _ == _); }
+    { return equal(first1, last1, first2, last2, constexpr_::equal_to{}); }
 
 
     template <typename BidirIter, typename BinaryPred>
@@ -116,7 +128,7 @@ namespace boost { namespace hana { namespace detail { namespace constexpr_ {
 
     template <typename BidirIter>
     constexpr void sort(BidirIter first, BidirIter last)
-    { sort(first, last, _ < _); }
+    { sort(first, last, constexpr_::less{}); }
 
 
     template <typename InputIter, typename T>
@@ -11,7 +11,6 @@ Distributed under the Boost Software License, Version 1.0.
 #define BOOST_HANA_DETAIL_CONSTEXPR_ARRAY_HPP
 
 #include <boost/hana/detail/constexpr/algorithm.hpp>
-#include <boost/hana/functional/placeholder.hpp>
 
 #include <cstddef>
 
@@ -70,7 +69,7 @@ namespace constexpr_ {
         }
 
         constexpr auto permutations() const
-        { return this->permutations(hana::_ < hana::_); }
+        { return this->permutations(constexpr_::less{}); }
 
 
         template <typename BinaryPred>
@@ -81,7 +80,7 @@ namespace constexpr_ {
         }
 
         constexpr auto sort() const
-        { return this->sort(hana::_ < hana::_); }
+        { return this->sort(constexpr_::less{}); }
 
         template <typename U>
         constexpr auto iota(U value) const {
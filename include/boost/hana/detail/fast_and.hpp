@@ -0,0 +1,29 @@
+/*!
+@file
+Defines `boost::hana::detail::fast_and`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_FAST_AND_HPP
+#define BOOST_HANA_DETAIL_FAST_AND_HPP
+
+#include <type_traits>
+
+
+namespace boost { namespace hana { namespace detail {
+    //! Returns whether all the `b...` are true.
+    //!
+    //! This is a single instantiation of `std::is_same`, regardless of the
+    //! number of booleans, which makes it much cheaper than folding them or
+    //! calling `hana::all` on an array of booleans, especially in concept
+    //! checks that are compiled in every translation unit.
+    template <bool ...b>
+    struct fast_and
+        : std::is_same<fast_and<b...>, fast_and<(b, true)...>>
+    { };
+}}} // end namespace boost::hana::detail
+
+#endif // !BOOST_HANA_DETAIL_FAST_AND_HPP
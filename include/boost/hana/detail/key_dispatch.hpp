@@ -0,0 +1,268 @@
+/*!
+@file
+Defines `boost::hana::detail::key_dispatch`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_KEY_DISPATCH_HPP
+#define BOOST_HANA_DETAIL_KEY_DISPATCH_HPP
+
+#include <boost/hana/detail/constexpr/array.hpp>
+#include <boost/hana/detail/wrong.hpp>
+#include <boost/hana/fwd/string.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+
+namespace boost { namespace hana { namespace detail {
+    namespace key_dispatch_detail {
+        constexpr std::uint64_t byte(char c)
+        { return static_cast<unsigned char>(c); }
+
+        // Compilers turn these into a single (unaligned) load on little
+        // endian platforms.
+        constexpr std::uint64_t load4(char const* s)
+        { return byte(s[0]) | byte(s[1]) << 8 | byte(s[2]) << 16 | byte(s[3]) << 24; }
+
+        constexpr std::uint64_t load8(char const* s)
+        { return load4(s) | load4(s + 4) << 32; }
+
+        constexpr std::uint64_t fnv1a(char const* s, std::size_t n) {
+            std::uint64_t h = 14695981039346656037u;
+            for (std::size_t i = 0; i != n; ++i)
+                h = (h ^ byte(s[i])) * 1099511628211u;
+            return h;
+        }
+
+        // A string of length `n` summarized by two words. When `n <= 16`,
+        // the words hold every character of the string, so two strings of
+        // the same length are equal if and only if their words are equal.
+        // Longer strings also mix the characters in the middle into `last`.
+        struct words {
+            std::uint64_t first;
+            std::uint64_t last;
+        };
+
+        constexpr words split(char const* s, std::size_t n) {
+            if (n >= 8) {
+                words w{load8(s), load8(s + n - 8)};
+                if (n > 16)
+                    w.last ^= fnv1a(s + 8, n - 16);
+                return w;
+            }
+            else if (n >= 4)
+                return {load4(s), load4(s + n - 4)};
+            else if (n != 0)
+                return {byte(s[0]) | byte(s[n / 2]) << 8 | byte(s[n - 1]) << 16, 0};
+            else
+                return {0, 0};
+        }
+
+        constexpr std::uint32_t
+        hash(std::uint32_t seed, words w, std::size_t n) {
+            std::uint64_t h = (w.first ^ std::uint64_t{seed} << 32) * 0x9e3779b97f4a7c15u
+                            ^ (w.last + n) * 0xbf58476d1ce4e5b9u;
+            h = (h ^ (h >> 32)) * 0x94d049bb133111ebu;
+            return static_cast<std::uint32_t>(h ^ (h >> 29));
+        }
+
+        struct entry {
+            char const* name;
+            std::size_t size;
+            words w;
+        };
+
+        template <typename Key>
+        struct key {
+            static_assert(detail::wrong<key<Key>>{},
+            "detail::key_dispatch<Keys...> requires the keys to be "
+            "compile-time Strings");
+        };
+
+        template <char ...c>
+        struct key<_string<c...>> {
+            static constexpr char const name[sizeof...(c) + 1] = {c..., '\0'};
+            static constexpr entry value{name, sizeof...(c), split(name, sizeof...(c))};
+        };
+
+        template <char ...c>
+        constexpr char const key<_string<c...>>::name[sizeof...(c) + 1];
+
+        template <char ...c>
+        constexpr entry key<_string<c...>>::value;
+
+        template <std::size_t N>
+        constexpr std::size_t max_length(constexpr_::array<entry, N> entries) {
+            std::size_t result = 0;
+            for (std::size_t i = 0; i != N; ++i)
+                if (entries[i].size > result)
+                    result = entries[i].size;
+            return result;
+        }
+
+        constexpr std::size_t ceil_power_of_two(std::size_t n) {
+            std::size_t p = 1;
+            while (p < n)
+                p *= 2;
+            return p;
+        }
+
+        // A slot of the hash table. An empty slot has an impossible size
+        // and holds `index == N`.
+        struct slot {
+            words w;
+            std::size_t size;
+            std::size_t index;
+        };
+
+        template <std::size_t N>
+        struct layout {
+            static constexpr std::size_t buckets = ceil_power_of_two(N);
+            static constexpr std::size_t slots = ceil_power_of_two(2 * N);
+
+            std::uint32_t seed;
+            constexpr_::array<std::uint32_t, buckets> displacements;
+            constexpr_::array<slot, slots> table;
+        };
+
+        // Builds a perfect hash table with the hash and displace method.
+        // The low bits of the hash of a key select its bucket, and the key
+        // goes in the slot given by its high bits plus the displacement of
+        // its bucket. Starting from the largest buckets, we look for a
+        // displacement sending all of the keys of each bucket to free slots.
+        // This only fails when two keys of a bucket have the same high bits,
+        // in which case we start over with another seed.
+        template <std::size_t N>
+        constexpr layout<N> make_layout(constexpr_::array<entry, N> entries) {
+            using L = layout<N>;
+            for (std::uint32_t seed = 0; ; ++seed) {
+                L result{seed, {}, {}};
+                for (std::size_t s = 0; s != L::slots; ++s)
+                    result.table[s] = slot{{0, 0}, static_cast<std::size_t>(-1), N};
+
+                constexpr_::array<std::uint32_t, N> hashes{};
+                constexpr_::array<std::size_t, L::buckets + 1> starts{};
+                for (std::size_t i = 0; i != N; ++i) {
+                    hashes[i] = hash(seed, entries[i].w, entries[i].size);
+                    ++starts[(hashes[i] & (L::buckets - 1)) + 1];
+                }
+
+                // Sort the keys by bucket.
+                std::size_t largest = 0;
+                for (std::size_t b = 0; b != L::buckets; ++b) {
+                    if (starts[b + 1] > largest)
+                        largest = starts[b + 1];
+                    starts[b + 1] += starts[b];
+                }
+                constexpr_::array<std::size_t, N> keys{};
+                constexpr_::array<std::size_t, L::buckets> filled{};
+                for (std::size_t i = 0; i != N; ++i) {
+                    std::size_t const b = hashes[i] & (L::buckets - 1);
+                    keys[starts[b] + filled[b]++] = i;
+                }
+
+                bool placed = true;
+                for (std::size_t size = largest; size != 0 && placed; --size) {
+                    for (std::size_t b = 0; b != L::buckets && placed; ++b) {
+                        if (starts[b + 1] - starts[b] != size)
+                            continue;
+
+                        placed = false;
+                        for (std::uint32_t d = 0; d != L::slots && !placed; ++d) {
+                            placed = true;
+                            for (std::size_t k = starts[b]; k != starts[b + 1] && placed; ++k)
+                                placed = result.table[((hashes[keys[k]] >> 16) + d)
+                                                        & (L::slots - 1)].index == N;
+                            for (std::size_t k = starts[b]; k != starts[b + 1] && placed; ++k)
+                                for (std::size_t j = starts[b]; j != k && placed; ++j)
+                                    placed = ((hashes[keys[k]] >> 16) & (L::slots - 1)) !=
+                                             ((hashes[keys[j]] >> 16) & (L::slots - 1));
+                            if (placed) {
+                                result.displacements[b] = d;
+                                for (std::size_t k = starts[b]; k != starts[b + 1]; ++k) {
+                                    entry const& e = entries[keys[k]];
+                                    result.table[((hashes[keys[k]] >> 16) + d)
+                                                    & (L::slots - 1)] = slot{e.w, e.size, keys[k]};
+                                }
+                            }
+                        }
+                    }
+                }
+
+                if (placed)
+                    return result;
+            }
+        }
+    }
+
+    //! @ingroup group-details
+    //! Maps a runtime string to the index of the equal compile-time
+    //! `String` in `Keys...`, in constant time.
+    //!
+    //! A perfect hash table of the keys, with at least twice as many slots
+    //! as there are keys, is generated at compile-time. A runtime string is
+    //! summarized by its length and two words loaded from its beginning and
+    //! its end, which hold all of its characters when it is at most 16
+    //! characters long. Looking up the string then requires hashing these
+    //! words, loading the displacement of its bucket, and comparing the
+    //! length and the words stored in the only slot where the string can
+    //! be with those of the string. Only the characters in the middle of
+    //! longer strings are hashed and compared one by one. The keys must be
+    //! distinct.
+    template <typename ...Keys>
+    struct key_dispatch {
+    private:
+        static constexpr constexpr_::array<
+            key_dispatch_detail::entry, sizeof...(Keys)
+        > entries_{{key_dispatch_detail::key<Keys>::value...}};
+
+        using layout = key_dispatch_detail::layout<sizeof...(Keys)>;
+        static constexpr layout layout_ = key_dispatch_detail::make_layout(entries_);
+
+    public:
+        //! The number of keys, which is also the index returned by `find`
+        //! when no key is equal to the string.
+        static constexpr std::size_t size = sizeof...(Keys);
+
+        //! The length of the longest key.
+        static constexpr std::size_t max_length =
+            key_dispatch_detail::max_length(entries_);
+
+        //! Returns the index of the key equal to the string `[s, s + n)`,
+        //! or `size` if there is no such key.
+        static std::size_t find(char const* s, std::size_t n) {
+            key_dispatch_detail::words const w = key_dispatch_detail::split(s, n);
+            std::uint32_t const h = key_dispatch_detail::hash(layout_.seed, w, n);
+            std::uint32_t const d = layout_.displacements[h & (layout::buckets - 1)];
+            key_dispatch_detail::slot const& slot =
+                layout_.table[((h >> 16) + d) & (layout::slots - 1)];
+
+            if (slot.size != n || slot.w.first != w.first || slot.w.last != w.last)
+                return size;
+            if (n > 16 && std::memcmp(entries_[slot.index].name + 8, s + 8, n - 16) != 0)
+                return size;
+            return slot.index;
+        }
+    };
+
+    template <typename ...Keys>
+    constexpr constexpr_::array<key_dispatch_detail::entry, sizeof...(Keys)>
+    key_dispatch<Keys...>::entries_;
+
+    template <typename ...Keys>
+    constexpr key_dispatch_detail::layout<sizeof...(Keys)>
+    key_dispatch<Keys...>::layout_;
+
+    template <typename ...Keys>
+    constexpr std::size_t key_dispatch<Keys...>::size;
+
+    template <typename ...Keys>
+    constexpr std::size_t key_dispatch<Keys...>::max_length;
+}}} // end namespace boost::hana::detail
+
+#endif // !BOOST_HANA_DETAIL_KEY_DISPATCH_HPP
@@ -0,0 +1,110 @@
+/*!
+@file
+Defines `boost::hana::detail::mapped_file`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_MAPPED_FILE_HPP
+#define BOOST_HANA_DETAIL_MAPPED_FILE_HPP
+
+#include <cstddef>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+namespace boost { namespace hana { namespace detail {
+    //! @ingroup group-details
+    //! A file mapped read-only in memory with POSIX `mmap`.
+    //!
+    //! An empty file can't be mapped, so it is represented by an empty
+    //! buffer which is not backed by a mapping.
+    class mapped_file {
+        char const* data_ = nullptr;
+        std::size_t size_ = 0;
+
+        // The buffer of an empty file. It must be a single object, since
+        // `close` compares its address to know whether to unmap the file.
+        static char const* empty() {
+            static char const buffer = '\0';
+            return &buffer;
+        }
+
+    public:
+        mapped_file() = default;
+        mapped_file(mapped_file const&) = delete;
+        mapped_file& operator=(mapped_file const&) = delete;
+
+        mapped_file(mapped_file&& other) noexcept
+            : data_{other.data_}, size_{other.size_}
+        {
+            other.data_ = nullptr;
+            other.size_ = 0;
+        }
+
+        mapped_file& operator=(mapped_file&& other) noexcept {
+            if (this != &other) {
+                this->close();
+                data_ = other.data_;
+                size_ = other.size_;
+                other.data_ = nullptr;
+                other.size_ = 0;
+            }
+            return *this;
+        }
+
+        ~mapped_file()
+        { this->close(); }
+
+        //! Maps the file at `path`, and returns whether it succeeded.
+        bool open(char const* path) {
+            this->close();
+
+            int fd = ::open(path, O_RDONLY);
+            if (fd < 0)
+                return false;
+            struct ::stat st;
+            if (::fstat(fd, &st) != 0) {
+                ::close(fd);
+                return false;
+            }
+            if (st.st_size == 0) {
+                ::close(fd);
+                data_ = empty();
+                return true;
+            }
+
+            std::size_t const size = static_cast<std::size_t>(st.st_size);
+            void* p = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            ::close(fd);
+            if (p == MAP_FAILED)
+                return false;
+            data_ = static_cast<char const*>(p);
+            size_ = size;
+            return true;
+        }
+
+        void close() {
+            if (data_ != nullptr && data_ != empty())
+                ::munmap(const_cast<char*>(data_), size_);
+            data_ = nullptr;
+            size_ = 0;
+        }
+
+        bool is_open() const
+        { return data_ != nullptr; }
+
+        char const* data() const
+        { return data_; }
+
+        std::size_t size() const
+        { return size_; }
+    };
+}}} // end namespace boost::hana::detail
+
+#endif // !BOOST_HANA_DETAIL_MAPPED_FILE_HPP
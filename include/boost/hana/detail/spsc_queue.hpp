@@ -0,0 +1,171 @@
+/*!
+@file
+Defines `boost::hana::detail::spsc_queue`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_SPSC_QUEUE_HPP
+#define BOOST_HANA_DETAIL_SPSC_QUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <thread>
+#include <type_traits>
+
+
+namespace boost { namespace hana { namespace detail {
+    //! @ingroup group-details
+    //! Bounded lock-free queue with a single producer and a single consumer.
+    //!
+    //! The queue is a ring buffer whose capacity is rounded up to a power
+    //! of two. Each side keeps a private copy of its own index and a cached
+    //! copy of the other side's index, and only publishes its index once
+    //! every `batch` operations (or when it would otherwise have to wait).
+    //! This keeps the cache lines holding the indices from bouncing between
+    //! the two threads on every element.
+    //!
+    //! When the queue is full, the producer waits until the consumer makes
+    //! room, which propagates backpressure upstream. Waiting operations give
+    //! up as soon as the `cancelled` flag they are given becomes true.
+    template <typename T>
+    class spsc_queue {
+        using storage_t = typename std::aligned_storage<
+            sizeof(T), alignof(T)
+        >::type;
+
+        std::size_t capacity_;
+        std::size_t mask_;
+        std::size_t batch_;
+        std::unique_ptr<storage_t[]> slots_;
+
+        // Written by the producer.
+        alignas(64) std::atomic<std::size_t> tail_{0};
+        std::atomic<bool> closed_{false};
+
+        // Written by the consumer.
+        alignas(64) std::atomic<std::size_t> head_{0};
+
+        // Private to the producer.
+        alignas(64) std::size_t tail_local_ = 0;
+        std::size_t head_cache_ = 0;
+
+        // Private to the consumer.
+        alignas(64) std::size_t head_local_ = 0;
+        std::size_t tail_cache_ = 0;
+
+        T* slot(std::size_t i)
+        { return reinterpret_cast<T*>(&slots_[i & mask_]); }
+
+        static void pause(unsigned& spins) {
+            if (++spins > 64)
+                std::this_thread::yield();
+        }
+
+    public:
+        spsc_queue(std::size_t capacity, std::size_t batch) {
+            capacity_ = 1;
+            while (capacity_ < capacity)
+                capacity_ *= 2;
+            mask_ = capacity_ - 1;
+            batch_ = batch == 0 ? 1 : batch > capacity_ ? capacity_ : batch;
+            slots_.reset(new storage_t[capacity_]);
+        }
+
+        spsc_queue(spsc_queue const&) = delete;
+        spsc_queue& operator=(spsc_queue const&) = delete;
+
+        // Must only be called once both sides are done with the queue.
+        ~spsc_queue() {
+            for (std::size_t i = head_local_; i != tail_local_; ++i)
+                slot(i)->~T();
+        }
+
+        //////////////////////////////////////////////////////////////////////
+        // Producer side
+        //////////////////////////////////////////////////////////////////////
+        //! Push an element, waiting while the queue is full. Returns false
+        //! if the wait was cancelled, in which case nothing is pushed.
+        template <typename X>
+        bool push(X&& x, std::atomic<bool> const& cancelled) {
+            unsigned spins = 0;
+            while (tail_local_ - head_cache_ == capacity_) {
+                head_cache_ = head_.load(std::memory_order_acquire);
+                if (tail_local_ - head_cache_ != capacity_)
+                    break;
+                flush();
+                if (cancelled.load(std::memory_order_relaxed))
+                    return false;
+                pause(spins);
+            }
+
+            ::new (static_cast<void*>(slot(tail_local_))) T(static_cast<X&&>(x));
+            ++tail_local_;
+            if (tail_local_ - tail_.load(std::memory_order_relaxed) >= batch_)
+                flush();
+            return true;
+        }
+
+        //! Make all the elements pushed so far visible to the consumer.
+        void flush()
+        { tail_.store(tail_local_, std::memory_order_release); }
+
+        //! Signal that no more elements will be pushed.
+        void close() {
+            flush();
+            closed_.store(true, std::memory_order_release);
+        }
+
+        //////////////////////////////////////////////////////////////////////
+        // Consumer side
+        //////////////////////////////////////////////////////////////////////
+        //! Wait until an element is available, calling `idle()` once before
+        //! starting to wait. Returns false when the queue has been closed
+        //! and all its elements were consumed, or when the wait was
+        //! cancelled.
+        template <typename Idle>
+        bool wait(std::atomic<bool> const& cancelled, Idle&& idle) {
+            if (head_local_ != tail_cache_)
+                return true;
+
+            bool idled = false;
+            unsigned spins = 0;
+            while (true) {
+                tail_cache_ = tail_.load(std::memory_order_acquire);
+                if (head_local_ != tail_cache_)
+                    return true;
+
+                head_.store(head_local_, std::memory_order_release);
+                if (closed_.load(std::memory_order_acquire)) {
+                    tail_cache_ = tail_.load(std::memory_order_acquire);
+                    return head_local_ != tail_cache_;
+                }
+                if (cancelled.load(std::memory_order_relaxed))
+                    return false;
+                if (!idled) {
+                    idle();
+                    idled = true;
+                }
+                pause(spins);
+            }
+        }
+
+        //! Access the oldest element; `wait` must have returned true.
+        T& front()
+        { return *slot(head_local_); }
+
+        //! Destroy the oldest element; `wait` must have returned true.
+        void pop() {
+            slot(head_local_)->~T();
+            ++head_local_;
+            if (head_local_ - head_.load(std::memory_order_relaxed) >= batch_)
+                head_.store(head_local_, std::memory_order_release);
+        }
+    };
+}}} // end namespace boost::hana::detail
+
+#endif // !BOOST_HANA_DETAIL_SPSC_QUEUE_HPP
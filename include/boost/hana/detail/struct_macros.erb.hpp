@@ -5,17 +5,18 @@
     be controlled with the 'MAX_NUMBER_OF_MEMBERS' variable,
     which can be set when calling ERB to generate the header:
 
-        export MAX_NUMBER_OF_MEMBERS=55; erb struct_macros.erb.hpp
+        export MAX_NUMBER_OF_MEMBERS=300; erb struct_macros.erb.hpp
 
-    'MAX_NUMBER_OF_MEMBERS' must be <= 62, otherwise an error is triggered.
-    In case 'MAX_NUMBER_OF_MEMBERS' is not specified, it defaults to 40.
+    In case 'MAX_NUMBER_OF_MEMBERS' is not specified, it defaults to 256.
+    The size of the generated header grows linearly with it, and so does
+    the cost of expanding the macros with n members, up to a log(n) factor.
 
     [1]: http://en.wikipedia.org/wiki/ERuby
 %>
 
 <%
-    MAX_NUMBER_OF_MEMBERS = (ENV["MAX_NUMBER_OF_MEMBERS"] || 40).to_i
-    raise "MAX_NUMBER_OF_MEMBERS must be <= 62" if MAX_NUMBER_OF_MEMBERS > 62
+    MAX_NUMBER_OF_MEMBERS = (ENV["MAX_NUMBER_OF_MEMBERS"] || 256).to_i
+    MAX_NUMBER_OF_ARGS = MAX_NUMBER_OF_MEMBERS + 1
 %>
 
 /*!
@@ -74,95 +75,112 @@ namespace boost { namespace hana { namespace struct_detail {
 }}}
 
 //////////////////////////////////////////////////////////////////////////////
-// BOOST_HANA_ADAPT_STRUCT
+// Iteration over the members
+//
+// `BOOST_HANA_STRUCT_FOR_EACH(N, MACRO, SEP, TYPE, m1, ..., mn)`, where
+// `N == n + 1`, expands to `MACRO(TYPE, 0, m1) SEP() ... SEP() MACRO(TYPE,
+// n - 1, mn)`. The members are handled in blocks whose sizes are the powers
+// of two making up `n`, largest first. `BOOST_HANA_STRUCT_BLOCK_k` expands
+// a block of `k` members, and `BOOST_HANA_STRUCT_TAKE_k` expands a block of
+// `k` members and hands the rest to the macro handling them. Hence, the
+// remaining members are only rescanned once per block, i.e. at most log(n)
+// times, and the size of this header grows linearly with the maximum number
+// of members. The index of a member is `I + i`, where `I` is the sum of the
+// sizes of the previous blocks.
 //////////////////////////////////////////////////////////////////////////////
-#define BOOST_HANA_ADAPT_STRUCT(...)                                        \
-  BOOST_HANA_ADAPT_STRUCT_IMPL(BOOST_HANA_PP_NARG(__VA_ARGS__), __VA_ARGS__)\
-  static_assert(true, "force the usage of a trailing semicolon")            \
-/**/
+#define BOOST_HANA_STRUCT_NARG(...) \
+    BOOST_HANA_STRUCT_NARG_IMPL(__VA_ARGS__, <%= (1..MAX_NUMBER_OF_ARGS).to_a.reverse.join(', ') %>,)
+
+#define BOOST_HANA_STRUCT_NARG_IMPL(<%= (0...MAX_NUMBER_OF_ARGS).map { |i| "e#{i}" }.join(', ') %>, N, ...) N
 
-#define BOOST_HANA_ADAPT_STRUCT_IMPL(N, ...) \
-  BOOST_HANA_PP_CONCAT(BOOST_HANA_ADAPT_STRUCT_IMPL_, N)(__VA_ARGS__)
+#define BOOST_HANA_STRUCT_FRONT(...) BOOST_HANA_STRUCT_FRONT_IMPL(__VA_ARGS__, )
+#define BOOST_HANA_STRUCT_FRONT_IMPL(TYPE, ...) TYPE
+
+#define BOOST_HANA_STRUCT_COMMA() ,
+#define BOOST_HANA_STRUCT_NOTHING()
+
+#define BOOST_HANA_STRUCT_FOR_EACH(N, MACRO, SEP, ...) \
+    BOOST_HANA_PP_CONCAT(BOOST_HANA_STRUCT_FOR_EACH_, N)(MACRO, SEP, 0, __VA_ARGS__)
+<%
+    blocks = (0...MAX_NUMBER_OF_MEMBERS.bit_length).map { |j| 2**j }
+    params = ->(k) { (1..k).map { |i| "m#{i}" }.join(', ') }
+%>
+<% blocks.each do |k| %>
+#define BOOST_HANA_STRUCT_BLOCK_<%= k %>(MACRO, SEP, I, TYPE, <%= params[k] %>) <%= (1..k).map { |i| "MACRO(TYPE, I + #{i - 1}, m#{i})" }.join(' SEP() ') %><% end %>
+<% blocks.select { |k| k < MAX_NUMBER_OF_MEMBERS }.each do |k| %>
+#define BOOST_HANA_STRUCT_TAKE_<%= k %>(NEXT, MACRO, SEP, I, TYPE, <%= params[k] %>, ...) BOOST_HANA_STRUCT_BLOCK_<%= k %>(MACRO, SEP, I, TYPE, <%= params[k] %>) SEP() NEXT(MACRO, SEP, I + <%= k %>, TYPE, __VA_ARGS__)<% end %>
+
+#define BOOST_HANA_STRUCT_FOR_EACH_1(MACRO, SEP, I, TYPE)
+<% (1..MAX_NUMBER_OF_MEMBERS).each do |n|
+    k = 2**(n.bit_length - 1)
+%><% if k == n %>
+#define BOOST_HANA_STRUCT_FOR_EACH_<%= n + 1 %>(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_BLOCK_<%= k %>(MACRO, SEP, I, __VA_ARGS__)<% else %>
+#define BOOST_HANA_STRUCT_FOR_EACH_<%= n + 1 %>(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_<%= k %>(BOOST_HANA_STRUCT_FOR_EACH_<%= n - k + 1 %>, MACRO, SEP, I, __VA_ARGS__)<% end %><% end %>
+
+#define BOOST_HANA_MEMBER_NAME_IMPL(TYPE, i, MEMBER)                        \
+  BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK MEMBER)                        \
+/**/
 
 #define BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, i, MEMBER)                        \
   ::boost::hana::make_pair(                                                 \
     ::boost::hana::struct_detail::prepare_member_name<i, member_names>(),   \
     ::boost::hana::struct_detail::member_ptr<                               \
-      decltype(&TYPE::MEMBER), &TYPE::MEMBER                                \
+      decltype(&TYPE::BOOST_HANA_PP_BACK MEMBER),                           \
+      &TYPE::BOOST_HANA_PP_BACK MEMBER                                      \
     >{}                                                                     \
   )                                                                         \
 /**/
 
-<% (0..MAX_NUMBER_OF_MEMBERS).each do |n|
-    members = (1..n).to_a.map { |i| "m#{i}" }
-    args = ["TYPE"] + members
-    member_pairs = members.map.with_index { |member, i|
-        "BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, #{i}, BOOST_HANA_PP_BACK #{member})"
-    }
-    member_names = members.map { |member|
-        "BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK #{member})"
-    }
-%>
-#define BOOST_HANA_ADAPT_STRUCT_IMPL_<%= n+1 %>(<%= args.join(', ') %>)     \
+#define BOOST_HANA_MEMBER_DECL_IMPL(TYPE, i, MEMBER)                        \
+  BOOST_HANA_PP_DROP_BACK MEMBER BOOST_HANA_PP_BACK MEMBER;                 \
+/**/
+
+#define BOOST_HANA_ACCESSORS_IMPL(N, ...)                                   \
+  static constexpr auto apply() {                                           \
+    struct member_names {                                                   \
+      static constexpr auto get() {                                         \
+        return ::boost::hana::make_tuple(                                   \
+          BOOST_HANA_STRUCT_FOR_EACH(N, BOOST_HANA_MEMBER_NAME_IMPL,        \
+                                     BOOST_HANA_STRUCT_COMMA, __VA_ARGS__)  \
+        );                                                                  \
+      }                                                                     \
+    };                                                                      \
+    return ::boost::hana::make_tuple(                                       \
+      BOOST_HANA_STRUCT_FOR_EACH(N, BOOST_HANA_MEMBER_PAIR_IMPL,            \
+                                 BOOST_HANA_STRUCT_COMMA, __VA_ARGS__)      \
+    );                                                                      \
+  }                                                                         \
+/**/
+
+//////////////////////////////////////////////////////////////////////////////
+// BOOST_HANA_ADAPT_STRUCT
+//////////////////////////////////////////////////////////////////////////////
+#define BOOST_HANA_ADAPT_STRUCT(...)                                        \
+  BOOST_HANA_ADAPT_STRUCT_IMPL(BOOST_HANA_STRUCT_NARG(__VA_ARGS__), __VA_ARGS__)\
+  static_assert(true, "force the usage of a trailing semicolon")            \
+/**/
+
+#define BOOST_HANA_ADAPT_STRUCT_IMPL(N, ...)                                \
     namespace boost { namespace hana {                                      \
         template <>                                                         \
-        struct accessors_impl<TYPE> {                                       \
-            static constexpr auto apply() {                                 \
-                struct member_names {                                       \
-                  static constexpr auto get() {                             \
-                      return ::boost::hana::make_tuple(                     \
-                          <%= member_names.join(', ') %>                    \
-                      );                                                    \
-                  }                                                         \
-                };                                                          \
-                return ::boost::hana::make_tuple(                           \
-                    <%= member_pairs.join(', ') %>                          \
-                );                                                          \
-            }                                                               \
+        struct accessors_impl<BOOST_HANA_STRUCT_FRONT(__VA_ARGS__)> {       \
+            BOOST_HANA_ACCESSORS_IMPL(N, __VA_ARGS__)                       \
         };                                                                  \
     }}                                                                      \
 /**/
-<% end %>
 
 //////////////////////////////////////////////////////////////////////////////
 // BOOST_HANA_DEFINE_STRUCT
 //////////////////////////////////////////////////////////////////////////////
 #define BOOST_HANA_DEFINE_STRUCT(...) \
-    BOOST_HANA_DEFINE_STRUCT_IMPL(BOOST_HANA_PP_NARG(__VA_ARGS__), __VA_ARGS__)
+    BOOST_HANA_DEFINE_STRUCT_IMPL(BOOST_HANA_STRUCT_NARG(__VA_ARGS__), __VA_ARGS__)
 
-#define BOOST_HANA_DEFINE_STRUCT_IMPL(N, ...) \
-    BOOST_HANA_PP_CONCAT(BOOST_HANA_DEFINE_STRUCT_IMPL_, N)(__VA_ARGS__)
-
-<% (0..MAX_NUMBER_OF_MEMBERS).each do |n|
-    members = (1..n).to_a.map { |i| "m#{i}" }
-    args = ["TYPE"] + members
-    member_pairs = members.map.with_index { |member, i|
-        "BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, #{i}, BOOST_HANA_PP_BACK #{member})"
-    }
-    member_decls = members.map { |member|
-        "BOOST_HANA_PP_DROP_BACK #{member} BOOST_HANA_PP_BACK #{member};"
-    }
-    member_names = members.map { |member|
-        "BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK #{member})"
-    }
-%>
-#define BOOST_HANA_DEFINE_STRUCT_IMPL_<%= n+1 %>(<%= args.join(', ') %> )   \
-  <%= member_decls.join(' ') %>                                             \
+#define BOOST_HANA_DEFINE_STRUCT_IMPL(N, ...)                               \
+  BOOST_HANA_STRUCT_FOR_EACH(N, BOOST_HANA_MEMBER_DECL_IMPL,                \
+                             BOOST_HANA_STRUCT_NOTHING, __VA_ARGS__)        \
   struct hana { struct accessors_impl {                                     \
-    static constexpr auto apply() {                                         \
-      struct member_names {                                                 \
-        static constexpr auto get() {                                       \
-            return ::boost::hana::make_tuple(                               \
-                <%= member_names.join(', ') %>                              \
-            );                                                              \
-        }                                                                   \
-      };                                                                    \
-      return ::boost::hana::make_tuple(                                     \
-        <%= member_pairs.join(", ") %>                                      \
-      );                                                                    \
-    }                                                                       \
+    BOOST_HANA_ACCESSORS_IMPL(N, __VA_ARGS__)                               \
   }; }                                                                      \
 /**/
-<% end %>
 
 #endif // !BOOST_HANA_DETAIL_STRUCT_MACROS_HPP
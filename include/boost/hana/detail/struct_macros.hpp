@@ -58,1594 +58,376 @@ namespace boost { namespace hana { namespace struct_detail {
 }}}
 
 //////////////////////////////////////////////////////////////////////////////
-// BOOST_HANA_ADAPT_STRUCT
+// Iteration over the members
+//
+// `BOOST_HANA_STRUCT_FOR_EACH(N, MACRO, SEP, TYPE, m1, ..., mn)`, where
+// `N == n + 1`, expands to `MACRO(TYPE, 0, m1) SEP() ... SEP() MACRO(TYPE,
+// n - 1, mn)`. The members are handled in blocks whose sizes are the powers
+// of two making up `n`, largest first. `BOOST_HANA_STRUCT_BLOCK_k` expands
+// a block of `k` members, and `BOOST_HANA_STRUCT_TAKE_k` expands a block of
+// `k` members and hands the rest to the macro handling them. Hence, the
+// remaining members are only rescanned once per block, i.e. at most log(n)
+// times, and the size of this header grows linearly with the maximum number
+// of members. The index of a member is `I + i`, where `I` is the sum of the
+// sizes of the previous blocks.
 //////////////////////////////////////////////////////////////////////////////
-#define BOOST_HANA_ADAPT_STRUCT(...)                                        \
-  BOOST_HANA_ADAPT_STRUCT_IMPL(BOOST_HANA_PP_NARG(__VA_ARGS__), __VA_ARGS__)\
-  static_assert(true, "force the usage of a trailing semicolon")            \
+#define BOOST_HANA_STRUCT_NARG(...) \
+    BOOST_HANA_STRUCT_NARG_IMPL(__VA_ARGS__, 257, 256, 255, 254, 253, 252, 251, 250, 249, 248, 247, 246, 245, 244, 243, 242, 241, 240, 239, 238, 237, 236, 235, 234, 233, 232, 231, 230, 229, 228, 227, 226, 225, 224, 223, 222, 221, 220, 219, 218, 217, 216, 215, 214, 213, 212, 211, 210, 209, 208, 207, 206, 205, 204, 203, 202, 201, 200, 199, 198, 197, 196, 195, 194, 193, 192, 191, 190, 189, 188, 187, 186, 185, 184, 183, 182, 181, 180, 179, 178, 177, 176, 175, 174, 173, 172, 171, 170, 169, 168, 167, 166, 165, 164, 163, 162, 161, 160, 159, 158, 157, 156, 155, 154, 153, 152, 151, 150, 149, 148, 147, 146, 145, 144, 143, 142, 141, 140, 139, 138, 137, 136, 135, 134, 133, 132, 131, 130, 129, 128, 127, 126, 125, 124, 123, 122, 121, 120, 119, 118, 117, 116, 115, 114, 113, 112, 111, 110, 109, 108, 107, 106, 105, 104, 103, 102, 101, 100, 99, 98, 97, 96, 95, 94, 93, 92, 91, 90, 89, 88, 87, 86, 85, 84, 83, 82, 81, 80, 79, 78, 77, 76, 75, 74, 73, 72, 71, 70, 69, 68, 67, 66, 65, 64, 63, 62, 61, 60, 59, 58, 57, 56, 55, 54, 53, 52, 51, 50, 49, 48, 47, 46, 45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1,)
+
+#define BOOST_HANA_STRUCT_NARG_IMPL(e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235, e236, e237, e238, e239, e240, e241, e242, e243, e244, e245, e246, e247, e248, e249, e250, e251, e252, e253, e254, e255, e256, N, ...) N
+
+#define BOOST_HANA_STRUCT_FRONT(...) BOOST_HANA_STRUCT_FRONT_IMPL(__VA_ARGS__, )
+#define BOOST_HANA_STRUCT_FRONT_IMPL(TYPE, ...) TYPE
+
+#define BOOST_HANA_STRUCT_COMMA() ,
+#define BOOST_HANA_STRUCT_NOTHING()
+
+#define BOOST_HANA_STRUCT_FOR_EACH(N, MACRO, SEP, ...) \
+    BOOST_HANA_PP_CONCAT(BOOST_HANA_STRUCT_FOR_EACH_, N)(MACRO, SEP, 0, __VA_ARGS__)
+
+
+#define BOOST_HANA_STRUCT_BLOCK_1(MACRO, SEP, I, TYPE, m1) MACRO(TYPE, I + 0, m1)
+#define BOOST_HANA_STRUCT_BLOCK_2(MACRO, SEP, I, TYPE, m1, m2) MACRO(TYPE, I + 0, m1) SEP() MACRO(TYPE, I + 1, m2)
+#define BOOST_HANA_STRUCT_BLOCK_4(MACRO, SEP, I, TYPE, m1, m2, m3, m4) MACRO(TYPE, I + 0, m1) SEP() MACRO(TYPE, I + 1, m2) SEP() MACRO(TYPE, I + 2, m3) SEP() MACRO(TYPE, I + 3, m4)
+#define BOOST_HANA_STRUCT_BLOCK_8(MACRO, SEP, I, TYPE, m1, m2, m3, m4, m5, m6, m7, m8) MACRO(TYPE, I + 0, m1) SEP() MACRO(TYPE, I + 1, m2) SEP() MACRO(TYPE, I + 2, m3) SEP() MACRO(TYPE, I + 3, m4) SEP() MACRO(TYPE, I + 4, m5) SEP() MACRO(TYPE, I + 5, m6) SEP() MACRO(TYPE, I + 6, m7) SEP() MACRO(TYPE, I + 7, m8)
+#define BOOST_HANA_STRUCT_BLOCK_16(MACRO, SEP, I, TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16) MACRO(TYPE, I + 0, m1) SEP() MACRO(TYPE, I + 1, m2) SEP() MACRO(TYPE, I + 2, m3) SEP() MACRO(TYPE, I + 3, m4) SEP() MACRO(TYPE, I + 4, m5) SEP() MACRO(TYPE, I + 5, m6) SEP() MACRO(TYPE, I + 6, m7) SEP() MACRO(TYPE, I + 7, m8) SEP() MACRO(TYPE, I + 8, m9) SEP() MACRO(TYPE, I + 9, m10) SEP() MACRO(TYPE, I + 10, m11) SEP() MACRO(TYPE, I + 11, m12) SEP() MACRO(TYPE, I + 12, m13) SEP() MACRO(TYPE, I + 13, m14) SEP() MACRO(TYPE, I + 14, m15) SEP() MACRO(TYPE, I + 15, m16)
+#define BOOST_HANA_STRUCT_BLOCK_32(MACRO, SEP, I, TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32) MACRO(TYPE, I + 0, m1) SEP() MACRO(TYPE, I + 1, m2) SEP() MACRO(TYPE, I + 2, m3) SEP() MACRO(TYPE, I + 3, m4) SEP() MACRO(TYPE, I + 4, m5) SEP() MACRO(TYPE, I + 5, m6) SEP() MACRO(TYPE, I + 6, m7) SEP() MACRO(TYPE, I + 7, m8) SEP() MACRO(TYPE, I + 8, m9) SEP() MACRO(TYPE, I + 9, m10) SEP() MACRO(TYPE, I + 10, m11) SEP() MACRO(TYPE, I + 11, m12) SEP() MACRO(TYPE, I + 12, m13) SEP() MACRO(TYPE, I + 13, m14) SEP() MACRO(TYPE, I + 14, m15) SEP() MACRO(TYPE, I + 15, m16) SEP() MACRO(TYPE, I + 16, m17) SEP() MACRO(TYPE, I + 17, m18) SEP() MACRO(TYPE, I + 18, m19) SEP() MACRO(TYPE, I + 19, m20) SEP() MACRO(TYPE, I + 20, m21) SEP() MACRO(TYPE, I + 21, m22) SEP() MACRO(TYPE, I + 22, m23) SEP() MACRO(TYPE, I + 23, m24) SEP() MACRO(TYPE, I + 24, m25) SEP() MACRO(TYPE, I + 25, m26) SEP() MACRO(TYPE, I + 26, m27) SEP() MACRO(TYPE, I + 27, m28) SEP() MACRO(TYPE, I + 28, m29) SEP() MACRO(TYPE, I + 29, m30) SEP() MACRO(TYPE, I + 30, m31) SEP() MACRO(TYPE, I + 31, m32)
+#define BOOST_HANA_STRUCT_BLOCK_64(MACRO, SEP, I, TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40, m41, m42, m43, m44, m45, m46, m47, m48, m49, m50, m51, m52, m53, m54, m55, m56, m57, m58, m59, m60, m61, m62, m63, m64) MACRO(TYPE, I + 0, m1) SEP() MACRO(TYPE, I + 1, m2) SEP() MACRO(TYPE, I + 2, m3) SEP() MACRO(TYPE, I + 3, m4) SEP() MACRO(TYPE, I + 4, m5) SEP() MACRO(TYPE, I + 5, m6) SEP() MACRO(TYPE, I + 6, m7) SEP() MACRO(TYPE, I + 7, m8) SEP() MACRO(TYPE, I + 8, m9) SEP() MACRO(TYPE, I + 9, m10) SEP() MACRO(TYPE, I + 10, m11) SEP() MACRO(TYPE, I + 11, m12) SEP() MACRO(TYPE, I + 12, m13) SEP() MACRO(TYPE, I + 13, m14) SEP() MACRO(TYPE, I + 14, m15) SEP() MACRO(TYPE, I + 15, m16) SEP() MACRO(TYPE, I + 16, m17) SEP() MACRO(TYPE, I + 17, m18) SEP() MACRO(TYPE, I + 18, m19) SEP() MACRO(TYPE, I + 19, m20) SEP() MACRO(TYPE, I + 20, m21) SEP() MACRO(TYPE, I + 21, m22) SEP() MACRO(TYPE, I + 22, m23) SEP() MACRO(TYPE, I + 23, m24) SEP() MACRO(TYPE, I + 24, m25) SEP() MACRO(TYPE, I + 25, m26) SEP() MACRO(TYPE, I + 26, m27) SEP() MACRO(TYPE, I + 27, m28) SEP() MACRO(TYPE, I + 28, m29) SEP() MACRO(TYPE, I + 29, m30) SEP() MACRO(TYPE, I + 30, m31) SEP() MACRO(TYPE, I + 31, m32) SEP() MACRO(TYPE, I + 32, m33) SEP() MACRO(TYPE, I + 33, m34) SEP() MACRO(TYPE, I + 34, m35) SEP() MACRO(TYPE, I + 35, m36) SEP() MACRO(TYPE, I + 36, m37) SEP() MACRO(TYPE, I + 37, m38) SEP() MACRO(TYPE, I + 38, m39) SEP() MACRO(TYPE, I + 39, m40) SEP() MACRO(TYPE, I + 40, m41) SEP() MACRO(TYPE, I + 41, m42) SEP() MACRO(TYPE, I + 42, m43) SEP() MACRO(TYPE, I + 43, m44) SEP() MACRO(TYPE, I + 44, m45) SEP() MACRO(TYPE, I + 45, m46) SEP() MACRO(TYPE, I + 46, m47) SEP() MACRO(TYPE, I + 47, m48) SEP() MACRO(TYPE, I + 48, m49) SEP() MACRO(TYPE, I + 49, m50) SEP() MACRO(TYPE, I + 50, m51) SEP() MACRO(TYPE, I + 51, m52) SEP() MACRO(TYPE, I + 52, m53) SEP() MACRO(TYPE, I + 53, m54) SEP() MACRO(TYPE, I + 54, m55) SEP() MACRO(TYPE, I + 55, m56) SEP() MACRO(TYPE, I + 56, m57) SEP() MACRO(TYPE, I + 57, m58) SEP() MACRO(TYPE, I + 58, m59) SEP() MACRO(TYPE, I + 59, m60) SEP() MACRO(TYPE, I + 60, m61) SEP() MACRO(TYPE, I + 61, m62) SEP() MACRO(TYPE, I + 62, m63) SEP() MACRO(TYPE, I + 63, m64)
+#define BOOST_HANA_STRUCT_BLOCK_128(MACRO, SEP, I, TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40, m41, m42, m43, m44, m45, m46, m47, m48, m49, m50, m51, m52, m53, m54, m55, m56, m57, m58, m59, m60, m61, m62, m63, m64, m65, m66, m67, m68, m69, m70, m71, m72, m73, m74, m75, m76, m77, m78, m79, m80, m81, m82, m83, m84, m85, m86, m87, m88, m89, m90, m91, m92, m93, m94, m95, m96, m97, m98, m99, m100, m101, m102, m103, m104, m105, m106, m107, m108, m109, m110, m111, m112, m113, m114, m115, m116, m117, m118, m119, m120, m121, m122, m123, m124, m125, m126, m127, m128) MACRO(TYPE, I + 0, m1) SEP() MACRO(TYPE, I + 1, m2) SEP() MACRO(TYPE, I + 2, m3) SEP() MACRO(TYPE, I + 3, m4) SEP() MACRO(TYPE, I + 4, m5) SEP() MACRO(TYPE, I + 5, m6) SEP() MACRO(TYPE, I + 6, m7) SEP() MACRO(TYPE, I + 7, m8) SEP() MACRO(TYPE, I + 8, m9) SEP() MACRO(TYPE, I + 9, m10) SEP() MACRO(TYPE, I + 10, m11) SEP() MACRO(TYPE, I + 11, m12) SEP() MACRO(TYPE, I + 12, m13) SEP() MACRO(TYPE, I + 13, m14) SEP() MACRO(TYPE, I + 14, m15) SEP() MACRO(TYPE, I + 15, m16) SEP() MACRO(TYPE, I + 16, m17) SEP() MACRO(TYPE, I + 17, m18) SEP() MACRO(TYPE, I + 18, m19) SEP() MACRO(TYPE, I + 19, m20) SEP() MACRO(TYPE, I + 20, m21) SEP() MACRO(TYPE, I + 21, m22) SEP() MACRO(TYPE, I + 22, m23) SEP() MACRO(TYPE, I + 23, m24) SEP() MACRO(TYPE, I + 24, m25) SEP() MACRO(TYPE, I + 25, m26) SEP() MACRO(TYPE, I + 26, m27) SEP() MACRO(TYPE, I + 27, m28) SEP() MACRO(TYPE, I + 28, m29) SEP() MACRO(TYPE, I + 29, m30) SEP() MACRO(TYPE, I + 30, m31) SEP() MACRO(TYPE, I + 31, m32) SEP() MACRO(TYPE, I + 32, m33) SEP() MACRO(TYPE, I + 33, m34) SEP() MACRO(TYPE, I + 34, m35) SEP() MACRO(TYPE, I + 35, m36) SEP() MACRO(TYPE, I + 36, m37) SEP() MACRO(TYPE, I + 37, m38) SEP() MACRO(TYPE, I + 38, m39) SEP() MACRO(TYPE, I + 39, m40) SEP() MACRO(TYPE, I + 40, m41) SEP() MACRO(TYPE, I + 41, m42) SEP() MACRO(TYPE, I + 42, m43) SEP() MACRO(TYPE, I + 43, m44) SEP() MACRO(TYPE, I + 44, m45) SEP() MACRO(TYPE, I + 45, m46) SEP() MACRO(TYPE, I + 46, m47) SEP() MACRO(TYPE, I + 47, m48) SEP() MACRO(TYPE, I + 48, m49) SEP() MACRO(TYPE, I + 49, m50) SEP() MACRO(TYPE, I + 50, m51) SEP() MACRO(TYPE, I + 51, m52) SEP() MACRO(TYPE, I + 52, m53) SEP() MACRO(TYPE, I + 53, m54) SEP() MACRO(TYPE, I + 54, m55) SEP() MACRO(TYPE, I + 55, m56) SEP() MACRO(TYPE, I + 56, m57) SEP() MACRO(TYPE, I + 57, m58) SEP() MACRO(TYPE, I + 58, m59) SEP() MACRO(TYPE, I + 59, m60) SEP() MACRO(TYPE, I + 60, m61) SEP() MACRO(TYPE, I + 61, m62) SEP() MACRO(TYPE, I + 62, m63) SEP() MACRO(TYPE, I + 63, m64) SEP() MACRO(TYPE, I + 64, m65) SEP() MACRO(TYPE, I + 65, m66) SEP() MACRO(TYPE, I + 66, m67) SEP() MACRO(TYPE, I + 67, m68) SEP() MACRO(TYPE, I + 68, m69) SEP() MACRO(TYPE, I + 69, m70) SEP() MACRO(TYPE, I + 70, m71) SEP() MACRO(TYPE, I + 71, m72) SEP() MACRO(TYPE, I + 72, m73) SEP() MACRO(TYPE, I + 73, m74) SEP() MACRO(TYPE, I + 74, m75) SEP() MACRO(TYPE, I + 75, m76) SEP() MACRO(TYPE, I + 76, m77) SEP() MACRO(TYPE, I + 77, m78) SEP() MACRO(TYPE, I + 78, m79) SEP() MACRO(TYPE, I + 79, m80) SEP() MACRO(TYPE, I + 80, m81) SEP() MACRO(TYPE, I + 81, m82) SEP() MACRO(TYPE, I + 82, m83) SEP() MACRO(TYPE, I + 83, m84) SEP() MACRO(TYPE, I + 84, m85) SEP() MACRO(TYPE, I + 85, m86) SEP() MACRO(TYPE, I + 86, m87) SEP() MACRO(TYPE, I + 87, m88) SEP() MACRO(TYPE, I + 88, m89) SEP() MACRO(TYPE, I + 89, m90) SEP() MACRO(TYPE, I + 90, m91) SEP() MACRO(TYPE, I + 91, m92) SEP() MACRO(TYPE, I + 92, m93) SEP() MACRO(TYPE, I + 93, m94) SEP() MACRO(TYPE, I + 94, m95) SEP() MACRO(TYPE, I + 95, m96) SEP() MACRO(TYPE, I + 96, m97) SEP() MACRO(TYPE, I + 97, m98) SEP() MACRO(TYPE, I + 98, m99) SEP() MACRO(TYPE, I + 99, m100) SEP() MACRO(TYPE, I + 100, m101) SEP() MACRO(TYPE, I + 101, m102) SEP() MACRO(TYPE, I + 102, m103) SEP() MACRO(TYPE, I + 103, m104) SEP() MACRO(TYPE, I + 104, m105) SEP() MACRO(TYPE, I + 105, m106) SEP() MACRO(TYPE, I + 106, m107) SEP() MACRO(TYPE, I + 107, m108) SEP() MACRO(TYPE, I + 108, m109) SEP() MACRO(TYPE, I + 109, m110) SEP() MACRO(TYPE, I + 110, m111) SEP() MACRO(TYPE, I + 111, m112) SEP() MACRO(TYPE, I + 112, m113) SEP() MACRO(TYPE, I + 113, m114) SEP() MACRO(TYPE, I + 114, m115) SEP() MACRO(TYPE, I + 115, m116) SEP() MACRO(TYPE, I + 116, m117) SEP() MACRO(TYPE, I + 117, m118) SEP() MACRO(TYPE, I + 118, m119) SEP() MACRO(TYPE, I + 119, m120) SEP() MACRO(TYPE, I + 120, m121) SEP() MACRO(TYPE, I + 121, m122) SEP() MACRO(TYPE, I + 122, m123) SEP() MACRO(TYPE, I + 123, m124) SEP() MACRO(TYPE, I + 124, m125) SEP() MACRO(TYPE, I + 125, m126) SEP() MACRO(TYPE, I + 126, m127) SEP() MACRO(TYPE, I + 127, m128)
+#define BOOST_HANA_STRUCT_BLOCK_256(MACRO, SEP, I, TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40, m41, m42, m43, m44, m45, m46, m47, m48, m49, m50, m51, m52, m53, m54, m55, m56, m57, m58, m59, m60, m61, m62, m63, m64, m65, m66, m67, m68, m69, m70, m71, m72, m73, m74, m75, m76, m77, m78, m79, m80, m81, m82, m83, m84, m85, m86, m87, m88, m89, m90, m91, m92, m93, m94, m95, m96, m97, m98, m99, m100, m101, m102, m103, m104, m105, m106, m107, m108, m109, m110, m111, m112, m113, m114, m115, m116, m117, m118, m119, m120, m121, m122, m123, m124, m125, m126, m127, m128, m129, m130, m131, m132, m133, m134, m135, m136, m137, m138, m139, m140, m141, m142, m143, m144, m145, m146, m147, m148, m149, m150, m151, m152, m153, m154, m155, m156, m157, m158, m159, m160, m161, m162, m163, m164, m165, m166, m167, m168, m169, m170, m171, m172, m173, m174, m175, m176, m177, m178, m179, m180, m181, m182, m183, m184, m185, m186, m187, m188, m189, m190, m191, m192, m193, m194, m195, m196, m197, m198, m199, m200, m201, m202, m203, m204, m205, m206, m207, m208, m209, m210, m211, m212, m213, m214, m215, m216, m217, m218, m219, m220, m221, m222, m223, m224, m225, m226, m227, m228, m229, m230, m231, m232, m233, m234, m235, m236, m237, m238, m239, m240, m241, m242, m243, m244, m245, m246, m247, m248, m249, m250, m251, m252, m253, m254, m255, m256) MACRO(TYPE, I + 0, m1) SEP() MACRO(TYPE, I + 1, m2) SEP() MACRO(TYPE, I + 2, m3) SEP() MACRO(TYPE, I + 3, m4) SEP() MACRO(TYPE, I + 4, m5) SEP() MACRO(TYPE, I + 5, m6) SEP() MACRO(TYPE, I + 6, m7) SEP() MACRO(TYPE, I + 7, m8) SEP() MACRO(TYPE, I + 8, m9) SEP() MACRO(TYPE, I + 9, m10) SEP() MACRO(TYPE, I + 10, m11) SEP() MACRO(TYPE, I + 11, m12) SEP() MACRO(TYPE, I + 12, m13) SEP() MACRO(TYPE, I + 13, m14) SEP() MACRO(TYPE, I + 14, m15) SEP() MACRO(TYPE, I + 15, m16) SEP() MACRO(TYPE, I + 16, m17) SEP() MACRO(TYPE, I + 17, m18) SEP() MACRO(TYPE, I + 18, m19) SEP() MACRO(TYPE, I + 19, m20) SEP() MACRO(TYPE, I + 20, m21) SEP() MACRO(TYPE, I + 21, m22) SEP() MACRO(TYPE, I + 22, m23) SEP() MACRO(TYPE, I + 23, m24) SEP() MACRO(TYPE, I + 24, m25) SEP() MACRO(TYPE, I + 25, m26) SEP() MACRO(TYPE, I + 26, m27) SEP() MACRO(TYPE, I + 27, m28) SEP() MACRO(TYPE, I + 28, m29) SEP() MACRO(TYPE, I + 29, m30) SEP() MACRO(TYPE, I + 30, m31) SEP() MACRO(TYPE, I + 31, m32) SEP() MACRO(TYPE, I + 32, m33) SEP() MACRO(TYPE, I + 33, m34) SEP() MACRO(TYPE, I + 34, m35) SEP() MACRO(TYPE, I + 35, m36) SEP() MACRO(TYPE, I + 36, m37) SEP() MACRO(TYPE, I + 37, m38) SEP() MACRO(TYPE, I + 38, m39) SEP() MACRO(TYPE, I + 39, m40) SEP() MACRO(TYPE, I + 40, m41) SEP() MACRO(TYPE, I + 41, m42) SEP() MACRO(TYPE, I + 42, m43) SEP() MACRO(TYPE, I + 43, m44) SEP() MACRO(TYPE, I + 44, m45) SEP() MACRO(TYPE, I + 45, m46) SEP() MACRO(TYPE, I + 46, m47) SEP() MACRO(TYPE, I + 47, m48) SEP() MACRO(TYPE, I + 48, m49) SEP() MACRO(TYPE, I + 49, m50) SEP() MACRO(TYPE, I + 50, m51) SEP() MACRO(TYPE, I + 51, m52) SEP() MACRO(TYPE, I + 52, m53) SEP() MACRO(TYPE, I + 53, m54) SEP() MACRO(TYPE, I + 54, m55) SEP() MACRO(TYPE, I + 55, m56) SEP() MACRO(TYPE, I + 56, m57) SEP() MACRO(TYPE, I + 57, m58) SEP() MACRO(TYPE, I + 58, m59) SEP() MACRO(TYPE, I + 59, m60) SEP() MACRO(TYPE, I + 60, m61) SEP() MACRO(TYPE, I + 61, m62) SEP() MACRO(TYPE, I + 62, m63) SEP() MACRO(TYPE, I + 63, m64) SEP() MACRO(TYPE, I + 64, m65) SEP() MACRO(TYPE, I + 65, m66) SEP() MACRO(TYPE, I + 66, m67) SEP() MACRO(TYPE, I + 67, m68) SEP() MACRO(TYPE, I + 68, m69) SEP() MACRO(TYPE, I + 69, m70) SEP() MACRO(TYPE, I + 70, m71) SEP() MACRO(TYPE, I + 71, m72) SEP() MACRO(TYPE, I + 72, m73) SEP() MACRO(TYPE, I + 73, m74) SEP() MACRO(TYPE, I + 74, m75) SEP() MACRO(TYPE, I + 75, m76) SEP() MACRO(TYPE, I + 76, m77) SEP() MACRO(TYPE, I + 77, m78) SEP() MACRO(TYPE, I + 78, m79) SEP() MACRO(TYPE, I + 79, m80) SEP() MACRO(TYPE, I + 80, m81) SEP() MACRO(TYPE, I + 81, m82) SEP() MACRO(TYPE, I + 82, m83) SEP() MACRO(TYPE, I + 83, m84) SEP() MACRO(TYPE, I + 84, m85) SEP() MACRO(TYPE, I + 85, m86) SEP() MACRO(TYPE, I + 86, m87) SEP() MACRO(TYPE, I + 87, m88) SEP() MACRO(TYPE, I + 88, m89) SEP() MACRO(TYPE, I + 89, m90) SEP() MACRO(TYPE, I + 90, m91) SEP() MACRO(TYPE, I + 91, m92) SEP() MACRO(TYPE, I + 92, m93) SEP() MACRO(TYPE, I + 93, m94) SEP() MACRO(TYPE, I + 94, m95) SEP() MACRO(TYPE, I + 95, m96) SEP() MACRO(TYPE, I + 96, m97) SEP() MACRO(TYPE, I + 97, m98) SEP() MACRO(TYPE, I + 98, m99) SEP() MACRO(TYPE, I + 99, m100) SEP() MACRO(TYPE, I + 100, m101) SEP() MACRO(TYPE, I + 101, m102) SEP() MACRO(TYPE, I + 102, m103) SEP() MACRO(TYPE, I + 103, m104) SEP() MACRO(TYPE, I + 104, m105) SEP() MACRO(TYPE, I + 105, m106) SEP() MACRO(TYPE, I + 106, m107) SEP() MACRO(TYPE, I + 107, m108) SEP() MACRO(TYPE, I + 108, m109) SEP() MACRO(TYPE, I + 109, m110) SEP() MACRO(TYPE, I + 110, m111) SEP() MACRO(TYPE, I + 111, m112) SEP() MACRO(TYPE, I + 112, m113) SEP() MACRO(TYPE, I + 113, m114) SEP() MACRO(TYPE, I + 114, m115) SEP() MACRO(TYPE, I + 115, m116) SEP() MACRO(TYPE, I + 116, m117) SEP() MACRO(TYPE, I + 117, m118) SEP() MACRO(TYPE, I + 118, m119) SEP() MACRO(TYPE, I + 119, m120) SEP() MACRO(TYPE, I + 120, m121) SEP() MACRO(TYPE, I + 121, m122) SEP() MACRO(TYPE, I + 122, m123) SEP() MACRO(TYPE, I + 123, m124) SEP() MACRO(TYPE, I + 124, m125) SEP() MACRO(TYPE, I + 125, m126) SEP() MACRO(TYPE, I + 126, m127) SEP() MACRO(TYPE, I + 127, m128) SEP() MACRO(TYPE, I + 128, m129) SEP() MACRO(TYPE, I + 129, m130) SEP() MACRO(TYPE, I + 130, m131) SEP() MACRO(TYPE, I + 131, m132) SEP() MACRO(TYPE, I + 132, m133) SEP() MACRO(TYPE, I + 133, m134) SEP() MACRO(TYPE, I + 134, m135) SEP() MACRO(TYPE, I + 135, m136) SEP() MACRO(TYPE, I + 136, m137) SEP() MACRO(TYPE, I + 137, m138) SEP() MACRO(TYPE, I + 138, m139) SEP() MACRO(TYPE, I + 139, m140) SEP() MACRO(TYPE, I + 140, m141) SEP() MACRO(TYPE, I + 141, m142) SEP() MACRO(TYPE, I + 142, m143) SEP() MACRO(TYPE, I + 143, m144) SEP() MACRO(TYPE, I + 144, m145) SEP() MACRO(TYPE, I + 145, m146) SEP() MACRO(TYPE, I + 146, m147) SEP() MACRO(TYPE, I + 147, m148) SEP() MACRO(TYPE, I + 148, m149) SEP() MACRO(TYPE, I + 149, m150) SEP() MACRO(TYPE, I + 150, m151) SEP() MACRO(TYPE, I + 151, m152) SEP() MACRO(TYPE, I + 152, m153) SEP() MACRO(TYPE, I + 153, m154) SEP() MACRO(TYPE, I + 154, m155) SEP() MACRO(TYPE, I + 155, m156) SEP() MACRO(TYPE, I + 156, m157) SEP() MACRO(TYPE, I + 157, m158) SEP() MACRO(TYPE, I + 158, m159) SEP() MACRO(TYPE, I + 159, m160) SEP() MACRO(TYPE, I + 160, m161) SEP() MACRO(TYPE, I + 161, m162) SEP() MACRO(TYPE, I + 162, m163) SEP() MACRO(TYPE, I + 163, m164) SEP() MACRO(TYPE, I + 164, m165) SEP() MACRO(TYPE, I + 165, m166) SEP() MACRO(TYPE, I + 166, m167) SEP() MACRO(TYPE, I + 167, m168) SEP() MACRO(TYPE, I + 168, m169) SEP() MACRO(TYPE, I + 169, m170) SEP() MACRO(TYPE, I + 170, m171) SEP() MACRO(TYPE, I + 171, m172) SEP() MACRO(TYPE, I + 172, m173) SEP() MACRO(TYPE, I + 173, m174) SEP() MACRO(TYPE, I + 174, m175) SEP() MACRO(TYPE, I + 175, m176) SEP() MACRO(TYPE, I + 176, m177) SEP() MACRO(TYPE, I + 177, m178) SEP() MACRO(TYPE, I + 178, m179) SEP() MACRO(TYPE, I + 179, m180) SEP() MACRO(TYPE, I + 180, m181) SEP() MACRO(TYPE, I + 181, m182) SEP() MACRO(TYPE, I + 182, m183) SEP() MACRO(TYPE, I + 183, m184) SEP() MACRO(TYPE, I + 184, m185) SEP() MACRO(TYPE, I + 185, m186) SEP() MACRO(TYPE, I + 186, m187) SEP() MACRO(TYPE, I + 187, m188) SEP() MACRO(TYPE, I + 188, m189) SEP() MACRO(TYPE, I + 189, m190) SEP() MACRO(TYPE, I + 190, m191) SEP() MACRO(TYPE, I + 191, m192) SEP() MACRO(TYPE, I + 192, m193) SEP() MACRO(TYPE, I + 193, m194) SEP() MACRO(TYPE, I + 194, m195) SEP() MACRO(TYPE, I + 195, m196) SEP() MACRO(TYPE, I + 196, m197) SEP() MACRO(TYPE, I + 197, m198) SEP() MACRO(TYPE, I + 198, m199) SEP() MACRO(TYPE, I + 199, m200) SEP() MACRO(TYPE, I + 200, m201) SEP() MACRO(TYPE, I + 201, m202) SEP() MACRO(TYPE, I + 202, m203) SEP() MACRO(TYPE, I + 203, m204) SEP() MACRO(TYPE, I + 204, m205) SEP() MACRO(TYPE, I + 205, m206) SEP() MACRO(TYPE, I + 206, m207) SEP() MACRO(TYPE, I + 207, m208) SEP() MACRO(TYPE, I + 208, m209) SEP() MACRO(TYPE, I + 209, m210) SEP() MACRO(TYPE, I + 210, m211) SEP() MACRO(TYPE, I + 211, m212) SEP() MACRO(TYPE, I + 212, m213) SEP() MACRO(TYPE, I + 213, m214) SEP() MACRO(TYPE, I + 214, m215) SEP() MACRO(TYPE, I + 215, m216) SEP() MACRO(TYPE, I + 216, m217) SEP() MACRO(TYPE, I + 217, m218) SEP() MACRO(TYPE, I + 218, m219) SEP() MACRO(TYPE, I + 219, m220) SEP() MACRO(TYPE, I + 220, m221) SEP() MACRO(TYPE, I + 221, m222) SEP() MACRO(TYPE, I + 222, m223) SEP() MACRO(TYPE, I + 223, m224) SEP() MACRO(TYPE, I + 224, m225) SEP() MACRO(TYPE, I + 225, m226) SEP() MACRO(TYPE, I + 226, m227) SEP() MACRO(TYPE, I + 227, m228) SEP() MACRO(TYPE, I + 228, m229) SEP() MACRO(TYPE, I + 229, m230) SEP() MACRO(TYPE, I + 230, m231) SEP() MACRO(TYPE, I + 231, m232) SEP() MACRO(TYPE, I + 232, m233) SEP() MACRO(TYPE, I + 233, m234) SEP() MACRO(TYPE, I + 234, m235) SEP() MACRO(TYPE, I + 235, m236) SEP() MACRO(TYPE, I + 236, m237) SEP() MACRO(TYPE, I + 237, m238) SEP() MACRO(TYPE, I + 238, m239) SEP() MACRO(TYPE, I + 239, m240) SEP() MACRO(TYPE, I + 240, m241) SEP() MACRO(TYPE, I + 241, m242) SEP() MACRO(TYPE, I + 242, m243) SEP() MACRO(TYPE, I + 243, m244) SEP() MACRO(TYPE, I + 244, m245) SEP() MACRO(TYPE, I + 245, m246) SEP() MACRO(TYPE, I + 246, m247) SEP() MACRO(TYPE, I + 247, m248) SEP() MACRO(TYPE, I + 248, m249) SEP() MACRO(TYPE, I + 249, m250) SEP() MACRO(TYPE, I + 250, m251) SEP() MACRO(TYPE, I + 251, m252) SEP() MACRO(TYPE, I + 252, m253) SEP() MACRO(TYPE, I + 253, m254) SEP() MACRO(TYPE, I + 254, m255) SEP() MACRO(TYPE, I + 255, m256)
+
+#define BOOST_HANA_STRUCT_TAKE_1(NEXT, MACRO, SEP, I, TYPE, m1, ...) BOOST_HANA_STRUCT_BLOCK_1(MACRO, SEP, I, TYPE, m1) SEP() NEXT(MACRO, SEP, I + 1, TYPE, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_TAKE_2(NEXT, MACRO, SEP, I, TYPE, m1, m2, ...) BOOST_HANA_STRUCT_BLOCK_2(MACRO, SEP, I, TYPE, m1, m2) SEP() NEXT(MACRO, SEP, I + 2, TYPE, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_TAKE_4(NEXT, MACRO, SEP, I, TYPE, m1, m2, m3, m4, ...) BOOST_HANA_STRUCT_BLOCK_4(MACRO, SEP, I, TYPE, m1, m2, m3, m4) SEP() NEXT(MACRO, SEP, I + 4, TYPE, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_TAKE_8(NEXT, MACRO, SEP, I, TYPE, m1, m2, m3, m4, m5, m6, m7, m8, ...) BOOST_HANA_STRUCT_BLOCK_8(MACRO, SEP, I, TYPE, m1, m2, m3, m4, m5, m6, m7, m8) SEP() NEXT(MACRO, SEP, I + 8, TYPE, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_TAKE_16(NEXT, MACRO, SEP, I, TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, ...) BOOST_HANA_STRUCT_BLOCK_16(MACRO, SEP, I, TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16) SEP() NEXT(MACRO, SEP, I + 16, TYPE, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_TAKE_32(NEXT, MACRO, SEP, I, TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, ...) BOOST_HANA_STRUCT_BLOCK_32(MACRO, SEP, I, TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32) SEP() NEXT(MACRO, SEP, I + 32, TYPE, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_TAKE_64(NEXT, MACRO, SEP, I, TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40, m41, m42, m43, m44, m45, m46, m47, m48, m49, m50, m51, m52, m53, m54, m55, m56, m57, m58, m59, m60, m61, m62, m63, m64, ...) BOOST_HANA_STRUCT_BLOCK_64(MACRO, SEP, I, TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40, m41, m42, m43, m44, m45, m46, m47, m48, m49, m50, m51, m52, m53, m54, m55, m56, m57, m58, m59, m60, m61, m62, m63, m64) SEP() NEXT(MACRO, SEP, I + 64, TYPE, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_TAKE_128(NEXT, MACRO, SEP, I, TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40, m41, m42, m43, m44, m45, m46, m47, m48, m49, m50, m51, m52, m53, m54, m55, m56, m57, m58, m59, m60, m61, m62, m63, m64, m65, m66, m67, m68, m69, m70, m71, m72, m73, m74, m75, m76, m77, m78, m79, m80, m81, m82, m83, m84, m85, m86, m87, m88, m89, m90, m91, m92, m93, m94, m95, m96, m97, m98, m99, m100, m101, m102, m103, m104, m105, m106, m107, m108, m109, m110, m111, m112, m113, m114, m115, m116, m117, m118, m119, m120, m121, m122, m123, m124, m125, m126, m127, m128, ...) BOOST_HANA_STRUCT_BLOCK_128(MACRO, SEP, I, TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40, m41, m42, m43, m44, m45, m46, m47, m48, m49, m50, m51, m52, m53, m54, m55, m56, m57, m58, m59, m60, m61, m62, m63, m64, m65, m66, m67, m68, m69, m70, m71, m72, m73, m74, m75, m76, m77, m78, m79, m80, m81, m82, m83, m84, m85, m86, m87, m88, m89, m90, m91, m92, m93, m94, m95, m96, m97, m98, m99, m100, m101, m102, m103, m104, m105, m106, m107, m108, m109, m110, m111, m112, m113, m114, m115, m116, m117, m118, m119, m120, m121, m122, m123, m124, m125, m126, m127, m128) SEP() NEXT(MACRO, SEP, I + 128, TYPE, __VA_ARGS__)
+
+#define BOOST_HANA_STRUCT_FOR_EACH_1(MACRO, SEP, I, TYPE)
+
+#define BOOST_HANA_STRUCT_FOR_EACH_2(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_BLOCK_1(MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_3(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_BLOCK_2(MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_4(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_2(BOOST_HANA_STRUCT_FOR_EACH_2, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_5(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_BLOCK_4(MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_6(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_4(BOOST_HANA_STRUCT_FOR_EACH_2, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_7(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_4(BOOST_HANA_STRUCT_FOR_EACH_3, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_8(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_4(BOOST_HANA_STRUCT_FOR_EACH_4, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_9(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_BLOCK_8(MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_10(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_8(BOOST_HANA_STRUCT_FOR_EACH_2, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_11(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_8(BOOST_HANA_STRUCT_FOR_EACH_3, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_12(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_8(BOOST_HANA_STRUCT_FOR_EACH_4, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_13(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_8(BOOST_HANA_STRUCT_FOR_EACH_5, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_14(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_8(BOOST_HANA_STRUCT_FOR_EACH_6, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_15(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_8(BOOST_HANA_STRUCT_FOR_EACH_7, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_16(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_8(BOOST_HANA_STRUCT_FOR_EACH_8, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_17(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_BLOCK_16(MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_18(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_16(BOOST_HANA_STRUCT_FOR_EACH_2, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_19(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_16(BOOST_HANA_STRUCT_FOR_EACH_3, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_20(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_16(BOOST_HANA_STRUCT_FOR_EACH_4, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_21(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_16(BOOST_HANA_STRUCT_FOR_EACH_5, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_22(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_16(BOOST_HANA_STRUCT_FOR_EACH_6, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_23(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_16(BOOST_HANA_STRUCT_FOR_EACH_7, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_24(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_16(BOOST_HANA_STRUCT_FOR_EACH_8, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_25(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_16(BOOST_HANA_STRUCT_FOR_EACH_9, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_26(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_16(BOOST_HANA_STRUCT_FOR_EACH_10, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_27(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_16(BOOST_HANA_STRUCT_FOR_EACH_11, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_28(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_16(BOOST_HANA_STRUCT_FOR_EACH_12, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_29(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_16(BOOST_HANA_STRUCT_FOR_EACH_13, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_30(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_16(BOOST_HANA_STRUCT_FOR_EACH_14, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_31(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_16(BOOST_HANA_STRUCT_FOR_EACH_15, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_32(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_16(BOOST_HANA_STRUCT_FOR_EACH_16, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_33(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_BLOCK_32(MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_34(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_32(BOOST_HANA_STRUCT_FOR_EACH_2, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_35(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_32(BOOST_HANA_STRUCT_FOR_EACH_3, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_36(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_32(BOOST_HANA_STRUCT_FOR_EACH_4, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_37(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_32(BOOST_HANA_STRUCT_FOR_EACH_5, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_38(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_32(BOOST_HANA_STRUCT_FOR_EACH_6, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_39(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_32(BOOST_HANA_STRUCT_FOR_EACH_7, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_40(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_32(BOOST_HANA_STRUCT_FOR_EACH_8, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_41(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_32(BOOST_HANA_STRUCT_FOR_EACH_9, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_42(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_32(BOOST_HANA_STRUCT_FOR_EACH_10, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_43(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_32(BOOST_HANA_STRUCT_FOR_EACH_11, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_44(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_32(BOOST_HANA_STRUCT_FOR_EACH_12, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_45(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_32(BOOST_HANA_STRUCT_FOR_EACH_13, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_46(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_32(BOOST_HANA_STRUCT_FOR_EACH_14, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_47(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_32(BOOST_HANA_STRUCT_FOR_EACH_15, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_48(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_32(BOOST_HANA_STRUCT_FOR_EACH_16, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_49(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_32(BOOST_HANA_STRUCT_FOR_EACH_17, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_50(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_32(BOOST_HANA_STRUCT_FOR_EACH_18, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_51(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_32(BOOST_HANA_STRUCT_FOR_EACH_19, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_52(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_32(BOOST_HANA_STRUCT_FOR_EACH_20, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_53(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_32(BOOST_HANA_STRUCT_FOR_EACH_21, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_54(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_32(BOOST_HANA_STRUCT_FOR_EACH_22, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_55(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_32(BOOST_HANA_STRUCT_FOR_EACH_23, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_56(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_32(BOOST_HANA_STRUCT_FOR_EACH_24, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_57(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_32(BOOST_HANA_STRUCT_FOR_EACH_25, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_58(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_32(BOOST_HANA_STRUCT_FOR_EACH_26, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_59(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_32(BOOST_HANA_STRUCT_FOR_EACH_27, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_60(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_32(BOOST_HANA_STRUCT_FOR_EACH_28, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_61(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_32(BOOST_HANA_STRUCT_FOR_EACH_29, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_62(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_32(BOOST_HANA_STRUCT_FOR_EACH_30, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_63(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_32(BOOST_HANA_STRUCT_FOR_EACH_31, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_64(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_32(BOOST_HANA_STRUCT_FOR_EACH_32, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_65(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_BLOCK_64(MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_66(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_2, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_67(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_3, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_68(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_4, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_69(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_5, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_70(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_6, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_71(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_7, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_72(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_8, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_73(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_9, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_74(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_10, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_75(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_11, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_76(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_12, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_77(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_13, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_78(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_14, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_79(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_15, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_80(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_16, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_81(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_17, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_82(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_18, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_83(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_19, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_84(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_20, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_85(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_21, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_86(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_22, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_87(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_23, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_88(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_24, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_89(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_25, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_90(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_26, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_91(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_27, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_92(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_28, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_93(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_29, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_94(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_30, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_95(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_31, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_96(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_32, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_97(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_33, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_98(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_34, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_99(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_35, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_100(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_36, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_101(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_37, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_102(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_38, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_103(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_39, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_104(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_40, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_105(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_41, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_106(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_42, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_107(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_43, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_108(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_44, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_109(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_45, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_110(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_46, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_111(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_47, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_112(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_48, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_113(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_49, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_114(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_50, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_115(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_51, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_116(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_52, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_117(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_53, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_118(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_54, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_119(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_55, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_120(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_56, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_121(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_57, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_122(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_58, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_123(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_59, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_124(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_60, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_125(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_61, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_126(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_62, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_127(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_63, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_128(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_64(BOOST_HANA_STRUCT_FOR_EACH_64, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_129(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_BLOCK_128(MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_130(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_2, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_131(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_3, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_132(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_4, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_133(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_5, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_134(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_6, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_135(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_7, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_136(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_8, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_137(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_9, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_138(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_10, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_139(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_11, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_140(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_12, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_141(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_13, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_142(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_14, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_143(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_15, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_144(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_16, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_145(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_17, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_146(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_18, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_147(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_19, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_148(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_20, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_149(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_21, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_150(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_22, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_151(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_23, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_152(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_24, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_153(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_25, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_154(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_26, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_155(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_27, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_156(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_28, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_157(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_29, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_158(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_30, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_159(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_31, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_160(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_32, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_161(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_33, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_162(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_34, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_163(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_35, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_164(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_36, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_165(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_37, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_166(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_38, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_167(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_39, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_168(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_40, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_169(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_41, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_170(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_42, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_171(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_43, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_172(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_44, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_173(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_45, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_174(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_46, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_175(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_47, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_176(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_48, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_177(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_49, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_178(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_50, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_179(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_51, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_180(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_52, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_181(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_53, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_182(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_54, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_183(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_55, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_184(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_56, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_185(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_57, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_186(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_58, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_187(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_59, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_188(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_60, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_189(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_61, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_190(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_62, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_191(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_63, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_192(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_64, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_193(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_65, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_194(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_66, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_195(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_67, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_196(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_68, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_197(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_69, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_198(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_70, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_199(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_71, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_200(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_72, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_201(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_73, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_202(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_74, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_203(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_75, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_204(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_76, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_205(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_77, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_206(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_78, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_207(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_79, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_208(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_80, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_209(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_81, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_210(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_82, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_211(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_83, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_212(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_84, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_213(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_85, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_214(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_86, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_215(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_87, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_216(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_88, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_217(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_89, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_218(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_90, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_219(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_91, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_220(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_92, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_221(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_93, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_222(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_94, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_223(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_95, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_224(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_96, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_225(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_97, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_226(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_98, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_227(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_99, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_228(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_100, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_229(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_101, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_230(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_102, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_231(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_103, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_232(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_104, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_233(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_105, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_234(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_106, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_235(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_107, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_236(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_108, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_237(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_109, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_238(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_110, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_239(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_111, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_240(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_112, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_241(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_113, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_242(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_114, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_243(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_115, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_244(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_116, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_245(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_117, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_246(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_118, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_247(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_119, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_248(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_120, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_249(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_121, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_250(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_122, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_251(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_123, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_252(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_124, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_253(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_125, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_254(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_126, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_255(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_127, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_256(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_TAKE_128(BOOST_HANA_STRUCT_FOR_EACH_128, MACRO, SEP, I, __VA_ARGS__)
+#define BOOST_HANA_STRUCT_FOR_EACH_257(MACRO, SEP, I, ...) BOOST_HANA_STRUCT_BLOCK_256(MACRO, SEP, I, __VA_ARGS__)
+
+#define BOOST_HANA_MEMBER_NAME_IMPL(TYPE, i, MEMBER)                        \
+  BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK MEMBER)                        \
 /**/
 
-#define BOOST_HANA_ADAPT_STRUCT_IMPL(N, ...) \
-  BOOST_HANA_PP_CONCAT(BOOST_HANA_ADAPT_STRUCT_IMPL_, N)(__VA_ARGS__)
-
 #define BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, i, MEMBER)                        \
   ::boost::hana::make_pair(                                                 \
     ::boost::hana::struct_detail::prepare_member_name<i, member_names>(),   \
     ::boost::hana::struct_detail::member_ptr<                               \
-      decltype(&TYPE::MEMBER), &TYPE::MEMBER                                \
+      decltype(&TYPE::BOOST_HANA_PP_BACK MEMBER),                           \
+      &TYPE::BOOST_HANA_PP_BACK MEMBER                                      \
     >{}                                                                     \
   )                                                                         \
 /**/
 
-
-#define BOOST_HANA_ADAPT_STRUCT_IMPL_1(TYPE)     \
-    namespace boost { namespace hana {                                      \
-        template <>                                                         \
-        struct accessors_impl<TYPE> {                                       \
-            static constexpr auto apply() {                                 \
-                struct member_names {                                       \
-                  static constexpr auto get() {                             \
-                      return ::boost::hana::make_tuple(                     \
-                                              \
-                      );                                                    \
-                  }                                                         \
-                };                                                          \
-                return ::boost::hana::make_tuple(                           \
-                                              \
-                );                                                          \
-            }                                                               \
-        };                                                                  \
-    }}                                                                      \
-/**/
-
-#define BOOST_HANA_ADAPT_STRUCT_IMPL_2(TYPE, m1)     \
-    namespace boost { namespace hana {                                      \
-        template <>                                                         \
-        struct accessors_impl<TYPE> {                                       \
-            static constexpr auto apply() {                                 \
-                struct member_names {                                       \
-                  static constexpr auto get() {                             \
-                      return ::boost::hana::make_tuple(                     \
-                          BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1)                    \
-                      );                                                    \
-                  }                                                         \
-                };                                                          \
-                return ::boost::hana::make_tuple(                           \
-                    BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1)                          \
-                );                                                          \
-            }                                                               \
-        };                                                                  \
-    }}                                                                      \
-/**/
-
-#define BOOST_HANA_ADAPT_STRUCT_IMPL_3(TYPE, m1, m2)     \
-    namespace boost { namespace hana {                                      \
-        template <>                                                         \
-        struct accessors_impl<TYPE> {                                       \
-            static constexpr auto apply() {                                 \
-                struct member_names {                                       \
-                  static constexpr auto get() {                             \
-                      return ::boost::hana::make_tuple(                     \
-                          BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2)                    \
-                      );                                                    \
-                  }                                                         \
-                };                                                          \
-                return ::boost::hana::make_tuple(                           \
-                    BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2)                          \
-                );                                                          \
-            }                                                               \
-        };                                                                  \
-    }}                                                                      \
-/**/
-
-#define BOOST_HANA_ADAPT_STRUCT_IMPL_4(TYPE, m1, m2, m3)     \
-    namespace boost { namespace hana {                                      \
-        template <>                                                         \
-        struct accessors_impl<TYPE> {                                       \
-            static constexpr auto apply() {                                 \
-                struct member_names {                                       \
-                  static constexpr auto get() {                             \
-                      return ::boost::hana::make_tuple(                     \
-                          BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3)                    \
-                      );                                                    \
-                  }                                                         \
-                };                                                          \
-                return ::boost::hana::make_tuple(                           \
-                    BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3)                          \
-                );                                                          \
-            }                                                               \
-        };                                                                  \
-    }}                                                                      \
-/**/
-
-#define BOOST_HANA_ADAPT_STRUCT_IMPL_5(TYPE, m1, m2, m3, m4)     \
-    namespace boost { namespace hana {                                      \
-        template <>                                                         \
-        struct accessors_impl<TYPE> {                                       \
-            static constexpr auto apply() {                                 \
-                struct member_names {                                       \
-                  static constexpr auto get() {                             \
-                      return ::boost::hana::make_tuple(                     \
-                          BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4)                    \
-                      );                                                    \
-                  }                                                         \
-                };                                                          \
-                return ::boost::hana::make_tuple(                           \
-                    BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4)                          \
-                );                                                          \
-            }                                                               \
-        };                                                                  \
-    }}                                                                      \
-/**/
-
-#define BOOST_HANA_ADAPT_STRUCT_IMPL_6(TYPE, m1, m2, m3, m4, m5)     \
-    namespace boost { namespace hana {                                      \
-        template <>                                                         \
-        struct accessors_impl<TYPE> {                                       \
-            static constexpr auto apply() {                                 \
-                struct member_names {                                       \
-                  static constexpr auto get() {                             \
-                      return ::boost::hana::make_tuple(                     \
-                          BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5)                    \
-                      );                                                    \
-                  }                                                         \
-                };                                                          \
-                return ::boost::hana::make_tuple(                           \
-                    BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5)                          \
-                );                                                          \
-            }                                                               \
-        };                                                                  \
-    }}                                                                      \
-/**/
-
-#define BOOST_HANA_ADAPT_STRUCT_IMPL_7(TYPE, m1, m2, m3, m4, m5, m6)     \
-    namespace boost { namespace hana {                                      \
-        template <>                                                         \
-        struct accessors_impl<TYPE> {                                       \
-            static constexpr auto apply() {                                 \
-                struct member_names {                                       \
-                  static constexpr auto get() {                             \
-                      return ::boost::hana::make_tuple(                     \
-                          BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6)                    \
-                      );                                                    \
-                  }                                                         \
-                };                                                          \
-                return ::boost::hana::make_tuple(                           \
-                    BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6)                          \
-                );                                                          \
-            }                                                               \
-        };                                                                  \
-    }}                                                                      \
+#define BOOST_HANA_MEMBER_DECL_IMPL(TYPE, i, MEMBER)                        \
+  BOOST_HANA_PP_DROP_BACK MEMBER BOOST_HANA_PP_BACK MEMBER;                 \
 /**/
 
-#define BOOST_HANA_ADAPT_STRUCT_IMPL_8(TYPE, m1, m2, m3, m4, m5, m6, m7)     \
-    namespace boost { namespace hana {                                      \
-        template <>                                                         \
-        struct accessors_impl<TYPE> {                                       \
-            static constexpr auto apply() {                                 \
-                struct member_names {                                       \
-                  static constexpr auto get() {                             \
-                      return ::boost::hana::make_tuple(                     \
-                          BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7)                    \
-                      );                                                    \
-                  }                                                         \
-                };                                                          \
-                return ::boost::hana::make_tuple(                           \
-                    BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7)                          \
-                );                                                          \
-            }                                                               \
-        };                                                                  \
-    }}                                                                      \
+#define BOOST_HANA_ACCESSORS_IMPL(N, ...)                                   \
+  static constexpr auto apply() {                                           \
+    struct member_names {                                                   \
+      static constexpr auto get() {                                         \
+        return ::boost::hana::make_tuple(                                   \
+          BOOST_HANA_STRUCT_FOR_EACH(N, BOOST_HANA_MEMBER_NAME_IMPL,        \
+                                     BOOST_HANA_STRUCT_COMMA, __VA_ARGS__)  \
+        );                                                                  \
+      }                                                                     \
+    };                                                                      \
+    return ::boost::hana::make_tuple(                                       \
+      BOOST_HANA_STRUCT_FOR_EACH(N, BOOST_HANA_MEMBER_PAIR_IMPL,            \
+                                 BOOST_HANA_STRUCT_COMMA, __VA_ARGS__)      \
+    );                                                                      \
+  }                                                                         \
 /**/
 
-#define BOOST_HANA_ADAPT_STRUCT_IMPL_9(TYPE, m1, m2, m3, m4, m5, m6, m7, m8)     \
-    namespace boost { namespace hana {                                      \
-        template <>                                                         \
-        struct accessors_impl<TYPE> {                                       \
-            static constexpr auto apply() {                                 \
-                struct member_names {                                       \
-                  static constexpr auto get() {                             \
-                      return ::boost::hana::make_tuple(                     \
-                          BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8)                    \
-                      );                                                    \
-                  }                                                         \
-                };                                                          \
-                return ::boost::hana::make_tuple(                           \
-                    BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8)                          \
-                );                                                          \
-            }                                                               \
-        };                                                                  \
-    }}                                                                      \
-/**/
-
-#define BOOST_HANA_ADAPT_STRUCT_IMPL_10(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9)     \
-    namespace boost { namespace hana {                                      \
-        template <>                                                         \
-        struct accessors_impl<TYPE> {                                       \
-            static constexpr auto apply() {                                 \
-                struct member_names {                                       \
-                  static constexpr auto get() {                             \
-                      return ::boost::hana::make_tuple(                     \
-                          BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9)                    \
-                      );                                                    \
-                  }                                                         \
-                };                                                          \
-                return ::boost::hana::make_tuple(                           \
-                    BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9)                          \
-                );                                                          \
-            }                                                               \
-        };                                                                  \
-    }}                                                                      \
-/**/
-
-#define BOOST_HANA_ADAPT_STRUCT_IMPL_11(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10)     \
-    namespace boost { namespace hana {                                      \
-        template <>                                                         \
-        struct accessors_impl<TYPE> {                                       \
-            static constexpr auto apply() {                                 \
-                struct member_names {                                       \
-                  static constexpr auto get() {                             \
-                      return ::boost::hana::make_tuple(                     \
-                          BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10)                    \
-                      );                                                    \
-                  }                                                         \
-                };                                                          \
-                return ::boost::hana::make_tuple(                           \
-                    BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10)                          \
-                );                                                          \
-            }                                                               \
-        };                                                                  \
-    }}                                                                      \
-/**/
-
-#define BOOST_HANA_ADAPT_STRUCT_IMPL_12(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11)     \
-    namespace boost { namespace hana {                                      \
-        template <>                                                         \
-        struct accessors_impl<TYPE> {                                       \
-            static constexpr auto apply() {                                 \
-                struct member_names {                                       \
-                  static constexpr auto get() {                             \
-                      return ::boost::hana::make_tuple(                     \
-                          BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11)                    \
-                      );                                                    \
-                  }                                                         \
-                };                                                          \
-                return ::boost::hana::make_tuple(                           \
-                    BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11)                          \
-                );                                                          \
-            }                                                               \
-        };                                                                  \
-    }}                                                                      \
-/**/
-
-#define BOOST_HANA_ADAPT_STRUCT_IMPL_13(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12)     \
-    namespace boost { namespace hana {                                      \
-        template <>                                                         \
-        struct accessors_impl<TYPE> {                                       \
-            static constexpr auto apply() {                                 \
-                struct member_names {                                       \
-                  static constexpr auto get() {                             \
-                      return ::boost::hana::make_tuple(                     \
-                          BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12)                    \
-                      );                                                    \
-                  }                                                         \
-                };                                                          \
-                return ::boost::hana::make_tuple(                           \
-                    BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12)                          \
-                );                                                          \
-            }                                                               \
-        };                                                                  \
-    }}                                                                      \
-/**/
-
-#define BOOST_HANA_ADAPT_STRUCT_IMPL_14(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13)     \
-    namespace boost { namespace hana {                                      \
-        template <>                                                         \
-        struct accessors_impl<TYPE> {                                       \
-            static constexpr auto apply() {                                 \
-                struct member_names {                                       \
-                  static constexpr auto get() {                             \
-                      return ::boost::hana::make_tuple(                     \
-                          BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13)                    \
-                      );                                                    \
-                  }                                                         \
-                };                                                          \
-                return ::boost::hana::make_tuple(                           \
-                    BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13)                          \
-                );                                                          \
-            }                                                               \
-        };                                                                  \
-    }}                                                                      \
-/**/
-
-#define BOOST_HANA_ADAPT_STRUCT_IMPL_15(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14)     \
-    namespace boost { namespace hana {                                      \
-        template <>                                                         \
-        struct accessors_impl<TYPE> {                                       \
-            static constexpr auto apply() {                                 \
-                struct member_names {                                       \
-                  static constexpr auto get() {                             \
-                      return ::boost::hana::make_tuple(                     \
-                          BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14)                    \
-                      );                                                    \
-                  }                                                         \
-                };                                                          \
-                return ::boost::hana::make_tuple(                           \
-                    BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14)                          \
-                );                                                          \
-            }                                                               \
-        };                                                                  \
-    }}                                                                      \
-/**/
-
-#define BOOST_HANA_ADAPT_STRUCT_IMPL_16(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15)     \
-    namespace boost { namespace hana {                                      \
-        template <>                                                         \
-        struct accessors_impl<TYPE> {                                       \
-            static constexpr auto apply() {                                 \
-                struct member_names {                                       \
-                  static constexpr auto get() {                             \
-                      return ::boost::hana::make_tuple(                     \
-                          BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15)                    \
-                      );                                                    \
-                  }                                                         \
-                };                                                          \
-                return ::boost::hana::make_tuple(                           \
-                    BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15)                          \
-                );                                                          \
-            }                                                               \
-        };                                                                  \
-    }}                                                                      \
-/**/
-
-#define BOOST_HANA_ADAPT_STRUCT_IMPL_17(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16)     \
-    namespace boost { namespace hana {                                      \
-        template <>                                                         \
-        struct accessors_impl<TYPE> {                                       \
-            static constexpr auto apply() {                                 \
-                struct member_names {                                       \
-                  static constexpr auto get() {                             \
-                      return ::boost::hana::make_tuple(                     \
-                          BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16)                    \
-                      );                                                    \
-                  }                                                         \
-                };                                                          \
-                return ::boost::hana::make_tuple(                           \
-                    BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16)                          \
-                );                                                          \
-            }                                                               \
-        };                                                                  \
-    }}                                                                      \
-/**/
-
-#define BOOST_HANA_ADAPT_STRUCT_IMPL_18(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17)     \
-    namespace boost { namespace hana {                                      \
-        template <>                                                         \
-        struct accessors_impl<TYPE> {                                       \
-            static constexpr auto apply() {                                 \
-                struct member_names {                                       \
-                  static constexpr auto get() {                             \
-                      return ::boost::hana::make_tuple(                     \
-                          BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17)                    \
-                      );                                                    \
-                  }                                                         \
-                };                                                          \
-                return ::boost::hana::make_tuple(                           \
-                    BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17)                          \
-                );                                                          \
-            }                                                               \
-        };                                                                  \
-    }}                                                                      \
-/**/
-
-#define BOOST_HANA_ADAPT_STRUCT_IMPL_19(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18)     \
-    namespace boost { namespace hana {                                      \
-        template <>                                                         \
-        struct accessors_impl<TYPE> {                                       \
-            static constexpr auto apply() {                                 \
-                struct member_names {                                       \
-                  static constexpr auto get() {                             \
-                      return ::boost::hana::make_tuple(                     \
-                          BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18)                    \
-                      );                                                    \
-                  }                                                         \
-                };                                                          \
-                return ::boost::hana::make_tuple(                           \
-                    BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18)                          \
-                );                                                          \
-            }                                                               \
-        };                                                                  \
-    }}                                                                      \
-/**/
-
-#define BOOST_HANA_ADAPT_STRUCT_IMPL_20(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19)     \
-    namespace boost { namespace hana {                                      \
-        template <>                                                         \
-        struct accessors_impl<TYPE> {                                       \
-            static constexpr auto apply() {                                 \
-                struct member_names {                                       \
-                  static constexpr auto get() {                             \
-                      return ::boost::hana::make_tuple(                     \
-                          BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19)                    \
-                      );                                                    \
-                  }                                                         \
-                };                                                          \
-                return ::boost::hana::make_tuple(                           \
-                    BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19)                          \
-                );                                                          \
-            }                                                               \
-        };                                                                  \
-    }}                                                                      \
-/**/
-
-#define BOOST_HANA_ADAPT_STRUCT_IMPL_21(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20)     \
-    namespace boost { namespace hana {                                      \
-        template <>                                                         \
-        struct accessors_impl<TYPE> {                                       \
-            static constexpr auto apply() {                                 \
-                struct member_names {                                       \
-                  static constexpr auto get() {                             \
-                      return ::boost::hana::make_tuple(                     \
-                          BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m20)                    \
-                      );                                                    \
-                  }                                                         \
-                };                                                          \
-                return ::boost::hana::make_tuple(                           \
-                    BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 19, BOOST_HANA_PP_BACK m20)                          \
-                );                                                          \
-            }                                                               \
-        };                                                                  \
-    }}                                                                      \
-/**/
-
-#define BOOST_HANA_ADAPT_STRUCT_IMPL_22(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21)     \
-    namespace boost { namespace hana {                                      \
-        template <>                                                         \
-        struct accessors_impl<TYPE> {                                       \
-            static constexpr auto apply() {                                 \
-                struct member_names {                                       \
-                  static constexpr auto get() {                             \
-                      return ::boost::hana::make_tuple(                     \
-                          BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m20), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m21)                    \
-                      );                                                    \
-                  }                                                         \
-                };                                                          \
-                return ::boost::hana::make_tuple(                           \
-                    BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 19, BOOST_HANA_PP_BACK m20), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 20, BOOST_HANA_PP_BACK m21)                          \
-                );                                                          \
-            }                                                               \
-        };                                                                  \
-    }}                                                                      \
-/**/
-
-#define BOOST_HANA_ADAPT_STRUCT_IMPL_23(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22)     \
-    namespace boost { namespace hana {                                      \
-        template <>                                                         \
-        struct accessors_impl<TYPE> {                                       \
-            static constexpr auto apply() {                                 \
-                struct member_names {                                       \
-                  static constexpr auto get() {                             \
-                      return ::boost::hana::make_tuple(                     \
-                          BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m20), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m21), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m22)                    \
-                      );                                                    \
-                  }                                                         \
-                };                                                          \
-                return ::boost::hana::make_tuple(                           \
-                    BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 19, BOOST_HANA_PP_BACK m20), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 20, BOOST_HANA_PP_BACK m21), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 21, BOOST_HANA_PP_BACK m22)                          \
-                );                                                          \
-            }                                                               \
-        };                                                                  \
-    }}                                                                      \
-/**/
-
-#define BOOST_HANA_ADAPT_STRUCT_IMPL_24(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23)     \
-    namespace boost { namespace hana {                                      \
-        template <>                                                         \
-        struct accessors_impl<TYPE> {                                       \
-            static constexpr auto apply() {                                 \
-                struct member_names {                                       \
-                  static constexpr auto get() {                             \
-                      return ::boost::hana::make_tuple(                     \
-                          BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m20), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m21), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m22), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m23)                    \
-                      );                                                    \
-                  }                                                         \
-                };                                                          \
-                return ::boost::hana::make_tuple(                           \
-                    BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 19, BOOST_HANA_PP_BACK m20), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 20, BOOST_HANA_PP_BACK m21), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 21, BOOST_HANA_PP_BACK m22), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 22, BOOST_HANA_PP_BACK m23)                          \
-                );                                                          \
-            }                                                               \
-        };                                                                  \
-    }}                                                                      \
-/**/
-
-#define BOOST_HANA_ADAPT_STRUCT_IMPL_25(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24)     \
-    namespace boost { namespace hana {                                      \
-        template <>                                                         \
-        struct accessors_impl<TYPE> {                                       \
-            static constexpr auto apply() {                                 \
-                struct member_names {                                       \
-                  static constexpr auto get() {                             \
-                      return ::boost::hana::make_tuple(                     \
-                          BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m20), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m21), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m22), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m23), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m24)                    \
-                      );                                                    \
-                  }                                                         \
-                };                                                          \
-                return ::boost::hana::make_tuple(                           \
-                    BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 19, BOOST_HANA_PP_BACK m20), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 20, BOOST_HANA_PP_BACK m21), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 21, BOOST_HANA_PP_BACK m22), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 22, BOOST_HANA_PP_BACK m23), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 23, BOOST_HANA_PP_BACK m24)                          \
-                );                                                          \
-            }                                                               \
-        };                                                                  \
-    }}                                                                      \
-/**/
-
-#define BOOST_HANA_ADAPT_STRUCT_IMPL_26(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25)     \
-    namespace boost { namespace hana {                                      \
-        template <>                                                         \
-        struct accessors_impl<TYPE> {                                       \
-            static constexpr auto apply() {                                 \
-                struct member_names {                                       \
-                  static constexpr auto get() {                             \
-                      return ::boost::hana::make_tuple(                     \
-                          BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m20), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m21), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m22), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m23), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m24), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m25)                    \
-                      );                                                    \
-                  }                                                         \
-                };                                                          \
-                return ::boost::hana::make_tuple(                           \
-                    BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 19, BOOST_HANA_PP_BACK m20), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 20, BOOST_HANA_PP_BACK m21), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 21, BOOST_HANA_PP_BACK m22), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 22, BOOST_HANA_PP_BACK m23), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 23, BOOST_HANA_PP_BACK m24), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 24, BOOST_HANA_PP_BACK m25)                          \
-                );                                                          \
-            }                                                               \
-        };                                                                  \
-    }}                                                                      \
-/**/
-
-#define BOOST_HANA_ADAPT_STRUCT_IMPL_27(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26)     \
-    namespace boost { namespace hana {                                      \
-        template <>                                                         \
-        struct accessors_impl<TYPE> {                                       \
-            static constexpr auto apply() {                                 \
-                struct member_names {                                       \
-                  static constexpr auto get() {                             \
-                      return ::boost::hana::make_tuple(                     \
-                          BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m20), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m21), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m22), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m23), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m24), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m25), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m26)                    \
-                      );                                                    \
-                  }                                                         \
-                };                                                          \
-                return ::boost::hana::make_tuple(                           \
-                    BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 19, BOOST_HANA_PP_BACK m20), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 20, BOOST_HANA_PP_BACK m21), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 21, BOOST_HANA_PP_BACK m22), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 22, BOOST_HANA_PP_BACK m23), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 23, BOOST_HANA_PP_BACK m24), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 24, BOOST_HANA_PP_BACK m25), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 25, BOOST_HANA_PP_BACK m26)                          \
-                );                                                          \
-            }                                                               \
-        };                                                                  \
-    }}                                                                      \
-/**/
-
-#define BOOST_HANA_ADAPT_STRUCT_IMPL_28(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27)     \
-    namespace boost { namespace hana {                                      \
-        template <>                                                         \
-        struct accessors_impl<TYPE> {                                       \
-            static constexpr auto apply() {                                 \
-                struct member_names {                                       \
-                  static constexpr auto get() {                             \
-                      return ::boost::hana::make_tuple(                     \
-                          BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m20), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m21), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m22), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m23), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m24), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m25), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m26), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m27)                    \
-                      );                                                    \
-                  }                                                         \
-                };                                                          \
-                return ::boost::hana::make_tuple(                           \
-                    BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 19, BOOST_HANA_PP_BACK m20), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 20, BOOST_HANA_PP_BACK m21), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 21, BOOST_HANA_PP_BACK m22), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 22, BOOST_HANA_PP_BACK m23), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 23, BOOST_HANA_PP_BACK m24), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 24, BOOST_HANA_PP_BACK m25), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 25, BOOST_HANA_PP_BACK m26), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 26, BOOST_HANA_PP_BACK m27)                          \
-                );                                                          \
-            }                                                               \
-        };                                                                  \
-    }}                                                                      \
-/**/
-
-#define BOOST_HANA_ADAPT_STRUCT_IMPL_29(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28)     \
-    namespace boost { namespace hana {                                      \
-        template <>                                                         \
-        struct accessors_impl<TYPE> {                                       \
-            static constexpr auto apply() {                                 \
-                struct member_names {                                       \
-                  static constexpr auto get() {                             \
-                      return ::boost::hana::make_tuple(                     \
-                          BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m20), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m21), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m22), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m23), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m24), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m25), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m26), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m27), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m28)                    \
-                      );                                                    \
-                  }                                                         \
-                };                                                          \
-                return ::boost::hana::make_tuple(                           \
-                    BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 19, BOOST_HANA_PP_BACK m20), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 20, BOOST_HANA_PP_BACK m21), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 21, BOOST_HANA_PP_BACK m22), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 22, BOOST_HANA_PP_BACK m23), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 23, BOOST_HANA_PP_BACK m24), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 24, BOOST_HANA_PP_BACK m25), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 25, BOOST_HANA_PP_BACK m26), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 26, BOOST_HANA_PP_BACK m27), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 27, BOOST_HANA_PP_BACK m28)                          \
-                );                                                          \
-            }                                                               \
-        };                                                                  \
-    }}                                                                      \
-/**/
-
-#define BOOST_HANA_ADAPT_STRUCT_IMPL_30(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29)     \
-    namespace boost { namespace hana {                                      \
-        template <>                                                         \
-        struct accessors_impl<TYPE> {                                       \
-            static constexpr auto apply() {                                 \
-                struct member_names {                                       \
-                  static constexpr auto get() {                             \
-                      return ::boost::hana::make_tuple(                     \
-                          BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m20), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m21), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m22), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m23), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m24), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m25), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m26), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m27), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m28), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m29)                    \
-                      );                                                    \
-                  }                                                         \
-                };                                                          \
-                return ::boost::hana::make_tuple(                           \
-                    BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 19, BOOST_HANA_PP_BACK m20), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 20, BOOST_HANA_PP_BACK m21), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 21, BOOST_HANA_PP_BACK m22), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 22, BOOST_HANA_PP_BACK m23), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 23, BOOST_HANA_PP_BACK m24), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 24, BOOST_HANA_PP_BACK m25), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 25, BOOST_HANA_PP_BACK m26), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 26, BOOST_HANA_PP_BACK m27), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 27, BOOST_HANA_PP_BACK m28), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 28, BOOST_HANA_PP_BACK m29)                          \
-                );                                                          \
-            }                                                               \
-        };                                                                  \
-    }}                                                                      \
-/**/
-
-#define BOOST_HANA_ADAPT_STRUCT_IMPL_31(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30)     \
-    namespace boost { namespace hana {                                      \
-        template <>                                                         \
-        struct accessors_impl<TYPE> {                                       \
-            static constexpr auto apply() {                                 \
-                struct member_names {                                       \
-                  static constexpr auto get() {                             \
-                      return ::boost::hana::make_tuple(                     \
-                          BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m20), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m21), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m22), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m23), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m24), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m25), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m26), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m27), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m28), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m29), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m30)                    \
-                      );                                                    \
-                  }                                                         \
-                };                                                          \
-                return ::boost::hana::make_tuple(                           \
-                    BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 19, BOOST_HANA_PP_BACK m20), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 20, BOOST_HANA_PP_BACK m21), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 21, BOOST_HANA_PP_BACK m22), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 22, BOOST_HANA_PP_BACK m23), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 23, BOOST_HANA_PP_BACK m24), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 24, BOOST_HANA_PP_BACK m25), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 25, BOOST_HANA_PP_BACK m26), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 26, BOOST_HANA_PP_BACK m27), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 27, BOOST_HANA_PP_BACK m28), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 28, BOOST_HANA_PP_BACK m29), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 29, BOOST_HANA_PP_BACK m30)                          \
-                );                                                          \
-            }                                                               \
-        };                                                                  \
-    }}                                                                      \
-/**/
-
-#define BOOST_HANA_ADAPT_STRUCT_IMPL_32(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31)     \
-    namespace boost { namespace hana {                                      \
-        template <>                                                         \
-        struct accessors_impl<TYPE> {                                       \
-            static constexpr auto apply() {                                 \
-                struct member_names {                                       \
-                  static constexpr auto get() {                             \
-                      return ::boost::hana::make_tuple(                     \
-                          BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m20), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m21), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m22), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m23), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m24), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m25), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m26), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m27), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m28), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m29), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m30), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m31)                    \
-                      );                                                    \
-                  }                                                         \
-                };                                                          \
-                return ::boost::hana::make_tuple(                           \
-                    BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 19, BOOST_HANA_PP_BACK m20), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 20, BOOST_HANA_PP_BACK m21), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 21, BOOST_HANA_PP_BACK m22), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 22, BOOST_HANA_PP_BACK m23), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 23, BOOST_HANA_PP_BACK m24), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 24, BOOST_HANA_PP_BACK m25), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 25, BOOST_HANA_PP_BACK m26), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 26, BOOST_HANA_PP_BACK m27), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 27, BOOST_HANA_PP_BACK m28), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 28, BOOST_HANA_PP_BACK m29), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 29, BOOST_HANA_PP_BACK m30), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 30, BOOST_HANA_PP_BACK m31)                          \
-                );                                                          \
-            }                                                               \
-        };                                                                  \
-    }}                                                                      \
-/**/
-
-#define BOOST_HANA_ADAPT_STRUCT_IMPL_33(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32)     \
-    namespace boost { namespace hana {                                      \
-        template <>                                                         \
-        struct accessors_impl<TYPE> {                                       \
-            static constexpr auto apply() {                                 \
-                struct member_names {                                       \
-                  static constexpr auto get() {                             \
-                      return ::boost::hana::make_tuple(                     \
-                          BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m20), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m21), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m22), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m23), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m24), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m25), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m26), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m27), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m28), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m29), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m30), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m31), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m32)                    \
-                      );                                                    \
-                  }                                                         \
-                };                                                          \
-                return ::boost::hana::make_tuple(                           \
-                    BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 19, BOOST_HANA_PP_BACK m20), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 20, BOOST_HANA_PP_BACK m21), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 21, BOOST_HANA_PP_BACK m22), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 22, BOOST_HANA_PP_BACK m23), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 23, BOOST_HANA_PP_BACK m24), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 24, BOOST_HANA_PP_BACK m25), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 25, BOOST_HANA_PP_BACK m26), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 26, BOOST_HANA_PP_BACK m27), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 27, BOOST_HANA_PP_BACK m28), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 28, BOOST_HANA_PP_BACK m29), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 29, BOOST_HANA_PP_BACK m30), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 30, BOOST_HANA_PP_BACK m31), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 31, BOOST_HANA_PP_BACK m32)                          \
-                );                                                          \
-            }                                                               \
-        };                                                                  \
-    }}                                                                      \
-/**/
-
-#define BOOST_HANA_ADAPT_STRUCT_IMPL_34(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33)     \
-    namespace boost { namespace hana {                                      \
-        template <>                                                         \
-        struct accessors_impl<TYPE> {                                       \
-            static constexpr auto apply() {                                 \
-                struct member_names {                                       \
-                  static constexpr auto get() {                             \
-                      return ::boost::hana::make_tuple(                     \
-                          BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m20), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m21), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m22), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m23), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m24), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m25), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m26), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m27), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m28), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m29), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m30), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m31), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m32), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m33)                    \
-                      );                                                    \
-                  }                                                         \
-                };                                                          \
-                return ::boost::hana::make_tuple(                           \
-                    BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 19, BOOST_HANA_PP_BACK m20), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 20, BOOST_HANA_PP_BACK m21), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 21, BOOST_HANA_PP_BACK m22), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 22, BOOST_HANA_PP_BACK m23), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 23, BOOST_HANA_PP_BACK m24), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 24, BOOST_HANA_PP_BACK m25), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 25, BOOST_HANA_PP_BACK m26), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 26, BOOST_HANA_PP_BACK m27), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 27, BOOST_HANA_PP_BACK m28), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 28, BOOST_HANA_PP_BACK m29), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 29, BOOST_HANA_PP_BACK m30), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 30, BOOST_HANA_PP_BACK m31), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 31, BOOST_HANA_PP_BACK m32), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 32, BOOST_HANA_PP_BACK m33)                          \
-                );                                                          \
-            }                                                               \
-        };                                                                  \
-    }}                                                                      \
-/**/
-
-#define BOOST_HANA_ADAPT_STRUCT_IMPL_35(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34)     \
-    namespace boost { namespace hana {                                      \
-        template <>                                                         \
-        struct accessors_impl<TYPE> {                                       \
-            static constexpr auto apply() {                                 \
-                struct member_names {                                       \
-                  static constexpr auto get() {                             \
-                      return ::boost::hana::make_tuple(                     \
-                          BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m20), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m21), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m22), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m23), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m24), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m25), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m26), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m27), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m28), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m29), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m30), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m31), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m32), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m33), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m34)                    \
-                      );                                                    \
-                  }                                                         \
-                };                                                          \
-                return ::boost::hana::make_tuple(                           \
-                    BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 19, BOOST_HANA_PP_BACK m20), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 20, BOOST_HANA_PP_BACK m21), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 21, BOOST_HANA_PP_BACK m22), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 22, BOOST_HANA_PP_BACK m23), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 23, BOOST_HANA_PP_BACK m24), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 24, BOOST_HANA_PP_BACK m25), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 25, BOOST_HANA_PP_BACK m26), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 26, BOOST_HANA_PP_BACK m27), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 27, BOOST_HANA_PP_BACK m28), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 28, BOOST_HANA_PP_BACK m29), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 29, BOOST_HANA_PP_BACK m30), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 30, BOOST_HANA_PP_BACK m31), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 31, BOOST_HANA_PP_BACK m32), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 32, BOOST_HANA_PP_BACK m33), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 33, BOOST_HANA_PP_BACK m34)                          \
-                );                                                          \
-            }                                                               \
-        };                                                                  \
-    }}                                                                      \
-/**/
-
-#define BOOST_HANA_ADAPT_STRUCT_IMPL_36(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35)     \
-    namespace boost { namespace hana {                                      \
-        template <>                                                         \
-        struct accessors_impl<TYPE> {                                       \
-            static constexpr auto apply() {                                 \
-                struct member_names {                                       \
-                  static constexpr auto get() {                             \
-                      return ::boost::hana::make_tuple(                     \
-                          BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m20), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m21), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m22), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m23), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m24), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m25), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m26), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m27), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m28), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m29), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m30), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m31), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m32), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m33), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m34), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m35)                    \
-                      );                                                    \
-                  }                                                         \
-                };                                                          \
-                return ::boost::hana::make_tuple(                           \
-                    BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 19, BOOST_HANA_PP_BACK m20), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 20, BOOST_HANA_PP_BACK m21), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 21, BOOST_HANA_PP_BACK m22), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 22, BOOST_HANA_PP_BACK m23), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 23, BOOST_HANA_PP_BACK m24), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 24, BOOST_HANA_PP_BACK m25), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 25, BOOST_HANA_PP_BACK m26), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 26, BOOST_HANA_PP_BACK m27), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 27, BOOST_HANA_PP_BACK m28), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 28, BOOST_HANA_PP_BACK m29), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 29, BOOST_HANA_PP_BACK m30), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 30, BOOST_HANA_PP_BACK m31), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 31, BOOST_HANA_PP_BACK m32), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 32, BOOST_HANA_PP_BACK m33), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 33, BOOST_HANA_PP_BACK m34), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 34, BOOST_HANA_PP_BACK m35)                          \
-                );                                                          \
-            }                                                               \
-        };                                                                  \
-    }}                                                                      \
-/**/
-
-#define BOOST_HANA_ADAPT_STRUCT_IMPL_37(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36)     \
-    namespace boost { namespace hana {                                      \
-        template <>                                                         \
-        struct accessors_impl<TYPE> {                                       \
-            static constexpr auto apply() {                                 \
-                struct member_names {                                       \
-                  static constexpr auto get() {                             \
-                      return ::boost::hana::make_tuple(                     \
-                          BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m20), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m21), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m22), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m23), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m24), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m25), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m26), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m27), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m28), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m29), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m30), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m31), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m32), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m33), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m34), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m35), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m36)                    \
-                      );                                                    \
-                  }                                                         \
-                };                                                          \
-                return ::boost::hana::make_tuple(                           \
-                    BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 19, BOOST_HANA_PP_BACK m20), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 20, BOOST_HANA_PP_BACK m21), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 21, BOOST_HANA_PP_BACK m22), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 22, BOOST_HANA_PP_BACK m23), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 23, BOOST_HANA_PP_BACK m24), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 24, BOOST_HANA_PP_BACK m25), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 25, BOOST_HANA_PP_BACK m26), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 26, BOOST_HANA_PP_BACK m27), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 27, BOOST_HANA_PP_BACK m28), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 28, BOOST_HANA_PP_BACK m29), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 29, BOOST_HANA_PP_BACK m30), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 30, BOOST_HANA_PP_BACK m31), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 31, BOOST_HANA_PP_BACK m32), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 32, BOOST_HANA_PP_BACK m33), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 33, BOOST_HANA_PP_BACK m34), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 34, BOOST_HANA_PP_BACK m35), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 35, BOOST_HANA_PP_BACK m36)                          \
-                );                                                          \
-            }                                                               \
-        };                                                                  \
-    }}                                                                      \
-/**/
-
-#define BOOST_HANA_ADAPT_STRUCT_IMPL_38(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37)     \
-    namespace boost { namespace hana {                                      \
-        template <>                                                         \
-        struct accessors_impl<TYPE> {                                       \
-            static constexpr auto apply() {                                 \
-                struct member_names {                                       \
-                  static constexpr auto get() {                             \
-                      return ::boost::hana::make_tuple(                     \
-                          BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m20), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m21), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m22), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m23), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m24), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m25), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m26), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m27), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m28), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m29), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m30), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m31), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m32), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m33), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m34), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m35), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m36), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m37)                    \
-                      );                                                    \
-                  }                                                         \
-                };                                                          \
-                return ::boost::hana::make_tuple(                           \
-                    BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 19, BOOST_HANA_PP_BACK m20), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 20, BOOST_HANA_PP_BACK m21), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 21, BOOST_HANA_PP_BACK m22), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 22, BOOST_HANA_PP_BACK m23), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 23, BOOST_HANA_PP_BACK m24), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 24, BOOST_HANA_PP_BACK m25), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 25, BOOST_HANA_PP_BACK m26), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 26, BOOST_HANA_PP_BACK m27), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 27, BOOST_HANA_PP_BACK m28), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 28, BOOST_HANA_PP_BACK m29), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 29, BOOST_HANA_PP_BACK m30), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 30, BOOST_HANA_PP_BACK m31), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 31, BOOST_HANA_PP_BACK m32), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 32, BOOST_HANA_PP_BACK m33), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 33, BOOST_HANA_PP_BACK m34), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 34, BOOST_HANA_PP_BACK m35), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 35, BOOST_HANA_PP_BACK m36), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 36, BOOST_HANA_PP_BACK m37)                          \
-                );                                                          \
-            }                                                               \
-        };                                                                  \
-    }}                                                                      \
-/**/
-
-#define BOOST_HANA_ADAPT_STRUCT_IMPL_39(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38)     \
-    namespace boost { namespace hana {                                      \
-        template <>                                                         \
-        struct accessors_impl<TYPE> {                                       \
-            static constexpr auto apply() {                                 \
-                struct member_names {                                       \
-                  static constexpr auto get() {                             \
-                      return ::boost::hana::make_tuple(                     \
-                          BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m20), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m21), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m22), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m23), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m24), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m25), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m26), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m27), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m28), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m29), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m30), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m31), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m32), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m33), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m34), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m35), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m36), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m37), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m38)                    \
-                      );                                                    \
-                  }                                                         \
-                };                                                          \
-                return ::boost::hana::make_tuple(                           \
-                    BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 19, BOOST_HANA_PP_BACK m20), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 20, BOOST_HANA_PP_BACK m21), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 21, BOOST_HANA_PP_BACK m22), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 22, BOOST_HANA_PP_BACK m23), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 23, BOOST_HANA_PP_BACK m24), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 24, BOOST_HANA_PP_BACK m25), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 25, BOOST_HANA_PP_BACK m26), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 26, BOOST_HANA_PP_BACK m27), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 27, BOOST_HANA_PP_BACK m28), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 28, BOOST_HANA_PP_BACK m29), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 29, BOOST_HANA_PP_BACK m30), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 30, BOOST_HANA_PP_BACK m31), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 31, BOOST_HANA_PP_BACK m32), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 32, BOOST_HANA_PP_BACK m33), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 33, BOOST_HANA_PP_BACK m34), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 34, BOOST_HANA_PP_BACK m35), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 35, BOOST_HANA_PP_BACK m36), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 36, BOOST_HANA_PP_BACK m37), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 37, BOOST_HANA_PP_BACK m38)                          \
-                );                                                          \
-            }                                                               \
-        };                                                                  \
-    }}                                                                      \
-/**/
-
-#define BOOST_HANA_ADAPT_STRUCT_IMPL_40(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39)     \
-    namespace boost { namespace hana {                                      \
-        template <>                                                         \
-        struct accessors_impl<TYPE> {                                       \
-            static constexpr auto apply() {                                 \
-                struct member_names {                                       \
-                  static constexpr auto get() {                             \
-                      return ::boost::hana::make_tuple(                     \
-                          BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m20), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m21), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m22), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m23), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m24), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m25), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m26), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m27), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m28), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m29), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m30), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m31), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m32), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m33), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m34), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m35), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m36), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m37), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m38), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m39)                    \
-                      );                                                    \
-                  }                                                         \
-                };                                                          \
-                return ::boost::hana::make_tuple(                           \
-                    BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 19, BOOST_HANA_PP_BACK m20), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 20, BOOST_HANA_PP_BACK m21), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 21, BOOST_HANA_PP_BACK m22), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 22, BOOST_HANA_PP_BACK m23), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 23, BOOST_HANA_PP_BACK m24), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 24, BOOST_HANA_PP_BACK m25), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 25, BOOST_HANA_PP_BACK m26), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 26, BOOST_HANA_PP_BACK m27), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 27, BOOST_HANA_PP_BACK m28), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 28, BOOST_HANA_PP_BACK m29), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 29, BOOST_HANA_PP_BACK m30), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 30, BOOST_HANA_PP_BACK m31), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 31, BOOST_HANA_PP_BACK m32), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 32, BOOST_HANA_PP_BACK m33), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 33, BOOST_HANA_PP_BACK m34), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 34, BOOST_HANA_PP_BACK m35), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 35, BOOST_HANA_PP_BACK m36), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 36, BOOST_HANA_PP_BACK m37), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 37, BOOST_HANA_PP_BACK m38), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 38, BOOST_HANA_PP_BACK m39)                          \
-                );                                                          \
-            }                                                               \
-        };                                                                  \
-    }}                                                                      \
+//////////////////////////////////////////////////////////////////////////////
+// BOOST_HANA_ADAPT_STRUCT
+//////////////////////////////////////////////////////////////////////////////
+#define BOOST_HANA_ADAPT_STRUCT(...)                                        \
+  BOOST_HANA_ADAPT_STRUCT_IMPL(BOOST_HANA_STRUCT_NARG(__VA_ARGS__), __VA_ARGS__)\
+  static_assert(true, "force the usage of a trailing semicolon")            \
 /**/
 
-#define BOOST_HANA_ADAPT_STRUCT_IMPL_41(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40)     \
+#define BOOST_HANA_ADAPT_STRUCT_IMPL(N, ...)                                \
     namespace boost { namespace hana {                                      \
         template <>                                                         \
-        struct accessors_impl<TYPE> {                                       \
-            static constexpr auto apply() {                                 \
-                struct member_names {                                       \
-                  static constexpr auto get() {                             \
-                      return ::boost::hana::make_tuple(                     \
-                          BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m20), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m21), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m22), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m23), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m24), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m25), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m26), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m27), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m28), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m29), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m30), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m31), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m32), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m33), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m34), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m35), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m36), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m37), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m38), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m39), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m40)                    \
-                      );                                                    \
-                  }                                                         \
-                };                                                          \
-                return ::boost::hana::make_tuple(                           \
-                    BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 19, BOOST_HANA_PP_BACK m20), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 20, BOOST_HANA_PP_BACK m21), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 21, BOOST_HANA_PP_BACK m22), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 22, BOOST_HANA_PP_BACK m23), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 23, BOOST_HANA_PP_BACK m24), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 24, BOOST_HANA_PP_BACK m25), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 25, BOOST_HANA_PP_BACK m26), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 26, BOOST_HANA_PP_BACK m27), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 27, BOOST_HANA_PP_BACK m28), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 28, BOOST_HANA_PP_BACK m29), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 29, BOOST_HANA_PP_BACK m30), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 30, BOOST_HANA_PP_BACK m31), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 31, BOOST_HANA_PP_BACK m32), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 32, BOOST_HANA_PP_BACK m33), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 33, BOOST_HANA_PP_BACK m34), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 34, BOOST_HANA_PP_BACK m35), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 35, BOOST_HANA_PP_BACK m36), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 36, BOOST_HANA_PP_BACK m37), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 37, BOOST_HANA_PP_BACK m38), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 38, BOOST_HANA_PP_BACK m39), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 39, BOOST_HANA_PP_BACK m40)                          \
-                );                                                          \
-            }                                                               \
+        struct accessors_impl<BOOST_HANA_STRUCT_FRONT(__VA_ARGS__)> {       \
+            BOOST_HANA_ACCESSORS_IMPL(N, __VA_ARGS__)                       \
         };                                                                  \
     }}                                                                      \
 /**/
 
-
 //////////////////////////////////////////////////////////////////////////////
 // BOOST_HANA_DEFINE_STRUCT
 //////////////////////////////////////////////////////////////////////////////
 #define BOOST_HANA_DEFINE_STRUCT(...) \
-    BOOST_HANA_DEFINE_STRUCT_IMPL(BOOST_HANA_PP_NARG(__VA_ARGS__), __VA_ARGS__)
-
-#define BOOST_HANA_DEFINE_STRUCT_IMPL(N, ...) \
-    BOOST_HANA_PP_CONCAT(BOOST_HANA_DEFINE_STRUCT_IMPL_, N)(__VA_ARGS__)
-
-
-#define BOOST_HANA_DEFINE_STRUCT_IMPL_1(TYPE )   \
-                                               \
-  struct hana { struct accessors_impl {                                     \
-    static constexpr auto apply() {                                         \
-      struct member_names {                                                 \
-        static constexpr auto get() {                                       \
-            return ::boost::hana::make_tuple(                               \
-                                              \
-            );                                                              \
-        }                                                                   \
-      };                                                                    \
-      return ::boost::hana::make_tuple(                                     \
-                                              \
-      );                                                                    \
-    }                                                                       \
-  }; }                                                                      \
-/**/
-
-#define BOOST_HANA_DEFINE_STRUCT_IMPL_2(TYPE, m1 )   \
-  BOOST_HANA_PP_DROP_BACK m1 BOOST_HANA_PP_BACK m1;                                             \
-  struct hana { struct accessors_impl {                                     \
-    static constexpr auto apply() {                                         \
-      struct member_names {                                                 \
-        static constexpr auto get() {                                       \
-            return ::boost::hana::make_tuple(                               \
-                BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1)                              \
-            );                                                              \
-        }                                                                   \
-      };                                                                    \
-      return ::boost::hana::make_tuple(                                     \
-        BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1)                                      \
-      );                                                                    \
-    }                                                                       \
-  }; }                                                                      \
-/**/
-
-#define BOOST_HANA_DEFINE_STRUCT_IMPL_3(TYPE, m1, m2 )   \
-  BOOST_HANA_PP_DROP_BACK m1 BOOST_HANA_PP_BACK m1; BOOST_HANA_PP_DROP_BACK m2 BOOST_HANA_PP_BACK m2;                                             \
-  struct hana { struct accessors_impl {                                     \
-    static constexpr auto apply() {                                         \
-      struct member_names {                                                 \
-        static constexpr auto get() {                                       \
-            return ::boost::hana::make_tuple(                               \
-                BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2)                              \
-            );                                                              \
-        }                                                                   \
-      };                                                                    \
-      return ::boost::hana::make_tuple(                                     \
-        BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2)                                      \
-      );                                                                    \
-    }                                                                       \
-  }; }                                                                      \
-/**/
-
-#define BOOST_HANA_DEFINE_STRUCT_IMPL_4(TYPE, m1, m2, m3 )   \
-  BOOST_HANA_PP_DROP_BACK m1 BOOST_HANA_PP_BACK m1; BOOST_HANA_PP_DROP_BACK m2 BOOST_HANA_PP_BACK m2; BOOST_HANA_PP_DROP_BACK m3 BOOST_HANA_PP_BACK m3;                                             \
-  struct hana { struct accessors_impl {                                     \
-    static constexpr auto apply() {                                         \
-      struct member_names {                                                 \
-        static constexpr auto get() {                                       \
-            return ::boost::hana::make_tuple(                               \
-                BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3)                              \
-            );                                                              \
-        }                                                                   \
-      };                                                                    \
-      return ::boost::hana::make_tuple(                                     \
-        BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3)                                      \
-      );                                                                    \
-    }                                                                       \
-  }; }                                                                      \
-/**/
-
-#define BOOST_HANA_DEFINE_STRUCT_IMPL_5(TYPE, m1, m2, m3, m4 )   \
-  BOOST_HANA_PP_DROP_BACK m1 BOOST_HANA_PP_BACK m1; BOOST_HANA_PP_DROP_BACK m2 BOOST_HANA_PP_BACK m2; BOOST_HANA_PP_DROP_BACK m3 BOOST_HANA_PP_BACK m3; BOOST_HANA_PP_DROP_BACK m4 BOOST_HANA_PP_BACK m4;                                             \
-  struct hana { struct accessors_impl {                                     \
-    static constexpr auto apply() {                                         \
-      struct member_names {                                                 \
-        static constexpr auto get() {                                       \
-            return ::boost::hana::make_tuple(                               \
-                BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4)                              \
-            );                                                              \
-        }                                                                   \
-      };                                                                    \
-      return ::boost::hana::make_tuple(                                     \
-        BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4)                                      \
-      );                                                                    \
-    }                                                                       \
-  }; }                                                                      \
-/**/
-
-#define BOOST_HANA_DEFINE_STRUCT_IMPL_6(TYPE, m1, m2, m3, m4, m5 )   \
-  BOOST_HANA_PP_DROP_BACK m1 BOOST_HANA_PP_BACK m1; BOOST_HANA_PP_DROP_BACK m2 BOOST_HANA_PP_BACK m2; BOOST_HANA_PP_DROP_BACK m3 BOOST_HANA_PP_BACK m3; BOOST_HANA_PP_DROP_BACK m4 BOOST_HANA_PP_BACK m4; BOOST_HANA_PP_DROP_BACK m5 BOOST_HANA_PP_BACK m5;                                             \
-  struct hana { struct accessors_impl {                                     \
-    static constexpr auto apply() {                                         \
-      struct member_names {                                                 \
-        static constexpr auto get() {                                       \
-            return ::boost::hana::make_tuple(                               \
-                BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5)                              \
-            );                                                              \
-        }                                                                   \
-      };                                                                    \
-      return ::boost::hana::make_tuple(                                     \
-        BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5)                                      \
-      );                                                                    \
-    }                                                                       \
-  }; }                                                                      \
-/**/
-
-#define BOOST_HANA_DEFINE_STRUCT_IMPL_7(TYPE, m1, m2, m3, m4, m5, m6 )   \
-  BOOST_HANA_PP_DROP_BACK m1 BOOST_HANA_PP_BACK m1; BOOST_HANA_PP_DROP_BACK m2 BOOST_HANA_PP_BACK m2; BOOST_HANA_PP_DROP_BACK m3 BOOST_HANA_PP_BACK m3; BOOST_HANA_PP_DROP_BACK m4 BOOST_HANA_PP_BACK m4; BOOST_HANA_PP_DROP_BACK m5 BOOST_HANA_PP_BACK m5; BOOST_HANA_PP_DROP_BACK m6 BOOST_HANA_PP_BACK m6;                                             \
-  struct hana { struct accessors_impl {                                     \
-    static constexpr auto apply() {                                         \
-      struct member_names {                                                 \
-        static constexpr auto get() {                                       \
-            return ::boost::hana::make_tuple(                               \
-                BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6)                              \
-            );                                                              \
-        }                                                                   \
-      };                                                                    \
-      return ::boost::hana::make_tuple(                                     \
-        BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6)                                      \
-      );                                                                    \
-    }                                                                       \
-  }; }                                                                      \
-/**/
-
-#define BOOST_HANA_DEFINE_STRUCT_IMPL_8(TYPE, m1, m2, m3, m4, m5, m6, m7 )   \
-  BOOST_HANA_PP_DROP_BACK m1 BOOST_HANA_PP_BACK m1; BOOST_HANA_PP_DROP_BACK m2 BOOST_HANA_PP_BACK m2; BOOST_HANA_PP_DROP_BACK m3 BOOST_HANA_PP_BACK m3; BOOST_HANA_PP_DROP_BACK m4 BOOST_HANA_PP_BACK m4; BOOST_HANA_PP_DROP_BACK m5 BOOST_HANA_PP_BACK m5; BOOST_HANA_PP_DROP_BACK m6 BOOST_HANA_PP_BACK m6; BOOST_HANA_PP_DROP_BACK m7 BOOST_HANA_PP_BACK m7;                                             \
-  struct hana { struct accessors_impl {                                     \
-    static constexpr auto apply() {                                         \
-      struct member_names {                                                 \
-        static constexpr auto get() {                                       \
-            return ::boost::hana::make_tuple(                               \
-                BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7)                              \
-            );                                                              \
-        }                                                                   \
-      };                                                                    \
-      return ::boost::hana::make_tuple(                                     \
-        BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7)                                      \
-      );                                                                    \
-    }                                                                       \
-  }; }                                                                      \
-/**/
-
-#define BOOST_HANA_DEFINE_STRUCT_IMPL_9(TYPE, m1, m2, m3, m4, m5, m6, m7, m8 )   \
-  BOOST_HANA_PP_DROP_BACK m1 BOOST_HANA_PP_BACK m1; BOOST_HANA_PP_DROP_BACK m2 BOOST_HANA_PP_BACK m2; BOOST_HANA_PP_DROP_BACK m3 BOOST_HANA_PP_BACK m3; BOOST_HANA_PP_DROP_BACK m4 BOOST_HANA_PP_BACK m4; BOOST_HANA_PP_DROP_BACK m5 BOOST_HANA_PP_BACK m5; BOOST_HANA_PP_DROP_BACK m6 BOOST_HANA_PP_BACK m6; BOOST_HANA_PP_DROP_BACK m7 BOOST_HANA_PP_BACK m7; BOOST_HANA_PP_DROP_BACK m8 BOOST_HANA_PP_BACK m8;                                             \
-  struct hana { struct accessors_impl {                                     \
-    static constexpr auto apply() {                                         \
-      struct member_names {                                                 \
-        static constexpr auto get() {                                       \
-            return ::boost::hana::make_tuple(                               \
-                BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8)                              \
-            );                                                              \
-        }                                                                   \
-      };                                                                    \
-      return ::boost::hana::make_tuple(                                     \
-        BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8)                                      \
-      );                                                                    \
-    }                                                                       \
-  }; }                                                                      \
-/**/
-
-#define BOOST_HANA_DEFINE_STRUCT_IMPL_10(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9 )   \
-  BOOST_HANA_PP_DROP_BACK m1 BOOST_HANA_PP_BACK m1; BOOST_HANA_PP_DROP_BACK m2 BOOST_HANA_PP_BACK m2; BOOST_HANA_PP_DROP_BACK m3 BOOST_HANA_PP_BACK m3; BOOST_HANA_PP_DROP_BACK m4 BOOST_HANA_PP_BACK m4; BOOST_HANA_PP_DROP_BACK m5 BOOST_HANA_PP_BACK m5; BOOST_HANA_PP_DROP_BACK m6 BOOST_HANA_PP_BACK m6; BOOST_HANA_PP_DROP_BACK m7 BOOST_HANA_PP_BACK m7; BOOST_HANA_PP_DROP_BACK m8 BOOST_HANA_PP_BACK m8; BOOST_HANA_PP_DROP_BACK m9 BOOST_HANA_PP_BACK m9;                                             \
-  struct hana { struct accessors_impl {                                     \
-    static constexpr auto apply() {                                         \
-      struct member_names {                                                 \
-        static constexpr auto get() {                                       \
-            return ::boost::hana::make_tuple(                               \
-                BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9)                              \
-            );                                                              \
-        }                                                                   \
-      };                                                                    \
-      return ::boost::hana::make_tuple(                                     \
-        BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9)                                      \
-      );                                                                    \
-    }                                                                       \
-  }; }                                                                      \
-/**/
-
-#define BOOST_HANA_DEFINE_STRUCT_IMPL_11(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10 )   \
-  BOOST_HANA_PP_DROP_BACK m1 BOOST_HANA_PP_BACK m1; BOOST_HANA_PP_DROP_BACK m2 BOOST_HANA_PP_BACK m2; BOOST_HANA_PP_DROP_BACK m3 BOOST_HANA_PP_BACK m3; BOOST_HANA_PP_DROP_BACK m4 BOOST_HANA_PP_BACK m4; BOOST_HANA_PP_DROP_BACK m5 BOOST_HANA_PP_BACK m5; BOOST_HANA_PP_DROP_BACK m6 BOOST_HANA_PP_BACK m6; BOOST_HANA_PP_DROP_BACK m7 BOOST_HANA_PP_BACK m7; BOOST_HANA_PP_DROP_BACK m8 BOOST_HANA_PP_BACK m8; BOOST_HANA_PP_DROP_BACK m9 BOOST_HANA_PP_BACK m9; BOOST_HANA_PP_DROP_BACK m10 BOOST_HANA_PP_BACK m10;                                             \
-  struct hana { struct accessors_impl {                                     \
-    static constexpr auto apply() {                                         \
-      struct member_names {                                                 \
-        static constexpr auto get() {                                       \
-            return ::boost::hana::make_tuple(                               \
-                BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10)                              \
-            );                                                              \
-        }                                                                   \
-      };                                                                    \
-      return ::boost::hana::make_tuple(                                     \
-        BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10)                                      \
-      );                                                                    \
-    }                                                                       \
-  }; }                                                                      \
-/**/
-
-#define BOOST_HANA_DEFINE_STRUCT_IMPL_12(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11 )   \
-  BOOST_HANA_PP_DROP_BACK m1 BOOST_HANA_PP_BACK m1; BOOST_HANA_PP_DROP_BACK m2 BOOST_HANA_PP_BACK m2; BOOST_HANA_PP_DROP_BACK m3 BOOST_HANA_PP_BACK m3; BOOST_HANA_PP_DROP_BACK m4 BOOST_HANA_PP_BACK m4; BOOST_HANA_PP_DROP_BACK m5 BOOST_HANA_PP_BACK m5; BOOST_HANA_PP_DROP_BACK m6 BOOST_HANA_PP_BACK m6; BOOST_HANA_PP_DROP_BACK m7 BOOST_HANA_PP_BACK m7; BOOST_HANA_PP_DROP_BACK m8 BOOST_HANA_PP_BACK m8; BOOST_HANA_PP_DROP_BACK m9 BOOST_HANA_PP_BACK m9; BOOST_HANA_PP_DROP_BACK m10 BOOST_HANA_PP_BACK m10; BOOST_HANA_PP_DROP_BACK m11 BOOST_HANA_PP_BACK m11;                                             \
-  struct hana { struct accessors_impl {                                     \
-    static constexpr auto apply() {                                         \
-      struct member_names {                                                 \
-        static constexpr auto get() {                                       \
-            return ::boost::hana::make_tuple(                               \
-                BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11)                              \
-            );                                                              \
-        }                                                                   \
-      };                                                                    \
-      return ::boost::hana::make_tuple(                                     \
-        BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11)                                      \
-      );                                                                    \
-    }                                                                       \
-  }; }                                                                      \
-/**/
-
-#define BOOST_HANA_DEFINE_STRUCT_IMPL_13(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12 )   \
-  BOOST_HANA_PP_DROP_BACK m1 BOOST_HANA_PP_BACK m1; BOOST_HANA_PP_DROP_BACK m2 BOOST_HANA_PP_BACK m2; BOOST_HANA_PP_DROP_BACK m3 BOOST_HANA_PP_BACK m3; BOOST_HANA_PP_DROP_BACK m4 BOOST_HANA_PP_BACK m4; BOOST_HANA_PP_DROP_BACK m5 BOOST_HANA_PP_BACK m5; BOOST_HANA_PP_DROP_BACK m6 BOOST_HANA_PP_BACK m6; BOOST_HANA_PP_DROP_BACK m7 BOOST_HANA_PP_BACK m7; BOOST_HANA_PP_DROP_BACK m8 BOOST_HANA_PP_BACK m8; BOOST_HANA_PP_DROP_BACK m9 BOOST_HANA_PP_BACK m9; BOOST_HANA_PP_DROP_BACK m10 BOOST_HANA_PP_BACK m10; BOOST_HANA_PP_DROP_BACK m11 BOOST_HANA_PP_BACK m11; BOOST_HANA_PP_DROP_BACK m12 BOOST_HANA_PP_BACK m12;                                             \
-  struct hana { struct accessors_impl {                                     \
-    static constexpr auto apply() {                                         \
-      struct member_names {                                                 \
-        static constexpr auto get() {                                       \
-            return ::boost::hana::make_tuple(                               \
-                BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12)                              \
-            );                                                              \
-        }                                                                   \
-      };                                                                    \
-      return ::boost::hana::make_tuple(                                     \
-        BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12)                                      \
-      );                                                                    \
-    }                                                                       \
-  }; }                                                                      \
-/**/
-
-#define BOOST_HANA_DEFINE_STRUCT_IMPL_14(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13 )   \
-  BOOST_HANA_PP_DROP_BACK m1 BOOST_HANA_PP_BACK m1; BOOST_HANA_PP_DROP_BACK m2 BOOST_HANA_PP_BACK m2; BOOST_HANA_PP_DROP_BACK m3 BOOST_HANA_PP_BACK m3; BOOST_HANA_PP_DROP_BACK m4 BOOST_HANA_PP_BACK m4; BOOST_HANA_PP_DROP_BACK m5 BOOST_HANA_PP_BACK m5; BOOST_HANA_PP_DROP_BACK m6 BOOST_HANA_PP_BACK m6; BOOST_HANA_PP_DROP_BACK m7 BOOST_HANA_PP_BACK m7; BOOST_HANA_PP_DROP_BACK m8 BOOST_HANA_PP_BACK m8; BOOST_HANA_PP_DROP_BACK m9 BOOST_HANA_PP_BACK m9; BOOST_HANA_PP_DROP_BACK m10 BOOST_HANA_PP_BACK m10; BOOST_HANA_PP_DROP_BACK m11 BOOST_HANA_PP_BACK m11; BOOST_HANA_PP_DROP_BACK m12 BOOST_HANA_PP_BACK m12; BOOST_HANA_PP_DROP_BACK m13 BOOST_HANA_PP_BACK m13;                                             \
-  struct hana { struct accessors_impl {                                     \
-    static constexpr auto apply() {                                         \
-      struct member_names {                                                 \
-        static constexpr auto get() {                                       \
-            return ::boost::hana::make_tuple(                               \
-                BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13)                              \
-            );                                                              \
-        }                                                                   \
-      };                                                                    \
-      return ::boost::hana::make_tuple(                                     \
-        BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13)                                      \
-      );                                                                    \
-    }                                                                       \
-  }; }                                                                      \
-/**/
-
-#define BOOST_HANA_DEFINE_STRUCT_IMPL_15(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14 )   \
-  BOOST_HANA_PP_DROP_BACK m1 BOOST_HANA_PP_BACK m1; BOOST_HANA_PP_DROP_BACK m2 BOOST_HANA_PP_BACK m2; BOOST_HANA_PP_DROP_BACK m3 BOOST_HANA_PP_BACK m3; BOOST_HANA_PP_DROP_BACK m4 BOOST_HANA_PP_BACK m4; BOOST_HANA_PP_DROP_BACK m5 BOOST_HANA_PP_BACK m5; BOOST_HANA_PP_DROP_BACK m6 BOOST_HANA_PP_BACK m6; BOOST_HANA_PP_DROP_BACK m7 BOOST_HANA_PP_BACK m7; BOOST_HANA_PP_DROP_BACK m8 BOOST_HANA_PP_BACK m8; BOOST_HANA_PP_DROP_BACK m9 BOOST_HANA_PP_BACK m9; BOOST_HANA_PP_DROP_BACK m10 BOOST_HANA_PP_BACK m10; BOOST_HANA_PP_DROP_BACK m11 BOOST_HANA_PP_BACK m11; BOOST_HANA_PP_DROP_BACK m12 BOOST_HANA_PP_BACK m12; BOOST_HANA_PP_DROP_BACK m13 BOOST_HANA_PP_BACK m13; BOOST_HANA_PP_DROP_BACK m14 BOOST_HANA_PP_BACK m14;                                             \
-  struct hana { struct accessors_impl {                                     \
-    static constexpr auto apply() {                                         \
-      struct member_names {                                                 \
-        static constexpr auto get() {                                       \
-            return ::boost::hana::make_tuple(                               \
-                BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14)                              \
-            );                                                              \
-        }                                                                   \
-      };                                                                    \
-      return ::boost::hana::make_tuple(                                     \
-        BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14)                                      \
-      );                                                                    \
-    }                                                                       \
-  }; }                                                                      \
-/**/
-
-#define BOOST_HANA_DEFINE_STRUCT_IMPL_16(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15 )   \
-  BOOST_HANA_PP_DROP_BACK m1 BOOST_HANA_PP_BACK m1; BOOST_HANA_PP_DROP_BACK m2 BOOST_HANA_PP_BACK m2; BOOST_HANA_PP_DROP_BACK m3 BOOST_HANA_PP_BACK m3; BOOST_HANA_PP_DROP_BACK m4 BOOST_HANA_PP_BACK m4; BOOST_HANA_PP_DROP_BACK m5 BOOST_HANA_PP_BACK m5; BOOST_HANA_PP_DROP_BACK m6 BOOST_HANA_PP_BACK m6; BOOST_HANA_PP_DROP_BACK m7 BOOST_HANA_PP_BACK m7; BOOST_HANA_PP_DROP_BACK m8 BOOST_HANA_PP_BACK m8; BOOST_HANA_PP_DROP_BACK m9 BOOST_HANA_PP_BACK m9; BOOST_HANA_PP_DROP_BACK m10 BOOST_HANA_PP_BACK m10; BOOST_HANA_PP_DROP_BACK m11 BOOST_HANA_PP_BACK m11; BOOST_HANA_PP_DROP_BACK m12 BOOST_HANA_PP_BACK m12; BOOST_HANA_PP_DROP_BACK m13 BOOST_HANA_PP_BACK m13; BOOST_HANA_PP_DROP_BACK m14 BOOST_HANA_PP_BACK m14; BOOST_HANA_PP_DROP_BACK m15 BOOST_HANA_PP_BACK m15;                                             \
-  struct hana { struct accessors_impl {                                     \
-    static constexpr auto apply() {                                         \
-      struct member_names {                                                 \
-        static constexpr auto get() {                                       \
-            return ::boost::hana::make_tuple(                               \
-                BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15)                              \
-            );                                                              \
-        }                                                                   \
-      };                                                                    \
-      return ::boost::hana::make_tuple(                                     \
-        BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15)                                      \
-      );                                                                    \
-    }                                                                       \
-  }; }                                                                      \
-/**/
-
-#define BOOST_HANA_DEFINE_STRUCT_IMPL_17(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16 )   \
-  BOOST_HANA_PP_DROP_BACK m1 BOOST_HANA_PP_BACK m1; BOOST_HANA_PP_DROP_BACK m2 BOOST_HANA_PP_BACK m2; BOOST_HANA_PP_DROP_BACK m3 BOOST_HANA_PP_BACK m3; BOOST_HANA_PP_DROP_BACK m4 BOOST_HANA_PP_BACK m4; BOOST_HANA_PP_DROP_BACK m5 BOOST_HANA_PP_BACK m5; BOOST_HANA_PP_DROP_BACK m6 BOOST_HANA_PP_BACK m6; BOOST_HANA_PP_DROP_BACK m7 BOOST_HANA_PP_BACK m7; BOOST_HANA_PP_DROP_BACK m8 BOOST_HANA_PP_BACK m8; BOOST_HANA_PP_DROP_BACK m9 BOOST_HANA_PP_BACK m9; BOOST_HANA_PP_DROP_BACK m10 BOOST_HANA_PP_BACK m10; BOOST_HANA_PP_DROP_BACK m11 BOOST_HANA_PP_BACK m11; BOOST_HANA_PP_DROP_BACK m12 BOOST_HANA_PP_BACK m12; BOOST_HANA_PP_DROP_BACK m13 BOOST_HANA_PP_BACK m13; BOOST_HANA_PP_DROP_BACK m14 BOOST_HANA_PP_BACK m14; BOOST_HANA_PP_DROP_BACK m15 BOOST_HANA_PP_BACK m15; BOOST_HANA_PP_DROP_BACK m16 BOOST_HANA_PP_BACK m16;                                             \
-  struct hana { struct accessors_impl {                                     \
-    static constexpr auto apply() {                                         \
-      struct member_names {                                                 \
-        static constexpr auto get() {                                       \
-            return ::boost::hana::make_tuple(                               \
-                BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16)                              \
-            );                                                              \
-        }                                                                   \
-      };                                                                    \
-      return ::boost::hana::make_tuple(                                     \
-        BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16)                                      \
-      );                                                                    \
-    }                                                                       \
-  }; }                                                                      \
-/**/
-
-#define BOOST_HANA_DEFINE_STRUCT_IMPL_18(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17 )   \
-  BOOST_HANA_PP_DROP_BACK m1 BOOST_HANA_PP_BACK m1; BOOST_HANA_PP_DROP_BACK m2 BOOST_HANA_PP_BACK m2; BOOST_HANA_PP_DROP_BACK m3 BOOST_HANA_PP_BACK m3; BOOST_HANA_PP_DROP_BACK m4 BOOST_HANA_PP_BACK m4; BOOST_HANA_PP_DROP_BACK m5 BOOST_HANA_PP_BACK m5; BOOST_HANA_PP_DROP_BACK m6 BOOST_HANA_PP_BACK m6; BOOST_HANA_PP_DROP_BACK m7 BOOST_HANA_PP_BACK m7; BOOST_HANA_PP_DROP_BACK m8 BOOST_HANA_PP_BACK m8; BOOST_HANA_PP_DROP_BACK m9 BOOST_HANA_PP_BACK m9; BOOST_HANA_PP_DROP_BACK m10 BOOST_HANA_PP_BACK m10; BOOST_HANA_PP_DROP_BACK m11 BOOST_HANA_PP_BACK m11; BOOST_HANA_PP_DROP_BACK m12 BOOST_HANA_PP_BACK m12; BOOST_HANA_PP_DROP_BACK m13 BOOST_HANA_PP_BACK m13; BOOST_HANA_PP_DROP_BACK m14 BOOST_HANA_PP_BACK m14; BOOST_HANA_PP_DROP_BACK m15 BOOST_HANA_PP_BACK m15; BOOST_HANA_PP_DROP_BACK m16 BOOST_HANA_PP_BACK m16; BOOST_HANA_PP_DROP_BACK m17 BOOST_HANA_PP_BACK m17;                                             \
-  struct hana { struct accessors_impl {                                     \
-    static constexpr auto apply() {                                         \
-      struct member_names {                                                 \
-        static constexpr auto get() {                                       \
-            return ::boost::hana::make_tuple(                               \
-                BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17)                              \
-            );                                                              \
-        }                                                                   \
-      };                                                                    \
-      return ::boost::hana::make_tuple(                                     \
-        BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17)                                      \
-      );                                                                    \
-    }                                                                       \
-  }; }                                                                      \
-/**/
-
-#define BOOST_HANA_DEFINE_STRUCT_IMPL_19(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18 )   \
-  BOOST_HANA_PP_DROP_BACK m1 BOOST_HANA_PP_BACK m1; BOOST_HANA_PP_DROP_BACK m2 BOOST_HANA_PP_BACK m2; BOOST_HANA_PP_DROP_BACK m3 BOOST_HANA_PP_BACK m3; BOOST_HANA_PP_DROP_BACK m4 BOOST_HANA_PP_BACK m4; BOOST_HANA_PP_DROP_BACK m5 BOOST_HANA_PP_BACK m5; BOOST_HANA_PP_DROP_BACK m6 BOOST_HANA_PP_BACK m6; BOOST_HANA_PP_DROP_BACK m7 BOOST_HANA_PP_BACK m7; BOOST_HANA_PP_DROP_BACK m8 BOOST_HANA_PP_BACK m8; BOOST_HANA_PP_DROP_BACK m9 BOOST_HANA_PP_BACK m9; BOOST_HANA_PP_DROP_BACK m10 BOOST_HANA_PP_BACK m10; BOOST_HANA_PP_DROP_BACK m11 BOOST_HANA_PP_BACK m11; BOOST_HANA_PP_DROP_BACK m12 BOOST_HANA_PP_BACK m12; BOOST_HANA_PP_DROP_BACK m13 BOOST_HANA_PP_BACK m13; BOOST_HANA_PP_DROP_BACK m14 BOOST_HANA_PP_BACK m14; BOOST_HANA_PP_DROP_BACK m15 BOOST_HANA_PP_BACK m15; BOOST_HANA_PP_DROP_BACK m16 BOOST_HANA_PP_BACK m16; BOOST_HANA_PP_DROP_BACK m17 BOOST_HANA_PP_BACK m17; BOOST_HANA_PP_DROP_BACK m18 BOOST_HANA_PP_BACK m18;                                             \
-  struct hana { struct accessors_impl {                                     \
-    static constexpr auto apply() {                                         \
-      struct member_names {                                                 \
-        static constexpr auto get() {                                       \
-            return ::boost::hana::make_tuple(                               \
-                BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18)                              \
-            );                                                              \
-        }                                                                   \
-      };                                                                    \
-      return ::boost::hana::make_tuple(                                     \
-        BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18)                                      \
-      );                                                                    \
-    }                                                                       \
-  }; }                                                                      \
-/**/
-
-#define BOOST_HANA_DEFINE_STRUCT_IMPL_20(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19 )   \
-  BOOST_HANA_PP_DROP_BACK m1 BOOST_HANA_PP_BACK m1; BOOST_HANA_PP_DROP_BACK m2 BOOST_HANA_PP_BACK m2; BOOST_HANA_PP_DROP_BACK m3 BOOST_HANA_PP_BACK m3; BOOST_HANA_PP_DROP_BACK m4 BOOST_HANA_PP_BACK m4; BOOST_HANA_PP_DROP_BACK m5 BOOST_HANA_PP_BACK m5; BOOST_HANA_PP_DROP_BACK m6 BOOST_HANA_PP_BACK m6; BOOST_HANA_PP_DROP_BACK m7 BOOST_HANA_PP_BACK m7; BOOST_HANA_PP_DROP_BACK m8 BOOST_HANA_PP_BACK m8; BOOST_HANA_PP_DROP_BACK m9 BOOST_HANA_PP_BACK m9; BOOST_HANA_PP_DROP_BACK m10 BOOST_HANA_PP_BACK m10; BOOST_HANA_PP_DROP_BACK m11 BOOST_HANA_PP_BACK m11; BOOST_HANA_PP_DROP_BACK m12 BOOST_HANA_PP_BACK m12; BOOST_HANA_PP_DROP_BACK m13 BOOST_HANA_PP_BACK m13; BOOST_HANA_PP_DROP_BACK m14 BOOST_HANA_PP_BACK m14; BOOST_HANA_PP_DROP_BACK m15 BOOST_HANA_PP_BACK m15; BOOST_HANA_PP_DROP_BACK m16 BOOST_HANA_PP_BACK m16; BOOST_HANA_PP_DROP_BACK m17 BOOST_HANA_PP_BACK m17; BOOST_HANA_PP_DROP_BACK m18 BOOST_HANA_PP_BACK m18; BOOST_HANA_PP_DROP_BACK m19 BOOST_HANA_PP_BACK m19;                                             \
-  struct hana { struct accessors_impl {                                     \
-    static constexpr auto apply() {                                         \
-      struct member_names {                                                 \
-        static constexpr auto get() {                                       \
-            return ::boost::hana::make_tuple(                               \
-                BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19)                              \
-            );                                                              \
-        }                                                                   \
-      };                                                                    \
-      return ::boost::hana::make_tuple(                                     \
-        BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19)                                      \
-      );                                                                    \
-    }                                                                       \
-  }; }                                                                      \
-/**/
-
-#define BOOST_HANA_DEFINE_STRUCT_IMPL_21(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20 )   \
-  BOOST_HANA_PP_DROP_BACK m1 BOOST_HANA_PP_BACK m1; BOOST_HANA_PP_DROP_BACK m2 BOOST_HANA_PP_BACK m2; BOOST_HANA_PP_DROP_BACK m3 BOOST_HANA_PP_BACK m3; BOOST_HANA_PP_DROP_BACK m4 BOOST_HANA_PP_BACK m4; BOOST_HANA_PP_DROP_BACK m5 BOOST_HANA_PP_BACK m5; BOOST_HANA_PP_DROP_BACK m6 BOOST_HANA_PP_BACK m6; BOOST_HANA_PP_DROP_BACK m7 BOOST_HANA_PP_BACK m7; BOOST_HANA_PP_DROP_BACK m8 BOOST_HANA_PP_BACK m8; BOOST_HANA_PP_DROP_BACK m9 BOOST_HANA_PP_BACK m9; BOOST_HANA_PP_DROP_BACK m10 BOOST_HANA_PP_BACK m10; BOOST_HANA_PP_DROP_BACK m11 BOOST_HANA_PP_BACK m11; BOOST_HANA_PP_DROP_BACK m12 BOOST_HANA_PP_BACK m12; BOOST_HANA_PP_DROP_BACK m13 BOOST_HANA_PP_BACK m13; BOOST_HANA_PP_DROP_BACK m14 BOOST_HANA_PP_BACK m14; BOOST_HANA_PP_DROP_BACK m15 BOOST_HANA_PP_BACK m15; BOOST_HANA_PP_DROP_BACK m16 BOOST_HANA_PP_BACK m16; BOOST_HANA_PP_DROP_BACK m17 BOOST_HANA_PP_BACK m17; BOOST_HANA_PP_DROP_BACK m18 BOOST_HANA_PP_BACK m18; BOOST_HANA_PP_DROP_BACK m19 BOOST_HANA_PP_BACK m19; BOOST_HANA_PP_DROP_BACK m20 BOOST_HANA_PP_BACK m20;                                             \
-  struct hana { struct accessors_impl {                                     \
-    static constexpr auto apply() {                                         \
-      struct member_names {                                                 \
-        static constexpr auto get() {                                       \
-            return ::boost::hana::make_tuple(                               \
-                BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m20)                              \
-            );                                                              \
-        }                                                                   \
-      };                                                                    \
-      return ::boost::hana::make_tuple(                                     \
-        BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 19, BOOST_HANA_PP_BACK m20)                                      \
-      );                                                                    \
-    }                                                                       \
-  }; }                                                                      \
-/**/
-
-#define BOOST_HANA_DEFINE_STRUCT_IMPL_22(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21 )   \
-  BOOST_HANA_PP_DROP_BACK m1 BOOST_HANA_PP_BACK m1; BOOST_HANA_PP_DROP_BACK m2 BOOST_HANA_PP_BACK m2; BOOST_HANA_PP_DROP_BACK m3 BOOST_HANA_PP_BACK m3; BOOST_HANA_PP_DROP_BACK m4 BOOST_HANA_PP_BACK m4; BOOST_HANA_PP_DROP_BACK m5 BOOST_HANA_PP_BACK m5; BOOST_HANA_PP_DROP_BACK m6 BOOST_HANA_PP_BACK m6; BOOST_HANA_PP_DROP_BACK m7 BOOST_HANA_PP_BACK m7; BOOST_HANA_PP_DROP_BACK m8 BOOST_HANA_PP_BACK m8; BOOST_HANA_PP_DROP_BACK m9 BOOST_HANA_PP_BACK m9; BOOST_HANA_PP_DROP_BACK m10 BOOST_HANA_PP_BACK m10; BOOST_HANA_PP_DROP_BACK m11 BOOST_HANA_PP_BACK m11; BOOST_HANA_PP_DROP_BACK m12 BOOST_HANA_PP_BACK m12; BOOST_HANA_PP_DROP_BACK m13 BOOST_HANA_PP_BACK m13; BOOST_HANA_PP_DROP_BACK m14 BOOST_HANA_PP_BACK m14; BOOST_HANA_PP_DROP_BACK m15 BOOST_HANA_PP_BACK m15; BOOST_HANA_PP_DROP_BACK m16 BOOST_HANA_PP_BACK m16; BOOST_HANA_PP_DROP_BACK m17 BOOST_HANA_PP_BACK m17; BOOST_HANA_PP_DROP_BACK m18 BOOST_HANA_PP_BACK m18; BOOST_HANA_PP_DROP_BACK m19 BOOST_HANA_PP_BACK m19; BOOST_HANA_PP_DROP_BACK m20 BOOST_HANA_PP_BACK m20; BOOST_HANA_PP_DROP_BACK m21 BOOST_HANA_PP_BACK m21;                                             \
-  struct hana { struct accessors_impl {                                     \
-    static constexpr auto apply() {                                         \
-      struct member_names {                                                 \
-        static constexpr auto get() {                                       \
-            return ::boost::hana::make_tuple(                               \
-                BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m20), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m21)                              \
-            );                                                              \
-        }                                                                   \
-      };                                                                    \
-      return ::boost::hana::make_tuple(                                     \
-        BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 19, BOOST_HANA_PP_BACK m20), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 20, BOOST_HANA_PP_BACK m21)                                      \
-      );                                                                    \
-    }                                                                       \
-  }; }                                                                      \
-/**/
-
-#define BOOST_HANA_DEFINE_STRUCT_IMPL_23(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22 )   \
-  BOOST_HANA_PP_DROP_BACK m1 BOOST_HANA_PP_BACK m1; BOOST_HANA_PP_DROP_BACK m2 BOOST_HANA_PP_BACK m2; BOOST_HANA_PP_DROP_BACK m3 BOOST_HANA_PP_BACK m3; BOOST_HANA_PP_DROP_BACK m4 BOOST_HANA_PP_BACK m4; BOOST_HANA_PP_DROP_BACK m5 BOOST_HANA_PP_BACK m5; BOOST_HANA_PP_DROP_BACK m6 BOOST_HANA_PP_BACK m6; BOOST_HANA_PP_DROP_BACK m7 BOOST_HANA_PP_BACK m7; BOOST_HANA_PP_DROP_BACK m8 BOOST_HANA_PP_BACK m8; BOOST_HANA_PP_DROP_BACK m9 BOOST_HANA_PP_BACK m9; BOOST_HANA_PP_DROP_BACK m10 BOOST_HANA_PP_BACK m10; BOOST_HANA_PP_DROP_BACK m11 BOOST_HANA_PP_BACK m11; BOOST_HANA_PP_DROP_BACK m12 BOOST_HANA_PP_BACK m12; BOOST_HANA_PP_DROP_BACK m13 BOOST_HANA_PP_BACK m13; BOOST_HANA_PP_DROP_BACK m14 BOOST_HANA_PP_BACK m14; BOOST_HANA_PP_DROP_BACK m15 BOOST_HANA_PP_BACK m15; BOOST_HANA_PP_DROP_BACK m16 BOOST_HANA_PP_BACK m16; BOOST_HANA_PP_DROP_BACK m17 BOOST_HANA_PP_BACK m17; BOOST_HANA_PP_DROP_BACK m18 BOOST_HANA_PP_BACK m18; BOOST_HANA_PP_DROP_BACK m19 BOOST_HANA_PP_BACK m19; BOOST_HANA_PP_DROP_BACK m20 BOOST_HANA_PP_BACK m20; BOOST_HANA_PP_DROP_BACK m21 BOOST_HANA_PP_BACK m21; BOOST_HANA_PP_DROP_BACK m22 BOOST_HANA_PP_BACK m22;                                             \
-  struct hana { struct accessors_impl {                                     \
-    static constexpr auto apply() {                                         \
-      struct member_names {                                                 \
-        static constexpr auto get() {                                       \
-            return ::boost::hana::make_tuple(                               \
-                BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m20), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m21), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m22)                              \
-            );                                                              \
-        }                                                                   \
-      };                                                                    \
-      return ::boost::hana::make_tuple(                                     \
-        BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 19, BOOST_HANA_PP_BACK m20), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 20, BOOST_HANA_PP_BACK m21), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 21, BOOST_HANA_PP_BACK m22)                                      \
-      );                                                                    \
-    }                                                                       \
-  }; }                                                                      \
-/**/
-
-#define BOOST_HANA_DEFINE_STRUCT_IMPL_24(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23 )   \
-  BOOST_HANA_PP_DROP_BACK m1 BOOST_HANA_PP_BACK m1; BOOST_HANA_PP_DROP_BACK m2 BOOST_HANA_PP_BACK m2; BOOST_HANA_PP_DROP_BACK m3 BOOST_HANA_PP_BACK m3; BOOST_HANA_PP_DROP_BACK m4 BOOST_HANA_PP_BACK m4; BOOST_HANA_PP_DROP_BACK m5 BOOST_HANA_PP_BACK m5; BOOST_HANA_PP_DROP_BACK m6 BOOST_HANA_PP_BACK m6; BOOST_HANA_PP_DROP_BACK m7 BOOST_HANA_PP_BACK m7; BOOST_HANA_PP_DROP_BACK m8 BOOST_HANA_PP_BACK m8; BOOST_HANA_PP_DROP_BACK m9 BOOST_HANA_PP_BACK m9; BOOST_HANA_PP_DROP_BACK m10 BOOST_HANA_PP_BACK m10; BOOST_HANA_PP_DROP_BACK m11 BOOST_HANA_PP_BACK m11; BOOST_HANA_PP_DROP_BACK m12 BOOST_HANA_PP_BACK m12; BOOST_HANA_PP_DROP_BACK m13 BOOST_HANA_PP_BACK m13; BOOST_HANA_PP_DROP_BACK m14 BOOST_HANA_PP_BACK m14; BOOST_HANA_PP_DROP_BACK m15 BOOST_HANA_PP_BACK m15; BOOST_HANA_PP_DROP_BACK m16 BOOST_HANA_PP_BACK m16; BOOST_HANA_PP_DROP_BACK m17 BOOST_HANA_PP_BACK m17; BOOST_HANA_PP_DROP_BACK m18 BOOST_HANA_PP_BACK m18; BOOST_HANA_PP_DROP_BACK m19 BOOST_HANA_PP_BACK m19; BOOST_HANA_PP_DROP_BACK m20 BOOST_HANA_PP_BACK m20; BOOST_HANA_PP_DROP_BACK m21 BOOST_HANA_PP_BACK m21; BOOST_HANA_PP_DROP_BACK m22 BOOST_HANA_PP_BACK m22; BOOST_HANA_PP_DROP_BACK m23 BOOST_HANA_PP_BACK m23;                                             \
-  struct hana { struct accessors_impl {                                     \
-    static constexpr auto apply() {                                         \
-      struct member_names {                                                 \
-        static constexpr auto get() {                                       \
-            return ::boost::hana::make_tuple(                               \
-                BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m20), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m21), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m22), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m23)                              \
-            );                                                              \
-        }                                                                   \
-      };                                                                    \
-      return ::boost::hana::make_tuple(                                     \
-        BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 19, BOOST_HANA_PP_BACK m20), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 20, BOOST_HANA_PP_BACK m21), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 21, BOOST_HANA_PP_BACK m22), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 22, BOOST_HANA_PP_BACK m23)                                      \
-      );                                                                    \
-    }                                                                       \
-  }; }                                                                      \
-/**/
-
-#define BOOST_HANA_DEFINE_STRUCT_IMPL_25(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24 )   \
-  BOOST_HANA_PP_DROP_BACK m1 BOOST_HANA_PP_BACK m1; BOOST_HANA_PP_DROP_BACK m2 BOOST_HANA_PP_BACK m2; BOOST_HANA_PP_DROP_BACK m3 BOOST_HANA_PP_BACK m3; BOOST_HANA_PP_DROP_BACK m4 BOOST_HANA_PP_BACK m4; BOOST_HANA_PP_DROP_BACK m5 BOOST_HANA_PP_BACK m5; BOOST_HANA_PP_DROP_BACK m6 BOOST_HANA_PP_BACK m6; BOOST_HANA_PP_DROP_BACK m7 BOOST_HANA_PP_BACK m7; BOOST_HANA_PP_DROP_BACK m8 BOOST_HANA_PP_BACK m8; BOOST_HANA_PP_DROP_BACK m9 BOOST_HANA_PP_BACK m9; BOOST_HANA_PP_DROP_BACK m10 BOOST_HANA_PP_BACK m10; BOOST_HANA_PP_DROP_BACK m11 BOOST_HANA_PP_BACK m11; BOOST_HANA_PP_DROP_BACK m12 BOOST_HANA_PP_BACK m12; BOOST_HANA_PP_DROP_BACK m13 BOOST_HANA_PP_BACK m13; BOOST_HANA_PP_DROP_BACK m14 BOOST_HANA_PP_BACK m14; BOOST_HANA_PP_DROP_BACK m15 BOOST_HANA_PP_BACK m15; BOOST_HANA_PP_DROP_BACK m16 BOOST_HANA_PP_BACK m16; BOOST_HANA_PP_DROP_BACK m17 BOOST_HANA_PP_BACK m17; BOOST_HANA_PP_DROP_BACK m18 BOOST_HANA_PP_BACK m18; BOOST_HANA_PP_DROP_BACK m19 BOOST_HANA_PP_BACK m19; BOOST_HANA_PP_DROP_BACK m20 BOOST_HANA_PP_BACK m20; BOOST_HANA_PP_DROP_BACK m21 BOOST_HANA_PP_BACK m21; BOOST_HANA_PP_DROP_BACK m22 BOOST_HANA_PP_BACK m22; BOOST_HANA_PP_DROP_BACK m23 BOOST_HANA_PP_BACK m23; BOOST_HANA_PP_DROP_BACK m24 BOOST_HANA_PP_BACK m24;                                             \
-  struct hana { struct accessors_impl {                                     \
-    static constexpr auto apply() {                                         \
-      struct member_names {                                                 \
-        static constexpr auto get() {                                       \
-            return ::boost::hana::make_tuple(                               \
-                BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m20), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m21), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m22), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m23), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m24)                              \
-            );                                                              \
-        }                                                                   \
-      };                                                                    \
-      return ::boost::hana::make_tuple(                                     \
-        BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 19, BOOST_HANA_PP_BACK m20), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 20, BOOST_HANA_PP_BACK m21), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 21, BOOST_HANA_PP_BACK m22), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 22, BOOST_HANA_PP_BACK m23), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 23, BOOST_HANA_PP_BACK m24)                                      \
-      );                                                                    \
-    }                                                                       \
-  }; }                                                                      \
-/**/
-
-#define BOOST_HANA_DEFINE_STRUCT_IMPL_26(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25 )   \
-  BOOST_HANA_PP_DROP_BACK m1 BOOST_HANA_PP_BACK m1; BOOST_HANA_PP_DROP_BACK m2 BOOST_HANA_PP_BACK m2; BOOST_HANA_PP_DROP_BACK m3 BOOST_HANA_PP_BACK m3; BOOST_HANA_PP_DROP_BACK m4 BOOST_HANA_PP_BACK m4; BOOST_HANA_PP_DROP_BACK m5 BOOST_HANA_PP_BACK m5; BOOST_HANA_PP_DROP_BACK m6 BOOST_HANA_PP_BACK m6; BOOST_HANA_PP_DROP_BACK m7 BOOST_HANA_PP_BACK m7; BOOST_HANA_PP_DROP_BACK m8 BOOST_HANA_PP_BACK m8; BOOST_HANA_PP_DROP_BACK m9 BOOST_HANA_PP_BACK m9; BOOST_HANA_PP_DROP_BACK m10 BOOST_HANA_PP_BACK m10; BOOST_HANA_PP_DROP_BACK m11 BOOST_HANA_PP_BACK m11; BOOST_HANA_PP_DROP_BACK m12 BOOST_HANA_PP_BACK m12; BOOST_HANA_PP_DROP_BACK m13 BOOST_HANA_PP_BACK m13; BOOST_HANA_PP_DROP_BACK m14 BOOST_HANA_PP_BACK m14; BOOST_HANA_PP_DROP_BACK m15 BOOST_HANA_PP_BACK m15; BOOST_HANA_PP_DROP_BACK m16 BOOST_HANA_PP_BACK m16; BOOST_HANA_PP_DROP_BACK m17 BOOST_HANA_PP_BACK m17; BOOST_HANA_PP_DROP_BACK m18 BOOST_HANA_PP_BACK m18; BOOST_HANA_PP_DROP_BACK m19 BOOST_HANA_PP_BACK m19; BOOST_HANA_PP_DROP_BACK m20 BOOST_HANA_PP_BACK m20; BOOST_HANA_PP_DROP_BACK m21 BOOST_HANA_PP_BACK m21; BOOST_HANA_PP_DROP_BACK m22 BOOST_HANA_PP_BACK m22; BOOST_HANA_PP_DROP_BACK m23 BOOST_HANA_PP_BACK m23; BOOST_HANA_PP_DROP_BACK m24 BOOST_HANA_PP_BACK m24; BOOST_HANA_PP_DROP_BACK m25 BOOST_HANA_PP_BACK m25;                                             \
-  struct hana { struct accessors_impl {                                     \
-    static constexpr auto apply() {                                         \
-      struct member_names {                                                 \
-        static constexpr auto get() {                                       \
-            return ::boost::hana::make_tuple(                               \
-                BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m20), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m21), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m22), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m23), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m24), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m25)                              \
-            );                                                              \
-        }                                                                   \
-      };                                                                    \
-      return ::boost::hana::make_tuple(                                     \
-        BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 19, BOOST_HANA_PP_BACK m20), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 20, BOOST_HANA_PP_BACK m21), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 21, BOOST_HANA_PP_BACK m22), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 22, BOOST_HANA_PP_BACK m23), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 23, BOOST_HANA_PP_BACK m24), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 24, BOOST_HANA_PP_BACK m25)                                      \
-      );                                                                    \
-    }                                                                       \
-  }; }                                                                      \
-/**/
-
-#define BOOST_HANA_DEFINE_STRUCT_IMPL_27(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26 )   \
-  BOOST_HANA_PP_DROP_BACK m1 BOOST_HANA_PP_BACK m1; BOOST_HANA_PP_DROP_BACK m2 BOOST_HANA_PP_BACK m2; BOOST_HANA_PP_DROP_BACK m3 BOOST_HANA_PP_BACK m3; BOOST_HANA_PP_DROP_BACK m4 BOOST_HANA_PP_BACK m4; BOOST_HANA_PP_DROP_BACK m5 BOOST_HANA_PP_BACK m5; BOOST_HANA_PP_DROP_BACK m6 BOOST_HANA_PP_BACK m6; BOOST_HANA_PP_DROP_BACK m7 BOOST_HANA_PP_BACK m7; BOOST_HANA_PP_DROP_BACK m8 BOOST_HANA_PP_BACK m8; BOOST_HANA_PP_DROP_BACK m9 BOOST_HANA_PP_BACK m9; BOOST_HANA_PP_DROP_BACK m10 BOOST_HANA_PP_BACK m10; BOOST_HANA_PP_DROP_BACK m11 BOOST_HANA_PP_BACK m11; BOOST_HANA_PP_DROP_BACK m12 BOOST_HANA_PP_BACK m12; BOOST_HANA_PP_DROP_BACK m13 BOOST_HANA_PP_BACK m13; BOOST_HANA_PP_DROP_BACK m14 BOOST_HANA_PP_BACK m14; BOOST_HANA_PP_DROP_BACK m15 BOOST_HANA_PP_BACK m15; BOOST_HANA_PP_DROP_BACK m16 BOOST_HANA_PP_BACK m16; BOOST_HANA_PP_DROP_BACK m17 BOOST_HANA_PP_BACK m17; BOOST_HANA_PP_DROP_BACK m18 BOOST_HANA_PP_BACK m18; BOOST_HANA_PP_DROP_BACK m19 BOOST_HANA_PP_BACK m19; BOOST_HANA_PP_DROP_BACK m20 BOOST_HANA_PP_BACK m20; BOOST_HANA_PP_DROP_BACK m21 BOOST_HANA_PP_BACK m21; BOOST_HANA_PP_DROP_BACK m22 BOOST_HANA_PP_BACK m22; BOOST_HANA_PP_DROP_BACK m23 BOOST_HANA_PP_BACK m23; BOOST_HANA_PP_DROP_BACK m24 BOOST_HANA_PP_BACK m24; BOOST_HANA_PP_DROP_BACK m25 BOOST_HANA_PP_BACK m25; BOOST_HANA_PP_DROP_BACK m26 BOOST_HANA_PP_BACK m26;                                             \
-  struct hana { struct accessors_impl {                                     \
-    static constexpr auto apply() {                                         \
-      struct member_names {                                                 \
-        static constexpr auto get() {                                       \
-            return ::boost::hana::make_tuple(                               \
-                BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m20), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m21), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m22), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m23), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m24), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m25), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m26)                              \
-            );                                                              \
-        }                                                                   \
-      };                                                                    \
-      return ::boost::hana::make_tuple(                                     \
-        BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 19, BOOST_HANA_PP_BACK m20), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 20, BOOST_HANA_PP_BACK m21), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 21, BOOST_HANA_PP_BACK m22), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 22, BOOST_HANA_PP_BACK m23), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 23, BOOST_HANA_PP_BACK m24), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 24, BOOST_HANA_PP_BACK m25), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 25, BOOST_HANA_PP_BACK m26)                                      \
-      );                                                                    \
-    }                                                                       \
-  }; }                                                                      \
-/**/
-
-#define BOOST_HANA_DEFINE_STRUCT_IMPL_28(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27 )   \
-  BOOST_HANA_PP_DROP_BACK m1 BOOST_HANA_PP_BACK m1; BOOST_HANA_PP_DROP_BACK m2 BOOST_HANA_PP_BACK m2; BOOST_HANA_PP_DROP_BACK m3 BOOST_HANA_PP_BACK m3; BOOST_HANA_PP_DROP_BACK m4 BOOST_HANA_PP_BACK m4; BOOST_HANA_PP_DROP_BACK m5 BOOST_HANA_PP_BACK m5; BOOST_HANA_PP_DROP_BACK m6 BOOST_HANA_PP_BACK m6; BOOST_HANA_PP_DROP_BACK m7 BOOST_HANA_PP_BACK m7; BOOST_HANA_PP_DROP_BACK m8 BOOST_HANA_PP_BACK m8; BOOST_HANA_PP_DROP_BACK m9 BOOST_HANA_PP_BACK m9; BOOST_HANA_PP_DROP_BACK m10 BOOST_HANA_PP_BACK m10; BOOST_HANA_PP_DROP_BACK m11 BOOST_HANA_PP_BACK m11; BOOST_HANA_PP_DROP_BACK m12 BOOST_HANA_PP_BACK m12; BOOST_HANA_PP_DROP_BACK m13 BOOST_HANA_PP_BACK m13; BOOST_HANA_PP_DROP_BACK m14 BOOST_HANA_PP_BACK m14; BOOST_HANA_PP_DROP_BACK m15 BOOST_HANA_PP_BACK m15; BOOST_HANA_PP_DROP_BACK m16 BOOST_HANA_PP_BACK m16; BOOST_HANA_PP_DROP_BACK m17 BOOST_HANA_PP_BACK m17; BOOST_HANA_PP_DROP_BACK m18 BOOST_HANA_PP_BACK m18; BOOST_HANA_PP_DROP_BACK m19 BOOST_HANA_PP_BACK m19; BOOST_HANA_PP_DROP_BACK m20 BOOST_HANA_PP_BACK m20; BOOST_HANA_PP_DROP_BACK m21 BOOST_HANA_PP_BACK m21; BOOST_HANA_PP_DROP_BACK m22 BOOST_HANA_PP_BACK m22; BOOST_HANA_PP_DROP_BACK m23 BOOST_HANA_PP_BACK m23; BOOST_HANA_PP_DROP_BACK m24 BOOST_HANA_PP_BACK m24; BOOST_HANA_PP_DROP_BACK m25 BOOST_HANA_PP_BACK m25; BOOST_HANA_PP_DROP_BACK m26 BOOST_HANA_PP_BACK m26; BOOST_HANA_PP_DROP_BACK m27 BOOST_HANA_PP_BACK m27;                                             \
-  struct hana { struct accessors_impl {                                     \
-    static constexpr auto apply() {                                         \
-      struct member_names {                                                 \
-        static constexpr auto get() {                                       \
-            return ::boost::hana::make_tuple(                               \
-                BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m20), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m21), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m22), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m23), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m24), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m25), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m26), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m27)                              \
-            );                                                              \
-        }                                                                   \
-      };                                                                    \
-      return ::boost::hana::make_tuple(                                     \
-        BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 19, BOOST_HANA_PP_BACK m20), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 20, BOOST_HANA_PP_BACK m21), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 21, BOOST_HANA_PP_BACK m22), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 22, BOOST_HANA_PP_BACK m23), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 23, BOOST_HANA_PP_BACK m24), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 24, BOOST_HANA_PP_BACK m25), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 25, BOOST_HANA_PP_BACK m26), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 26, BOOST_HANA_PP_BACK m27)                                      \
-      );                                                                    \
-    }                                                                       \
-  }; }                                                                      \
-/**/
-
-#define BOOST_HANA_DEFINE_STRUCT_IMPL_29(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28 )   \
-  BOOST_HANA_PP_DROP_BACK m1 BOOST_HANA_PP_BACK m1; BOOST_HANA_PP_DROP_BACK m2 BOOST_HANA_PP_BACK m2; BOOST_HANA_PP_DROP_BACK m3 BOOST_HANA_PP_BACK m3; BOOST_HANA_PP_DROP_BACK m4 BOOST_HANA_PP_BACK m4; BOOST_HANA_PP_DROP_BACK m5 BOOST_HANA_PP_BACK m5; BOOST_HANA_PP_DROP_BACK m6 BOOST_HANA_PP_BACK m6; BOOST_HANA_PP_DROP_BACK m7 BOOST_HANA_PP_BACK m7; BOOST_HANA_PP_DROP_BACK m8 BOOST_HANA_PP_BACK m8; BOOST_HANA_PP_DROP_BACK m9 BOOST_HANA_PP_BACK m9; BOOST_HANA_PP_DROP_BACK m10 BOOST_HANA_PP_BACK m10; BOOST_HANA_PP_DROP_BACK m11 BOOST_HANA_PP_BACK m11; BOOST_HANA_PP_DROP_BACK m12 BOOST_HANA_PP_BACK m12; BOOST_HANA_PP_DROP_BACK m13 BOOST_HANA_PP_BACK m13; BOOST_HANA_PP_DROP_BACK m14 BOOST_HANA_PP_BACK m14; BOOST_HANA_PP_DROP_BACK m15 BOOST_HANA_PP_BACK m15; BOOST_HANA_PP_DROP_BACK m16 BOOST_HANA_PP_BACK m16; BOOST_HANA_PP_DROP_BACK m17 BOOST_HANA_PP_BACK m17; BOOST_HANA_PP_DROP_BACK m18 BOOST_HANA_PP_BACK m18; BOOST_HANA_PP_DROP_BACK m19 BOOST_HANA_PP_BACK m19; BOOST_HANA_PP_DROP_BACK m20 BOOST_HANA_PP_BACK m20; BOOST_HANA_PP_DROP_BACK m21 BOOST_HANA_PP_BACK m21; BOOST_HANA_PP_DROP_BACK m22 BOOST_HANA_PP_BACK m22; BOOST_HANA_PP_DROP_BACK m23 BOOST_HANA_PP_BACK m23; BOOST_HANA_PP_DROP_BACK m24 BOOST_HANA_PP_BACK m24; BOOST_HANA_PP_DROP_BACK m25 BOOST_HANA_PP_BACK m25; BOOST_HANA_PP_DROP_BACK m26 BOOST_HANA_PP_BACK m26; BOOST_HANA_PP_DROP_BACK m27 BOOST_HANA_PP_BACK m27; BOOST_HANA_PP_DROP_BACK m28 BOOST_HANA_PP_BACK m28;                                             \
-  struct hana { struct accessors_impl {                                     \
-    static constexpr auto apply() {                                         \
-      struct member_names {                                                 \
-        static constexpr auto get() {                                       \
-            return ::boost::hana::make_tuple(                               \
-                BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m20), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m21), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m22), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m23), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m24), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m25), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m26), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m27), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m28)                              \
-            );                                                              \
-        }                                                                   \
-      };                                                                    \
-      return ::boost::hana::make_tuple(                                     \
-        BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 19, BOOST_HANA_PP_BACK m20), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 20, BOOST_HANA_PP_BACK m21), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 21, BOOST_HANA_PP_BACK m22), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 22, BOOST_HANA_PP_BACK m23), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 23, BOOST_HANA_PP_BACK m24), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 24, BOOST_HANA_PP_BACK m25), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 25, BOOST_HANA_PP_BACK m26), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 26, BOOST_HANA_PP_BACK m27), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 27, BOOST_HANA_PP_BACK m28)                                      \
-      );                                                                    \
-    }                                                                       \
-  }; }                                                                      \
-/**/
-
-#define BOOST_HANA_DEFINE_STRUCT_IMPL_30(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29 )   \
-  BOOST_HANA_PP_DROP_BACK m1 BOOST_HANA_PP_BACK m1; BOOST_HANA_PP_DROP_BACK m2 BOOST_HANA_PP_BACK m2; BOOST_HANA_PP_DROP_BACK m3 BOOST_HANA_PP_BACK m3; BOOST_HANA_PP_DROP_BACK m4 BOOST_HANA_PP_BACK m4; BOOST_HANA_PP_DROP_BACK m5 BOOST_HANA_PP_BACK m5; BOOST_HANA_PP_DROP_BACK m6 BOOST_HANA_PP_BACK m6; BOOST_HANA_PP_DROP_BACK m7 BOOST_HANA_PP_BACK m7; BOOST_HANA_PP_DROP_BACK m8 BOOST_HANA_PP_BACK m8; BOOST_HANA_PP_DROP_BACK m9 BOOST_HANA_PP_BACK m9; BOOST_HANA_PP_DROP_BACK m10 BOOST_HANA_PP_BACK m10; BOOST_HANA_PP_DROP_BACK m11 BOOST_HANA_PP_BACK m11; BOOST_HANA_PP_DROP_BACK m12 BOOST_HANA_PP_BACK m12; BOOST_HANA_PP_DROP_BACK m13 BOOST_HANA_PP_BACK m13; BOOST_HANA_PP_DROP_BACK m14 BOOST_HANA_PP_BACK m14; BOOST_HANA_PP_DROP_BACK m15 BOOST_HANA_PP_BACK m15; BOOST_HANA_PP_DROP_BACK m16 BOOST_HANA_PP_BACK m16; BOOST_HANA_PP_DROP_BACK m17 BOOST_HANA_PP_BACK m17; BOOST_HANA_PP_DROP_BACK m18 BOOST_HANA_PP_BACK m18; BOOST_HANA_PP_DROP_BACK m19 BOOST_HANA_PP_BACK m19; BOOST_HANA_PP_DROP_BACK m20 BOOST_HANA_PP_BACK m20; BOOST_HANA_PP_DROP_BACK m21 BOOST_HANA_PP_BACK m21; BOOST_HANA_PP_DROP_BACK m22 BOOST_HANA_PP_BACK m22; BOOST_HANA_PP_DROP_BACK m23 BOOST_HANA_PP_BACK m23; BOOST_HANA_PP_DROP_BACK m24 BOOST_HANA_PP_BACK m24; BOOST_HANA_PP_DROP_BACK m25 BOOST_HANA_PP_BACK m25; BOOST_HANA_PP_DROP_BACK m26 BOOST_HANA_PP_BACK m26; BOOST_HANA_PP_DROP_BACK m27 BOOST_HANA_PP_BACK m27; BOOST_HANA_PP_DROP_BACK m28 BOOST_HANA_PP_BACK m28; BOOST_HANA_PP_DROP_BACK m29 BOOST_HANA_PP_BACK m29;                                             \
-  struct hana { struct accessors_impl {                                     \
-    static constexpr auto apply() {                                         \
-      struct member_names {                                                 \
-        static constexpr auto get() {                                       \
-            return ::boost::hana::make_tuple(                               \
-                BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m20), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m21), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m22), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m23), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m24), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m25), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m26), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m27), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m28), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m29)                              \
-            );                                                              \
-        }                                                                   \
-      };                                                                    \
-      return ::boost::hana::make_tuple(                                     \
-        BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 19, BOOST_HANA_PP_BACK m20), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 20, BOOST_HANA_PP_BACK m21), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 21, BOOST_HANA_PP_BACK m22), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 22, BOOST_HANA_PP_BACK m23), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 23, BOOST_HANA_PP_BACK m24), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 24, BOOST_HANA_PP_BACK m25), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 25, BOOST_HANA_PP_BACK m26), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 26, BOOST_HANA_PP_BACK m27), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 27, BOOST_HANA_PP_BACK m28), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 28, BOOST_HANA_PP_BACK m29)                                      \
-      );                                                                    \
-    }                                                                       \
-  }; }                                                                      \
-/**/
-
-#define BOOST_HANA_DEFINE_STRUCT_IMPL_31(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30 )   \
-  BOOST_HANA_PP_DROP_BACK m1 BOOST_HANA_PP_BACK m1; BOOST_HANA_PP_DROP_BACK m2 BOOST_HANA_PP_BACK m2; BOOST_HANA_PP_DROP_BACK m3 BOOST_HANA_PP_BACK m3; BOOST_HANA_PP_DROP_BACK m4 BOOST_HANA_PP_BACK m4; BOOST_HANA_PP_DROP_BACK m5 BOOST_HANA_PP_BACK m5; BOOST_HANA_PP_DROP_BACK m6 BOOST_HANA_PP_BACK m6; BOOST_HANA_PP_DROP_BACK m7 BOOST_HANA_PP_BACK m7; BOOST_HANA_PP_DROP_BACK m8 BOOST_HANA_PP_BACK m8; BOOST_HANA_PP_DROP_BACK m9 BOOST_HANA_PP_BACK m9; BOOST_HANA_PP_DROP_BACK m10 BOOST_HANA_PP_BACK m10; BOOST_HANA_PP_DROP_BACK m11 BOOST_HANA_PP_BACK m11; BOOST_HANA_PP_DROP_BACK m12 BOOST_HANA_PP_BACK m12; BOOST_HANA_PP_DROP_BACK m13 BOOST_HANA_PP_BACK m13; BOOST_HANA_PP_DROP_BACK m14 BOOST_HANA_PP_BACK m14; BOOST_HANA_PP_DROP_BACK m15 BOOST_HANA_PP_BACK m15; BOOST_HANA_PP_DROP_BACK m16 BOOST_HANA_PP_BACK m16; BOOST_HANA_PP_DROP_BACK m17 BOOST_HANA_PP_BACK m17; BOOST_HANA_PP_DROP_BACK m18 BOOST_HANA_PP_BACK m18; BOOST_HANA_PP_DROP_BACK m19 BOOST_HANA_PP_BACK m19; BOOST_HANA_PP_DROP_BACK m20 BOOST_HANA_PP_BACK m20; BOOST_HANA_PP_DROP_BACK m21 BOOST_HANA_PP_BACK m21; BOOST_HANA_PP_DROP_BACK m22 BOOST_HANA_PP_BACK m22; BOOST_HANA_PP_DROP_BACK m23 BOOST_HANA_PP_BACK m23; BOOST_HANA_PP_DROP_BACK m24 BOOST_HANA_PP_BACK m24; BOOST_HANA_PP_DROP_BACK m25 BOOST_HANA_PP_BACK m25; BOOST_HANA_PP_DROP_BACK m26 BOOST_HANA_PP_BACK m26; BOOST_HANA_PP_DROP_BACK m27 BOOST_HANA_PP_BACK m27; BOOST_HANA_PP_DROP_BACK m28 BOOST_HANA_PP_BACK m28; BOOST_HANA_PP_DROP_BACK m29 BOOST_HANA_PP_BACK m29; BOOST_HANA_PP_DROP_BACK m30 BOOST_HANA_PP_BACK m30;                                             \
-  struct hana { struct accessors_impl {                                     \
-    static constexpr auto apply() {                                         \
-      struct member_names {                                                 \
-        static constexpr auto get() {                                       \
-            return ::boost::hana::make_tuple(                               \
-                BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m20), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m21), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m22), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m23), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m24), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m25), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m26), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m27), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m28), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m29), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m30)                              \
-            );                                                              \
-        }                                                                   \
-      };                                                                    \
-      return ::boost::hana::make_tuple(                                     \
-        BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 19, BOOST_HANA_PP_BACK m20), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 20, BOOST_HANA_PP_BACK m21), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 21, BOOST_HANA_PP_BACK m22), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 22, BOOST_HANA_PP_BACK m23), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 23, BOOST_HANA_PP_BACK m24), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 24, BOOST_HANA_PP_BACK m25), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 25, BOOST_HANA_PP_BACK m26), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 26, BOOST_HANA_PP_BACK m27), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 27, BOOST_HANA_PP_BACK m28), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 28, BOOST_HANA_PP_BACK m29), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 29, BOOST_HANA_PP_BACK m30)                                      \
-      );                                                                    \
-    }                                                                       \
-  }; }                                                                      \
-/**/
-
-#define BOOST_HANA_DEFINE_STRUCT_IMPL_32(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31 )   \
-  BOOST_HANA_PP_DROP_BACK m1 BOOST_HANA_PP_BACK m1; BOOST_HANA_PP_DROP_BACK m2 BOOST_HANA_PP_BACK m2; BOOST_HANA_PP_DROP_BACK m3 BOOST_HANA_PP_BACK m3; BOOST_HANA_PP_DROP_BACK m4 BOOST_HANA_PP_BACK m4; BOOST_HANA_PP_DROP_BACK m5 BOOST_HANA_PP_BACK m5; BOOST_HANA_PP_DROP_BACK m6 BOOST_HANA_PP_BACK m6; BOOST_HANA_PP_DROP_BACK m7 BOOST_HANA_PP_BACK m7; BOOST_HANA_PP_DROP_BACK m8 BOOST_HANA_PP_BACK m8; BOOST_HANA_PP_DROP_BACK m9 BOOST_HANA_PP_BACK m9; BOOST_HANA_PP_DROP_BACK m10 BOOST_HANA_PP_BACK m10; BOOST_HANA_PP_DROP_BACK m11 BOOST_HANA_PP_BACK m11; BOOST_HANA_PP_DROP_BACK m12 BOOST_HANA_PP_BACK m12; BOOST_HANA_PP_DROP_BACK m13 BOOST_HANA_PP_BACK m13; BOOST_HANA_PP_DROP_BACK m14 BOOST_HANA_PP_BACK m14; BOOST_HANA_PP_DROP_BACK m15 BOOST_HANA_PP_BACK m15; BOOST_HANA_PP_DROP_BACK m16 BOOST_HANA_PP_BACK m16; BOOST_HANA_PP_DROP_BACK m17 BOOST_HANA_PP_BACK m17; BOOST_HANA_PP_DROP_BACK m18 BOOST_HANA_PP_BACK m18; BOOST_HANA_PP_DROP_BACK m19 BOOST_HANA_PP_BACK m19; BOOST_HANA_PP_DROP_BACK m20 BOOST_HANA_PP_BACK m20; BOOST_HANA_PP_DROP_BACK m21 BOOST_HANA_PP_BACK m21; BOOST_HANA_PP_DROP_BACK m22 BOOST_HANA_PP_BACK m22; BOOST_HANA_PP_DROP_BACK m23 BOOST_HANA_PP_BACK m23; BOOST_HANA_PP_DROP_BACK m24 BOOST_HANA_PP_BACK m24; BOOST_HANA_PP_DROP_BACK m25 BOOST_HANA_PP_BACK m25; BOOST_HANA_PP_DROP_BACK m26 BOOST_HANA_PP_BACK m26; BOOST_HANA_PP_DROP_BACK m27 BOOST_HANA_PP_BACK m27; BOOST_HANA_PP_DROP_BACK m28 BOOST_HANA_PP_BACK m28; BOOST_HANA_PP_DROP_BACK m29 BOOST_HANA_PP_BACK m29; BOOST_HANA_PP_DROP_BACK m30 BOOST_HANA_PP_BACK m30; BOOST_HANA_PP_DROP_BACK m31 BOOST_HANA_PP_BACK m31;                                             \
-  struct hana { struct accessors_impl {                                     \
-    static constexpr auto apply() {                                         \
-      struct member_names {                                                 \
-        static constexpr auto get() {                                       \
-            return ::boost::hana::make_tuple(                               \
-                BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m20), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m21), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m22), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m23), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m24), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m25), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m26), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m27), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m28), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m29), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m30), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m31)                              \
-            );                                                              \
-        }                                                                   \
-      };                                                                    \
-      return ::boost::hana::make_tuple(                                     \
-        BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 19, BOOST_HANA_PP_BACK m20), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 20, BOOST_HANA_PP_BACK m21), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 21, BOOST_HANA_PP_BACK m22), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 22, BOOST_HANA_PP_BACK m23), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 23, BOOST_HANA_PP_BACK m24), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 24, BOOST_HANA_PP_BACK m25), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 25, BOOST_HANA_PP_BACK m26), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 26, BOOST_HANA_PP_BACK m27), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 27, BOOST_HANA_PP_BACK m28), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 28, BOOST_HANA_PP_BACK m29), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 29, BOOST_HANA_PP_BACK m30), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 30, BOOST_HANA_PP_BACK m31)                                      \
-      );                                                                    \
-    }                                                                       \
-  }; }                                                                      \
-/**/
-
-#define BOOST_HANA_DEFINE_STRUCT_IMPL_33(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32 )   \
-  BOOST_HANA_PP_DROP_BACK m1 BOOST_HANA_PP_BACK m1; BOOST_HANA_PP_DROP_BACK m2 BOOST_HANA_PP_BACK m2; BOOST_HANA_PP_DROP_BACK m3 BOOST_HANA_PP_BACK m3; BOOST_HANA_PP_DROP_BACK m4 BOOST_HANA_PP_BACK m4; BOOST_HANA_PP_DROP_BACK m5 BOOST_HANA_PP_BACK m5; BOOST_HANA_PP_DROP_BACK m6 BOOST_HANA_PP_BACK m6; BOOST_HANA_PP_DROP_BACK m7 BOOST_HANA_PP_BACK m7; BOOST_HANA_PP_DROP_BACK m8 BOOST_HANA_PP_BACK m8; BOOST_HANA_PP_DROP_BACK m9 BOOST_HANA_PP_BACK m9; BOOST_HANA_PP_DROP_BACK m10 BOOST_HANA_PP_BACK m10; BOOST_HANA_PP_DROP_BACK m11 BOOST_HANA_PP_BACK m11; BOOST_HANA_PP_DROP_BACK m12 BOOST_HANA_PP_BACK m12; BOOST_HANA_PP_DROP_BACK m13 BOOST_HANA_PP_BACK m13; BOOST_HANA_PP_DROP_BACK m14 BOOST_HANA_PP_BACK m14; BOOST_HANA_PP_DROP_BACK m15 BOOST_HANA_PP_BACK m15; BOOST_HANA_PP_DROP_BACK m16 BOOST_HANA_PP_BACK m16; BOOST_HANA_PP_DROP_BACK m17 BOOST_HANA_PP_BACK m17; BOOST_HANA_PP_DROP_BACK m18 BOOST_HANA_PP_BACK m18; BOOST_HANA_PP_DROP_BACK m19 BOOST_HANA_PP_BACK m19; BOOST_HANA_PP_DROP_BACK m20 BOOST_HANA_PP_BACK m20; BOOST_HANA_PP_DROP_BACK m21 BOOST_HANA_PP_BACK m21; BOOST_HANA_PP_DROP_BACK m22 BOOST_HANA_PP_BACK m22; BOOST_HANA_PP_DROP_BACK m23 BOOST_HANA_PP_BACK m23; BOOST_HANA_PP_DROP_BACK m24 BOOST_HANA_PP_BACK m24; BOOST_HANA_PP_DROP_BACK m25 BOOST_HANA_PP_BACK m25; BOOST_HANA_PP_DROP_BACK m26 BOOST_HANA_PP_BACK m26; BOOST_HANA_PP_DROP_BACK m27 BOOST_HANA_PP_BACK m27; BOOST_HANA_PP_DROP_BACK m28 BOOST_HANA_PP_BACK m28; BOOST_HANA_PP_DROP_BACK m29 BOOST_HANA_PP_BACK m29; BOOST_HANA_PP_DROP_BACK m30 BOOST_HANA_PP_BACK m30; BOOST_HANA_PP_DROP_BACK m31 BOOST_HANA_PP_BACK m31; BOOST_HANA_PP_DROP_BACK m32 BOOST_HANA_PP_BACK m32;                                             \
-  struct hana { struct accessors_impl {                                     \
-    static constexpr auto apply() {                                         \
-      struct member_names {                                                 \
-        static constexpr auto get() {                                       \
-            return ::boost::hana::make_tuple(                               \
-                BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m20), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m21), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m22), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m23), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m24), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m25), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m26), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m27), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m28), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m29), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m30), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m31), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m32)                              \
-            );                                                              \
-        }                                                                   \
-      };                                                                    \
-      return ::boost::hana::make_tuple(                                     \
-        BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 19, BOOST_HANA_PP_BACK m20), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 20, BOOST_HANA_PP_BACK m21), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 21, BOOST_HANA_PP_BACK m22), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 22, BOOST_HANA_PP_BACK m23), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 23, BOOST_HANA_PP_BACK m24), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 24, BOOST_HANA_PP_BACK m25), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 25, BOOST_HANA_PP_BACK m26), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 26, BOOST_HANA_PP_BACK m27), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 27, BOOST_HANA_PP_BACK m28), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 28, BOOST_HANA_PP_BACK m29), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 29, BOOST_HANA_PP_BACK m30), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 30, BOOST_HANA_PP_BACK m31), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 31, BOOST_HANA_PP_BACK m32)                                      \
-      );                                                                    \
-    }                                                                       \
-  }; }                                                                      \
-/**/
-
-#define BOOST_HANA_DEFINE_STRUCT_IMPL_34(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33 )   \
-  BOOST_HANA_PP_DROP_BACK m1 BOOST_HANA_PP_BACK m1; BOOST_HANA_PP_DROP_BACK m2 BOOST_HANA_PP_BACK m2; BOOST_HANA_PP_DROP_BACK m3 BOOST_HANA_PP_BACK m3; BOOST_HANA_PP_DROP_BACK m4 BOOST_HANA_PP_BACK m4; BOOST_HANA_PP_DROP_BACK m5 BOOST_HANA_PP_BACK m5; BOOST_HANA_PP_DROP_BACK m6 BOOST_HANA_PP_BACK m6; BOOST_HANA_PP_DROP_BACK m7 BOOST_HANA_PP_BACK m7; BOOST_HANA_PP_DROP_BACK m8 BOOST_HANA_PP_BACK m8; BOOST_HANA_PP_DROP_BACK m9 BOOST_HANA_PP_BACK m9; BOOST_HANA_PP_DROP_BACK m10 BOOST_HANA_PP_BACK m10; BOOST_HANA_PP_DROP_BACK m11 BOOST_HANA_PP_BACK m11; BOOST_HANA_PP_DROP_BACK m12 BOOST_HANA_PP_BACK m12; BOOST_HANA_PP_DROP_BACK m13 BOOST_HANA_PP_BACK m13; BOOST_HANA_PP_DROP_BACK m14 BOOST_HANA_PP_BACK m14; BOOST_HANA_PP_DROP_BACK m15 BOOST_HANA_PP_BACK m15; BOOST_HANA_PP_DROP_BACK m16 BOOST_HANA_PP_BACK m16; BOOST_HANA_PP_DROP_BACK m17 BOOST_HANA_PP_BACK m17; BOOST_HANA_PP_DROP_BACK m18 BOOST_HANA_PP_BACK m18; BOOST_HANA_PP_DROP_BACK m19 BOOST_HANA_PP_BACK m19; BOOST_HANA_PP_DROP_BACK m20 BOOST_HANA_PP_BACK m20; BOOST_HANA_PP_DROP_BACK m21 BOOST_HANA_PP_BACK m21; BOOST_HANA_PP_DROP_BACK m22 BOOST_HANA_PP_BACK m22; BOOST_HANA_PP_DROP_BACK m23 BOOST_HANA_PP_BACK m23; BOOST_HANA_PP_DROP_BACK m24 BOOST_HANA_PP_BACK m24; BOOST_HANA_PP_DROP_BACK m25 BOOST_HANA_PP_BACK m25; BOOST_HANA_PP_DROP_BACK m26 BOOST_HANA_PP_BACK m26; BOOST_HANA_PP_DROP_BACK m27 BOOST_HANA_PP_BACK m27; BOOST_HANA_PP_DROP_BACK m28 BOOST_HANA_PP_BACK m28; BOOST_HANA_PP_DROP_BACK m29 BOOST_HANA_PP_BACK m29; BOOST_HANA_PP_DROP_BACK m30 BOOST_HANA_PP_BACK m30; BOOST_HANA_PP_DROP_BACK m31 BOOST_HANA_PP_BACK m31; BOOST_HANA_PP_DROP_BACK m32 BOOST_HANA_PP_BACK m32; BOOST_HANA_PP_DROP_BACK m33 BOOST_HANA_PP_BACK m33;                                             \
-  struct hana { struct accessors_impl {                                     \
-    static constexpr auto apply() {                                         \
-      struct member_names {                                                 \
-        static constexpr auto get() {                                       \
-            return ::boost::hana::make_tuple(                               \
-                BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m20), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m21), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m22), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m23), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m24), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m25), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m26), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m27), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m28), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m29), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m30), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m31), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m32), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m33)                              \
-            );                                                              \
-        }                                                                   \
-      };                                                                    \
-      return ::boost::hana::make_tuple(                                     \
-        BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 19, BOOST_HANA_PP_BACK m20), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 20, BOOST_HANA_PP_BACK m21), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 21, BOOST_HANA_PP_BACK m22), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 22, BOOST_HANA_PP_BACK m23), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 23, BOOST_HANA_PP_BACK m24), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 24, BOOST_HANA_PP_BACK m25), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 25, BOOST_HANA_PP_BACK m26), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 26, BOOST_HANA_PP_BACK m27), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 27, BOOST_HANA_PP_BACK m28), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 28, BOOST_HANA_PP_BACK m29), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 29, BOOST_HANA_PP_BACK m30), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 30, BOOST_HANA_PP_BACK m31), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 31, BOOST_HANA_PP_BACK m32), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 32, BOOST_HANA_PP_BACK m33)                                      \
-      );                                                                    \
-    }                                                                       \
-  }; }                                                                      \
-/**/
+    BOOST_HANA_DEFINE_STRUCT_IMPL(BOOST_HANA_STRUCT_NARG(__VA_ARGS__), __VA_ARGS__)
 
-#define BOOST_HANA_DEFINE_STRUCT_IMPL_35(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34 )   \
-  BOOST_HANA_PP_DROP_BACK m1 BOOST_HANA_PP_BACK m1; BOOST_HANA_PP_DROP_BACK m2 BOOST_HANA_PP_BACK m2; BOOST_HANA_PP_DROP_BACK m3 BOOST_HANA_PP_BACK m3; BOOST_HANA_PP_DROP_BACK m4 BOOST_HANA_PP_BACK m4; BOOST_HANA_PP_DROP_BACK m5 BOOST_HANA_PP_BACK m5; BOOST_HANA_PP_DROP_BACK m6 BOOST_HANA_PP_BACK m6; BOOST_HANA_PP_DROP_BACK m7 BOOST_HANA_PP_BACK m7; BOOST_HANA_PP_DROP_BACK m8 BOOST_HANA_PP_BACK m8; BOOST_HANA_PP_DROP_BACK m9 BOOST_HANA_PP_BACK m9; BOOST_HANA_PP_DROP_BACK m10 BOOST_HANA_PP_BACK m10; BOOST_HANA_PP_DROP_BACK m11 BOOST_HANA_PP_BACK m11; BOOST_HANA_PP_DROP_BACK m12 BOOST_HANA_PP_BACK m12; BOOST_HANA_PP_DROP_BACK m13 BOOST_HANA_PP_BACK m13; BOOST_HANA_PP_DROP_BACK m14 BOOST_HANA_PP_BACK m14; BOOST_HANA_PP_DROP_BACK m15 BOOST_HANA_PP_BACK m15; BOOST_HANA_PP_DROP_BACK m16 BOOST_HANA_PP_BACK m16; BOOST_HANA_PP_DROP_BACK m17 BOOST_HANA_PP_BACK m17; BOOST_HANA_PP_DROP_BACK m18 BOOST_HANA_PP_BACK m18; BOOST_HANA_PP_DROP_BACK m19 BOOST_HANA_PP_BACK m19; BOOST_HANA_PP_DROP_BACK m20 BOOST_HANA_PP_BACK m20; BOOST_HANA_PP_DROP_BACK m21 BOOST_HANA_PP_BACK m21; BOOST_HANA_PP_DROP_BACK m22 BOOST_HANA_PP_BACK m22; BOOST_HANA_PP_DROP_BACK m23 BOOST_HANA_PP_BACK m23; BOOST_HANA_PP_DROP_BACK m24 BOOST_HANA_PP_BACK m24; BOOST_HANA_PP_DROP_BACK m25 BOOST_HANA_PP_BACK m25; BOOST_HANA_PP_DROP_BACK m26 BOOST_HANA_PP_BACK m26; BOOST_HANA_PP_DROP_BACK m27 BOOST_HANA_PP_BACK m27; BOOST_HANA_PP_DROP_BACK m28 BOOST_HANA_PP_BACK m28; BOOST_HANA_PP_DROP_BACK m29 BOOST_HANA_PP_BACK m29; BOOST_HANA_PP_DROP_BACK m30 BOOST_HANA_PP_BACK m30; BOOST_HANA_PP_DROP_BACK m31 BOOST_HANA_PP_BACK m31; BOOST_HANA_PP_DROP_BACK m32 BOOST_HANA_PP_BACK m32; BOOST_HANA_PP_DROP_BACK m33 BOOST_HANA_PP_BACK m33; BOOST_HANA_PP_DROP_BACK m34 BOOST_HANA_PP_BACK m34;                                             \
+#define BOOST_HANA_DEFINE_STRUCT_IMPL(N, ...)                               \
+  BOOST_HANA_STRUCT_FOR_EACH(N, BOOST_HANA_MEMBER_DECL_IMPL,                \
+                             BOOST_HANA_STRUCT_NOTHING, __VA_ARGS__)        \
   struct hana { struct accessors_impl {                                     \
-    static constexpr auto apply() {                                         \
-      struct member_names {                                                 \
-        static constexpr auto get() {                                       \
-            return ::boost::hana::make_tuple(                               \
-                BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m20), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m21), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m22), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m23), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m24), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m25), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m26), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m27), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m28), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m29), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m30), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m31), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m32), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m33), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m34)                              \
-            );                                                              \
-        }                                                                   \
-      };                                                                    \
-      return ::boost::hana::make_tuple(                                     \
-        BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 19, BOOST_HANA_PP_BACK m20), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 20, BOOST_HANA_PP_BACK m21), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 21, BOOST_HANA_PP_BACK m22), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 22, BOOST_HANA_PP_BACK m23), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 23, BOOST_HANA_PP_BACK m24), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 24, BOOST_HANA_PP_BACK m25), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 25, BOOST_HANA_PP_BACK m26), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 26, BOOST_HANA_PP_BACK m27), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 27, BOOST_HANA_PP_BACK m28), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 28, BOOST_HANA_PP_BACK m29), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 29, BOOST_HANA_PP_BACK m30), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 30, BOOST_HANA_PP_BACK m31), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 31, BOOST_HANA_PP_BACK m32), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 32, BOOST_HANA_PP_BACK m33), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 33, BOOST_HANA_PP_BACK m34)                                      \
-      );                                                                    \
-    }                                                                       \
+    BOOST_HANA_ACCESSORS_IMPL(N, __VA_ARGS__)                               \
   }; }                                                                      \
 /**/
 
-#define BOOST_HANA_DEFINE_STRUCT_IMPL_36(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35 )   \
-  BOOST_HANA_PP_DROP_BACK m1 BOOST_HANA_PP_BACK m1; BOOST_HANA_PP_DROP_BACK m2 BOOST_HANA_PP_BACK m2; BOOST_HANA_PP_DROP_BACK m3 BOOST_HANA_PP_BACK m3; BOOST_HANA_PP_DROP_BACK m4 BOOST_HANA_PP_BACK m4; BOOST_HANA_PP_DROP_BACK m5 BOOST_HANA_PP_BACK m5; BOOST_HANA_PP_DROP_BACK m6 BOOST_HANA_PP_BACK m6; BOOST_HANA_PP_DROP_BACK m7 BOOST_HANA_PP_BACK m7; BOOST_HANA_PP_DROP_BACK m8 BOOST_HANA_PP_BACK m8; BOOST_HANA_PP_DROP_BACK m9 BOOST_HANA_PP_BACK m9; BOOST_HANA_PP_DROP_BACK m10 BOOST_HANA_PP_BACK m10; BOOST_HANA_PP_DROP_BACK m11 BOOST_HANA_PP_BACK m11; BOOST_HANA_PP_DROP_BACK m12 BOOST_HANA_PP_BACK m12; BOOST_HANA_PP_DROP_BACK m13 BOOST_HANA_PP_BACK m13; BOOST_HANA_PP_DROP_BACK m14 BOOST_HANA_PP_BACK m14; BOOST_HANA_PP_DROP_BACK m15 BOOST_HANA_PP_BACK m15; BOOST_HANA_PP_DROP_BACK m16 BOOST_HANA_PP_BACK m16; BOOST_HANA_PP_DROP_BACK m17 BOOST_HANA_PP_BACK m17; BOOST_HANA_PP_DROP_BACK m18 BOOST_HANA_PP_BACK m18; BOOST_HANA_PP_DROP_BACK m19 BOOST_HANA_PP_BACK m19; BOOST_HANA_PP_DROP_BACK m20 BOOST_HANA_PP_BACK m20; BOOST_HANA_PP_DROP_BACK m21 BOOST_HANA_PP_BACK m21; BOOST_HANA_PP_DROP_BACK m22 BOOST_HANA_PP_BACK m22; BOOST_HANA_PP_DROP_BACK m23 BOOST_HANA_PP_BACK m23; BOOST_HANA_PP_DROP_BACK m24 BOOST_HANA_PP_BACK m24; BOOST_HANA_PP_DROP_BACK m25 BOOST_HANA_PP_BACK m25; BOOST_HANA_PP_DROP_BACK m26 BOOST_HANA_PP_BACK m26; BOOST_HANA_PP_DROP_BACK m27 BOOST_HANA_PP_BACK m27; BOOST_HANA_PP_DROP_BACK m28 BOOST_HANA_PP_BACK m28; BOOST_HANA_PP_DROP_BACK m29 BOOST_HANA_PP_BACK m29; BOOST_HANA_PP_DROP_BACK m30 BOOST_HANA_PP_BACK m30; BOOST_HANA_PP_DROP_BACK m31 BOOST_HANA_PP_BACK m31; BOOST_HANA_PP_DROP_BACK m32 BOOST_HANA_PP_BACK m32; BOOST_HANA_PP_DROP_BACK m33 BOOST_HANA_PP_BACK m33; BOOST_HANA_PP_DROP_BACK m34 BOOST_HANA_PP_BACK m34; BOOST_HANA_PP_DROP_BACK m35 BOOST_HANA_PP_BACK m35;                                             \
-  struct hana { struct accessors_impl {                                     \
-    static constexpr auto apply() {                                         \
-      struct member_names {                                                 \
-        static constexpr auto get() {                                       \
-            return ::boost::hana::make_tuple(                               \
-                BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m20), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m21), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m22), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m23), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m24), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m25), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m26), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m27), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m28), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m29), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m30), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m31), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m32), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m33), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m34), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m35)                              \
-            );                                                              \
-        }                                                                   \
-      };                                                                    \
-      return ::boost::hana::make_tuple(                                     \
-        BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 19, BOOST_HANA_PP_BACK m20), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 20, BOOST_HANA_PP_BACK m21), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 21, BOOST_HANA_PP_BACK m22), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 22, BOOST_HANA_PP_BACK m23), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 23, BOOST_HANA_PP_BACK m24), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 24, BOOST_HANA_PP_BACK m25), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 25, BOOST_HANA_PP_BACK m26), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 26, BOOST_HANA_PP_BACK m27), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 27, BOOST_HANA_PP_BACK m28), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 28, BOOST_HANA_PP_BACK m29), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 29, BOOST_HANA_PP_BACK m30), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 30, BOOST_HANA_PP_BACK m31), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 31, BOOST_HANA_PP_BACK m32), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 32, BOOST_HANA_PP_BACK m33), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 33, BOOST_HANA_PP_BACK m34), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 34, BOOST_HANA_PP_BACK m35)                                      \
-      );                                                                    \
-    }                                                                       \
-  }; }                                                                      \
-/**/
-
-#define BOOST_HANA_DEFINE_STRUCT_IMPL_37(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36 )   \
-  BOOST_HANA_PP_DROP_BACK m1 BOOST_HANA_PP_BACK m1; BOOST_HANA_PP_DROP_BACK m2 BOOST_HANA_PP_BACK m2; BOOST_HANA_PP_DROP_BACK m3 BOOST_HANA_PP_BACK m3; BOOST_HANA_PP_DROP_BACK m4 BOOST_HANA_PP_BACK m4; BOOST_HANA_PP_DROP_BACK m5 BOOST_HANA_PP_BACK m5; BOOST_HANA_PP_DROP_BACK m6 BOOST_HANA_PP_BACK m6; BOOST_HANA_PP_DROP_BACK m7 BOOST_HANA_PP_BACK m7; BOOST_HANA_PP_DROP_BACK m8 BOOST_HANA_PP_BACK m8; BOOST_HANA_PP_DROP_BACK m9 BOOST_HANA_PP_BACK m9; BOOST_HANA_PP_DROP_BACK m10 BOOST_HANA_PP_BACK m10; BOOST_HANA_PP_DROP_BACK m11 BOOST_HANA_PP_BACK m11; BOOST_HANA_PP_DROP_BACK m12 BOOST_HANA_PP_BACK m12; BOOST_HANA_PP_DROP_BACK m13 BOOST_HANA_PP_BACK m13; BOOST_HANA_PP_DROP_BACK m14 BOOST_HANA_PP_BACK m14; BOOST_HANA_PP_DROP_BACK m15 BOOST_HANA_PP_BACK m15; BOOST_HANA_PP_DROP_BACK m16 BOOST_HANA_PP_BACK m16; BOOST_HANA_PP_DROP_BACK m17 BOOST_HANA_PP_BACK m17; BOOST_HANA_PP_DROP_BACK m18 BOOST_HANA_PP_BACK m18; BOOST_HANA_PP_DROP_BACK m19 BOOST_HANA_PP_BACK m19; BOOST_HANA_PP_DROP_BACK m20 BOOST_HANA_PP_BACK m20; BOOST_HANA_PP_DROP_BACK m21 BOOST_HANA_PP_BACK m21; BOOST_HANA_PP_DROP_BACK m22 BOOST_HANA_PP_BACK m22; BOOST_HANA_PP_DROP_BACK m23 BOOST_HANA_PP_BACK m23; BOOST_HANA_PP_DROP_BACK m24 BOOST_HANA_PP_BACK m24; BOOST_HANA_PP_DROP_BACK m25 BOOST_HANA_PP_BACK m25; BOOST_HANA_PP_DROP_BACK m26 BOOST_HANA_PP_BACK m26; BOOST_HANA_PP_DROP_BACK m27 BOOST_HANA_PP_BACK m27; BOOST_HANA_PP_DROP_BACK m28 BOOST_HANA_PP_BACK m28; BOOST_HANA_PP_DROP_BACK m29 BOOST_HANA_PP_BACK m29; BOOST_HANA_PP_DROP_BACK m30 BOOST_HANA_PP_BACK m30; BOOST_HANA_PP_DROP_BACK m31 BOOST_HANA_PP_BACK m31; BOOST_HANA_PP_DROP_BACK m32 BOOST_HANA_PP_BACK m32; BOOST_HANA_PP_DROP_BACK m33 BOOST_HANA_PP_BACK m33; BOOST_HANA_PP_DROP_BACK m34 BOOST_HANA_PP_BACK m34; BOOST_HANA_PP_DROP_BACK m35 BOOST_HANA_PP_BACK m35; BOOST_HANA_PP_DROP_BACK m36 BOOST_HANA_PP_BACK m36;                                             \
-  struct hana { struct accessors_impl {                                     \
-    static constexpr auto apply() {                                         \
-      struct member_names {                                                 \
-        static constexpr auto get() {                                       \
-            return ::boost::hana::make_tuple(                               \
-                BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m20), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m21), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m22), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m23), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m24), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m25), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m26), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m27), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m28), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m29), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m30), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m31), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m32), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m33), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m34), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m35), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m36)                              \
-            );                                                              \
-        }                                                                   \
-      };                                                                    \
-      return ::boost::hana::make_tuple(                                     \
-        BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 19, BOOST_HANA_PP_BACK m20), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 20, BOOST_HANA_PP_BACK m21), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 21, BOOST_HANA_PP_BACK m22), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 22, BOOST_HANA_PP_BACK m23), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 23, BOOST_HANA_PP_BACK m24), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 24, BOOST_HANA_PP_BACK m25), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 25, BOOST_HANA_PP_BACK m26), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 26, BOOST_HANA_PP_BACK m27), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 27, BOOST_HANA_PP_BACK m28), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 28, BOOST_HANA_PP_BACK m29), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 29, BOOST_HANA_PP_BACK m30), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 30, BOOST_HANA_PP_BACK m31), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 31, BOOST_HANA_PP_BACK m32), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 32, BOOST_HANA_PP_BACK m33), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 33, BOOST_HANA_PP_BACK m34), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 34, BOOST_HANA_PP_BACK m35), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 35, BOOST_HANA_PP_BACK m36)                                      \
-      );                                                                    \
-    }                                                                       \
-  }; }                                                                      \
-/**/
-
-#define BOOST_HANA_DEFINE_STRUCT_IMPL_38(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37 )   \
-  BOOST_HANA_PP_DROP_BACK m1 BOOST_HANA_PP_BACK m1; BOOST_HANA_PP_DROP_BACK m2 BOOST_HANA_PP_BACK m2; BOOST_HANA_PP_DROP_BACK m3 BOOST_HANA_PP_BACK m3; BOOST_HANA_PP_DROP_BACK m4 BOOST_HANA_PP_BACK m4; BOOST_HANA_PP_DROP_BACK m5 BOOST_HANA_PP_BACK m5; BOOST_HANA_PP_DROP_BACK m6 BOOST_HANA_PP_BACK m6; BOOST_HANA_PP_DROP_BACK m7 BOOST_HANA_PP_BACK m7; BOOST_HANA_PP_DROP_BACK m8 BOOST_HANA_PP_BACK m8; BOOST_HANA_PP_DROP_BACK m9 BOOST_HANA_PP_BACK m9; BOOST_HANA_PP_DROP_BACK m10 BOOST_HANA_PP_BACK m10; BOOST_HANA_PP_DROP_BACK m11 BOOST_HANA_PP_BACK m11; BOOST_HANA_PP_DROP_BACK m12 BOOST_HANA_PP_BACK m12; BOOST_HANA_PP_DROP_BACK m13 BOOST_HANA_PP_BACK m13; BOOST_HANA_PP_DROP_BACK m14 BOOST_HANA_PP_BACK m14; BOOST_HANA_PP_DROP_BACK m15 BOOST_HANA_PP_BACK m15; BOOST_HANA_PP_DROP_BACK m16 BOOST_HANA_PP_BACK m16; BOOST_HANA_PP_DROP_BACK m17 BOOST_HANA_PP_BACK m17; BOOST_HANA_PP_DROP_BACK m18 BOOST_HANA_PP_BACK m18; BOOST_HANA_PP_DROP_BACK m19 BOOST_HANA_PP_BACK m19; BOOST_HANA_PP_DROP_BACK m20 BOOST_HANA_PP_BACK m20; BOOST_HANA_PP_DROP_BACK m21 BOOST_HANA_PP_BACK m21; BOOST_HANA_PP_DROP_BACK m22 BOOST_HANA_PP_BACK m22; BOOST_HANA_PP_DROP_BACK m23 BOOST_HANA_PP_BACK m23; BOOST_HANA_PP_DROP_BACK m24 BOOST_HANA_PP_BACK m24; BOOST_HANA_PP_DROP_BACK m25 BOOST_HANA_PP_BACK m25; BOOST_HANA_PP_DROP_BACK m26 BOOST_HANA_PP_BACK m26; BOOST_HANA_PP_DROP_BACK m27 BOOST_HANA_PP_BACK m27; BOOST_HANA_PP_DROP_BACK m28 BOOST_HANA_PP_BACK m28; BOOST_HANA_PP_DROP_BACK m29 BOOST_HANA_PP_BACK m29; BOOST_HANA_PP_DROP_BACK m30 BOOST_HANA_PP_BACK m30; BOOST_HANA_PP_DROP_BACK m31 BOOST_HANA_PP_BACK m31; BOOST_HANA_PP_DROP_BACK m32 BOOST_HANA_PP_BACK m32; BOOST_HANA_PP_DROP_BACK m33 BOOST_HANA_PP_BACK m33; BOOST_HANA_PP_DROP_BACK m34 BOOST_HANA_PP_BACK m34; BOOST_HANA_PP_DROP_BACK m35 BOOST_HANA_PP_BACK m35; BOOST_HANA_PP_DROP_BACK m36 BOOST_HANA_PP_BACK m36; BOOST_HANA_PP_DROP_BACK m37 BOOST_HANA_PP_BACK m37;                                             \
-  struct hana { struct accessors_impl {                                     \
-    static constexpr auto apply() {                                         \
-      struct member_names {                                                 \
-        static constexpr auto get() {                                       \
-            return ::boost::hana::make_tuple(                               \
-                BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m20), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m21), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m22), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m23), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m24), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m25), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m26), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m27), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m28), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m29), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m30), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m31), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m32), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m33), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m34), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m35), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m36), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m37)                              \
-            );                                                              \
-        }                                                                   \
-      };                                                                    \
-      return ::boost::hana::make_tuple(                                     \
-        BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 19, BOOST_HANA_PP_BACK m20), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 20, BOOST_HANA_PP_BACK m21), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 21, BOOST_HANA_PP_BACK m22), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 22, BOOST_HANA_PP_BACK m23), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 23, BOOST_HANA_PP_BACK m24), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 24, BOOST_HANA_PP_BACK m25), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 25, BOOST_HANA_PP_BACK m26), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 26, BOOST_HANA_PP_BACK m27), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 27, BOOST_HANA_PP_BACK m28), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 28, BOOST_HANA_PP_BACK m29), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 29, BOOST_HANA_PP_BACK m30), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 30, BOOST_HANA_PP_BACK m31), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 31, BOOST_HANA_PP_BACK m32), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 32, BOOST_HANA_PP_BACK m33), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 33, BOOST_HANA_PP_BACK m34), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 34, BOOST_HANA_PP_BACK m35), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 35, BOOST_HANA_PP_BACK m36), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 36, BOOST_HANA_PP_BACK m37)                                      \
-      );                                                                    \
-    }                                                                       \
-  }; }                                                                      \
-/**/
-
-#define BOOST_HANA_DEFINE_STRUCT_IMPL_39(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38 )   \
-  BOOST_HANA_PP_DROP_BACK m1 BOOST_HANA_PP_BACK m1; BOOST_HANA_PP_DROP_BACK m2 BOOST_HANA_PP_BACK m2; BOOST_HANA_PP_DROP_BACK m3 BOOST_HANA_PP_BACK m3; BOOST_HANA_PP_DROP_BACK m4 BOOST_HANA_PP_BACK m4; BOOST_HANA_PP_DROP_BACK m5 BOOST_HANA_PP_BACK m5; BOOST_HANA_PP_DROP_BACK m6 BOOST_HANA_PP_BACK m6; BOOST_HANA_PP_DROP_BACK m7 BOOST_HANA_PP_BACK m7; BOOST_HANA_PP_DROP_BACK m8 BOOST_HANA_PP_BACK m8; BOOST_HANA_PP_DROP_BACK m9 BOOST_HANA_PP_BACK m9; BOOST_HANA_PP_DROP_BACK m10 BOOST_HANA_PP_BACK m10; BOOST_HANA_PP_DROP_BACK m11 BOOST_HANA_PP_BACK m11; BOOST_HANA_PP_DROP_BACK m12 BOOST_HANA_PP_BACK m12; BOOST_HANA_PP_DROP_BACK m13 BOOST_HANA_PP_BACK m13; BOOST_HANA_PP_DROP_BACK m14 BOOST_HANA_PP_BACK m14; BOOST_HANA_PP_DROP_BACK m15 BOOST_HANA_PP_BACK m15; BOOST_HANA_PP_DROP_BACK m16 BOOST_HANA_PP_BACK m16; BOOST_HANA_PP_DROP_BACK m17 BOOST_HANA_PP_BACK m17; BOOST_HANA_PP_DROP_BACK m18 BOOST_HANA_PP_BACK m18; BOOST_HANA_PP_DROP_BACK m19 BOOST_HANA_PP_BACK m19; BOOST_HANA_PP_DROP_BACK m20 BOOST_HANA_PP_BACK m20; BOOST_HANA_PP_DROP_BACK m21 BOOST_HANA_PP_BACK m21; BOOST_HANA_PP_DROP_BACK m22 BOOST_HANA_PP_BACK m22; BOOST_HANA_PP_DROP_BACK m23 BOOST_HANA_PP_BACK m23; BOOST_HANA_PP_DROP_BACK m24 BOOST_HANA_PP_BACK m24; BOOST_HANA_PP_DROP_BACK m25 BOOST_HANA_PP_BACK m25; BOOST_HANA_PP_DROP_BACK m26 BOOST_HANA_PP_BACK m26; BOOST_HANA_PP_DROP_BACK m27 BOOST_HANA_PP_BACK m27; BOOST_HANA_PP_DROP_BACK m28 BOOST_HANA_PP_BACK m28; BOOST_HANA_PP_DROP_BACK m29 BOOST_HANA_PP_BACK m29; BOOST_HANA_PP_DROP_BACK m30 BOOST_HANA_PP_BACK m30; BOOST_HANA_PP_DROP_BACK m31 BOOST_HANA_PP_BACK m31; BOOST_HANA_PP_DROP_BACK m32 BOOST_HANA_PP_BACK m32; BOOST_HANA_PP_DROP_BACK m33 BOOST_HANA_PP_BACK m33; BOOST_HANA_PP_DROP_BACK m34 BOOST_HANA_PP_BACK m34; BOOST_HANA_PP_DROP_BACK m35 BOOST_HANA_PP_BACK m35; BOOST_HANA_PP_DROP_BACK m36 BOOST_HANA_PP_BACK m36; BOOST_HANA_PP_DROP_BACK m37 BOOST_HANA_PP_BACK m37; BOOST_HANA_PP_DROP_BACK m38 BOOST_HANA_PP_BACK m38;                                             \
-  struct hana { struct accessors_impl {                                     \
-    static constexpr auto apply() {                                         \
-      struct member_names {                                                 \
-        static constexpr auto get() {                                       \
-            return ::boost::hana::make_tuple(                               \
-                BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m20), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m21), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m22), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m23), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m24), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m25), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m26), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m27), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m28), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m29), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m30), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m31), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m32), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m33), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m34), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m35), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m36), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m37), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m38)                              \
-            );                                                              \
-        }                                                                   \
-      };                                                                    \
-      return ::boost::hana::make_tuple(                                     \
-        BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 19, BOOST_HANA_PP_BACK m20), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 20, BOOST_HANA_PP_BACK m21), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 21, BOOST_HANA_PP_BACK m22), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 22, BOOST_HANA_PP_BACK m23), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 23, BOOST_HANA_PP_BACK m24), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 24, BOOST_HANA_PP_BACK m25), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 25, BOOST_HANA_PP_BACK m26), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 26, BOOST_HANA_PP_BACK m27), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 27, BOOST_HANA_PP_BACK m28), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 28, BOOST_HANA_PP_BACK m29), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 29, BOOST_HANA_PP_BACK m30), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 30, BOOST_HANA_PP_BACK m31), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 31, BOOST_HANA_PP_BACK m32), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 32, BOOST_HANA_PP_BACK m33), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 33, BOOST_HANA_PP_BACK m34), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 34, BOOST_HANA_PP_BACK m35), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 35, BOOST_HANA_PP_BACK m36), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 36, BOOST_HANA_PP_BACK m37), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 37, BOOST_HANA_PP_BACK m38)                                      \
-      );                                                                    \
-    }                                                                       \
-  }; }                                                                      \
-/**/
-
-#define BOOST_HANA_DEFINE_STRUCT_IMPL_40(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39 )   \
-  BOOST_HANA_PP_DROP_BACK m1 BOOST_HANA_PP_BACK m1; BOOST_HANA_PP_DROP_BACK m2 BOOST_HANA_PP_BACK m2; BOOST_HANA_PP_DROP_BACK m3 BOOST_HANA_PP_BACK m3; BOOST_HANA_PP_DROP_BACK m4 BOOST_HANA_PP_BACK m4; BOOST_HANA_PP_DROP_BACK m5 BOOST_HANA_PP_BACK m5; BOOST_HANA_PP_DROP_BACK m6 BOOST_HANA_PP_BACK m6; BOOST_HANA_PP_DROP_BACK m7 BOOST_HANA_PP_BACK m7; BOOST_HANA_PP_DROP_BACK m8 BOOST_HANA_PP_BACK m8; BOOST_HANA_PP_DROP_BACK m9 BOOST_HANA_PP_BACK m9; BOOST_HANA_PP_DROP_BACK m10 BOOST_HANA_PP_BACK m10; BOOST_HANA_PP_DROP_BACK m11 BOOST_HANA_PP_BACK m11; BOOST_HANA_PP_DROP_BACK m12 BOOST_HANA_PP_BACK m12; BOOST_HANA_PP_DROP_BACK m13 BOOST_HANA_PP_BACK m13; BOOST_HANA_PP_DROP_BACK m14 BOOST_HANA_PP_BACK m14; BOOST_HANA_PP_DROP_BACK m15 BOOST_HANA_PP_BACK m15; BOOST_HANA_PP_DROP_BACK m16 BOOST_HANA_PP_BACK m16; BOOST_HANA_PP_DROP_BACK m17 BOOST_HANA_PP_BACK m17; BOOST_HANA_PP_DROP_BACK m18 BOOST_HANA_PP_BACK m18; BOOST_HANA_PP_DROP_BACK m19 BOOST_HANA_PP_BACK m19; BOOST_HANA_PP_DROP_BACK m20 BOOST_HANA_PP_BACK m20; BOOST_HANA_PP_DROP_BACK m21 BOOST_HANA_PP_BACK m21; BOOST_HANA_PP_DROP_BACK m22 BOOST_HANA_PP_BACK m22; BOOST_HANA_PP_DROP_BACK m23 BOOST_HANA_PP_BACK m23; BOOST_HANA_PP_DROP_BACK m24 BOOST_HANA_PP_BACK m24; BOOST_HANA_PP_DROP_BACK m25 BOOST_HANA_PP_BACK m25; BOOST_HANA_PP_DROP_BACK m26 BOOST_HANA_PP_BACK m26; BOOST_HANA_PP_DROP_BACK m27 BOOST_HANA_PP_BACK m27; BOOST_HANA_PP_DROP_BACK m28 BOOST_HANA_PP_BACK m28; BOOST_HANA_PP_DROP_BACK m29 BOOST_HANA_PP_BACK m29; BOOST_HANA_PP_DROP_BACK m30 BOOST_HANA_PP_BACK m30; BOOST_HANA_PP_DROP_BACK m31 BOOST_HANA_PP_BACK m31; BOOST_HANA_PP_DROP_BACK m32 BOOST_HANA_PP_BACK m32; BOOST_HANA_PP_DROP_BACK m33 BOOST_HANA_PP_BACK m33; BOOST_HANA_PP_DROP_BACK m34 BOOST_HANA_PP_BACK m34; BOOST_HANA_PP_DROP_BACK m35 BOOST_HANA_PP_BACK m35; BOOST_HANA_PP_DROP_BACK m36 BOOST_HANA_PP_BACK m36; BOOST_HANA_PP_DROP_BACK m37 BOOST_HANA_PP_BACK m37; BOOST_HANA_PP_DROP_BACK m38 BOOST_HANA_PP_BACK m38; BOOST_HANA_PP_DROP_BACK m39 BOOST_HANA_PP_BACK m39;                                             \
-  struct hana { struct accessors_impl {                                     \
-    static constexpr auto apply() {                                         \
-      struct member_names {                                                 \
-        static constexpr auto get() {                                       \
-            return ::boost::hana::make_tuple(                               \
-                BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m20), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m21), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m22), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m23), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m24), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m25), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m26), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m27), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m28), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m29), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m30), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m31), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m32), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m33), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m34), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m35), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m36), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m37), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m38), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m39)                              \
-            );                                                              \
-        }                                                                   \
-      };                                                                    \
-      return ::boost::hana::make_tuple(                                     \
-        BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 19, BOOST_HANA_PP_BACK m20), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 20, BOOST_HANA_PP_BACK m21), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 21, BOOST_HANA_PP_BACK m22), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 22, BOOST_HANA_PP_BACK m23), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 23, BOOST_HANA_PP_BACK m24), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 24, BOOST_HANA_PP_BACK m25), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 25, BOOST_HANA_PP_BACK m26), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 26, BOOST_HANA_PP_BACK m27), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 27, BOOST_HANA_PP_BACK m28), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 28, BOOST_HANA_PP_BACK m29), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 29, BOOST_HANA_PP_BACK m30), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 30, BOOST_HANA_PP_BACK m31), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 31, BOOST_HANA_PP_BACK m32), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 32, BOOST_HANA_PP_BACK m33), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 33, BOOST_HANA_PP_BACK m34), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 34, BOOST_HANA_PP_BACK m35), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 35, BOOST_HANA_PP_BACK m36), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 36, BOOST_HANA_PP_BACK m37), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 37, BOOST_HANA_PP_BACK m38), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 38, BOOST_HANA_PP_BACK m39)                                      \
-      );                                                                    \
-    }                                                                       \
-  }; }                                                                      \
-/**/
-
-#define BOOST_HANA_DEFINE_STRUCT_IMPL_41(TYPE, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40 )   \
-  BOOST_HANA_PP_DROP_BACK m1 BOOST_HANA_PP_BACK m1; BOOST_HANA_PP_DROP_BACK m2 BOOST_HANA_PP_BACK m2; BOOST_HANA_PP_DROP_BACK m3 BOOST_HANA_PP_BACK m3; BOOST_HANA_PP_DROP_BACK m4 BOOST_HANA_PP_BACK m4; BOOST_HANA_PP_DROP_BACK m5 BOOST_HANA_PP_BACK m5; BOOST_HANA_PP_DROP_BACK m6 BOOST_HANA_PP_BACK m6; BOOST_HANA_PP_DROP_BACK m7 BOOST_HANA_PP_BACK m7; BOOST_HANA_PP_DROP_BACK m8 BOOST_HANA_PP_BACK m8; BOOST_HANA_PP_DROP_BACK m9 BOOST_HANA_PP_BACK m9; BOOST_HANA_PP_DROP_BACK m10 BOOST_HANA_PP_BACK m10; BOOST_HANA_PP_DROP_BACK m11 BOOST_HANA_PP_BACK m11; BOOST_HANA_PP_DROP_BACK m12 BOOST_HANA_PP_BACK m12; BOOST_HANA_PP_DROP_BACK m13 BOOST_HANA_PP_BACK m13; BOOST_HANA_PP_DROP_BACK m14 BOOST_HANA_PP_BACK m14; BOOST_HANA_PP_DROP_BACK m15 BOOST_HANA_PP_BACK m15; BOOST_HANA_PP_DROP_BACK m16 BOOST_HANA_PP_BACK m16; BOOST_HANA_PP_DROP_BACK m17 BOOST_HANA_PP_BACK m17; BOOST_HANA_PP_DROP_BACK m18 BOOST_HANA_PP_BACK m18; BOOST_HANA_PP_DROP_BACK m19 BOOST_HANA_PP_BACK m19; BOOST_HANA_PP_DROP_BACK m20 BOOST_HANA_PP_BACK m20; BOOST_HANA_PP_DROP_BACK m21 BOOST_HANA_PP_BACK m21; BOOST_HANA_PP_DROP_BACK m22 BOOST_HANA_PP_BACK m22; BOOST_HANA_PP_DROP_BACK m23 BOOST_HANA_PP_BACK m23; BOOST_HANA_PP_DROP_BACK m24 BOOST_HANA_PP_BACK m24; BOOST_HANA_PP_DROP_BACK m25 BOOST_HANA_PP_BACK m25; BOOST_HANA_PP_DROP_BACK m26 BOOST_HANA_PP_BACK m26; BOOST_HANA_PP_DROP_BACK m27 BOOST_HANA_PP_BACK m27; BOOST_HANA_PP_DROP_BACK m28 BOOST_HANA_PP_BACK m28; BOOST_HANA_PP_DROP_BACK m29 BOOST_HANA_PP_BACK m29; BOOST_HANA_PP_DROP_BACK m30 BOOST_HANA_PP_BACK m30; BOOST_HANA_PP_DROP_BACK m31 BOOST_HANA_PP_BACK m31; BOOST_HANA_PP_DROP_BACK m32 BOOST_HANA_PP_BACK m32; BOOST_HANA_PP_DROP_BACK m33 BOOST_HANA_PP_BACK m33; BOOST_HANA_PP_DROP_BACK m34 BOOST_HANA_PP_BACK m34; BOOST_HANA_PP_DROP_BACK m35 BOOST_HANA_PP_BACK m35; BOOST_HANA_PP_DROP_BACK m36 BOOST_HANA_PP_BACK m36; BOOST_HANA_PP_DROP_BACK m37 BOOST_HANA_PP_BACK m37; BOOST_HANA_PP_DROP_BACK m38 BOOST_HANA_PP_BACK m38; BOOST_HANA_PP_DROP_BACK m39 BOOST_HANA_PP_BACK m39; BOOST_HANA_PP_DROP_BACK m40 BOOST_HANA_PP_BACK m40;                                             \
-  struct hana { struct accessors_impl {                                     \
-    static constexpr auto apply() {                                         \
-      struct member_names {                                                 \
-        static constexpr auto get() {                                       \
-            return ::boost::hana::make_tuple(                               \
-                BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m1), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m2), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m3), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m4), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m5), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m6), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m7), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m8), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m9), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m10), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m11), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m12), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m13), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m14), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m15), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m16), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m17), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m18), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m19), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m20), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m21), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m22), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m23), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m24), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m25), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m26), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m27), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m28), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m29), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m30), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m31), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m32), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m33), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m34), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m35), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m36), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m37), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m38), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m39), BOOST_HANA_PP_STRINGIZE(BOOST_HANA_PP_BACK m40)                              \
-            );                                                              \
-        }                                                                   \
-      };                                                                    \
-      return ::boost::hana::make_tuple(                                     \
-        BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 0, BOOST_HANA_PP_BACK m1), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 1, BOOST_HANA_PP_BACK m2), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 2, BOOST_HANA_PP_BACK m3), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 3, BOOST_HANA_PP_BACK m4), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 4, BOOST_HANA_PP_BACK m5), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 5, BOOST_HANA_PP_BACK m6), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 6, BOOST_HANA_PP_BACK m7), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 7, BOOST_HANA_PP_BACK m8), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 8, BOOST_HANA_PP_BACK m9), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 9, BOOST_HANA_PP_BACK m10), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 10, BOOST_HANA_PP_BACK m11), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 11, BOOST_HANA_PP_BACK m12), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 12, BOOST_HANA_PP_BACK m13), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 13, BOOST_HANA_PP_BACK m14), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 14, BOOST_HANA_PP_BACK m15), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 15, BOOST_HANA_PP_BACK m16), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 16, BOOST_HANA_PP_BACK m17), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 17, BOOST_HANA_PP_BACK m18), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 18, BOOST_HANA_PP_BACK m19), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 19, BOOST_HANA_PP_BACK m20), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 20, BOOST_HANA_PP_BACK m21), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 21, BOOST_HANA_PP_BACK m22), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 22, BOOST_HANA_PP_BACK m23), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 23, BOOST_HANA_PP_BACK m24), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 24, BOOST_HANA_PP_BACK m25), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 25, BOOST_HANA_PP_BACK m26), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 26, BOOST_HANA_PP_BACK m27), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 27, BOOST_HANA_PP_BACK m28), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 28, BOOST_HANA_PP_BACK m29), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 29, BOOST_HANA_PP_BACK m30), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 30, BOOST_HANA_PP_BACK m31), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 31, BOOST_HANA_PP_BACK m32), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 32, BOOST_HANA_PP_BACK m33), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 33, BOOST_HANA_PP_BACK m34), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 34, BOOST_HANA_PP_BACK m35), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 35, BOOST_HANA_PP_BACK m36), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 36, BOOST_HANA_PP_BACK m37), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 37, BOOST_HANA_PP_BACK m38), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 38, BOOST_HANA_PP_BACK m39), BOOST_HANA_MEMBER_PAIR_IMPL(TYPE, 39, BOOST_HANA_PP_BACK m40)                                      \
-      );                                                                    \
-    }                                                                       \
-  }; }                                                                      \
-/**/
-
-
 #endif // !BOOST_HANA_DETAIL_STRUCT_MACROS_HPP
@@ -0,0 +1,249 @@
+/*!
+@file
+Defines `boost::hana::detail::thread_pool`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_THREAD_POOL_HPP
+#define BOOST_HANA_DETAIL_THREAD_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace boost { namespace hana { namespace detail {
+    //! @ingroup group-details
+    //! Small work-stealing pool of threads used to run a batch of
+    //! independent tasks.
+    //!
+    //! A batch of `n` tasks is split into one contiguous range of task
+    //! indices per participant, where the participants are the worker
+    //! threads and the thread submitting the batch. Each participant pops
+    //! tasks from the front of its own range and, when it runs out of work,
+    //! steals tasks from the back of the ranges of the other participants.
+    //! A range is a single atomic word holding both of its bounds, so both
+    //! operations are a single compare-and-swap.
+    //!
+    //! Only one batch runs at a time. If a batch is submitted while another
+    //! one is running (from another thread or from within a task), the new
+    //! batch is simply executed on the submitting thread. This makes it safe
+    //! to nest parallel algorithms.
+    class thread_pool {
+        using range_t = std::uint64_t;
+
+        struct batch {
+            std::size_t participants;
+            std::unique_ptr<std::atomic<range_t>[]> ranges;
+            void (*invoke)(void*, std::size_t);
+            void* context;
+            std::mutex error_mutex;
+            std::exception_ptr error;
+        };
+
+        static constexpr range_t make_range(range_t begin, range_t end)
+        { return (begin << 32) | end; }
+
+        static bool pop_front(std::atomic<range_t>& range, std::size_t& i) {
+            range_t r = range.load(std::memory_order_relaxed);
+            while (true) {
+                range_t begin = r >> 32, end = r & 0xFFFFFFFF;
+                if (begin >= end)
+                    return false;
+                if (range.compare_exchange_weak(r, make_range(begin + 1, end))) {
+                    i = static_cast<std::size_t>(begin);
+                    return true;
+                }
+            }
+        }
+
+        static bool steal_back(std::atomic<range_t>& range, std::size_t& i) {
+            range_t r = range.load(std::memory_order_relaxed);
+            while (true) {
+                range_t begin = r >> 32, end = r & 0xFFFFFFFF;
+                if (begin >= end)
+                    return false;
+                if (range.compare_exchange_weak(r, make_range(begin, end - 1))) {
+                    i = static_cast<std::size_t>(end - 1);
+                    return true;
+                }
+            }
+        }
+
+        static void execute(batch& b, std::size_t i) {
+            try {
+                b.invoke(b.context, i);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock{b.error_mutex};
+                if (!b.error)
+                    b.error = std::current_exception();
+            }
+        }
+
+        static void participate(batch& b, std::size_t self) {
+            std::size_t i;
+            while (true) {
+                if (pop_front(b.ranges[self], i)) {
+                    execute(b, i);
+                    continue;
+                }
+
+                bool stole = false;
+                for (std::size_t k = 1; k < b.participants && !stole; ++k) {
+                    std::size_t victim = (self + k) % b.participants;
+                    if (steal_back(b.ranges[victim], i)) {
+                        execute(b, i);
+                        stole = true;
+                    }
+                }
+                if (!stole)
+                    return;
+            }
+        }
+
+        static bool& inside_batch() {
+            static thread_local bool inside = false;
+            return inside;
+        }
+
+        void work(std::size_t self) {
+            inside_batch() = true;
+            std::size_t seen = 0;
+            while (true) {
+                batch* b;
+                {
+                    std::unique_lock<std::mutex> lock{mutex_};
+                    wakeup_.wait(lock, [&] {
+                        return stop_ || (current_ && generation_ != seen);
+                    });
+                    if (stop_)
+                        return;
+                    seen = generation_;
+                    b = current_;
+                    ++active_;
+                }
+
+                participate(*b, self);
+
+                {
+                    std::lock_guard<std::mutex> lock{mutex_};
+                    if (--active_ == 0)
+                        done_.notify_all();
+                }
+            }
+        }
+
+        std::vector<std::thread> workers_;
+        std::mutex submit_;
+        std::mutex mutex_;
+        std::condition_variable wakeup_;
+        std::condition_variable done_;
+        batch* current_ = nullptr;
+        std::size_t generation_ = 0;
+        std::size_t active_ = 0;
+        bool stop_ = false;
+
+    public:
+        explicit thread_pool(std::size_t workers) {
+            workers_.reserve(workers);
+            for (std::size_t i = 0; i < workers; ++i)
+                workers_.emplace_back([this, i] { this->work(i + 1); });
+        }
+
+        thread_pool(thread_pool const&) = delete;
+        thread_pool& operator=(thread_pool const&) = delete;
+
+        ~thread_pool() {
+            {
+                std::lock_guard<std::mutex> lock{mutex_};
+                stop_ = true;
+            }
+            wakeup_.notify_all();
+            for (std::thread& worker : workers_)
+                worker.join();
+        }
+
+        //! Number of threads taking part in a batch, including the thread
+        //! submitting it.
+        std::size_t concurrency() const
+        { return workers_.size() + 1; }
+
+        //! Call `invoke(context, i)` for every `i` in `[0, n)` and return
+        //! once all the calls are done. If any call throws, the first
+        //! exception is rethrown once all the other calls have completed.
+        void run(std::size_t n, void (*invoke)(void*, std::size_t), void* context) {
+            if (n == 0)
+                return;
+
+            bool& inside = inside_batch();
+            std::unique_lock<std::mutex> submit{submit_, std::defer_lock};
+            if (n == 1 || workers_.empty() || inside || !submit.try_lock()) {
+                std::exception_ptr error;
+                for (std::size_t i = 0; i < n; ++i) {
+                    try {
+                        invoke(context, i);
+                    } catch (...) {
+                        if (!error)
+                            error = std::current_exception();
+                    }
+                }
+                if (error)
+                    std::rethrow_exception(error);
+                return;
+            }
+
+            batch b;
+            b.participants = concurrency();
+            b.ranges.reset(new std::atomic<range_t>[b.participants]);
+            b.invoke = invoke;
+            b.context = context;
+            for (std::size_t p = 0; p < b.participants; ++p) {
+                range_t begin = n * p / b.participants;
+                range_t end = n * (p + 1) / b.participants;
+                b.ranges[p].store(make_range(begin, end), std::memory_order_relaxed);
+            }
+
+            {
+                std::lock_guard<std::mutex> lock{mutex_};
+                current_ = &b;
+                ++generation_;
+            }
+            wakeup_.notify_all();
+
+            inside = true;
+            participate(b, 0);
+            inside = false;
+
+            {
+                std::unique_lock<std::mutex> lock{mutex_};
+                current_ = nullptr;
+                done_.wait(lock, [&] { return active_ == 0; });
+            }
+
+            if (b.error)
+                std::rethrow_exception(b.error);
+        }
+
+        //! Pool shared by the whole program, with one worker per hardware
+        //! thread besides the calling thread.
+        static thread_pool& instance() {
+            static thread_pool pool{
+                std::thread::hardware_concurrency() > 1
+                    ? std::thread::hardware_concurrency() - 1
+                    : 0
+            };
+            return pool;
+        }
+    };
+}}} // end namespace boost::hana::detail
+
+#endif // !BOOST_HANA_DETAIL_THREAD_POOL_HPP
@@ -0,0 +1,63 @@
+/*!
+@file
+Defines `boost::hana::detail::variadic::fold_balanced`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_VARIADIC_FOLD_BALANCED_HPP
+#define BOOST_HANA_DETAIL_VARIADIC_FOLD_BALANCED_HPP
+
+#include <boost/hana/detail/closure.hpp>
+
+#include <cstddef>
+
+
+namespace boost { namespace hana { namespace detail { namespace variadic {
+    // Reduces the `n` elements of the closure starting at index `lo` by
+    // splitting them in two halves, reducing each half and then combining
+    // the two partial results with `f`. The closure only holds references
+    // to the original arguments, so nothing is copied on the way down.
+    template <std::size_t lo, std::size_t n>
+    struct fold_balanced_impl {
+        template <typename F, typename Xs>
+        static constexpr decltype(auto) apply(F& f, Xs& xs) {
+            return f(fold_balanced_impl<lo, n / 2>::apply(f, xs),
+                     fold_balanced_impl<lo + n / 2, n - n / 2>::apply(f, xs));
+        }
+    };
+
+    template <std::size_t lo>
+    struct fold_balanced_impl<lo, 1> {
+        template <typename Xn>
+        static constexpr Xn forward(element<lo, Xn>& x)
+        { return static_cast<Xn>(x.get); }
+
+        template <typename F, typename Xs>
+        static constexpr decltype(auto) apply(F&, Xs& xs)
+        { return forward(xs); }
+    };
+
+    struct _fold_balanced {
+        template <typename F, typename X1>
+        constexpr X1 operator()(F&&, X1&& x1) const
+        { return static_cast<X1&&>(x1); }
+
+        template <typename F, typename X1, typename X2, typename ...Xn>
+        constexpr decltype(auto)
+        operator()(F&& f, X1&& x1, X2&& x2, Xn&& ...xn) const {
+            closure<X1&&, X2&&, Xn&&...> xs{
+                static_cast<X1&&>(x1),
+                static_cast<X2&&>(x2),
+                static_cast<Xn&&>(xn)...
+            };
+            return fold_balanced_impl<0, 2 + sizeof...(Xn)>::apply(f, xs);
+        }
+    };
+
+    constexpr _fold_balanced fold_balanced{};
+}}}} // end namespace boost::hana::detail::variadic
+
+#endif // !BOOST_HANA_DETAIL_VARIADIC_FOLD_BALANCED_HPP
@@ -21,6 +21,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/core/when.hpp>
 #include <boost/hana/detail/by.hpp> // needed by xxx.by
 #include <boost/hana/detail/create.hpp>
+#include <boost/hana/detail/variadic/fold_balanced.hpp>
 #include <boost/hana/detail/variadic/foldl1.hpp>
 #include <boost/hana/detail/variadic/foldr1.hpp>
 #include <boost/hana/detail/variadic/for_each.hpp>
@@ -107,6 +108,38 @@ namespace boost { namespace hana {
         }
     };
 
+    //////////////////////////////////////////////////////////////////////////
+    // fold_balanced
+    //////////////////////////////////////////////////////////////////////////
+    template <typename T, typename>
+    struct fold_balanced_impl : fold_balanced_impl<T, when<true>> { };
+
+    template <typename T, bool condition>
+    struct fold_balanced_impl<T, when<condition>> : default_ {
+        // with state
+        template <typename Xs, typename S, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, S&& s, F&& f) {
+            return hana::unpack(static_cast<Xs&&>(xs),
+                hana::partial(
+                    detail::variadic::fold_balanced,
+                    static_cast<F&&>(f),
+                    static_cast<S&&>(s)
+                )
+            );
+        }
+
+        // without state
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            return hana::unpack(static_cast<Xs&&>(xs),
+                hana::partial(
+                    detail::variadic::fold_balanced,
+                    static_cast<F&&>(f)
+                )
+            );
+        }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // monadic_fold_left
     //////////////////////////////////////////////////////////////////////////
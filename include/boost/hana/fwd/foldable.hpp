@@ -354,6 +354,120 @@ namespace boost { namespace hana {
     constexpr _fold_right fold_right{};
 #endif
 
+    //! Tree-shaped fold of a structure using an associative binary operation
+    //! and an optional initial reduction state.
+    //! @relates Foldable
+    //!
+    //! `fold_balanced` reduces the elements of a structure pairwise, in a
+    //! balanced binary tree. Given a structure containing `x1, ..., xn`, an
+    //! associative function `f` and an optional initial state, the elements
+    //! are split in two halves, each half is reduced recursively and the two
+    //! partial results are combined with `f`. For example,
+    //! @code
+    //!     f(f(x1, x2), f(x3, x4))                 // without state
+    //!     f(f(state, x1), f(x2, f(x3, x4)))       // with state
+    //! @endcode
+    //!
+    //! When `f` is associative, the result is the same as for `fold_left`
+    //! and `fold_right`. However, the chain of calls to `f` has a depth of
+    //! `log(n)` instead of `n`. At runtime, this exposes independent
+    //! operations to the processor, which can be significantly faster for
+    //! e.g. floating point sums. At compile-time, this also reduces the
+    //! depth of the template instantiations required to compute the
+    //! result. When `f` is not associative, the result is unspecified
+    //! and `fold_left` or `fold_right` should be used instead.
+    //!
+    //! When the structure is empty, two things may arise. If an initial
+    //! state was provided, it is returned as-is. Otherwise, if the no-state
+    //! version of the function was used, an error is triggered. When the
+    //! stucture contains a single element and the no-state version of the
+    //! function was used, that single element is returned as is.
+    //!
+    //!
+    //! Signature
+    //! ---------
+    //! Given a `Foldable` `F` and an optional initial state of tag `T`,
+    //! the signatures for `fold_balanced` are
+    //! \f[
+    //!     \mathtt{fold\_balanced} : F(T) \times T \times (T \times T \to T) \to T
+    //! \f]
+    //!
+    //! for the variant with an initial state, and
+    //! \f[
+    //!     \mathtt{fold\_balanced} : F(T) \times (T \times T \to T) \to T
+    //! \f]
+    //!
+    //! for the variant without an initial state.
+    //!
+    //! @param xs
+    //! The structure to fold.
+    //!
+    //! @param state
+    //! The initial value used for folding. It is treated as if it was the
+    //! first element of the structure.
+    //!
+    //! @param f
+    //! An associative binary function called as `f(x, y)`, where `x` and
+    //! `y` are either elements of the structure or partial results of the
+    //! reduction.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/foldable.cpp fold_balanced
+    //!
+    //!
+    //! Benchmarks
+    //! ----------
+    //! <div class="benchmark-chart"
+    //!      style="min-width: 310px; height: 400px; margin: 0 auto"
+    //!      data-dataset="benchmark.fold_balanced.execute.json">
+    //! </div>
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto fold_balanced = [](auto&& xs[, auto&& state], auto&& f) -> decltype(auto) {
+        return tag-dispatched;
+    };
+#else
+    template <typename Xs, typename = void>
+    struct fold_balanced_impl;
+
+    struct _fold_balanced {
+        template <typename Xs, typename State, typename F>
+        constexpr decltype(auto) operator()(Xs&& xs, State&& state, F&& f) const {
+            using S = typename datatype<Xs>::type;
+            using FoldBalanced = BOOST_HANA_DISPATCH_IF(fold_balanced_impl<S>,
+                _models<Foldable, S>{}()
+            );
+
+        #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+            static_assert(_models<Foldable, S>{},
+            "hana::fold_balanced(xs, state, f) requires xs to be Foldable");
+        #endif
+
+            return FoldBalanced::apply(static_cast<Xs&&>(xs),
+                                       static_cast<State&&>(state),
+                                       static_cast<F&&>(f));
+        }
+
+        template <typename Xs, typename F>
+        constexpr decltype(auto) operator()(Xs&& xs, F&& f) const {
+            using S = typename datatype<Xs>::type;
+            using FoldBalanced = BOOST_HANA_DISPATCH_IF(fold_balanced_impl<S>,
+                _models<Foldable, S>{}()
+            );
+
+        #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+            static_assert(_models<Foldable, S>{},
+            "hana::fold_balanced(xs, f) requires xs to be Foldable");
+        #endif
+
+            return FoldBalanced::apply(static_cast<Xs&&>(xs), static_cast<F&&>(f));
+        }
+    };
+
+    constexpr _fold_balanced fold_balanced{};
+#endif
+
     //! Equivalent to `fold_left`; provided for convenience.
     //! @relates Foldable
     //!
@@ -249,6 +249,35 @@ namespace boost { namespace hana {
     constexpr _members members{};
 #endif
 
+    //! Returns a `Sequence` of references to the members of a `Struct`.
+    //! @relates Struct
+    //!
+    //! Given a `Struct` object, `members_ref` returns a `Sequence` holding
+    //! references to all the members of the `Struct`, in the same order as
+    //! their respective accessor appears in the `accessors` sequence. Unlike
+    //! `members`, which copies the members into a new `Sequence`, this does
+    //! not copy anything and allows modifying the members through the
+    //! returned `Sequence`. When the `Struct` is a temporary, its members
+    //! are moved into the returned `Sequence` instead, so that it does not
+    //! hold dangling references.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/struct.cpp members_ref
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto members_ref = [](auto&& struct_) {
+        return sequence of references to the members of struct_;
+    };
+#else
+    struct _members_ref {
+        template <typename Object>
+        constexpr auto operator()(Object&& object) const;
+    };
+
+    constexpr _members_ref members_ref{};
+#endif
+
     // Note:
     // For the two macros below, their weird definition as variables seems to
     // exploit a glitch in Doxygen, which makes the macros appear in the
@@ -267,6 +296,8 @@ namespace boost { namespace hana {
     //! This macro only works if the tag of the user-defined type `T` is `T`
     //! itself. This is the case unless you specifically asked for something
     //! different; see `datatype`'s documentation.
+    //! Up to 256 members are supported; this limit can be raised by
+    //! regenerating `<boost/hana/detail/struct_macros.hpp>`.
     //!
     //!
     //! Example
@@ -290,6 +321,8 @@ namespace boost { namespace hana {
     //! This macro only works if the tag of the user-defined type `T` is `T`
     //! itself. This is the case unless you specifically asked for something
     //! different; see `datatype`'s documentation.
+    //! Up to 256 members are supported; this limit can be raised by
+    //! regenerating `<boost/hana/detail/struct_macros.hpp>`.
     //!
     //!
     //! Example
@@ -0,0 +1,172 @@
+/*!
+@file
+Forward declares `boost::hana::View`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FWD_VIEW_HPP
+#define BOOST_HANA_FWD_VIEW_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/fwd/core/operators.hpp>
+
+
+namespace boost { namespace hana {
+    //! @ingroup group-datatypes
+    //! Tag representing a lazy, non-owning view over the elements of an
+    //! `Iterable`.
+    //!
+    //! Algorithms like `transform` or `filter` create a new sequence
+    //! holding their result, which means that a chain of such algorithms
+    //! copies the elements of the sequence once per step, and instantiates
+    //! a new sequence type at each step too. A `View` instead refers to the
+    //! original sequence (called its _base_) without copying it, and holds
+    //! a compile-time map from the positions in the view to the positions
+    //! in the base, along with a function applied to the elements of the
+    //! base when they are accessed. Creating a view from another view
+    //! simply composes the index maps and the functions at compile-time,
+    //! so that a chain of views is always a single, flat view over the
+    //! original sequence; no intermediate sequence is ever created.
+    //!
+    //! Views are created with the functions in the `view` namespace, i.e.
+    //! `view::transform`, `view::filter`, `view::reverse` and `view::slice`.
+    //! Elements are only computed when the view is accessed, and they are
+    //! computed again each time they are accessed. A view can be turned
+    //! into a normal sequence with `to<Tuple>`, or consumed directly by any
+    //! algorithm on `Foldable`s or `Iterable`s, like `fold` or `for_each`.
+    //!
+    //! @note
+    //! A view refers to its base and does not own it, so the base must
+    //! outlive the view. For this reason, views can only be created from
+    //! lvalues, or from other views. Also, the functions given to
+    //! `view::transform` must not have side effects, since they may be
+    //! called any number of times for the same element.
+    //!
+    //!
+    //! Modeled concepts
+    //! ----------------
+    //! 1. `Foldable`\n
+    //! Folding a view is equivalent to folding the sequence it represents,
+    //! but the elements are passed directly from the base to the folding
+    //! function, without building an intermediate sequence.
+    //! @snippet example/view.cpp foldable
+    //!
+    //! 2. `Iterable` (operators provided)\n
+    //! Iterating over a view is equivalent to iterating over the sequence
+    //! it represents. `tail` returns a view over the same base.
+    //! @snippet example/view.cpp iterable
+    struct View { };
+
+    template <typename Xs, typename Indices, typename F>
+    struct _view;
+
+    namespace view {
+        //! Returns a view of a sequence whose elements are the result of
+        //! applying a function to the elements of the sequence.
+        //! @relates boost::hana::View
+        //!
+        //! Given an `Iterable` `xs` containing `x1, ..., xn` and a function
+        //! `f`, `view::transform(xs, f)` returns a view whose elements are
+        //! `f(x1), ..., f(xn)`. Nothing is computed until the elements are
+        //! accessed. If `xs` is itself a view, the result is a view over
+        //! the base of `xs`, with `f` composed after the function of `xs`.
+        //!
+        //!
+        //! Example
+        //! -------
+        //! @snippet example/view.cpp transform
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+        constexpr auto transform = [](auto& xs, auto&& f) {
+            return unspecified-view;
+        };
+#else
+        struct _transform {
+            template <typename Xs, typename F>
+            constexpr auto operator()(Xs&& xs, F&& f) const;
+        };
+
+        constexpr _transform transform{};
+#endif
+
+        //! Returns a view of the elements of a sequence satisfying a
+        //! compile-time predicate.
+        //! @relates boost::hana::View
+        //!
+        //! Given an `Iterable` `xs` and a predicate `pred`, `view::filter`
+        //! returns a view of the elements `x` of `xs` such that `pred(x)` is
+        //! a true-valued `Constant`, in the same order. The predicate must
+        //! return a `Constant` `Logical`, because the positions of the kept
+        //! elements are computed at compile-time from the type of `pred(x)`
+        //! only; `pred` is never actually called. When `xs` is the result of
+        //! `view::transform`, the transformation is not applied to the
+        //! elements that are filtered out.
+        //!
+        //!
+        //! Example
+        //! -------
+        //! @snippet example/view.cpp filter
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+        constexpr auto filter = [](auto& xs, auto&& pred) {
+            return unspecified-view;
+        };
+#else
+        struct _filter {
+            template <typename Xs, typename Pred>
+            constexpr auto operator()(Xs&& xs, Pred&& pred) const;
+        };
+
+        constexpr _filter filter{};
+#endif
+
+        //! Returns a view of the elements of a sequence in reverse order.
+        //! @relates boost::hana::View
+        //!
+        //!
+        //! Example
+        //! -------
+        //! @snippet example/view.cpp reverse
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+        constexpr auto reverse = [](auto& xs) {
+            return unspecified-view;
+        };
+#else
+        struct _reverse {
+            template <typename Xs>
+            constexpr auto operator()(Xs&& xs) const;
+        };
+
+        constexpr _reverse reverse{};
+#endif
+
+        //! Returns a view of the elements of a sequence in the half-open
+        //! interval `[from, to)` of positions.
+        //! @relates boost::hana::View
+        //!
+        //! `from` and `to` must be `Constant`s holding non-negative integral
+        //! values such that `from <= to <= length(xs)`. Otherwise, a
+        //! compilation error is triggered. Like with `take_at_most`, taking
+        //! the first `n` elements of a sequence is `view::slice(xs, 0, n)`.
+        //!
+        //!
+        //! Example
+        //! -------
+        //! @snippet example/view.cpp slice
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+        constexpr auto slice = [](auto& xs, auto from, auto to) {
+            return unspecified-view;
+        };
+#else
+        struct _slice {
+            template <typename Xs, typename From, typename To>
+            constexpr auto operator()(Xs&& xs, From const&, To const&) const;
+        };
+
+        constexpr _slice slice{};
+#endif
+    }
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_FWD_VIEW_HPP
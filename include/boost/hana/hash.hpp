@@ -0,0 +1,401 @@
+/*!
+@file
+Defines `boost::hana::hash` and the specializations of `std::hash` for
+`boost::hana::_tuple` and `boost::hana::_pair`.
+
+This header is not included by `boost/hana.hpp`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_HASH_HPP
+#define BOOST_HANA_HASH_HPP
+
+#include <boost/hana/comparable.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/datatype.hpp>
+#include <boost/hana/core/default.hpp>
+#include <boost/hana/core/models.hpp>
+#include <boost/hana/core/when.hpp>
+#include <boost/hana/detail/wrong.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/sequence.hpp>
+#include <boost/hana/struct.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+
+namespace boost { namespace hana {
+    namespace hash_detail {
+        // The 64 bits mixing function of Boost.ContainerHash, which has a
+        // good avalanche behavior: every bit of the input affects about half
+        // of the bits of the output.
+        inline std::uint64_t mix(std::uint64_t x) {
+            x ^= x >> 32;
+            x *= 0xe9846af9b1a615du;
+            x ^= x >> 32;
+            x *= 0xe9846af9b1a615du;
+            x ^= x >> 28;
+            return x;
+        }
+
+        inline std::uint64_t combine(std::uint64_t seed, std::uint64_t h)
+        { return hash_detail::mix(seed + 0x9e3779b9u + h); }
+
+        inline std::size_t hash_bytes(void const* p, std::size_t n) {
+            char const* bytes = static_cast<char const*>(p);
+            std::uint64_t h = n;
+            for (; n >= 8; bytes += 8, n -= 8) {
+                std::uint64_t word;
+                std::memcpy(&word, bytes, 8);
+                h = hash_detail::combine(h, word);
+            }
+            if (n != 0) {
+                std::uint64_t word = 0;
+                std::memcpy(&word, bytes, n);
+                h = hash_detail::combine(h, word);
+            }
+            return static_cast<std::size_t>(h);
+        }
+
+        template <typename T>
+        struct is_std_array : std::false_type { };
+
+        template <typename T, std::size_t n>
+        struct is_std_array<std::array<T, n>> : std::true_type { };
+
+        //////////////////////////////////////////////////////////////////////
+        // has_unique_representation
+        //
+        // Whether two objects of type T are equal if and only if their
+        // object representations are equal, like C++17's
+        // `std::has_unique_object_representations`. Integers, enumerations
+        // and pointers have this property; floating point numbers don't,
+        // since `0.0 == -0.0`. An aggregate of such types has it if it has
+        // no padding, which is the case when the sizes of its members add
+        // up to its size.
+        //////////////////////////////////////////////////////////////////////
+        template <typename T, typename = void>
+        struct has_unique_representation
+            : has_unique_representation<T, when<true>>
+        { };
+
+        template <typename T, bool condition>
+        struct has_unique_representation<T, when<condition>>
+            : std::integral_constant<bool,
+                std::is_integral<T>{} || std::is_enum<T>{} || std::is_pointer<T>{}
+            >
+        { };
+
+        template <bool ...b>
+        struct all : std::is_same<all<b...>, all<(b, true)...>> { };
+
+        template <std::size_t ...n>
+        constexpr std::size_t sum() {
+            std::size_t const sizes[] = {n..., 0};
+            std::size_t result = 0;
+            for (std::size_t size : sizes)
+                result += size;
+            return result;
+        }
+
+        template <typename Aggregate, typename ...Member>
+        struct without_padding
+            : std::integral_constant<bool,
+                std::is_trivially_copyable<Aggregate>{} &&
+                all<has_unique_representation<Member>{}()...>{} &&
+                sizeof(Aggregate) == hash_detail::sum<sizeof(Member)...>()
+            >
+        { };
+
+        template <typename T, std::size_t n>
+        struct has_unique_representation<T[n]>
+            : has_unique_representation<T>
+        { };
+
+        template <typename T, std::size_t n>
+        struct has_unique_representation<std::array<T, n>>
+            : std::integral_constant<bool,
+                has_unique_representation<T>{} && sizeof(std::array<T, n>) == n * sizeof(T)
+            >
+        { };
+
+        template <typename ...T>
+        struct has_unique_representation<_tuple<T...>>
+            : without_padding<_tuple<T...>, T...>
+        { };
+
+        template <typename First, typename Second>
+        struct has_unique_representation<_pair<First, Second>>
+            : without_padding<_pair<First, Second>, First, Second>
+        { };
+
+        // The members of a Struct must be real members, which are accessed
+        // by reference; otherwise, the Struct may hold other data.
+        template <typename S, typename Accessors = decltype(hana::accessors<S>())>
+        struct struct_without_padding;
+
+        template <typename S, typename ...Key, typename ...Accessor>
+        struct struct_without_padding<S, _tuple<_pair<Key, Accessor>...>>
+            : std::integral_constant<bool,
+                all<std::is_lvalue_reference<
+                    decltype(std::declval<Accessor>()(std::declval<S&>()))
+                >{}()...>{} &&
+                without_padding<S, typename std::decay<
+                    decltype(std::declval<Accessor>()(std::declval<S&>()))
+                >::type...>{}
+            >
+        { };
+
+        template <typename S>
+        struct has_unique_representation<S, when<_models<Struct, S>{}()>>
+            : struct_without_padding<S>
+        { };
+    }
+
+    //! @ingroup group-datatypes
+    //! Returns a hash value for an object, suitable for hash tables.
+    //!
+    //! Given an object `x`, `hash(x)` returns a `std::size_t` such that
+    //! `hash(x) == hash(y)` whenever `x` and `y` are objects of the same
+    //! type which compare equal. It is defined recursively:
+    //!
+    //! - The hash value of a `Struct` combines the hash values of its
+    //!   members, in order. Similarly, the hash value of a `Sequence`, of a
+    //!   `Pair` or of a `std::array` combines the hash values of its
+    //!   elements. The hash values are combined with the mixing function of
+    //!   Boost.ContainerHash, so that objects differing by a single bit in a
+    //!   single member have unrelated hash values.
+    //! - However, when an object of one of these types is made only of
+    //!   integers, enumerations or pointers and has no padding, it is equal
+    //!   to another object exactly when their bytes are equal. Its bytes are
+    //!   then hashed 8 at a time, without visiting the members.
+    //! - Any other object is hashed with `std::hash`.
+    //!
+    //! Other types can be made hashable by specializing `hash_impl`, whose
+    //! `apply` function takes the object and returns its hash value.
+    //!
+    //! `boost/hana/hash.hpp` also specializes `std::hash` for `hana::_tuple`
+    //! and `hana::_pair`, and the `BOOST_HANA_SPECIALIZE_STD_HASH` macro
+    //! does the same for a `Struct`, so that they can be used as the keys
+    //! of a `std::unordered_map` or `std::unordered_set`.
+    //!
+    //! @note
+    //! This function is not included by `boost/hana.hpp`; it must be
+    //! included with `boost/hana/hash.hpp`. Hash values may differ across
+    //! platforms and versions of the library, so they should not be stored.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/hash.cpp hash
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto hash = [](auto const& x) -> std::size_t {
+        return tag-dispatched;
+    };
+#else
+    template <typename T, typename = void>
+    struct hash_impl : hash_impl<T, when<true>> { };
+
+    struct _hash {
+        template <typename X>
+        std::size_t operator()(X const& x) const {
+            using T = typename std::decay<X>::type;
+            return hash_impl<T>::apply(x);
+        }
+    };
+
+    constexpr _hash hash{};
+#endif
+
+    namespace hash_detail {
+        template <typename T, typename = void>
+        struct has_std_hash : std::false_type { };
+
+        template <typename T>
+        struct has_std_hash<T, decltype((void)std::hash<T>{}(std::declval<T const&>()))>
+            : std::true_type
+        { };
+
+        template <typename T>
+        struct is_composite
+            : std::integral_constant<bool,
+                _models<Struct, T>{}() ||
+                _models<Sequence, typename datatype<T>::type>{}() ||
+                std::is_same<typename datatype<T>::type, Pair>{} ||
+                is_std_array<T>{}
+            >
+        { };
+
+        template <typename S>
+        struct hash_members {
+            S const& x;
+
+            template <typename ...Member>
+            std::size_t operator()(Member const& ...member) const {
+                std::uint64_t h = 0;
+                using Swallow = int[];
+                (void)Swallow{0, ((void)(
+                    h = hash_detail::combine(h, hana::hash(hana::second(member)(x)))
+                ), 0)...};
+                return static_cast<std::size_t>(h);
+            }
+        };
+
+        struct hash_elements {
+            template <typename ...X>
+            std::size_t operator()(X const& ...x) const {
+                std::uint64_t h = 0;
+                using Swallow = int[];
+                (void)Swallow{0, ((void)(
+                    h = hash_detail::combine(h, hana::hash(x))
+                ), 0)...};
+                return static_cast<std::size_t>(h);
+            }
+        };
+    }
+
+    template <typename T, bool condition>
+    struct hash_impl<T, when<condition>> : default_ {
+        static_assert(detail::wrong<hash_impl<T>>{},
+        "hana::hash requires the object to be a Struct, a Sequence, a Pair, "
+        "a std::array, or an object for which std::hash is defined");
+
+        static std::size_t apply(T const&);
+    };
+
+    template <typename T>
+    struct hash_impl<T, when<
+        hash_detail::is_composite<T>{}() &&
+        hash_detail::has_unique_representation<T>{}()
+    >> {
+        static std::size_t apply(T const& x)
+        { return hash_detail::hash_bytes(&x, sizeof(T)); }
+    };
+
+    template <typename S>
+    struct hash_impl<S, when<
+        _models<Struct, S>{}() &&
+        !hash_detail::has_unique_representation<S>{}()
+    >> {
+        static std::size_t apply(S const& x)
+        { return hana::unpack(hana::accessors<S>(), hash_detail::hash_members<S>{x}); }
+    };
+
+    template <typename T>
+    struct hash_impl<T, when<
+        _models<Sequence, typename datatype<T>::type>{}() &&
+        !_models<Struct, T>{}() &&
+        !hash_detail::is_std_array<T>{}() &&
+        !hash_detail::has_unique_representation<T>{}()
+    >> {
+        static std::size_t apply(T const& xs)
+        { return hana::unpack(xs, hash_detail::hash_elements{}); }
+    };
+
+    template <typename P>
+    struct hash_impl<P, when<
+        std::is_same<typename datatype<P>::type, Pair>{}() &&
+        !hash_detail::has_unique_representation<P>{}()
+    >> {
+        static std::size_t apply(P const& p)
+        { return hash_detail::hash_elements{}(hana::first(p), hana::second(p)); }
+    };
+
+    template <typename T, std::size_t n>
+    struct hash_impl<std::array<T, n>, when<
+        !hash_detail::has_unique_representation<std::array<T, n>>{}()
+    >> {
+        static std::size_t apply(std::array<T, n> const& xs) {
+            std::uint64_t h = 0;
+            for (T const& x : xs)
+                h = hash_detail::combine(h, hana::hash(x));
+            return static_cast<std::size_t>(h);
+        }
+    };
+
+    template <typename T>
+    struct hash_impl<T, when<
+        !hash_detail::is_composite<T>{}() &&
+        hash_detail::has_std_hash<T>{}()
+    >> {
+        static std::size_t apply(T const& x)
+        { return std::hash<T>{}(x); }
+    };
+
+    namespace hash_detail {
+        template <typename T>
+        struct std_hash {
+            std::size_t operator()(T const& x) const
+            { return hana::hash(x); }
+        };
+
+        // Objects with a unique representation are compared with a single
+        // `std::memcmp` instead of member by member.
+        template <typename T>
+        struct std_equal_to {
+            bool operator()(T const& x, T const& y) const
+            { return std_equal_to::apply(x, y, has_unique_representation<T>{}); }
+
+            static bool apply(T const& x, T const& y, std::true_type)
+            { return std::memcmp(&x, &y, sizeof(T)) == 0; }
+
+            static bool apply(T const& x, T const& y, std::false_type)
+            { return static_cast<bool>(hana::equal(x, y)); }
+        };
+    }
+}} // end namespace boost::hana
+
+namespace std {
+    template <typename ...T>
+    struct hash<boost::hana::_tuple<T...>>
+        : boost::hana::hash_detail::std_hash<boost::hana::_tuple<T...>>
+    { };
+
+    template <typename First, typename Second>
+    struct hash<boost::hana::_pair<First, Second>>
+        : boost::hana::hash_detail::std_hash<boost::hana::_pair<First, Second>>
+    { };
+}
+
+//! @ingroup group-datatypes
+//! Specializes `std::hash` and `std::equal_to` for a `Struct`.
+//!
+//! `BOOST_HANA_SPECIALIZE_STD_HASH(Type)` makes `std::hash<Type>` return
+//! `hana::hash(x)`, and `std::equal_to<Type>` compare objects with
+//! `hana::equal`, so that `Type` can be used as the key of a
+//! `std::unordered_map` or `std::unordered_set` without providing an
+//! `operator==`. When `Type` is made only of integers, enumerations or
+//! pointers and has no padding, objects are compared with a single
+//! `std::memcmp` instead of member by member. This macro must be used at
+//! global scope, after `Type` was made a `Struct`.
+//!
+//!
+//! Example
+//! -------
+//! @snippet example/hash.cpp std_hash
+#define BOOST_HANA_SPECIALIZE_STD_HASH(...)                                 \
+    namespace std {                                                         \
+        template <>                                                         \
+        struct hash<__VA_ARGS__>                                            \
+            : ::boost::hana::hash_detail::std_hash<__VA_ARGS__>             \
+        { };                                                                \
+                                                                            \
+        template <>                                                         \
+        struct equal_to<__VA_ARGS__>                                        \
+            : ::boost::hana::hash_detail::std_equal_to<__VA_ARGS__>         \
+        { };                                                                \
+    }                                                                       \
+/**/
+
+#endif // !BOOST_HANA_HASH_HPP
@@ -0,0 +1,1079 @@
+/*!
+@file
+Defines `boost::hana::to_json` and `boost::hana::from_json`.
+
+This header is not included by `boost/hana.hpp`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_JSON_HPP
+#define BOOST_HANA_JSON_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/convert.hpp>
+#include <boost/hana/core/datatype.hpp>
+#include <boost/hana/core/default.hpp>
+#include <boost/hana/core/models.hpp>
+#include <boost/hana/core/when.hpp>
+#include <boost/hana/detail/key_dispatch.hpp>
+#include <boost/hana/detail/void_t.hpp>
+#include <boost/hana/detail/wrong.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/sequence.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/struct.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+
+namespace boost { namespace hana {
+    //! @ingroup group-datatypes
+    //! Writes the JSON representation of an object to an output iterator.
+    //!
+    //! Given an object `x` and an output iterator `out` accepting `char`s,
+    //! `to_json(x, out)` writes the JSON representation of `x` to `out` and
+    //! returns the iterator past the last character written. Nothing is
+    //! allocated, so writing to a `char*` into a buffer that is large
+    //! enough, or to a `std::back_insert_iterator` into a `std::string`
+    //! whose capacity is reused from one object to the next, does not
+    //! allocate memory at all. The following objects can be written:
+    //!
+    //! - A `Struct` is written as a JSON object whose keys are the names of
+    //!   its members, which must be compile-time `String`s. The constant
+    //!   parts of the output (the braces, the quoted keys, the colons and
+    //!   the commas) are concatenated at compile-time into one `String` per
+    //!   member, so writing a `Struct` only copies one constant fragment
+    //!   before each member and the closing brace.
+    //! - A `Sequence`, or a runtime range with `begin()` and `end()` like
+    //!   a `std::vector`, is written as a JSON array.
+    //! - `std::string`, `char const*`, `char` and compile-time `String`s are
+    //!   written as JSON strings, with `"`, `\` and control characters
+    //!   escaped.
+    //! - Integral and floating point numbers are written as JSON numbers,
+    //!   except that non-finite floating point numbers are written as `null`.
+    //!   Floating point numbers are written with enough digits to be read
+    //!   back exactly.
+    //! - `bool` is written as `true` or `false`, and `nullptr` as `null`.
+    //!
+    //! Members and elements are written recursively, directly from the
+    //! object; no intermediate string is ever created. Other types can be
+    //! made serializable by specializing `to_json_impl`, whose `apply`
+    //! function takes the object and the output iterator and returns the
+    //! output iterator past the last character written.
+    //!
+    //! @note
+    //! This function is not included by `boost/hana.hpp`; it must be
+    //! included with `boost/hana/json.hpp`. Floating point numbers are
+    //! formatted with `std::snprintf`, so they depend on the C locale.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/json.cpp to_json
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto to_json = [](auto const& x, auto out) {
+        return tag-dispatched;
+    };
+#else
+    template <typename T, typename = void>
+    struct to_json_impl : to_json_impl<T, when<true>> { };
+
+    struct _to_json {
+        template <typename X, typename Out>
+        Out operator()(X const& x, Out out) const {
+            using T = typename std::decay<X>::type;
+            return to_json_impl<T>::apply(x, static_cast<Out&&>(out));
+        }
+    };
+
+    constexpr _to_json to_json{};
+#endif
+
+    //! @ingroup group-datatypes
+    //! Reads an object from its JSON representation in a buffer.
+    //!
+    //! Given a buffer `[first, last)` and an object `x`, `from_json(first,
+    //! last, x)` skips leading whitespace, reads a JSON value into `x`, and
+    //! returns a pointer past the last character of that value. If the
+    //! input does not start with a JSON representation of an object of the
+    //! type of `x`, a null pointer is returned instead, and `x` may have
+    //! been modified. The buffer does not need to be null-terminated, and
+    //! nothing is ever read past `last`. The following objects can be read:
+    //!
+    //! - A `Struct` is read from a JSON object. The members may appear in
+    //!   any order, the members that do not appear are left untouched, and
+    //!   the keys that are not the name of a member are skipped along with
+    //!   their value, which may nest at most 256 arrays and objects. A
+    //!   perfect hash table of the names of the members is generated at
+    //!   compile-time, so finding the member corresponding to a key requires
+    //!   hashing the key, comparing it with the only name that can match,
+    //!   and calling the function reading that member from a table, whatever
+    //!   the number of members.
+    //! - A `Sequence` is read from a JSON array with exactly as many
+    //!   elements, and its elements are read in place.
+    //! - A container with `clear()`, `emplace_back()` and `back()` member
+    //!   functions, like a `std::vector`, is cleared and then read from a
+    //!   JSON array by appending its elements one by one.
+    //! - `std::string` is read from a JSON string, and `char` from a JSON
+    //!   string holding a single character. Escape sequences are decoded,
+    //!   and `\u` escape sequences are encoded in UTF-8.
+    //! - Integral numbers are read from JSON numbers without fraction or
+    //!   exponent which fit in their type. Floating point numbers are read
+    //!   from any JSON number, or from `null`, which is read as a quiet NaN.
+    //! - `bool` is read from `true` or `false`, and `nullptr` from `null`.
+    //!
+    //! Numbers are parsed in place from the buffer. Floating point numbers
+    //! with few enough significant digits and a small enough exponent,
+    //! which covers most numbers found in practice, are computed exactly
+    //! with a single floating point multiplication or division. The other
+    //! ones are copied to a local buffer and converted with `std::strtod`,
+    //! so they depend on the C locale. Other types can be made readable by
+    //! specializing `from_json_impl`, whose `apply` function takes the
+    //! buffer, where leading whitespace was already skipped, and the object,
+    //! and returns a pointer past the value or a null pointer.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/json.cpp from_json
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto from_json = [](char const* first, char const* last, auto& x) {
+        return tag-dispatched;
+    };
+#else
+    template <typename T, typename = void>
+    struct from_json_impl : from_json_impl<T, when<true>> { };
+
+    namespace json_detail {
+        inline char const* skip_whitespace(char const* first, char const* last) {
+            while (first != last && (*first == ' ' || *first == '\n' ||
+                                     *first == '\r' || *first == '\t'))
+                ++first;
+            return first;
+        }
+    }
+
+    struct _from_json {
+        template <typename T>
+        char const* operator()(char const* first, char const* last, T& x) const {
+            first = json_detail::skip_whitespace(first, last);
+            return from_json_impl<T>::apply(first, last, x);
+        }
+    };
+
+    constexpr _from_json from_json{};
+#endif
+
+    namespace json_detail {
+        template <typename Out>
+        Out write(char const* s, std::size_t n, Out out)
+        { return std::copy(s, s + n, static_cast<Out&&>(out)); }
+
+        template <typename Out>
+        Out put(char c, Out out) {
+            *out = c;
+            ++out;
+            return out;
+        }
+
+        // Writes a compile-time `String` verbatim.
+        template <char ...s, typename Out>
+        Out write(_string<s...> const& str, Out out) {
+            return json_detail::write(hana::to<char const*>(str), sizeof...(s),
+                                      static_cast<Out&&>(out));
+        }
+
+        inline bool must_escape(char c) {
+            return c == '"' || c == '\\' ||
+                   static_cast<unsigned char>(c) < 0x20;
+        }
+
+        // Writes a quoted string, copying runs of characters that do not
+        // need to be escaped at once.
+        template <typename Out>
+        Out write_string(char const* s, std::size_t n, Out out) {
+            char const* const last = s + n;
+            out = json_detail::put('"', static_cast<Out&&>(out));
+            while (s != last) {
+                char const* run = std::find_if(s, last, must_escape);
+                out = std::copy(s, run, static_cast<Out&&>(out));
+                if (run == last)
+                    break;
+
+                char const c = *run;
+                char escaped[6] = {'\\', c, 0, 0, 0, 0};
+                std::size_t size = 2;
+                switch (c) {
+                    case '"':  case '\\': break;
+                    case '\b': escaped[1] = 'b'; break;
+                    case '\f': escaped[1] = 'f'; break;
+                    case '\n': escaped[1] = 'n'; break;
+                    case '\r': escaped[1] = 'r'; break;
+                    case '\t': escaped[1] = 't'; break;
+                    default: {
+                        char const hex[] = "0123456789abcdef";
+                        unsigned char const u = static_cast<unsigned char>(c);
+                        escaped[1] = 'u'; escaped[2] = '0'; escaped[3] = '0';
+                        escaped[4] = hex[u >> 4]; escaped[5] = hex[u & 0xF];
+                        size = 6;
+                    }
+                }
+                out = json_detail::write(escaped, size, static_cast<Out&&>(out));
+                s = run + 1;
+            }
+            return json_detail::put('"', static_cast<Out&&>(out));
+        }
+
+        template <typename T, typename Out>
+        Out write_integer(T x, Out out) {
+            using U = typename std::make_unsigned<T>::type;
+            char digits[std::numeric_limits<U>::digits10 + 2];
+            char* const last = digits + sizeof(digits);
+            char* first = last;
+
+            bool const negative = x < 0;
+            U u = negative ? static_cast<U>(0 - static_cast<U>(x)) : static_cast<U>(x);
+            do {
+                *--first = static_cast<char>('0' + u % 10);
+                u /= 10;
+            } while (u != 0);
+            if (negative)
+                *--first = '-';
+            return std::copy(first, last, static_cast<Out&&>(out));
+        }
+
+        template <typename T, typename Out>
+        Out write_floating(T x, Out out) {
+            if (!std::isfinite(x))
+                return json_detail::write("null", 4, static_cast<Out&&>(out));
+
+            constexpr int precision = std::numeric_limits<T>::max_digits10;
+            char buffer[64];
+            int n = std::snprintf(buffer, sizeof(buffer), "%.*Lg", precision,
+                                  static_cast<long double>(x));
+            return json_detail::write(buffer, static_cast<std::size_t>(n),
+                                      static_cast<Out&&>(out));
+        }
+
+        // The constant fragment written before the value of the member
+        // named `Key`; `open` is '{' for the first member and ',' for the
+        // other ones.
+        template <char open, typename Key>
+        struct key_fragment {
+            static_assert(detail::wrong<key_fragment>{},
+            "hana::to_json(x, out) requires the keys of the Struct x to be "
+            "compile-time Strings");
+        };
+
+        template <char open, char ...c>
+        struct key_fragment<open, _string<c...>> {
+            using type = _string<open, '"', c..., '"', ':'>;
+        };
+
+        template <typename X, typename Out>
+        struct write_members {
+            X const& x;
+            Out& out;
+
+            template <std::size_t ...k, typename ...Member>
+            void apply(std::index_sequence<k...>, Member const& ...member) const {
+                using Swallow = int[];
+                (void)Swallow{0, ((void)(
+                    out = json_detail::write(typename key_fragment<
+                        k == 0 ? '{' : ',',
+                        typename std::decay<decltype(hana::first(member))>::type
+                    >::type{}, static_cast<Out&&>(out)),
+                    out = hana::to_json(hana::second(member)(x),
+                                        static_cast<Out&&>(out))
+                ), 0)...};
+            }
+
+            template <typename ...Member>
+            void operator()(Member const& ...member) const {
+                this->apply(std::index_sequence_for<Member...>{}, member...);
+                out = sizeof...(Member) == 0
+                    ? json_detail::write("{}", 2, static_cast<Out&&>(out))
+                    : json_detail::put('}', static_cast<Out&&>(out));
+            }
+        };
+
+        template <typename Out>
+        struct write_elements {
+            Out& out;
+
+            template <std::size_t ...k, typename ...X>
+            void apply(std::index_sequence<k...>, X const& ...x) const {
+                using Swallow = int[];
+                (void)Swallow{0, ((void)(
+                    out = json_detail::put(k == 0 ? '[' : ',',
+                                           static_cast<Out&&>(out)),
+                    out = hana::to_json(x, static_cast<Out&&>(out))
+                ), 0)...};
+            }
+
+            template <typename ...X>
+            void operator()(X const& ...x) const {
+                this->apply(std::index_sequence_for<X...>{}, x...);
+                out = sizeof...(X) == 0
+                    ? json_detail::write("[]", 2, static_cast<Out&&>(out))
+                    : json_detail::put(']', static_cast<Out&&>(out));
+            }
+        };
+
+        template <typename T, typename = void>
+        struct is_range : std::false_type { };
+
+        template <typename T>
+        struct is_range<T, detail::void_t<
+            decltype(std::declval<T const&>().begin()),
+            decltype(std::declval<T const&>().end())
+        >> : std::true_type { };
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Default implementation
+    //////////////////////////////////////////////////////////////////////////
+    template <typename T, bool condition>
+    struct to_json_impl<T, when<condition>> : default_ {
+        template <typename X, typename Out>
+        static Out apply(X const&, Out out) {
+            static_assert(detail::wrong<to_json_impl<X>>{},
+            "hana::to_json(x, out) requires x to be a Struct, a Sequence, a "
+            "range, a string, a number, a bool or nullptr, or to_json_impl "
+            "to be specialized for the type of x");
+            return out;
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Strings
+    //////////////////////////////////////////////////////////////////////////
+    template <typename Traits, typename Allocator>
+    struct to_json_impl<std::basic_string<char, Traits, Allocator>> {
+        template <typename Out>
+        static Out apply(std::basic_string<char, Traits, Allocator> const& s, Out out)
+        { return json_detail::write_string(s.data(), s.size(), static_cast<Out&&>(out)); }
+    };
+
+    template <>
+    struct to_json_impl<char const*> {
+        template <typename Out>
+        static Out apply(char const* s, Out out) {
+            return json_detail::write_string(s, std::char_traits<char>::length(s),
+                                             static_cast<Out&&>(out));
+        }
+    };
+
+    template <>
+    struct to_json_impl<char*> : to_json_impl<char const*> { };
+
+    template <>
+    struct to_json_impl<char> {
+        template <typename Out>
+        static Out apply(char c, Out out)
+        { return json_detail::write_string(&c, 1, static_cast<Out&&>(out)); }
+    };
+
+    template <char ...s>
+    struct to_json_impl<_string<s...>> {
+        template <typename Out>
+        static Out apply(_string<s...> const& str, Out out) {
+            return json_detail::write_string(hana::to<char const*>(str),
+                                             sizeof...(s), static_cast<Out&&>(out));
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Numbers, bool and nullptr
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct to_json_impl<bool> {
+        template <typename Out>
+        static Out apply(bool b, Out out) {
+            return b ? json_detail::write("true", 4, static_cast<Out&&>(out))
+                     : json_detail::write("false", 5, static_cast<Out&&>(out));
+        }
+    };
+
+    template <>
+    struct to_json_impl<std::nullptr_t> {
+        template <typename Out>
+        static Out apply(std::nullptr_t, Out out)
+        { return json_detail::write("null", 4, static_cast<Out&&>(out)); }
+    };
+
+    template <typename T>
+    struct to_json_impl<T, when<std::is_integral<T>{}()>> {
+        template <typename Out>
+        static Out apply(T x, Out out)
+        { return json_detail::write_integer(x, static_cast<Out&&>(out)); }
+    };
+
+    template <typename T>
+    struct to_json_impl<T, when<std::is_floating_point<T>{}()>> {
+        template <typename Out>
+        static Out apply(T x, Out out)
+        { return json_detail::write_floating(x, static_cast<Out&&>(out)); }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Structs, Sequences and ranges
+    //////////////////////////////////////////////////////////////////////////
+    template <typename S>
+    struct to_json_impl<S, when<_models<Struct, S>{}()>> {
+        template <typename Out>
+        static Out apply(S const& x, Out out) {
+            hana::unpack(hana::accessors<S>(),
+                json_detail::write_members<S, Out>{x, out});
+            return out;
+        }
+    };
+
+    template <typename T>
+    struct to_json_impl<T, when<
+        _models<Sequence, typename datatype<T>::type>{}() &&
+        !_models<Struct, T>{}()
+    >> {
+        template <typename Out>
+        static Out apply(T const& xs, Out out) {
+            hana::unpack(xs, json_detail::write_elements<Out>{out});
+            return out;
+        }
+    };
+
+    template <typename T>
+    struct to_json_impl<T, when<
+        json_detail::is_range<T>{}() &&
+        !_models<Sequence, typename datatype<T>::type>{}() &&
+        !_models<Struct, T>{}()
+    >> {
+        template <typename Out>
+        static Out apply(T const& xs, Out out) {
+            auto first = xs.begin();
+            auto const last = xs.end();
+            if (first == last)
+                return json_detail::write("[]", 2, static_cast<Out&&>(out));
+
+            out = json_detail::put('[', static_cast<Out&&>(out));
+            out = hana::to_json(*first, static_cast<Out&&>(out));
+            for (++first; first != last; ++first) {
+                out = json_detail::put(',', static_cast<Out&&>(out));
+                out = hana::to_json(*first, static_cast<Out&&>(out));
+            }
+            return json_detail::put(']', static_cast<Out&&>(out));
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Reading
+    //////////////////////////////////////////////////////////////////////////
+    namespace json_detail {
+        inline char const* read_literal(char const* first, char const* last,
+                                        char const* literal, std::size_t n)
+        {
+            if (static_cast<std::size_t>(last - first) < n ||
+                std::memcmp(first, literal, n) != 0)
+                return nullptr;
+            return first + n;
+        }
+
+        // Returns a pointer to the closing quote of the string whose opening
+        // quote is at `first`, or a null pointer if there is no such string.
+        inline char const* find_string_end(char const* first, char const* last) {
+            if (first == last || *first != '"')
+                return nullptr;
+            for (++first; first != last; ++first) {
+                if (*first == '"')
+                    return first;
+                else if (*first == '\\') {
+                    if (++first == last)
+                        return nullptr;
+                }
+                else if (static_cast<unsigned char>(*first) < 0x20)
+                    return nullptr;
+            }
+            return nullptr;
+        }
+
+        inline bool read_hex4(char const* first, char const* last, std::uint32_t& u) {
+            if (last - first < 4)
+                return false;
+            u = 0;
+            for (char const* const end = first + 4; first != end; ++first) {
+                char const c = *first;
+                std::uint32_t digit = c >= '0' && c <= '9' ? c - '0'
+                                    : c >= 'a' && c <= 'f' ? c - 'a' + 10
+                                    : c >= 'A' && c <= 'F' ? c - 'A' + 10
+                                    : 16;
+                if (digit == 16)
+                    return false;
+                u = u * 16 + digit;
+            }
+            return true;
+        }
+
+        inline std::size_t encode_utf8(std::uint32_t u, char* out) {
+            if (u < 0x80) {
+                out[0] = static_cast<char>(u);
+                return 1;
+            } else if (u < 0x800) {
+                out[0] = static_cast<char>(0xC0 | (u >> 6));
+                out[1] = static_cast<char>(0x80 | (u & 0x3F));
+                return 2;
+            } else if (u < 0x10000) {
+                out[0] = static_cast<char>(0xE0 | (u >> 12));
+                out[1] = static_cast<char>(0x80 | ((u >> 6) & 0x3F));
+                out[2] = static_cast<char>(0x80 | (u & 0x3F));
+                return 3;
+            } else {
+                out[0] = static_cast<char>(0xF0 | (u >> 18));
+                out[1] = static_cast<char>(0x80 | ((u >> 12) & 0x3F));
+                out[2] = static_cast<char>(0x80 | ((u >> 6) & 0x3F));
+                out[3] = static_cast<char>(0x80 | (u & 0x3F));
+                return 4;
+            }
+        }
+
+        // Decodes the contents `[first, last)` of a JSON string, passing
+        // runs of unescaped characters and decoded escape sequences to
+        // `append(char const*, std::size_t)`, which may return false to
+        // stop. Returns whether the whole string was decoded.
+        template <typename Append>
+        bool decode_string(char const* first, char const* last, Append&& append) {
+            while (first != last) {
+                char const* run = std::find(first, last, '\\');
+                if (run != first && !append(first, static_cast<std::size_t>(run - first)))
+                    return false;
+                if (run == last)
+                    return true;
+                if (++run == last)
+                    return false;
+
+                char decoded[4];
+                std::size_t size = 1;
+                switch (*run++) {
+                    case '"':  decoded[0] = '"';  break;
+                    case '\\': decoded[0] = '\\'; break;
+                    case '/':  decoded[0] = '/';  break;
+                    case 'b':  decoded[0] = '\b'; break;
+                    case 'f':  decoded[0] = '\f'; break;
+                    case 'n':  decoded[0] = '\n'; break;
+                    case 'r':  decoded[0] = '\r'; break;
+                    case 't':  decoded[0] = '\t'; break;
+                    case 'u': {
+                        std::uint32_t u, low;
+                        if (!json_detail::read_hex4(run, last, u))
+                            return false;
+                        run += 4;
+                        if (u >= 0xD800 && u < 0xDC00) {
+                            if (last - run < 6 || run[0] != '\\' || run[1] != 'u' ||
+                                !json_detail::read_hex4(run + 2, last, low) ||
+                                low < 0xDC00 || low >= 0xE000)
+                                return false;
+                            run += 6;
+                            u = 0x10000 + ((u - 0xD800) << 10) + (low - 0xDC00);
+                        }
+                        else if (u >= 0xDC00 && u < 0xE000)
+                            return false;
+                        size = json_detail::encode_utf8(u, decoded);
+                        break;
+                    }
+                    default:
+                        return false;
+                }
+                if (!append(decoded, size))
+                    return false;
+                first = run;
+            }
+            return true;
+        }
+
+        // A JSON number, scanned from the buffer. At most 19 significant
+        // digits are kept in `mantissa`; `truncated` is set if there were
+        // more. The value is `mantissa * 10^exponent`.
+        struct number {
+            char const* end;
+            std::uint64_t mantissa;
+            int exponent;
+            bool negative;
+            bool truncated;
+            bool integer;
+        };
+
+        inline number scan_number(char const* first, char const* last) {
+            number n{nullptr, 0, 0, false, false, true};
+            if (first != last && *first == '-') {
+                n.negative = true;
+                ++first;
+            }
+
+            auto digit = [&](char c) {
+                std::uint64_t const max = std::numeric_limits<std::uint64_t>::max();
+                unsigned const d = static_cast<unsigned>(c - '0');
+                if (n.truncated || n.mantissa > max / 10 ||
+                    (n.mantissa == max / 10 && d > max % 10)) {
+                    n.truncated = true;
+                    return false;
+                }
+                n.mantissa = n.mantissa * 10 + d;
+                return true;
+            };
+            auto is_digit = [&] { return first != last && *first >= '0' && *first <= '9'; };
+
+            if (!is_digit())
+                return n;
+            if (*first == '0') {
+                ++first;
+                if (is_digit())
+                    return n;
+            }
+            else for (; is_digit(); ++first)
+                if (!digit(*first))
+                    ++n.exponent;
+
+            if (first != last && *first == '.') {
+                ++first;
+                n.integer = false;
+                if (!is_digit())
+                    return n;
+                for (; is_digit(); ++first)
+                    if (digit(*first))
+                        --n.exponent;
+            }
+
+            if (first != last && (*first == 'e' || *first == 'E')) {
+                ++first;
+                n.integer = false;
+                bool negative = false;
+                if (first != last && (*first == '+' || *first == '-'))
+                    negative = *first++ == '-';
+                if (!is_digit())
+                    return n;
+                int exponent = 0;
+                for (; is_digit(); ++first)
+                    if (exponent < 100000)
+                        exponent = exponent * 10 + (*first - '0');
+                n.exponent += negative ? -exponent : exponent;
+            }
+
+            n.end = first;
+            return n;
+        }
+
+        // The largest power of ten that is exactly representable in a
+        // floating point type with `digits` binary digits of mantissa.
+        constexpr int exact_powers_of_ten(int digits) {
+            int k = 0;
+            long double five = 5;
+            while (five < static_cast<long double>(
+                                digits >= 64 ? 18446744073709551615.0L
+                                             : static_cast<long double>(1ull << digits)))
+            {
+                five *= 5;
+                ++k;
+            }
+            return k;
+        }
+
+        inline float to_floating(char const* s, float*) { return std::strtof(s, nullptr); }
+        inline double to_floating(char const* s, double*) { return std::strtod(s, nullptr); }
+        inline long double to_floating(char const* s, long double*) { return std::strtold(s, nullptr); }
+
+        template <typename T>
+        char const* read_floating(char const* first, char const* last, T& x) {
+            if (first != last && *first == 'n') {
+                x = std::numeric_limits<T>::quiet_NaN();
+                return json_detail::read_literal(first, last, "null", 4);
+            }
+
+            number const n = json_detail::scan_number(first, last);
+            if (n.end == nullptr)
+                return nullptr;
+
+            constexpr int digits = std::numeric_limits<T>::digits;
+            constexpr int max_exponent = json_detail::exact_powers_of_ten(digits);
+            constexpr std::uint64_t max_mantissa =
+                digits >= 64 ? std::numeric_limits<std::uint64_t>::max()
+                             : (std::uint64_t{1} << (digits < 64 ? digits : 0));
+        #if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+            if (!n.truncated && n.mantissa <= max_mantissa &&
+                n.exponent >= -max_exponent && n.exponent <= max_exponent)
+            {
+                T power = 1;
+                for (int e = n.exponent < 0 ? -n.exponent : n.exponent; e != 0; --e)
+                    power *= 10;
+                T const mantissa = static_cast<T>(n.mantissa);
+                x = n.exponent < 0 ? mantissa / power : mantissa * power;
+                if (n.negative)
+                    x = -x;
+                return n.end;
+            }
+        #endif
+
+            std::size_t const size = static_cast<std::size_t>(n.end - first);
+            char buffer[64];
+            if (size < sizeof(buffer)) {
+                std::memcpy(buffer, first, size);
+                buffer[size] = '\0';
+                x = json_detail::to_floating(buffer, static_cast<T*>(nullptr));
+            } else {
+                std::string copy(first, n.end);
+                x = json_detail::to_floating(copy.c_str(), static_cast<T*>(nullptr));
+            }
+            return n.end;
+        }
+
+        template <typename T>
+        char const* read_integer(char const* first, char const* last, T& x) {
+            number const n = json_detail::scan_number(first, last);
+            if (n.end == nullptr || n.truncated || !n.integer)
+                return nullptr;
+
+            using U = typename std::make_unsigned<T>::type;
+            U const max = n.negative
+                ? static_cast<U>(U{0} - static_cast<U>(std::numeric_limits<T>::min()))
+                : static_cast<U>(std::numeric_limits<T>::max());
+            if (n.mantissa > max)
+                return nullptr;
+
+            U const u = static_cast<U>(n.mantissa);
+            x = n.negative ? static_cast<T>(U{0} - u) : static_cast<T>(u);
+            return n.end;
+        }
+
+        // The maximum nesting of arrays and objects in a skipped value. It
+        // bounds the recursion of `skip_value`, so that a deeply nested
+        // input is rejected instead of overflowing the stack.
+        constexpr std::size_t max_skip_depth = 256;
+
+        // Skips any JSON value.
+        inline char const* skip_value(char const* first, char const* last,
+                                      std::size_t depth = 0)
+        {
+            first = json_detail::skip_whitespace(first, last);
+            if (first == last)
+                return nullptr;
+
+            switch (*first) {
+                case '"': {
+                    char const* end = json_detail::find_string_end(first, last);
+                    return end ? end + 1 : nullptr;
+                }
+                case '{': case '[': {
+                    if (depth == max_skip_depth)
+                        return nullptr;
+                    char const close = *first == '{' ? '}' : ']';
+                    first = json_detail::skip_whitespace(first + 1, last);
+                    if (first != last && *first == close)
+                        return first + 1;
+                    while (true) {
+                        if (close == '}') {
+                            first = json_detail::find_string_end(first, last);
+                            if (!first)
+                                return nullptr;
+                            first = json_detail::skip_whitespace(first + 1, last);
+                            if (first == last || *first != ':')
+                                return nullptr;
+                            ++first;
+                        }
+                        first = json_detail::skip_value(first, last, depth + 1);
+                        if (!first)
+                            return nullptr;
+                        first = json_detail::skip_whitespace(first, last);
+                        if (first == last)
+                            return nullptr;
+                        if (*first == close)
+                            return first + 1;
+                        if (*first != ',')
+                            return nullptr;
+                        first = json_detail::skip_whitespace(first + 1, last);
+                    }
+                }
+                case 't': return json_detail::read_literal(first, last, "true", 4);
+                case 'f': return json_detail::read_literal(first, last, "false", 5);
+                case 'n': return json_detail::read_literal(first, last, "null", 4);
+                default:  return json_detail::scan_number(first, last).end;
+            }
+        }
+
+        // The table of functions reading the members of a Struct, indexed
+        // by the position of the member. The last function skips the value
+        // of an unknown key.
+        template <typename S, typename Indices = std::make_index_sequence<
+            decltype(hana::length(hana::accessors<S>()))::value
+        >>
+        struct members;
+
+        template <typename S, std::size_t ...k>
+        struct members<S, std::index_sequence<k...>> {
+            using reader = char const* (*)(char const*, char const*, S&);
+
+            using keys = detail::key_dispatch<
+                typename std::decay<decltype(hana::first(
+                    hana::at_c<k>(hana::accessors<S>())
+                ))>::type...
+            >;
+
+            template <std::size_t i>
+            static char const* read(char const* first, char const* last, S& s) {
+                return hana::from_json(first, last,
+                    hana::second(hana::at_c<i>(hana::accessors<S>()))(s));
+            }
+
+            static char const* skip(char const* first, char const* last, S&)
+            { return json_detail::skip_value(first, last); }
+
+            static constexpr reader readers[sizeof...(k) + 1] = {&read<k>..., &skip};
+
+            // Returns the index of the member whose name is the key whose
+            // quotes are at `first - 1` and `last`.
+            static std::size_t find(char const* first, char const* last) {
+                std::size_t const size = static_cast<std::size_t>(last - first);
+                if (std::memchr(first, '\\', size) == nullptr)
+                    return keys::find(first, size);
+
+                char decoded[keys::max_length + 1];
+                std::size_t n = 0;
+                bool const fits = json_detail::decode_string(first, last,
+                    [&](char const* s, std::size_t count) {
+                        if (count > sizeof(decoded) - n)
+                            return false;
+                        std::memcpy(decoded + n, s, count);
+                        n += count;
+                        return true;
+                    });
+                return fits ? keys::find(decoded, n) : keys::size;
+            }
+        };
+
+        template <typename S, std::size_t ...k>
+        constexpr typename members<S, std::index_sequence<k...>>::reader
+        members<S, std::index_sequence<k...>>::readers[sizeof...(k) + 1];
+
+        template <typename X>
+        char const* read_element(bool first_element, char const* first,
+                                 char const* last, X& x)
+        {
+            first = json_detail::skip_whitespace(first, last);
+            if (!first_element) {
+                if (first == last || *first != ',')
+                    return nullptr;
+                ++first;
+            }
+            return hana::from_json(first, last, x);
+        }
+
+        template <typename Xs, std::size_t ...k>
+        char const* read_elements(char const* first, char const* last, Xs& xs,
+                                  std::index_sequence<k...>)
+        {
+            using Swallow = bool[];
+            (void)Swallow{true, (first = first
+                ? json_detail::read_element(k == 0, first, last, hana::at_c<k>(xs))
+                : nullptr, true)...};
+            (void)last;
+            return first;
+        }
+
+        template <typename T, typename = void>
+        struct is_container : std::false_type { };
+
+        template <typename T>
+        struct is_container<T, detail::void_t<
+            decltype(std::declval<T&>().clear()),
+            decltype(std::declval<T&>().emplace_back()),
+            decltype(std::declval<T&>().back())
+        >> : std::true_type { };
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Default implementation
+    //////////////////////////////////////////////////////////////////////////
+    template <typename T, bool condition>
+    struct from_json_impl<T, when<condition>> : default_ {
+        template <typename X>
+        static char const* apply(char const*, char const*, X&) {
+            static_assert(detail::wrong<from_json_impl<X>>{},
+            "hana::from_json(first, last, x) requires x to be a Struct, a "
+            "Sequence, a container, a string, a number, a bool or nullptr, "
+            "or from_json_impl to be specialized for the type of x");
+            return nullptr;
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Strings
+    //////////////////////////////////////////////////////////////////////////
+    template <typename Traits, typename Allocator>
+    struct from_json_impl<std::basic_string<char, Traits, Allocator>> {
+        static char const* apply(char const* first, char const* last,
+                                 std::basic_string<char, Traits, Allocator>& s)
+        {
+            char const* const end = json_detail::find_string_end(first, last);
+            if (!end)
+                return nullptr;
+            s.clear();
+            bool const decoded = json_detail::decode_string(first + 1, end,
+                [&](char const* run, std::size_t n) {
+                    s.append(run, n);
+                    return true;
+                });
+            return decoded ? end + 1 : nullptr;
+        }
+    };
+
+    template <>
+    struct from_json_impl<char> {
+        static char const* apply(char const* first, char const* last, char& c) {
+            char const* const end = json_detail::find_string_end(first, last);
+            if (!end)
+                return nullptr;
+            std::size_t n = 0;
+            bool const decoded = json_detail::decode_string(first + 1, end,
+                [&](char const* run, std::size_t count) {
+                    if (n + count > 1)
+                        return false;
+                    c = *run;
+                    n += count;
+                    return true;
+                });
+            return decoded && n == 1 ? end + 1 : nullptr;
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Numbers, bool and nullptr
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct from_json_impl<bool> {
+        static char const* apply(char const* first, char const* last, bool& b) {
+            b = first != last && *first == 't';
+            return b ? json_detail::read_literal(first, last, "true", 4)
+                     : json_detail::read_literal(first, last, "false", 5);
+        }
+    };
+
+    template <>
+    struct from_json_impl<std::nullptr_t> {
+        static char const* apply(char const* first, char const* last, std::nullptr_t&)
+        { return json_detail::read_literal(first, last, "null", 4); }
+    };
+
+    template <typename T>
+    struct from_json_impl<T, when<std::is_integral<T>{}()>> {
+        static char const* apply(char const* first, char const* last, T& x)
+        { return json_detail::read_integer(first, last, x); }
+    };
+
+    template <typename T>
+    struct from_json_impl<T, when<std::is_floating_point<T>{}()>> {
+        static char const* apply(char const* first, char const* last, T& x)
+        { return json_detail::read_floating(first, last, x); }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Structs, Sequences and containers
+    //////////////////////////////////////////////////////////////////////////
+    template <typename S>
+    struct from_json_impl<S, when<_models<Struct, S>{}()>> {
+        static char const* apply(char const* first, char const* last, S& s) {
+            using Members = json_detail::members<S>;
+            if (first == last || *first != '{')
+                return nullptr;
+            first = json_detail::skip_whitespace(first + 1, last);
+            if (first != last && *first == '}')
+                return first + 1;
+
+            while (true) {
+                char const* const key = json_detail::find_string_end(first, last);
+                if (!key)
+                    return nullptr;
+                std::size_t const member = Members::find(first + 1, key);
+
+                first = json_detail::skip_whitespace(key + 1, last);
+                if (first == last || *first != ':')
+                    return nullptr;
+                first = Members::readers[member](first + 1, last, s);
+                if (!first)
+                    return nullptr;
+
+                first = json_detail::skip_whitespace(first, last);
+                if (first == last)
+                    return nullptr;
+                if (*first == '}')
+                    return first + 1;
+                if (*first != ',')
+                    return nullptr;
+                first = json_detail::skip_whitespace(first + 1, last);
+            }
+        }
+    };
+
+    template <typename T>
+    struct from_json_impl<T, when<
+        _models<Sequence, typename datatype<T>::type>{}() &&
+        !_models<Struct, T>{}()
+    >> {
+        static char const* apply(char const* first, char const* last, T& xs) {
+            if (first == last || *first != '[')
+                return nullptr;
+            constexpr std::size_t n = decltype(hana::length(xs))::value;
+            first = json_detail::read_elements(first + 1, last, xs,
+                                               std::make_index_sequence<n>{});
+            if (!first)
+                return nullptr;
+            first = json_detail::skip_whitespace(first, last);
+            return first != last && *first == ']' ? first + 1 : nullptr;
+        }
+    };
+
+    template <typename T>
+    struct from_json_impl<T, when<
+        json_detail::is_container<T>{}() &&
+        !_models<Sequence, typename datatype<T>::type>{}() &&
+        !_models<Struct, T>{}()
+    >> {
+        static char const* apply(char const* first, char const* last, T& xs) {
+            if (first == last || *first != '[')
+                return nullptr;
+            xs.clear();
+            first = json_detail::skip_whitespace(first + 1, last);
+            if (first != last && *first == ']')
+                return first + 1;
+
+            while (true) {
+                xs.emplace_back();
+                first = hana::from_json(first, last, xs.back());
+                if (!first)
+                    return nullptr;
+                first = json_detail::skip_whitespace(first, last);
+                if (first == last)
+                    return nullptr;
+                if (*first == ']')
+                    return first + 1;
+                if (*first != ',')
+                    return nullptr;
+                ++first;
+            }
+        }
+    };
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_JSON_HPP
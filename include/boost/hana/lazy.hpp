@@ -20,7 +20,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/core/operators.hpp>
 #include <boost/hana/core/when.hpp>
 #include <boost/hana/detail/closure.hpp>
-#include <boost/hana/detail/wrong.hpp>
+#include <boost/hana/detail/eval.hpp>
 #include <boost/hana/functional/apply.hpp>
 #include <boost/hana/functional/compose.hpp>
 #include <boost/hana/functional/id.hpp>
@@ -33,37 +33,6 @@ Distributed under the Boost Software License, Version 1.0.
 
 
 namespace boost { namespace hana {
-    //////////////////////////////////////////////////////////////////////////
-    // eval
-    //////////////////////////////////////////////////////////////////////////
-    template <typename T, typename>
-    struct eval_impl : eval_impl<T, when<true>> { };
-
-    template <typename T, bool condition>
-    struct eval_impl<T, when<condition>> : default_ {
-        template <typename Expr>
-        static constexpr auto eval_helper(Expr&& expr, int)
-            -> decltype(static_cast<Expr&&>(expr)())
-        { return static_cast<Expr&&>(expr)(); }
-
-        template <typename Expr>
-        static constexpr auto eval_helper(Expr&& expr, long)
-            -> decltype(static_cast<Expr&&>(expr)(hana::id))
-        { return static_cast<Expr&&>(expr)(hana::id); }
-
-        template <typename Expr>
-        static constexpr auto eval_helper(Expr&&, ...) {
-            static_assert(detail::wrong<Expr>{},
-            "hana::eval(expr) requires the expression to be Lazy, "
-            "a nullary Callable or a unary Callable that may be "
-            "called with hana::id");
-        }
-
-        template <typename Expr>
-        static constexpr decltype(auto) apply(Expr&& expr)
-        { return eval_helper(static_cast<Expr&&>(expr), int{}); }
-    };
-
     //////////////////////////////////////////////////////////////////////////
     // lazy
     //////////////////////////////////////////////////////////////////////////
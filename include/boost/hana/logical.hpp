@@ -22,10 +22,11 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/core/when.hpp>
 #include <boost/hana/detail/canonical_constant.hpp>
 #include <boost/hana/detail/dispatch_if.hpp>
+#include <boost/hana/detail/eval.hpp>
+#include <boost/hana/detail/variadic/foldl1.hpp>
 #include <boost/hana/functional/always.hpp>
 #include <boost/hana/functional/compose.hpp>
 #include <boost/hana/functional/id.hpp>
-#include <boost/hana/lazy.hpp>
 
 #include <type_traits>
 #include <utility>
@@ -20,6 +20,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/core/operators.hpp>
 #include <boost/hana/core/when.hpp>
 #include <boost/hana/detail/erase_key_fwd.hpp>
+#include <boost/hana/detail/fast_and.hpp>
 #include <boost/hana/detail/insert_fwd.hpp>
 #include <boost/hana/detail/keys_fwd.hpp>
 #include <boost/hana/foldable.hpp>
@@ -28,13 +29,16 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/functional/partial.hpp>
 #include <boost/hana/functor.hpp>
 #include <boost/hana/fwd/constant.hpp>
+#include <boost/hana/fwd/pair.hpp>
 #include <boost/hana/lazy.hpp>
 #include <boost/hana/logical.hpp>
 #include <boost/hana/product.hpp>
 #include <boost/hana/searchable.hpp>
 #include <boost/hana/tuple.hpp>
 
+#include <cstddef>
 #include <type_traits>
+#include <utility>
 
 
 namespace boost { namespace hana {
@@ -64,6 +68,115 @@ namespace boost { namespace hana {
         { };
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    // utilities
+    //////////////////////////////////////////////////////////////////////////
+    namespace map_detail {
+        // The number of pairs following the first pair of a map whose key
+        // satisfies a predicate. There is no `value` when no such pair
+        // exists, so this can be used for SFINAE.
+        template <typename M, typename Pred>
+        using find_tail_size = tuple_detail::find_tail_size<
+            decltype(std::declval<M>().storage),
+            decltype(hana::compose(std::declval<Pred>(), hana::first))
+        >;
+
+        template <typename M>
+        using size = tuple_detail::size<decltype(std::declval<M>().storage)>;
+
+        // Returns the value of a pair held in a map. Unlike `hana::second`,
+        // the value of an rvalue pair is returned as an rvalue reference
+        // instead of being moved into a temporary, since it is used right
+        // away to build the result of an algorithm.
+        struct get_second {
+            template <typename F, typename S>
+            constexpr S&& operator()(_pair<F, S>&& pair) const
+            { return static_cast<_pair<F, S>&&>(pair).second; }
+
+            template <typename Pair>
+            constexpr decltype(auto) operator()(Pair&& pair) const
+            { return hana::second(static_cast<Pair&&>(pair)); }
+        };
+
+        // Creates a map holding the pairs of a map's storage, followed by a
+        // new pair. The pairs are forwarded to the new map directly, which
+        // is cheaper than `append`ing to the storage and then `unpack`ing it.
+        template <typename Pair>
+        struct append_pair {
+            Pair& pair;
+
+            template <typename ...Pairs>
+            constexpr auto operator()(Pairs&& ...pairs) const {
+                return _map<typename std::decay<Pairs>::type...,
+                            typename std::decay<Pair>::type>{
+                    static_cast<Pairs&&>(pairs)..., static_cast<Pair&&>(pair)
+                };
+            }
+        };
+
+        // Creates a map holding all the pairs of a map's storage, except for
+        // the pair at index `n`.
+        template <std::size_t n, typename Storage, std::size_t ...before, std::size_t ...after>
+        constexpr auto erase_at(Storage&& storage, std::index_sequence<before...>,
+                                                   std::index_sequence<after...>)
+        {
+            return _map<
+                typename std::decay<decltype(hana::at_c<before>(storage))>::type...,
+                typename std::decay<decltype(hana::at_c<n + 1 + after>(storage))>::type...
+            >{
+                hana::at_c<before>(static_cast<Storage&&>(storage))...,
+                hana::at_c<n + 1 + after>(static_cast<Storage&&>(storage))...
+            };
+        }
+
+        // The concept checks of `make<Map>` for a single pair. They are
+        // computed once per type of pair, and then shared by all the maps
+        // containing such a pair. The key is only checked when the pair is
+        // a Product, and its comparison only when the key is Comparable, so
+        // that a failed check does not cause a cascade of other errors.
+        template <typename Pair,
+                  typename Key = decltype(hana::first(std::declval<Pair const&>())),
+                  bool = _models<Comparable, Key>{}()>
+        struct check_key {
+            static constexpr bool is_Comparable = false;
+            static constexpr bool is_compile_time_Comparable = true;
+        };
+
+        template <typename Pair, typename Key>
+        struct check_key<Pair, Key, true> {
+            static constexpr bool is_Comparable = true;
+            static constexpr bool is_compile_time_Comparable = _models<Constant,
+                decltype(hana::equal(std::declval<Key>(), std::declval<Key>()))
+            >{}();
+        };
+
+        template <typename Pair, bool = _models<Product, Pair>{}()>
+        struct check_pair {
+            static constexpr bool is_Product = false;
+            static constexpr bool is_Comparable = true;
+            static constexpr bool is_compile_time_Comparable = true;
+        };
+
+        template <typename Pair>
+        struct check_pair<Pair, true> : check_key<Pair> {
+            static constexpr bool is_Product = true;
+        };
+
+        // The concept checks of `make<Map>` for all the pairs, which are
+        // combined with `fast_and` instead of building arrays of booleans.
+        template <typename ...Pairs>
+        struct check_pairs {
+            static constexpr bool are_Products =
+                detail::fast_and<check_pair<Pairs>::is_Product...>::value;
+
+            static constexpr bool are_Comparable =
+                detail::fast_and<check_pair<Pairs>::is_Comparable...>::value;
+
+            static constexpr bool are_compile_time_Comparable =
+                detail::fast_and<check_pair<Pairs>::is_compile_time_Comparable...>::value;
+        };
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // make<Map>
     //////////////////////////////////////////////////////////////////////////
@@ -72,25 +185,17 @@ namespace boost { namespace hana {
         template <typename ...Pairs>
         static constexpr auto apply(Pairs&& ...pairs) {
         #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-            constexpr bool are_pairs[] = {true, _models<Product, Pairs>{}()...};
+            using Check = map_detail::check_pairs<
+                typename std::decay<Pairs>::type...
+            >;
 
-            static_assert(hana::all(are_pairs),
+            static_assert(Check::are_Products,
             "hana::make<Map>(pairs...) requires all the 'pairs' to be Products");
 
-            constexpr bool are_Comparable[] = {true,
-                _models<Comparable, decltype(hana::first(pairs))>{}()...
-            };
-
-            static_assert(hana::all(are_Comparable),
+            static_assert(Check::are_Comparable,
             "hana::make<Map>(pairs...) requires all the keys to be Comparable");
 
-            constexpr bool are_compile_time_Comparable[] = {true,
-                _models<Constant, decltype(
-                    hana::equal(hana::first(pairs), hana::first(pairs))
-                )>{}()...
-            };
-
-            static_assert(hana::all(are_compile_time_Comparable),
+            static_assert(Check::are_compile_time_Comparable,
             "hana::make<Map>(pairs...) requires all the keys to be "
             "Comparable at compile-time");
         #endif
@@ -118,7 +223,8 @@ namespace boost { namespace hana {
     //! @cond
     template <typename Map>
     constexpr decltype(auto) _values::operator()(Map&& map) const {
-        return hana::transform(static_cast<Map&&>(map).storage, second);
+        return hana::transform(static_cast<Map&&>(map).storage,
+                               map_detail::get_second{});
     }
     //! @endcond
 
@@ -135,11 +241,8 @@ namespace boost { namespace hana {
         template <typename M, typename P>
         static constexpr decltype(auto)
         insert_helper(M&& map, P&& pair, decltype(false_)) {
-            return hana::unpack(
-                hana::append(static_cast<M&&>(map).storage,
-                             static_cast<P&&>(pair)),
-                hana::make<Map>
-            );
+            return hana::unpack(static_cast<M&&>(map).storage,
+                                map_detail::append_pair<P>{pair});
         }
 
         template <typename M, typename P>
@@ -158,24 +261,54 @@ namespace boost { namespace hana {
     //////////////////////////////////////////////////////////////////////////
     template <>
     struct erase_key_impl<Map> {
-        template <typename M, typename Key>
-        static constexpr decltype(auto) apply(M&& map, Key&& key) {
-            return hana::unpack(
-                hana::remove_if(
-                    static_cast<M&&>(map).storage,
-                    hana::compose(
-                        hana::equal.to(static_cast<Key&&>(key)),
-                        hana::first
-                    )
-                ),
-                make<Map>
-            );
+        template <typename M, typename Key, std::size_t tail_size =
+            map_detail::find_tail_size<M, decltype(hana::equal.to(std::declval<Key>()))>::value
+        >
+        static constexpr auto erase_helper(M&& map, Key const&, int) {
+            constexpr std::size_t n = map_detail::size<M>::value - tail_size - 1;
+            return map_detail::erase_at<n>(static_cast<M&&>(map).storage,
+                std::make_index_sequence<n>{},
+                std::make_index_sequence<tail_size>{});
         }
+
+        template <typename M, typename Key>
+        static constexpr typename std::decay<M>::type
+        erase_helper(M&& map, Key const&, long)
+        { return static_cast<M&&>(map); }
+
+        template <typename M, typename Key>
+        static constexpr decltype(auto) apply(M&& map, Key const& key)
+        { return erase_helper(static_cast<M&&>(map), key, int{}); }
     };
 
     //////////////////////////////////////////////////////////////////////////
     // Comparable
     //////////////////////////////////////////////////////////////////////////
+    namespace map_detail {
+        // Whether a pair is also in another map. The map is held by reference
+        // and the values are compared in place, so comparing maps does not
+        // copy them.
+        template <typename M>
+        struct is_in {
+            M const& map;
+
+            template <typename Pair>
+            constexpr auto operator()(Pair const& pair) const {
+                return compare(pair, hana::contains(map, hana::first(pair)));
+            }
+
+            template <typename Pair>
+            constexpr auto compare(Pair const& pair, decltype(true_)) const {
+                return hana::equal(hana::second(pair),
+                                   hana::at_key(map, hana::first(pair)));
+            }
+
+            template <typename Pair>
+            constexpr auto compare(Pair const&, decltype(false_)) const
+            { return false_; }
+        };
+    }
+
     template <>
     struct equal_impl<Map, Map> {
         template <typename M1, typename M2>
@@ -185,10 +318,7 @@ namespace boost { namespace hana {
 
         template <typename M1, typename M2>
         static constexpr auto equal_helper(M1 const& m1, M2 const& m2, decltype(true_)) {
-            return hana::all_of(hana::keys(m1), hana::demux(equal)(
-                hana::partial(find, m1),
-                hana::partial(find, m2)
-            ));
+            return hana::all_of(m1.storage, map_detail::is_in<M2>{m2});
         }
 
         template <typename M1, typename M2>
@@ -205,21 +335,48 @@ namespace boost { namespace hana {
     //////////////////////////////////////////////////////////////////////////
     template <>
     struct find_if_impl<Map> {
+        template <typename M, typename Pred, std::size_t tail_size =
+            map_detail::find_tail_size<M, Pred>::value
+        >
+        static constexpr auto find_helper(M&& map, int) {
+            constexpr std::size_t n = map_detail::size<M>::value - tail_size - 1;
+            return hana::just(map_detail::get_second{}(
+                hana::at_c<n>(static_cast<M&&>(map).storage)
+            ));
+        }
+
         template <typename M, typename Pred>
-        static constexpr auto apply(M&& map, Pred&& pred) {
-            return hana::transform(
-                hana::find_if(static_cast<M&&>(map).storage,
-                    hana::compose(static_cast<Pred&&>(pred), first)),
-                second
-            );
+        static constexpr auto find_helper(M&&, long)
+        { return nothing; }
+
+        // Only the value which is found is copied or moved into the result.
+        template <typename M, typename Pred>
+        static constexpr auto apply(M&& map, Pred&&)
+        { return find_helper<M, Pred>(static_cast<M&&>(map), int{}); }
+    };
+
+    // Unlike the default implementation through `find`, this returns a
+    // reference to the value instead of a copy.
+    template <>
+    struct at_key_impl<Map> {
+        template <typename M, typename Key>
+        static constexpr decltype(auto) apply(M&& map, Key const&) {
+            constexpr std::size_t n = map_detail::size<M>::value - 1 -
+                map_detail::find_tail_size<M,
+                    decltype(hana::equal.to(std::declval<Key const&>()))
+                >::value;
+            return map_detail::get_second{}(
+                hana::at_c<n>(static_cast<M&&>(map).storage));
         }
     };
 
     template <>
     struct any_of_impl<Map> {
         template <typename M, typename Pred>
-        static constexpr auto apply(M map, Pred pred)
-        { return hana::any_of(hana::keys(map), pred); }
+        static constexpr auto apply(M const& map, Pred&& pred) {
+            return hana::any_of(map.storage,
+                hana::compose(static_cast<Pred&&>(pred), first));
+        }
     };
 
     //////////////////////////////////////////////////////////////////////////
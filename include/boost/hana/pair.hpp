@@ -70,18 +70,37 @@ namespace boost { namespace hana {
         }
     };
 
+    // The elements of lvalue pairs are returned by reference, so they are
+    // not copied. The elements of rvalue pairs are moved into the result,
+    // which may then safely outlive the pair.
     template <>
     struct first_impl<Pair> {
-        template <typename P>
-        static constexpr decltype(auto) apply(P&& p)
-        { return static_cast<P&&>(p).first; }
+        template <typename F, typename S>
+        static constexpr F& apply(_pair<F, S>& p)
+        { return p.first; }
+
+        template <typename F, typename S>
+        static constexpr F const& apply(_pair<F, S> const& p)
+        { return p.first; }
+
+        template <typename F, typename S>
+        static constexpr F apply(_pair<F, S>&& p)
+        { return static_cast<_pair<F, S>&&>(p).first; }
     };
 
     template <>
     struct second_impl<Pair> {
-        template <typename P>
-        static constexpr decltype(auto) apply(P&& p)
-        { return static_cast<P&&>(p).second; }
+        template <typename F, typename S>
+        static constexpr S& apply(_pair<F, S>& p)
+        { return p.second; }
+
+        template <typename F, typename S>
+        static constexpr S const& apply(_pair<F, S> const& p)
+        { return p.second; }
+
+        template <typename F, typename S>
+        static constexpr S apply(_pair<F, S>&& p)
+        { return static_cast<_pair<F, S>&&>(p).second; }
     };
 }} // end namespace boost::hana
 
@@ -0,0 +1,290 @@
+/*!
+@file
+Defines `boost::hana::parallel_for_each` and `boost::hana::parallel_transform`.
+
+This header is not included by `boost/hana.hpp` because it requires linking
+with the platform's threading library.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_PARALLEL_HPP
+#define BOOST_HANA_PARALLEL_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/datatype.hpp>
+#include <boost/hana/core/models.hpp>
+#include <boost/hana/detail/closure.hpp>
+#include <boost/hana/detail/thread_pool.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cstddef>
+#include <exception>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+
+namespace boost { namespace hana {
+    namespace parallel_detail {
+        template <std::size_t i, typename Xi>
+        constexpr Xi forward_at(detail::element<i, Xi>& x)
+        { return static_cast<Xi>(x.get); }
+
+        // Storage for the result of a single call to the function given to
+        // `parallel_transform`. The result is constructed in place by the
+        // thread executing the call, and destroyed with the storage.
+        template <typename T>
+        struct result_slot {
+            typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+            bool constructed = false;
+
+            result_slot() = default;
+            result_slot(result_slot const&) = delete;
+
+            template <typename X>
+            void construct(X&& x) {
+                ::new (static_cast<void*>(&storage)) T(static_cast<X&&>(x));
+                constructed = true;
+            }
+
+            T&& release()
+            { return static_cast<T&&>(*reinterpret_cast<T*>(&storage)); }
+
+            ~result_slot() {
+                if (constructed)
+                    reinterpret_cast<T*>(&storage)->~T();
+            }
+        };
+
+        // A chunk of `grain` consecutive elements is the unit of work handed
+        // to the thread pool; `Job` provides a table with one function per
+        // element, so running element `i` is a single indirect call. When
+        // there is a single chunk, the pool runs it on the calling thread.
+        template <typename Job>
+        struct chunked {
+            Job* job;
+            void (* const* table)(Job&);
+            std::size_t size;
+            std::size_t grain;
+
+            static void run(void* self_, std::size_t chunk) {
+                chunked& self = *static_cast<chunked*>(self_);
+                std::size_t first = chunk * self.grain;
+                std::size_t last = first + self.grain < self.size
+                                        ? first + self.grain : self.size;
+                std::exception_ptr error;
+                for (std::size_t i = first; i < last; ++i) {
+                    try {
+                        self.table[i](*self.job);
+                    } catch (...) {
+                        if (!error)
+                            error = std::current_exception();
+                    }
+                }
+                if (error)
+                    std::rethrow_exception(error);
+            }
+
+            void operator()() {
+                std::size_t chunks = (size + grain - 1) / grain;
+                detail::thread_pool::instance().run(chunks, &run, this);
+            }
+        };
+
+        template <typename F, typename ...X>
+        struct for_each_job {
+            F& f;
+            detail::closure<X&&...> xs;
+
+            template <std::size_t i>
+            static void call(for_each_job& self)
+            { self.f(parallel_detail::forward_at<i>(self.xs)); }
+
+            template <std::size_t ...i>
+            void run(std::size_t grain, std::index_sequence<i...>) {
+                using Call = void(*)(for_each_job&);
+                Call const table[] = {&call<i>..., nullptr};
+                chunked<for_each_job>{this, table, sizeof...(X), grain}();
+            }
+        };
+
+        template <typename F>
+        struct for_each_unpacked {
+            F& f;
+            std::size_t grain;
+
+            template <typename ...X>
+            void operator()(X&& ...x) const {
+                for_each_job<F, X...> job{f, {static_cast<X&&>(x)...}};
+                job.run(grain, std::make_index_sequence<sizeof...(X)>{});
+            }
+        };
+
+        template <typename F, typename ...X>
+        struct transform_job {
+            F& f;
+            detail::closure<X&&...> xs;
+            detail::closure<result_slot<
+                typename std::decay<decltype(std::declval<F&>()(std::declval<X>()))>::type
+            >...> results;
+
+            template <std::size_t i>
+            static void call(transform_job& self) {
+                detail::get<i>(self.results).construct(
+                    self.f(parallel_detail::forward_at<i>(self.xs))
+                );
+            }
+
+            template <std::size_t ...i>
+            auto run(std::size_t grain, std::index_sequence<i...>) {
+                using Call = void(*)(transform_job&);
+                Call const table[] = {&call<i>..., nullptr};
+                chunked<transform_job>{this, table, sizeof...(X), grain}();
+                return hana::make<Tuple>(detail::get<i>(results).release()...);
+            }
+        };
+
+        template <typename F>
+        struct transform_unpacked {
+            F& f;
+            std::size_t grain;
+
+            template <typename ...X>
+            auto operator()(X&& ...x) const {
+                transform_job<F, X...> job{f, {static_cast<X&&>(x)...}, {}};
+                return job.run(grain, std::make_index_sequence<sizeof...(X)>{});
+            }
+        };
+    }
+
+    //! @ingroup group-concurrency
+    //! Apply a function to each element of a structure, concurrently.
+    //!
+    //! Given a `Foldable` structure containing `x1, ..., xn` and a function
+    //! `f`, `parallel_for_each(xs, f)` calls `f(x1), ..., f(xn)` on a shared
+    //! pool of threads and returns once all the calls are done. Unlike
+    //! `for_each`, the order in which `f` is called on the elements is
+    //! unspecified and several calls may happen at the same time, so the
+    //! calls must be independent from each other. The thread calling
+    //! `parallel_for_each` takes part in the work, and idle threads steal
+    //! work from busy ones. If any call to `f` throws an exception, the
+    //! first exception is rethrown once all the other calls have completed.
+    //!
+    //! An optional `grain` specifies the number of consecutive elements
+    //! making up a single unit of work. Elements in the same unit of work
+    //! are processed sequentially by a single thread, which avoids paying
+    //! for synchronization when `f` is cheap for each element. When the
+    //! whole structure fits in a single unit of work, everything runs
+    //! inline on the calling thread. The default grain is 1.
+    //!
+    //! @note
+    //! This function is not included by `boost/hana.hpp`; it must be
+    //! included with `boost/hana/parallel.hpp`, and the program must be
+    //! linked with the platform's threading library.
+    //!
+    //!
+    //! @param xs
+    //! The structure whose elements are passed to `f`. The elements are
+    //! passed to `f` without being copied.
+    //!
+    //! @param f
+    //! A function called as `f(x)` for each element `x` of the structure.
+    //!
+    //! @param grain
+    //! The number of consecutive elements handled by a single thread at once.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/parallel.cpp parallel_for_each
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    auto parallel_for_each = [](auto&& xs, auto&& f, std::size_t grain = 1) -> void {
+        concurrently call f on each element;
+    };
+#else
+    struct _parallel_for_each {
+        template <typename Xs, typename F>
+        void operator()(Xs&& xs, F&& f, std::size_t grain = 1) const {
+            using S = typename datatype<Xs>::type;
+
+        #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+            static_assert(_models<Foldable, S>{},
+            "hana::parallel_for_each(xs, f) requires xs to be Foldable");
+        #endif
+
+            hana::unpack(static_cast<Xs&&>(xs),
+                parallel_detail::for_each_unpacked<F>{f, grain ? grain : 1});
+        }
+    };
+
+    constexpr _parallel_for_each parallel_for_each{};
+#endif
+
+    //! @ingroup group-concurrency
+    //! Apply a function to each element of a structure concurrently, and
+    //! return a `Tuple` of the results.
+    //!
+    //! Given a `Foldable` structure containing `x1, ..., xn` and a function
+    //! `f`, `parallel_transform(xs, f)` computes `f(x1), ..., f(xn)` on a
+    //! shared pool of threads and returns `make<Tuple>(f(x1), ..., f(xn))`,
+    //! with the results in the same order as the elements of the structure.
+    //! The calls to `f` happen in an unspecified order and possibly at the
+    //! same time, exactly as for `parallel_for_each`. The results are
+    //! constructed in place by the thread computing them, and then moved
+    //! into the returned tuple; they don't need to be default-constructible.
+    //! If any call to `f` throws an exception, the first exception is
+    //! rethrown once all the other calls have completed, and the results
+    //! computed so far are destroyed.
+    //!
+    //! The optional `grain` has the same meaning as for `parallel_for_each`.
+    //!
+    //! @note
+    //! This function is not included by `boost/hana.hpp`; it must be
+    //! included with `boost/hana/parallel.hpp`, and the program must be
+    //! linked with the platform's threading library.
+    //!
+    //!
+    //! @param xs
+    //! The structure whose elements are passed to `f`. The elements are
+    //! passed to `f` without being copied.
+    //!
+    //! @param f
+    //! A function called as `f(x)` for each element `x` of the structure,
+    //! and returning a non-`void` result.
+    //!
+    //! @param grain
+    //! The number of consecutive elements handled by a single thread at once.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/parallel.cpp parallel_transform
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    auto parallel_transform = [](auto&& xs, auto&& f, std::size_t grain = 1) {
+        return make<Tuple>(concurrently call f on each element);
+    };
+#else
+    struct _parallel_transform {
+        template <typename Xs, typename F>
+        auto operator()(Xs&& xs, F&& f, std::size_t grain = 1) const {
+            using S = typename datatype<Xs>::type;
+
+        #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+            static_assert(_models<Foldable, S>{},
+            "hana::parallel_transform(xs, f) requires xs to be Foldable");
+        #endif
+
+            return hana::unpack(static_cast<Xs&&>(xs),
+                parallel_detail::transform_unpacked<F>{f, grain ? grain : 1});
+        }
+    };
+
+    constexpr _parallel_transform parallel_transform{};
+#endif
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_PARALLEL_HPP
@@ -0,0 +1,252 @@
+/*!
+@file
+Defines `boost::hana::diff` and `boost::hana::apply_patch`.
+
+This header is not included by `boost/hana.hpp`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_PATCH_HPP
+#define BOOST_HANA_PATCH_HPP
+
+#include <boost/hana/binary.hpp>
+#include <boost/hana/comparable.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/models.hpp>
+#include <boost/hana/iterable.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/struct.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+
+namespace boost { namespace hana {
+    namespace patch_detail {
+        // Compares runs of adjacent raw members with a single `memcmp`.
+        // Since the members of `a` and `b` are at the same offsets, the
+        // checks for adjacency are folded away by the compiler. Only when
+        // a run differs are its members compared one by one, to find which
+        // ones changed.
+        struct comparer {
+            unsigned char* mask;
+            std::size_t const* sizes;
+            char const* a;
+            char const* b;
+            std::size_t size;
+            std::size_t first;
+
+            void add(std::size_t i, void const* pa, void const* pb) {
+                char const* const ca = static_cast<char const*>(pa);
+                char const* const cb = static_cast<char const*>(pb);
+                if (ca != a + size || cb != b + size) {
+                    this->flush(i);
+                    a = ca;
+                    b = cb;
+                    first = i;
+                }
+                size += sizes[i];
+            }
+
+            // Flushes the run made of the members in `[first, last)`.
+            void flush(std::size_t last) {
+                if (size != 0 && std::memcmp(a, b, size) != 0) {
+                    std::size_t offset = 0;
+                    for (std::size_t i = first; i != last; offset += sizes[i++]) {
+                        if (std::memcmp(a + offset, b + offset, sizes[i]) != 0)
+                            mask[i / 8] |= static_cast<unsigned char>(1u << (i % 8));
+                    }
+                }
+                size = 0;
+            }
+        };
+
+        template <typename S, typename Indices = std::make_index_sequence<
+            decltype(hana::length(hana::accessors<S>()))::value
+        >>
+        struct struct_patch;
+
+        template <typename S, std::size_t ...k>
+        struct struct_patch<S, std::index_sequence<k...>> {
+            using codec = binary_detail::struct_codec<S>;
+
+            template <std::size_t i>
+            using member_t = typename codec::template member_t<i>;
+
+            // Whether a member can be compared as part of a run of bytes.
+            template <std::size_t i>
+            using is_raw = std::integral_constant<bool,
+                binary_detail::is_raw<member_t<i>>{} &&
+                std::is_lvalue_reference<
+                    decltype(codec::template member<i>(std::declval<S const&>()))
+                >{}
+            >;
+
+            static constexpr std::size_t members = sizeof...(k);
+            static constexpr std::size_t mask_size = (members + 7) / 8;
+            static constexpr std::size_t sizes[members + 1] = {
+                (is_raw<k>{} ? sizeof(member_t<k>) : 0)..., 0
+            };
+
+            template <std::size_t i>
+            static void compare(S const& a, S const& b, comparer& c, std::true_type)
+            { c.add(i, &codec::template member<i>(a), &codec::template member<i>(b)); }
+
+            template <std::size_t i>
+            static void compare(S const& a, S const& b, comparer& c, std::false_type) {
+                c.flush(i);
+                if (!hana::equal(codec::template member<i>(a), codec::template member<i>(b)))
+                    c.mask[i / 8] |= static_cast<unsigned char>(1u << (i % 8));
+            }
+
+            static void compare(S const& a, S const& b, unsigned char* mask) {
+                comparer c{mask, sizes, nullptr, nullptr, 0, 0};
+                using Swallow = int[];
+                (void)Swallow{0, ((void)compare<k>(a, b, c, is_raw<k>{}), 0)...};
+                c.flush(members);
+            }
+
+            static bool changed(unsigned char const* mask, std::size_t i)
+            { return (mask[i / 8] >> (i % 8)) & 1u; }
+
+            template <typename W>
+            static void write(S const& b, unsigned char const* mask, W& w) {
+                using Swallow = int[];
+                (void)Swallow{0, ((void)(changed(mask, k) &&
+                    (codec::template write_member<k>(b, w, std::is_lvalue_reference<
+                        decltype(codec::template member<k>(b))
+                    >{}), true)
+                ), 0)...};
+            }
+
+            static bool read(S& x, unsigned char const* mask, binary_detail::reader& r) {
+                bool ok = true;
+                using Swallow = int[];
+                (void)Swallow{0, ((void)(ok = ok && (!changed(mask, k) ||
+                    binary_detail::codec<member_t<k>>::read(
+                        codec::template member<k>(x), r)
+                )), 0)...};
+                return ok;
+            }
+        };
+
+        template <typename S, std::size_t ...k>
+        constexpr std::size_t
+        struct_patch<S, std::index_sequence<k...>>::sizes[
+            struct_patch<S, std::index_sequence<k...>>::members + 1
+        ];
+    }
+
+    //! @ingroup group-datatypes
+    //! Writes the difference between two objects of a `Struct` as a patch.
+    //!
+    //! Given two objects `a` and `b` of the same `Struct` and an output
+    //! iterator `out` accepting `char`s, `diff(a, b, out)` writes a patch
+    //! which turns `a` into `b` when given to `apply_patch`, and returns the
+    //! output iterator past it. The patch starts with a bitmask holding one
+    //! bit per member, in the order of `accessors`, which is set when the
+    //! member changed. It is followed by the binary representation of the
+    //! changed members of `b`, as written by `to_binary`. Hence, a patch for
+    //! a `Struct` with `n` members where nothing changed is `(n + 7) / 8`
+    //! bytes long.
+    //!
+    //! Members written as is by `to_binary`, like numbers, enumerations and
+    //! `std::array`s of those, are compared by their object representation.
+    //! Runs of such members which are adjacent in memory are compared with
+    //! a single `memcmp`, and only the members of runs that differ are
+    //! compared one by one. Other members are compared with `equal`.
+    //!
+    //! @note
+    //! This function is not included by `boost/hana.hpp`; it must be
+    //! included with `boost/hana/patch.hpp`. Since numbers are compared
+    //! bitwise, `0.0` and `-0.0` are different, while a `NaN` is not
+    //! different from the same `NaN`.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/patch.cpp diff
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto diff = [](auto const& a, auto const& b, auto out) {
+        return output iterator past the patch turning a into b;
+    };
+#else
+    struct _diff {
+        template <typename S, typename Out>
+        Out operator()(S const& a, S const& b, Out out) const {
+        #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+            static_assert(_models<Struct, S>{},
+            "hana::diff(a, b, out) requires a and b to be Structs");
+        #endif
+
+            using Patch = patch_detail::struct_patch<S>;
+            unsigned char mask[Patch::mask_size + 1] = {};
+            Patch::compare(a, b, mask);
+
+            binary_detail::writer<Out> w{static_cast<Out&&>(out), nullptr, 0};
+            w.write(reinterpret_cast<char const*>(mask), Patch::mask_size);
+            Patch::write(b, mask, w);
+            w.flush();
+            return static_cast<Out&&>(w.out);
+        }
+    };
+
+    constexpr _diff diff{};
+#endif
+
+    //! @ingroup group-datatypes
+    //! Applies a patch written by `diff` to an object.
+    //!
+    //! Given a buffer `[first, last)` starting with a patch written by
+    //! `diff(a, b, out)` and an object `x` of the same `Struct` as `a` and
+    //! `b`, `apply_patch(first, last, x)` assigns the members of `b` which
+    //! are different from those of `a` to the members of `x`, and returns a
+    //! pointer past the patch. If the patch is invalid, a null pointer is
+    //! returned instead, and `x` may have been modified. Nothing is read
+    //! past `last`.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/patch.cpp diff
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto apply_patch = [](char const* first, char const* last, auto& x) {
+        return pointer past the patch, or nullptr;
+    };
+#else
+    struct _apply_patch {
+        template <typename S>
+        char const* operator()(char const* first, char const* last, S& x) const {
+        #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+            static_assert(_models<Struct, S>{},
+            "hana::apply_patch(first, last, x) requires x to be a Struct");
+        #endif
+
+            using Patch = patch_detail::struct_patch<S>;
+            if (static_cast<std::size_t>(last - first) < Patch::mask_size)
+                return nullptr;
+            unsigned char mask[Patch::mask_size + 1] = {};
+            std::memcpy(mask, first, Patch::mask_size);
+
+            // The bits past the last member must not be set.
+            if (Patch::members % 8 != 0 &&
+                (mask[Patch::mask_size - 1] >> (Patch::members % 8)) != 0)
+                return nullptr;
+
+            binary_detail::reader r{first + Patch::mask_size, last, nullptr, 0};
+            if (!Patch::read(x, mask, r) || !r.flush())
+                return nullptr;
+            return r.first;
+        }
+    };
+
+    constexpr _apply_patch apply_patch{};
+#endif
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_PATCH_HPP
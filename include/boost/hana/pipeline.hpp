@@ -0,0 +1,264 @@
+/*!
+@file
+Defines `boost::hana::pipeline`.
+
+This header is not included by `boost/hana.hpp` because it requires linking
+with the platform's threading library.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_PIPELINE_HPP
+#define BOOST_HANA_PIPELINE_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/closure.hpp>
+#include <boost/hana/detail/spsc_queue.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace boost { namespace hana {
+    namespace pipeline_detail {
+        template <typename ...T>
+        struct types { };
+
+        // Computes the types of the elements flowing into each stage; the
+        // input of the first stage is `T`, and the input of each other stage
+        // is the (decayed) result of the previous stage.
+        template <typename Inputs, typename T, typename ...F>
+        struct stage_inputs;
+
+        template <typename ...Inputs, typename T>
+        struct stage_inputs<types<Inputs...>, T> {
+            using type = types<Inputs...>;
+        };
+
+        template <typename ...Inputs, typename T, typename F, typename ...Fs>
+        struct stage_inputs<types<Inputs...>, T, F, Fs...>
+            : stage_inputs<
+                types<Inputs..., T>,
+                typename std::decay<
+                    decltype(std::declval<F&>()(std::declval<T>()))
+                >::type,
+                Fs...
+            >
+        { };
+
+        template <std::size_t i, typename T>
+        struct queue_at {
+            detail::spsc_queue<T> queue;
+
+            queue_at(std::size_t capacity, std::size_t batch)
+                : queue{capacity, batch}
+            { }
+        };
+
+        template <std::size_t i, typename T>
+        detail::spsc_queue<T>& get_queue(queue_at<i, T>& q)
+        { return q.queue; }
+
+        template <typename Indices, typename Inputs>
+        struct queues;
+
+        template <std::size_t ...i, typename ...T>
+        struct queues<std::index_sequence<i...>, types<T...>>
+            : queue_at<i, T>...
+        {
+            queues(std::size_t capacity, std::size_t batch)
+                : queue_at<i, T>{capacity, batch}...
+            { }
+        };
+
+        // State shared by the threads running one pass of a pipeline. The
+        // i-th stage consumes from the i-th queue and produces into the
+        // i+1-th queue, except for the last stage which writes into the
+        // output iterator.
+        template <typename Stages, typename Queues, typename Output>
+        struct run {
+            Stages stages;
+            Queues queues;
+            Output out;
+            std::atomic<bool> cancelled{false};
+            std::mutex error_mutex;
+            std::exception_ptr error;
+
+            run(Stages const& s, std::size_t capacity, std::size_t batch, Output o)
+                : stages(s), queues{capacity, batch}, out(o)
+            { }
+
+            void fail() {
+                {
+                    std::lock_guard<std::mutex> lock{error_mutex};
+                    if (!error)
+                        error = std::current_exception();
+                }
+                cancelled.store(true);
+            }
+
+            template <std::size_t i>
+            void stage(std::false_type /* last */) {
+                auto& in = pipeline_detail::get_queue<i>(queues);
+                auto& next = pipeline_detail::get_queue<i + 1>(queues);
+                try {
+                    while (in.wait(cancelled, [&] { next.flush(); })) {
+                        if (!next.push(detail::get<i>(stages)(std::move(in.front())),
+                                       cancelled))
+                            break;
+                        in.pop();
+                    }
+                } catch (...) {
+                    fail();
+                }
+                next.close();
+            }
+
+            template <std::size_t i>
+            void stage(std::true_type /* last */) {
+                auto& in = pipeline_detail::get_queue<i>(queues);
+                try {
+                    while (in.wait(cancelled, [] { })) {
+                        *out = detail::get<i>(stages)(std::move(in.front()));
+                        ++out;
+                        in.pop();
+                    }
+                } catch (...) {
+                    fail();
+                }
+            }
+
+            template <std::size_t i, std::size_t n>
+            static void start(run& self)
+            { self.stage<i>(std::integral_constant<bool, i + 1 == n>{}); }
+
+            template <typename Input, std::size_t ...i>
+            Output operator()(Input first, Input last, std::index_sequence<i...>) {
+                constexpr std::size_t n = sizeof...(i);
+                using Start = void (*)(run&);
+                Start const starts[] = {&start<i, n>...};
+
+                std::vector<std::thread> threads;
+                auto& source = pipeline_detail::get_queue<0>(queues);
+                try {
+                    threads.reserve(n);
+                    for (Start start : starts)
+                        threads.emplace_back(start, std::ref(*this));
+
+                    for (; first != last; ++first)
+                        if (!source.push(*first, cancelled))
+                            break;
+                } catch (...) {
+                    fail();
+                }
+                source.close();
+
+                for (std::thread& thread : threads)
+                    thread.join();
+
+                if (error)
+                    std::rethrow_exception(error);
+                return out;
+            }
+        };
+    }
+
+    template <typename ...F>
+    struct _pipeline {
+        detail::closure<F...> stages;
+        std::size_t capacity;
+        std::size_t batch;
+
+        template <typename Input, typename Output>
+        Output operator()(Input first, Input last, Output out) const {
+            using T = typename std::decay<decltype(*first)>::type;
+            using Inputs = typename pipeline_detail::stage_inputs<
+                pipeline_detail::types<>, T, F...
+            >::type;
+            using Queues = pipeline_detail::queues<
+                std::make_index_sequence<sizeof...(F)>, Inputs
+            >;
+
+            pipeline_detail::run<detail::closure<F...>, Queues, Output>
+                state{stages, capacity, batch, out};
+            return state(first, last, std::make_index_sequence<sizeof...(F)>{});
+        }
+
+        _pipeline with_buffer(std::size_t capacity_, std::size_t batch_) const
+        { return {stages, capacity_, batch_}; }
+    };
+
+    //! @ingroup group-concurrency
+    //! Run a sequence of functions as the stages of a concurrent pipeline.
+    //!
+    //! `pipeline(f1, ..., fn)` is the streaming equivalent of
+    //! `compose(fn, ..., f1)`. It returns a function object `p` such that
+    //! `p(first, last, out)` computes `fn(...f2(f1(x))...)` for each `x` in
+    //! the range `[first, last)` and writes the results, in order, to the
+    //! output iterator `out`. It returns the output iterator past the last
+    //! element written.
+    //!
+    //! However, each stage runs on its own thread, so the stages process
+    //! different elements at the same time. Consecutive stages are connected
+    //! by bounded lock-free queues with a single producer and a single
+    //! consumer. The type of the elements in each queue is deduced at
+    //! compile-time from the return type of the stage feeding it, so
+    //! elements are never type-erased or allocated individually. The
+    //! calling thread reads the input range and feeds the first stage,
+    //! and the last stage writes to the output iterator.
+    //!
+    //! When a queue is full, the stage feeding it waits for the next stage
+    //! to make room, so a slow stage throttles the stages before it instead
+    //! of making the queues grow. To reduce the synchronization between the
+    //! threads, elements are made visible to the next stage in batches,
+    //! or as soon as the producing stage runs out of work. The capacity of
+    //! the queues and the size of the batches can be set with
+    //! `p.with_buffer(capacity, batch)`, which returns a new pipeline with
+    //! the same stages; they default to 1024 and 32, respectively.
+    //!
+    //! If a stage throws an exception, the whole pipeline is stopped and the
+    //! first exception is rethrown from `p(first, last, out)` once all the
+    //! threads have finished. Elements that were not processed yet are
+    //! destroyed.
+    //!
+    //! @note
+    //! This function is not included by `boost/hana.hpp`; it must be
+    //! included with `boost/hana/pipeline.hpp`, and the program must be
+    //! linked with the platform's threading library. Each stage is called
+    //! from a single thread, but each pass through the pipeline works on
+    //! its own copy of the stages.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/pipeline.cpp pipeline
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto pipeline = [](auto&& f1, ..., auto&& fn) {
+        return [perfect-capture](auto first, auto last, auto out) {
+            return concurrently for each x in [first, last): *out++ = fn(...f1(x));
+        };
+    };
+#else
+    struct _make_pipeline {
+        template <typename ...F>
+        constexpr _pipeline<typename std::decay<F>::type...>
+        operator()(F&& ...f) const {
+            static_assert(sizeof...(F) > 0,
+            "hana::pipeline(f...) requires at least one stage");
+            return {{static_cast<F&&>(f)...}, 1024, 32};
+        }
+    };
+
+    constexpr _make_pipeline pipeline{};
+#endif
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_PIPELINE_HPP
@@ -20,6 +20,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/core/models.hpp>
 #include <boost/hana/core/when.hpp>
 #include <boost/hana/detail/by.hpp> // needed by xxx.by
+#include <boost/hana/detail/fast_and.hpp>
 #include <boost/hana/detail/insert_fwd.hpp>
 #include <boost/hana/detail/variadic/foldr1.hpp>
 #include <boost/hana/foldable.hpp>
@@ -965,10 +966,9 @@ namespace boost { namespace hana {
     constexpr decltype(auto)
     _zip_shortest_with::operator()(F&& f, Xs&& xs, Ys&& ...ys) const {
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        constexpr bool models_of_Sequence[] = {
-            _models<Sequence, Xs>{}, _models<Sequence, Ys>{}...
-        };
-        static_assert(hana::all(models_of_Sequence),
+        static_assert(detail::fast_and<
+            _models<Sequence, Xs>{}(), _models<Sequence, Ys>{}()...
+        >::value,
         "hana::zip.shortest.with(f, xs, ys...) requires xs and ys... to be Sequences");
     #endif
 
@@ -1004,10 +1004,9 @@ namespace boost { namespace hana {
                              operator()(Xs&& xs, Ys&& ...ys) const
     {
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        constexpr bool models_of_Sequence[] = {
-            _models<Sequence, Xs>{}, _models<Sequence, Ys>{}...
-        };
-        static_assert(hana::all(models_of_Sequence),
+        static_assert(detail::fast_and<
+            _models<Sequence, Xs>{}(), _models<Sequence, Ys>{}()...
+        >::value,
         "hana::zip.shortest(xs, ys...) requires xs and ys... to be Sequences");
     #endif
 
@@ -1037,10 +1036,9 @@ namespace boost { namespace hana {
     constexpr decltype(auto)
     _zip_unsafe_with::operator()(F&& f, Xs&& xs, Ys&& ...ys) const {
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        constexpr bool models_of_Sequence[] = {
-            _models<Sequence, Xs>{}, _models<Sequence, Ys>{}...
-        };
-        static_assert(hana::all(models_of_Sequence),
+        static_assert(detail::fast_and<
+            _models<Sequence, Xs>{}(), _models<Sequence, Ys>{}()...
+        >::value,
         "hana::zip.unsafe.with(f, xs, ys...) requires xs and ys... to be Sequences");
     #endif
 
@@ -1093,10 +1091,9 @@ namespace boost { namespace hana {
                              operator()(Xs&& xs, Ys&& ...ys) const
     {
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        constexpr bool models_of_Sequence[] = {
-            _models<Sequence, Xs>{}, _models<Sequence, Ys>{}...
-        };
-        static_assert(hana::all(models_of_Sequence),
+        static_assert(detail::fast_and<
+            _models<Sequence, Xs>{}(), _models<Sequence, Ys>{}()...
+        >::value,
         "hana::zip.unsafe(xs, ys...) requires xs and ys... to be Sequences");
     #endif
 
@@ -19,6 +19,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/core/operators.hpp>
 #include <boost/hana/core/when.hpp>
 #include <boost/hana/detail/erase_key_fwd.hpp>
+#include <boost/hana/detail/fast_and.hpp>
 #include <boost/hana/detail/insert_fwd.hpp>
 #include <boost/hana/foldable.hpp>
 #include <boost/hana/functional/flip.hpp>
@@ -29,7 +30,9 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/searchable.hpp>
 #include <boost/hana/tuple.hpp>
 
+#include <cstddef>
 #include <type_traits>
+#include <utility>
 
 
 namespace boost { namespace hana {
@@ -59,6 +62,96 @@ namespace boost { namespace hana {
         { };
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    // utilities
+    //////////////////////////////////////////////////////////////////////////
+    namespace set_detail {
+        // The number of elements following the element of a set which is
+        // equal to `X`. There is no `value` when no such element exists, so
+        // this can be used for SFINAE. Since the elements of a set are
+        // Comparable at compile-time, this is computed without comparing
+        // any element at runtime.
+        template <typename S, typename X>
+        using find_tail_size = tuple_detail::find_tail_size<
+            decltype(std::declval<S>().storage),
+            decltype(hana::equal.to(std::declval<X const&>()))
+        >;
+
+        template <typename S>
+        using size = tuple_detail::size<decltype(std::declval<S>().storage)>;
+
+        // Creates a set holding the elements of a set's storage, followed by
+        // a new element, which is not already in the set.
+        template <typename X>
+        struct append_element {
+            X& x;
+
+            template <typename ...Xs>
+            constexpr auto operator()(Xs&& ...xs) const {
+                return _set<typename std::decay<Xs>::type...,
+                            typename std::decay<X>::type>{
+                    static_cast<Xs&&>(xs)..., static_cast<X&&>(x)
+                };
+            }
+        };
+
+        // Creates a set holding all the elements of a set's storage, except
+        // for the element at index `n`.
+        template <std::size_t n, typename Storage, std::size_t ...before, std::size_t ...after>
+        constexpr auto erase_at(Storage&& storage, std::index_sequence<before...>,
+                                                   std::index_sequence<after...>)
+        {
+            return _set<
+                typename std::decay<decltype(hana::at_c<before>(storage))>::type...,
+                typename std::decay<decltype(hana::at_c<n + 1 + after>(storage))>::type...
+            >{
+                hana::at_c<before>(static_cast<Storage&&>(storage))...,
+                hana::at_c<n + 1 + after>(static_cast<Storage&&>(storage))...
+            };
+        }
+
+        // Whether an element is also in another set, which is held by
+        // reference so that comparing sets does not copy them.
+        template <typename S>
+        struct is_in {
+            S const& set;
+
+            template <typename X>
+            constexpr auto operator()(X const& x) const
+            { return hana::contains(set, x); }
+        };
+
+        // The concept checks of `make<Set>` for a single element. They are
+        // computed once per type of element, and then shared by all the sets
+        // containing such an element. The comparison of the element is only
+        // checked when it is Comparable, so that a failed check does not
+        // cause a cascade of other errors.
+        template <typename X, bool = _models<Comparable, X>{}()>
+        struct check_element {
+            static constexpr bool is_Comparable = false;
+            static constexpr bool is_compile_time_Comparable = true;
+        };
+
+        template <typename X>
+        struct check_element<X, true> {
+            static constexpr bool is_Comparable = true;
+            static constexpr bool is_compile_time_Comparable = _models<Constant,
+                decltype(hana::equal(std::declval<X const&>(), std::declval<X const&>()))
+            >{}();
+        };
+
+        // The concept checks of `make<Set>` for all the elements, which are
+        // combined with `fast_and` instead of building arrays of booleans.
+        template <typename ...Xs>
+        struct check_elements {
+            static constexpr bool are_Comparable =
+                detail::fast_and<check_element<Xs>::is_Comparable...>::value;
+
+            static constexpr bool are_compile_time_Comparable =
+                detail::fast_and<check_element<Xs>::is_compile_time_Comparable...>::value;
+        };
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // make<Set>
     //////////////////////////////////////////////////////////////////////////
@@ -67,18 +160,14 @@ namespace boost { namespace hana {
         template <typename ...Xs>
         static constexpr auto apply(Xs&& ...xs) {
         #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-            constexpr bool are_Comparable[] = {true,
-                _models<Comparable, Xs>{}()...
-            };
+            using Check = set_detail::check_elements<
+                typename std::decay<Xs>::type...
+            >;
 
-            static_assert(hana::all(are_Comparable),
+            static_assert(Check::are_Comparable,
             "hana::make<Set>(xs...) requires all the 'xs' to be Comparable");
 
-            constexpr bool are_compile_time_Comparable[] = {true,
-                _models<Constant, decltype(hana::equal(xs, xs))>{}()...
-            };
-
-            static_assert(hana::all(are_compile_time_Comparable),
+            static_assert(Check::are_compile_time_Comparable,
             "hana::make<Set>(xs...) requires all the 'xs' to be "
             "Comparable at compile-time");
         #endif
@@ -95,10 +184,10 @@ namespace boost { namespace hana {
     template <>
     struct equal_impl<Set, Set> {
         template <typename S1, typename S2>
-        static constexpr decltype(auto) apply(S1&& s1, S2&& s2) {
+        static constexpr auto apply(S1 const& s1, S2 const& s2) {
             return hana::and_(
                 hana::equal(hana::length(s1.storage), hana::length(s2.storage)),
-                hana::is_subset(static_cast<S1&&>(s1), static_cast<S2&&>(s2))
+                hana::all_of(s1.storage, set_detail::is_in<S2>{s2})
             );
         }
     };
@@ -127,6 +216,43 @@ namespace boost { namespace hana {
         }
     };
 
+    template <>
+    struct find_impl<Set> {
+        template <typename S, typename X, std::size_t tail_size =
+            set_detail::find_tail_size<S, X>::value
+        >
+        static constexpr auto find_helper(S&& set, int) {
+            constexpr std::size_t n = set_detail::size<S>::value - tail_size - 1;
+            return hana::just(hana::at_c<n>(static_cast<S&&>(set).storage));
+        }
+
+        template <typename S, typename X>
+        static constexpr auto find_helper(S&&, long)
+        { return nothing; }
+
+        // The key is only looked at through its type, so it is never copied.
+        template <typename S, typename X>
+        static constexpr auto apply(S&& set, X const&)
+        { return find_helper<S, X>(static_cast<S&&>(set), int{}); }
+    };
+
+    template <>
+    struct contains_impl<Set> {
+        template <typename S, typename X, std::size_t =
+            set_detail::find_tail_size<S, X>::value
+        >
+        static constexpr auto contains_helper(int)
+        { return true_; }
+
+        template <typename S, typename X>
+        static constexpr auto contains_helper(long)
+        { return false_; }
+
+        template <typename S, typename X>
+        static constexpr auto apply(S const&, X const&)
+        { return contains_helper<S const&, X>(int{}); }
+    };
+
     template <>
     struct any_of_impl<Set> {
         template <typename Set, typename Pred>
@@ -154,23 +280,22 @@ namespace boost { namespace hana {
     //////////////////////////////////////////////////////////////////////////
     template <>
     struct insert_impl<Set> {
-        struct insert_helper {
-            template <typename S, typename X>
-            constexpr decltype(auto) operator()(S&& s, X&& x) const {
-                return hana::unpack(
-                    hana::append(static_cast<S&&>(s).storage,
-                                 static_cast<X&&>(x)),
-                    hana::make<Set>
-                );
-            }
-        };
+        template <typename S, typename X>
+        static constexpr typename std::decay<S>::type
+        insert_helper(S&& set, X&&, decltype(true_))
+        { return static_cast<S&&>(set); }
+
+        template <typename S, typename X>
+        static constexpr decltype(auto)
+        insert_helper(S&& set, X&& x, decltype(false_)) {
+            return hana::unpack(static_cast<S&&>(set).storage,
+                                set_detail::append_element<X>{x});
+        }
 
         template <typename S, typename X>
         static constexpr decltype(auto) apply(S&& set, X&& x) {
-            return hana::eval_if(hana::contains(set, x),
-                hana::lazy(set),
-                hana::lazy(insert_helper{})(set, x)
-            );
+            return insert_helper(static_cast<S&&>(set), static_cast<X&&>(x),
+                                 hana::contains(set, x));
         }
     };
 
@@ -179,14 +304,23 @@ namespace boost { namespace hana {
     //////////////////////////////////////////////////////////////////////////
     template <>
     struct erase_key_impl<Set> {
-        template <typename S, typename X>
-        static constexpr decltype(auto) apply(S&& set, X&& x) {
-            return hana::unpack(
-                hana::remove(static_cast<S&&>(set).storage,
-                             static_cast<X&&>(x)),
-                make<Set>
-            );
+        template <typename S, typename X, std::size_t tail_size =
+            set_detail::find_tail_size<S, X>::value
+        >
+        static constexpr auto erase_helper(S&& set, int) {
+            constexpr std::size_t n = set_detail::size<S>::value - tail_size - 1;
+            return set_detail::erase_at<n>(static_cast<S&&>(set).storage,
+                std::make_index_sequence<n>{},
+                std::make_index_sequence<tail_size>{});
         }
+
+        template <typename S, typename X>
+        static constexpr typename std::decay<S>::type erase_helper(S&& set, long)
+        { return static_cast<S&&>(set); }
+
+        template <typename S, typename X>
+        static constexpr decltype(auto) apply(S&& set, X const&)
+        { return erase_helper<S, X>(static_cast<S&&>(set), int{}); }
     };
 }} // end namespace boost::hana
 
@@ -0,0 +1,422 @@
+/*!
+@file
+Defines `boost::hana::soa_vector`.
+
+This header is not included by `boost/hana.hpp`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_SOA_VECTOR_HPP
+#define BOOST_HANA_SOA_VECTOR_HPP
+
+#include <boost/hana/comparable.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/models.hpp>
+#include <boost/hana/detail/constexpr/algorithm.hpp>
+#include <boost/hana/detail/constexpr/array.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/iterable.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/struct.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace boost { namespace hana {
+    namespace soa_detail {
+        // A view of the contiguous elements of a column. Unlike the vector
+        // holding the column, it can't be used to change the number of
+        // elements, which must stay the same in all the columns.
+        template <typename T>
+        struct span {
+            T* data_;
+            std::size_t size_;
+
+            using value_type = typename std::remove_const<T>::type;
+            using iterator = T*;
+
+            T* data() const { return data_; }
+            std::size_t size() const { return size_; }
+            bool empty() const { return size_ == 0; }
+            T* begin() const { return data_; }
+            T* end() const { return data_ + size_; }
+            T& operator[](std::size_t n) const { return data_[n]; }
+        };
+
+        // The column of the `bool` members. `std::vector<bool>` is packed,
+        // so its elements are not contiguous `bool`s and it has no `data()`.
+        // Instead, this holds the `bool`s in a buffer of its own, with the
+        // part of the interface of `std::vector` used by `soa_vector`.
+        class bool_vector {
+            std::unique_ptr<bool[]> data_;
+            std::size_t size_ = 0;
+            std::size_t capacity_ = 0;
+
+        public:
+            using value_type = bool;
+            using iterator = bool*;
+            using const_iterator = bool const*;
+
+            bool_vector() = default;
+            bool_vector(bool_vector&&) = default;
+            bool_vector& operator=(bool_vector&&) = default;
+
+            bool_vector(bool_vector const& other)
+                : data_{other.size_ ? new bool[other.size_] : nullptr},
+                  size_{other.size_}, capacity_{other.size_}
+            { std::copy(other.begin(), other.end(), data_.get()); }
+
+            bool_vector& operator=(bool_vector const& other) {
+                if (this != &other) {
+                    bool_vector copy{other};
+                    *this = static_cast<bool_vector&&>(copy);
+                }
+                return *this;
+            }
+
+            bool* data() { return data_.get(); }
+            bool const* data() const { return data_.get(); }
+            std::size_t size() const { return size_; }
+            bool* begin() { return data_.get(); }
+            bool const* begin() const { return data_.get(); }
+            bool* end() { return data_.get() + size_; }
+            bool const* end() const { return data_.get() + size_; }
+            bool& operator[](std::size_t n) { return data_[n]; }
+            bool const& operator[](std::size_t n) const { return data_[n]; }
+
+            void reserve(std::size_t n) {
+                if (n <= capacity_)
+                    return;
+                std::unique_ptr<bool[]> data{new bool[n]};
+                std::copy(this->begin(), this->end(), data.get());
+                data_ = static_cast<std::unique_ptr<bool[]>&&>(data);
+                capacity_ = n;
+            }
+
+            void resize(std::size_t n) {
+                if (n > capacity_)
+                    this->reserve(std::max(n, 2 * capacity_));
+                if (n > size_)
+                    std::fill(this->end(), data_.get() + n, false);
+                size_ = n;
+            }
+
+            void push_back(bool b) {
+                if (size_ == capacity_)
+                    this->reserve(capacity_ ? 2 * capacity_ : 8);
+                data_[size_++] = b;
+            }
+
+            bool* erase(bool* first, bool* last) {
+                std::copy(last, this->end(), first);
+                size_ -= static_cast<std::size_t>(last - first);
+                return first;
+            }
+        };
+
+        template <typename T>
+        struct column_of { using type = std::vector<T>; };
+
+        template <>
+        struct column_of<bool> { using type = bool_vector; };
+
+        // Computes the type of the tuple of vectors holding the columns.
+        template <typename S>
+        struct make_columns {
+            template <typename ...Accessor>
+            auto operator()(Accessor&& ...accessor) const -> _tuple<
+                typename column_of<typename std::decay<
+                    decltype(hana::second(accessor)(std::declval<S&>()))
+                >::type>::type...
+            >;
+        };
+
+        template <typename S>
+        using columns = decltype(
+            hana::unpack(hana::accessors<S>(), make_columns<S>{})
+        );
+
+        // Computes the index of the member with the given key, or the
+        // number of members if there is no such member.
+        template <typename Key, typename ...Accessor>
+        constexpr std::size_t index_of_key() {
+            constexpr detail::constexpr_::array<bool, sizeof...(Accessor) + 1> matches{{
+                decltype(hana::equal(hana::first(std::declval<Accessor>()),
+                                     std::declval<Key>()))::value...,
+                true
+            }};
+            return static_cast<std::size_t>(
+                detail::constexpr_::find(matches.begin(), matches.end(), true)
+                    - matches.begin()
+            );
+        }
+
+        template <typename Key>
+        struct find_key {
+            template <typename ...Accessor>
+            auto operator()(Accessor&& ...) const -> std::integral_constant<
+                std::size_t, index_of_key<Key, Accessor...>()
+            >;
+        };
+
+        // The accessor of the `i`th member of a `reference`.
+        template <std::size_t i>
+        struct column_accessor {
+            template <typename Reference>
+            constexpr decltype(auto) operator()(Reference&& r) const
+            { return hana::at_c<i>(*r.columns_)[r.index_]; }
+        };
+
+        // Implements the operations on all the columns at once, along with
+        // the accessors of `reference`.
+        template <typename S, typename Indices = std::make_index_sequence<
+            decltype(hana::length(hana::accessors<S>()))::value
+        >>
+        struct layout;
+
+        template <typename S, std::size_t ...i>
+        struct layout<S, std::index_sequence<i...>> {
+            static constexpr auto apply() {
+                return hana::make_tuple(hana::make_pair(
+                    hana::first(hana::at_c<i>(hana::accessors<S>())),
+                    column_accessor<i>{}
+                )...);
+            }
+
+            template <typename Columns, typename Object>
+            static void assign(Columns& columns, std::size_t index, Object&& object) {
+                using swallow = int[];
+                (void)swallow{0, ((void)(
+                    hana::at_c<i>(columns)[index] =
+                        hana::second(hana::at_c<i>(hana::accessors<S>()))(
+                            static_cast<Object&&>(object))
+                ), 0)...};
+            }
+
+            template <typename Columns, typename Object>
+            static void push_back(Columns& columns, Object&& object) {
+                using swallow = int[];
+                (void)swallow{0, ((void)
+                    hana::at_c<i>(columns).push_back(
+                        hana::second(hana::at_c<i>(hana::accessors<S>()))(
+                            static_cast<Object&&>(object)))
+                , 0)...};
+            }
+
+            template <typename Columns, typename F>
+            static void for_each_column(Columns& columns, F&& f) {
+                using swallow = int[];
+                (void)swallow{0, ((void)f(
+                    hana::first(hana::at_c<i>(hana::accessors<S>())),
+                    span<typename std::remove_reference<
+                        decltype(hana::at_c<i>(columns)[0])
+                    >::type>{hana::at_c<i>(columns).data(),
+                             hana::at_c<i>(columns).size()}
+                ), 0)...};
+            }
+
+            template <typename Columns>
+            static void reserve(Columns& columns, std::size_t n) {
+                using swallow = int[];
+                (void)swallow{0, ((void)hana::at_c<i>(columns).reserve(n), 0)...};
+            }
+
+            template <typename Columns>
+            static void resize(Columns& columns, std::size_t n) {
+                using swallow = int[];
+                (void)swallow{0, ((void)hana::at_c<i>(columns).resize(n), 0)...};
+            }
+
+            template <typename Columns>
+            static void shrink(Columns& columns, std::size_t n) {
+                using swallow = int[];
+                (void)swallow{0, ((void)hana::at_c<i>(columns).erase(
+                    hana::at_c<i>(columns).begin() + n,
+                    hana::at_c<i>(columns).end()
+                ), 0)...};
+            }
+        };
+
+        // Removes the elements past `size` from the columns when destroyed,
+        // unless it is dismissed. This restores the columns to a consistent
+        // state when copying a member throws in the middle of a `push_back`.
+        template <typename S, typename Columns>
+        struct rollback {
+            Columns& columns;
+            std::size_t size;
+            bool dismissed;
+
+            ~rollback() {
+                if (!dismissed)
+                    layout<S>::shrink(columns, size);
+            }
+        };
+
+        // The proxy returned by `soa_vector::operator[]`. It is a `Struct`
+        // with the same keys as `S`, whose accessors return references to
+        // the elements of the columns.
+        template <typename S, typename Columns>
+        struct reference {
+            Columns* columns_;
+            std::size_t index_;
+
+            reference const& operator=(S const& object) const {
+                layout<S>::assign(*columns_, index_, object);
+                return *this;
+            }
+
+            reference const& operator=(S&& object) const {
+                layout<S>::assign(*columns_, index_,
+                                               static_cast<S&&>(object));
+                return *this;
+            }
+        };
+    }
+
+    template <typename S, typename Columns>
+    struct accessors_impl<soa_detail::reference<S, Columns>>
+        : soa_detail::layout<S>
+    { };
+
+    //! @ingroup group-datatypes
+    //! A sequence of `Struct`s stored as a structure of arrays.
+    //!
+    //! `soa_vector<S>` holds a sequence of objects of the `Struct` `S`, like
+    //! a `std::vector<S>` would. However, instead of storing the objects one
+    //! after the other, it stores the members of the objects in separate
+    //! columns. Each column is a `std::vector` holding the values of the
+    //! same member for all the objects, contiguously. The columns of `bool`
+    //! members are not `std::vector<bool>`s, whose elements are packed bits,
+    //! but buffers of plain `bool`s. The columns are generated at
+    //! compile-time from the `accessors` of `S`, which can be defined with
+    //! `BOOST_HANA_DEFINE_STRUCT`, `BOOST_HANA_ADAPT_STRUCT` or manually.
+    //!
+    //! This layout is more efficient when only a few members of many objects
+    //! are accessed, since the other members are not loaded from memory at
+    //! all. In particular, scanning a single column only reads the memory
+    //! holding that column, which can be much less than the memory holding
+    //! the objects when they have many members.
+    //!
+    //! `v[i]` returns a proxy to the `i`th object, which is itself a `Struct`
+    //! with the same keys as `S`. Its members are references to elements of
+    //! the columns, so it can be used with `at_key`, `for_each` and the other
+    //! algorithms on `Struct`s, and it can be assigned an object of type `S`.
+    //! `v.column(key)` returns a view of the contiguous elements of the
+    //! column of the member with the given key, and `v.for_each_column(f)`
+    //! calls `f(key, column)` for each member, in the order of `accessors`.
+    //!
+    //! @note
+    //! This container is not included by `boost/hana.hpp`; it must be
+    //! included with `boost/hana/soa_vector.hpp`. The objects are not
+    //! stored anywhere, so there is no way to get a reference or a pointer
+    //! to an object of type `S` from the container.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/soa_vector.cpp soa_vector
+    template <typename S>
+    struct soa_vector {
+    #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+        static_assert(_models<Struct, S>{},
+        "hana::soa_vector<S> requires S to be a Struct");
+    #endif
+
+    private:
+        static constexpr std::size_t member_count =
+            decltype(hana::length(hana::accessors<S>()))::value;
+        static_assert(member_count > 0,
+        "hana::soa_vector<S> requires S to have at least one member");
+
+        using columns_type = soa_detail::columns<S>;
+        using algorithms = soa_detail::layout<S>;
+        columns_type columns_;
+
+        template <typename Key>
+        using index_of = decltype(hana::unpack(hana::accessors<S>(),
+                                               soa_detail::find_key<Key>{}));
+
+    public:
+        using value_type = S;
+        using size_type = std::size_t;
+        using reference = soa_detail::reference<S, columns_type>;
+        using const_reference = soa_detail::reference<S, columns_type const>;
+
+        std::size_t size() const
+        { return hana::at_c<0>(columns_).size(); }
+
+        bool empty() const
+        { return this->size() == 0; }
+
+        void reserve(std::size_t n)
+        { algorithms::reserve(columns_, n); }
+
+        void resize(std::size_t n)
+        { algorithms::resize(columns_, n); }
+
+        void clear()
+        { algorithms::shrink(columns_, 0); }
+
+        void push_back(S const& object) {
+            soa_detail::rollback<S, columns_type> guard{columns_, this->size(), false};
+            algorithms::push_back(columns_, object);
+            guard.dismissed = true;
+        }
+
+        void push_back(S&& object) {
+            soa_detail::rollback<S, columns_type> guard{columns_, this->size(), false};
+            algorithms::push_back(columns_, static_cast<S&&>(object));
+            guard.dismissed = true;
+        }
+
+        void pop_back()
+        { algorithms::shrink(columns_, this->size() - 1); }
+
+        reference operator[](std::size_t n)
+        { return reference{&columns_, n}; }
+
+        const_reference operator[](std::size_t n) const
+        { return const_reference{&columns_, n}; }
+
+        template <typename Key>
+        auto column(Key const&) {
+            static_assert(index_of<Key>::value != member_count,
+            "hana::soa_vector<S>::column(key) requires key to be the key "
+            "of a member of S");
+            auto& c = hana::at_c<index_of<Key>::value>(columns_);
+            return soa_detail::span<typename std::decay<decltype(c[0])>::type>{
+                c.data(), c.size()
+            };
+        }
+
+        template <typename Key>
+        auto column(Key const&) const {
+            static_assert(index_of<Key>::value != member_count,
+            "hana::soa_vector<S>::column(key) requires key to be the key "
+            "of a member of S");
+            auto& c = hana::at_c<index_of<Key>::value>(columns_);
+            return soa_detail::span<typename std::decay<decltype(c[0])>::type const>{
+                c.data(), c.size()
+            };
+        }
+
+        template <typename F>
+        void for_each_column(F&& f)
+        { algorithms::for_each_column(columns_, f); }
+
+        template <typename F>
+        void for_each_column(F&& f) const
+        { algorithms::for_each_column(columns_, f); }
+    };
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_SOA_VECTOR_HPP
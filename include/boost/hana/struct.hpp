@@ -21,10 +21,13 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/detail/struct_macros.hpp>
 #include <boost/hana/foldable.hpp>
 #include <boost/hana/functional/compose.hpp>
-#include <boost/hana/functional/partial.hpp>
 #include <boost/hana/functor.hpp>
+#include <boost/hana/optional.hpp>
 #include <boost/hana/pair.hpp>
 #include <boost/hana/searchable.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <type_traits>
 
 
 namespace boost { namespace hana {
@@ -68,6 +71,46 @@ namespace boost { namespace hana {
         }
     };
 
+    //////////////////////////////////////////////////////////////////////////
+    // members_ref
+    //////////////////////////////////////////////////////////////////////////
+    namespace struct_detail {
+        // The type used to hold a member returned by an accessor. Members
+        // of lvalues are referred to, and members of rvalues are moved.
+        template <typename Member>
+        using member_holder = typename std::conditional<
+            std::is_lvalue_reference<Member>{}, Member,
+            typename std::decay<Member>::type
+        >::type;
+
+        template <typename Object>
+        struct members_ref_helper {
+            Object& object;
+
+            template <typename ...Accessor>
+            constexpr auto operator()(Accessor&& ...accessor) const {
+                return _tuple<member_holder<decltype(
+                    hana::second(accessor)(static_cast<Object&&>(object))
+                )>...>{hana::second(accessor)(static_cast<Object&&>(object))...};
+            }
+        };
+    }
+
+    //! @cond
+    template <typename Object>
+    constexpr auto _members_ref::operator()(Object&& object) const {
+        using S = typename datatype<Object>::type;
+
+    #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+        static_assert(_models<Struct, S>{},
+        "hana::members_ref(object) requires object to be a Struct");
+    #endif
+
+        return hana::unpack(hana::accessors<S>(),
+            struct_detail::members_ref_helper<Object>{object});
+    }
+    //! @endcond
+
     //////////////////////////////////////////////////////////////////////////
     // keys
     //////////////////////////////////////////////////////////////////////////
@@ -108,9 +151,15 @@ namespace boost { namespace hana {
     // Model of Comparable
     //////////////////////////////////////////////////////////////////////////
     namespace struct_detail {
+        // The objects are held by reference so comparing two Structs does
+        // not copy them.
+        template <typename X, typename Y>
         struct compare_members_of {
-            template <typename X, typename Y, typename Member>
-            constexpr decltype(auto) operator()(X&& x, Y&& y, Member&& member) const {
+            X& x;
+            Y& y;
+
+            template <typename Member>
+            constexpr decltype(auto) operator()(Member&& member) const {
                 auto accessor = hana::second(static_cast<Member&&>(member));
                 return hana::equal(accessor(static_cast<X&&>(x)),
                                    accessor(static_cast<Y&&>(y)));
@@ -123,9 +172,7 @@ namespace boost { namespace hana {
         template <typename X, typename Y>
         static constexpr decltype(auto) apply(X&& x, Y&& y) {
             return hana::all_of(hana::accessors<S>(),
-                hana::partial(struct_detail::compare_members_of{},
-                              static_cast<X&&>(x),
-                              static_cast<Y&&>(y)));
+                struct_detail::compare_members_of<X, Y>{x, y});
         }
     };
 
@@ -135,12 +182,20 @@ namespace boost { namespace hana {
     namespace struct_detail {
         // This is equivalent to `demux`, except that `demux` can't forward
         // the `udt` because it does not know the `g`s are accessors. Hence,
-        // this can result in faster code.
+        // this can result in faster code. Unlike `partial`, the `udt` is
+        // held by reference and the members of an lvalue `udt` are passed
+        // by reference, so folding a Struct never copies them.
+        template <typename F, typename Udt>
         struct almost_demux {
-            template <typename F, typename Udt, typename ...Members>
-            constexpr decltype(auto)
-            operator()(F&& f, Udt&& udt, Members&& ...g) const {
-                return static_cast<F&&>(f)(hana::make_pair(
+            F& f;
+            Udt& udt;
+
+            template <typename ...Members>
+            constexpr decltype(auto) operator()(Members&& ...g) const {
+                return static_cast<F&&>(f)(_pair<
+                    typename std::decay<decltype(hana::first(g))>::type,
+                    member_holder<decltype(hana::second(g)(static_cast<Udt&&>(udt)))>
+                >(
                     hana::first(static_cast<Members&&>(g)),
                     hana::second(static_cast<Members&&>(g))
                                                 (static_cast<Udt&&>(udt))
@@ -154,9 +209,7 @@ namespace boost { namespace hana {
         template <typename Udt, typename F>
         static constexpr decltype(auto) apply(Udt&& udt, F&& f) {
             return hana::unpack(hana::accessors<S>(),
-                hana::partial(struct_detail::almost_demux{},
-                              static_cast<F&&>(f),
-                              static_cast<Udt&&>(udt)));
+                struct_detail::almost_demux<F, Udt>{f, udt});
         }
     };
 
@@ -164,9 +217,11 @@ namespace boost { namespace hana {
     // Model of Searchable
     //////////////////////////////////////////////////////////////////////////
     namespace struct_detail {
+        // The object is held by reference, so only the member which is
+        // found is copied or moved out of it.
         template <typename X>
         struct get_member {
-            X x;
+            X&& x;
             template <typename Member>
             constexpr decltype(auto) operator()(Member&& member) && {
                 return hana::second(static_cast<Member&&>(member))(
@@ -189,6 +244,21 @@ namespace boost { namespace hana {
         }
     };
 
+    // Unlike the default implementation through `find`, this returns a
+    // reference to the member instead of a copy.
+    template <typename S>
+    struct at_key_impl<S, when<_models<Struct, S>{}()>> {
+        template <typename X, typename Key>
+        static constexpr decltype(auto) apply(X&& x, Key&& key) {
+            auto accessor = hana::second(hana::from_just(
+                hana::find_if(hana::accessors<S>(),
+                    hana::compose(hana::equal.to(static_cast<Key&&>(key)),
+                                  hana::first))
+            ));
+            return accessor(static_cast<X&&>(x));
+        }
+    };
+
     template <typename S>
     struct any_of_impl<S, when<_models<Struct, S>{}()>> {
         template <typename X, typename Pred>
@@ -1079,6 +1079,40 @@ namespace boost { namespace hana {
         }
     };
 
+    template <>
+    struct insert_impl<Tuple> {
+        using Size = std::size_t;
+
+        template <typename Xs, typename X, Size ...before, Size ...after>
+        static constexpr decltype(auto)
+        insert_helper(Xs&& xs, X&& x, std::index_sequence<before...>,
+                                      std::index_sequence<after...>)
+        {
+            return hana::make<Tuple>(
+                detail::get<before>(
+                    static_cast<Xs&&>(xs)
+                )...,
+                static_cast<X&&>(x),
+                detail::get<sizeof...(before) + after>(
+                    static_cast<Xs&&>(xs)
+                )...
+            );
+        }
+
+        template <typename Xs, typename N, typename X>
+        static constexpr decltype(auto) apply(Xs&& xs, N const&, X&& x) {
+            constexpr Size index = hana::value<N>();
+            constexpr Size size = tuple_detail::size<Xs>{}();
+            static_assert(index <= size,
+            "hana::insert(xs, n, x) requires n to be at most length(xs)");
+            // Clamped so that an invalid index only triggers the assertion.
+            constexpr Size before = index <= size ? index : size;
+            return insert_helper(static_cast<Xs&&>(xs), static_cast<X&&>(x),
+                          std::make_index_sequence<before>{},
+                          std::make_index_sequence<size - before>{});
+        }
+    };
+
     template <>
     struct partition_impl<Tuple> {
         template <int which, typename Pred, typename ...Xs>
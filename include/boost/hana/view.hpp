@@ -0,0 +1,356 @@
+/*!
+@file
+Defines `boost::hana::View`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_VIEW_HPP
+#define BOOST_HANA_VIEW_HPP
+
+#include <boost/hana/fwd/view.hpp>
+
+#include <boost/hana/bool.hpp>
+#include <boost/hana/comparable.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/constant.hpp>
+#include <boost/hana/core/datatype.hpp>
+#include <boost/hana/core/models.hpp>
+#include <boost/hana/core/operators.hpp>
+#include <boost/hana/detail/constexpr/algorithm.hpp>
+#include <boost/hana/detail/constexpr/array.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/iterable.hpp>
+#include <boost/hana/searchable.hpp>
+#include <boost/hana/sequence.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+
+namespace boost { namespace hana {
+    //////////////////////////////////////////////////////////////////////////
+    // _view
+    //////////////////////////////////////////////////////////////////////////
+    template <typename Xs, std::size_t ...i, typename F>
+    struct _view<Xs, std::index_sequence<i...>, F>
+        : operators::adl
+        , operators::Iterable_ops<_view<Xs, std::index_sequence<i...>, F>>
+    {
+        using indices = std::index_sequence<i...>;
+
+        Xs& base;
+        F fn;
+
+        constexpr _view(Xs& b, F f)
+            : base(b), fn(static_cast<F&&>(f))
+        { }
+    };
+
+    template <typename Xs, typename Indices, typename F>
+    struct datatype<_view<Xs, Indices, F>> {
+        using type = View;
+    };
+
+    namespace view_detail {
+        struct identity {
+            template <typename X>
+            constexpr X&& operator()(X&& x) const
+            { return static_cast<X&&>(x); }
+        };
+
+        template <typename G, typename F>
+        struct composed {
+            G g;
+            F f;
+
+            template <typename X>
+            constexpr decltype(auto) operator()(X&& x) const
+            { return g(f(static_cast<X&&>(x))); }
+        };
+
+        template <typename G>
+        constexpr typename std::decay<G>::type compose(G&& g, identity)
+        { return static_cast<G&&>(g); }
+
+        template <typename G, typename F>
+        constexpr composed<typename std::decay<G>::type, F> compose(G&& g, F const& f)
+        { return {static_cast<G&&>(g), f}; }
+
+        // Elements that are returned by rvalue reference are returned by
+        // value instead, since they may refer to a temporary.
+        template <typename T>
+        struct element { using type = T; };
+
+        template <typename T>
+        struct element<T&&> { using type = T; };
+
+        template <std::size_t ...i>
+        constexpr std::size_t index_at(std::size_t n) {
+            std::size_t const indices[] = {i..., 0};
+            return indices[n];
+        }
+
+        template <std::size_t n, typename Xs, std::size_t ...i, typename F>
+        constexpr typename element<
+            decltype(std::declval<F const&>()(
+                hana::at_c<index_at<i...>(n)>(std::declval<Xs&>())
+            ))
+        >::type get(_view<Xs, std::index_sequence<i...>, F> const& v)
+        { return v.fn(hana::at_c<index_at<i...>(n)>(v.base)); }
+
+        // Returns the view made of the elements of `v` at the given
+        // positions, which is a view over the same base.
+        template <typename Xs, std::size_t ...i, typename F, std::size_t ...p>
+        constexpr _view<Xs, std::index_sequence<index_at<i...>(p)...>, F>
+        select(_view<Xs, std::index_sequence<i...>, F> const& v,
+               std::index_sequence<p...>)
+        { return {v.base, v.fn}; }
+
+        template <std::size_t from, std::size_t ...p>
+        constexpr std::index_sequence<(from + p)...>
+        offset(std::index_sequence<p...>)
+        { return {}; }
+
+        template <std::size_t n, std::size_t ...p>
+        constexpr std::index_sequence<(n - 1 - p)...>
+        reversed(std::index_sequence<p...>)
+        { return {}; }
+
+        template <bool ...keep>
+        struct kept_positions {
+            static constexpr auto apply() {
+                constexpr std::size_t N = sizeof...(keep);
+                constexpr detail::constexpr_::array<bool, N> results = {{keep...}};
+                constexpr std::size_t kept = detail::constexpr_::count(
+                    &results[0], &results[N], true);
+                detail::constexpr_::array<std::size_t, kept> positions{};
+                std::size_t* out = &positions[0];
+                for (std::size_t p = 0; p < N; ++p)
+                    if (results[p])
+                        *out++ = p;
+                return positions;
+            }
+        };
+
+        template <typename Positions, std::size_t ...j>
+        constexpr auto generate_positions(std::index_sequence<j...>) {
+            constexpr auto positions = Positions::apply();
+            (void)positions; // remove GCC warning about `positions` being unused
+            return std::index_sequence<positions[j]...>{};
+        }
+
+        template <typename Xs, typename Indices, typename F, typename G>
+        constexpr auto transform(_view<Xs, Indices, F> const& v, G&& g) {
+            auto fn = view_detail::compose(static_cast<G&&>(g), v.fn);
+            return _view<Xs, Indices, decltype(fn)>{v.base, fn};
+        }
+
+        template <typename Pred, typename Xs, typename F, std::size_t i>
+        using satisfies = decltype(std::declval<Pred&>()(
+            std::declval<F const&>()(hana::at_c<i>(std::declval<Xs&>()))
+        ));
+
+        template <typename Pred, typename Xs, std::size_t ...i, typename F>
+        constexpr auto filter(_view<Xs, std::index_sequence<i...>, F> const& v) {
+            using Positions = kept_positions<
+                static_cast<bool>(hana::value<satisfies<Pred, Xs, F, i>>())...
+            >;
+            constexpr std::size_t kept = Positions::apply().size();
+            return view_detail::select(v,
+                view_detail::generate_positions<Positions>(
+                    std::make_index_sequence<kept>{}));
+        }
+
+        // Returns the view of all the elements of `xs`, or `xs` itself if
+        // it is already a view. This is what makes chains of views flat.
+        template <typename Xs, typename Tag = typename datatype<Xs>::type>
+        struct all {
+            using Base = typename std::remove_reference<Xs>::type;
+
+            static_assert(std::is_lvalue_reference<Xs>{},
+            "hana::view functions require their argument to be an lvalue or a "
+            "View, because views refer to their base without owning it");
+
+        #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+            static_assert(_models<Iterable, Tag>{},
+            "hana::view functions require their argument to be Iterable");
+        #endif
+
+            static constexpr std::size_t n =
+                hana::value<decltype(hana::length(std::declval<Base&>()))>();
+
+            static constexpr _view<Base, std::make_index_sequence<n>, identity>
+            apply(Base& xs)
+            { return {xs, identity{}}; }
+        };
+
+        template <typename Xs>
+        struct all<Xs, View> {
+            using V = typename std::decay<Xs>::type;
+
+            static constexpr V apply(V const& v)
+            { return v; }
+        };
+    }
+
+    //! @cond
+    template <typename Xs, typename F>
+    constexpr auto view::_transform::operator()(Xs&& xs, F&& f) const {
+        return view_detail::transform(view_detail::all<Xs>::apply(xs),
+                                      static_cast<F&&>(f));
+    }
+
+    template <typename Xs, typename Pred>
+    constexpr auto view::_filter::operator()(Xs&& xs, Pred&&) const {
+        return view_detail::filter<Pred>(view_detail::all<Xs>::apply(xs));
+    }
+
+    template <typename Xs>
+    constexpr auto view::_reverse::operator()(Xs&& xs) const {
+        auto v = view_detail::all<Xs>::apply(xs);
+        constexpr std::size_t n = decltype(v)::indices::size();
+        return view_detail::select(v,
+            view_detail::reversed<n>(std::make_index_sequence<n>{}));
+    }
+
+    template <typename Xs, typename From, typename To>
+    constexpr auto view::_slice::operator()(Xs&& xs, From const&, To const&) const {
+        auto v = view_detail::all<Xs>::apply(xs);
+        constexpr std::size_t n = decltype(v)::indices::size();
+
+    #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+        static_assert(_models<Constant, From>{} && _models<Constant, To>{},
+        "hana::view::slice(xs, from, to) requires 'from' and 'to' to be Constants");
+    #endif
+
+        constexpr std::size_t from = hana::value<From>();
+        constexpr std::size_t to = hana::value<To>();
+        static_assert(from <= to && to <= n,
+        "hana::view::slice(xs, from, to) requires from <= to <= length(xs)");
+
+        return view_detail::select(v,
+            view_detail::offset<from>(std::make_index_sequence<to - from>{}));
+    }
+    //! @endcond
+
+    //////////////////////////////////////////////////////////////////////////
+    // Operators
+    //////////////////////////////////////////////////////////////////////////
+    namespace operators {
+        template <>
+        struct of<View>
+            : operators::of<Comparable, Iterable>
+        { };
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Comparable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct equal_impl<View, View>
+        : Sequence::equal_impl<View, View>
+    { };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct unpack_impl<View> {
+        template <typename Xs, std::size_t ...i, typename F, typename G>
+        static constexpr decltype(auto)
+        apply(_view<Xs, std::index_sequence<i...>, F> const& v, G&& g) {
+            return static_cast<G&&>(g)(v.fn(hana::at_c<i>(v.base))...);
+        }
+    };
+
+    template <>
+    struct length_impl<View> {
+        template <typename Xs, std::size_t ...i, typename F>
+        static constexpr auto apply(_view<Xs, std::index_sequence<i...>, F> const&)
+        { return size_t<sizeof...(i)>; }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Searchable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct find_if_impl<View>
+        : Iterable::find_if_impl<View>
+    { };
+
+    template <>
+    struct any_of_impl<View>
+        : Iterable::any_of_impl<View>
+    { };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Iterable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct head_impl<View> {
+        template <typename V>
+        static constexpr decltype(auto) apply(V const& v)
+        { return view_detail::get<0>(v); }
+    };
+
+    template <>
+    struct tail_impl<View> {
+        template <typename Xs, std::size_t i, std::size_t ...j, typename F>
+        static constexpr auto
+        apply(_view<Xs, std::index_sequence<i, j...>, F> const& v)
+        { return _view<Xs, std::index_sequence<j...>, F>{v.base, v.fn}; }
+    };
+
+    template <>
+    struct is_empty_impl<View> {
+        template <typename Xs, std::size_t ...i, typename F>
+        static constexpr auto apply(_view<Xs, std::index_sequence<i...>, F> const&)
+        { return bool_<sizeof...(i) == 0>; }
+    };
+
+    template <>
+    struct at_impl<View> {
+        template <typename V, typename N>
+        static constexpr decltype(auto) apply(V const& v, N const&) {
+            constexpr std::size_t n = hana::value<N>();
+            return view_detail::get<n>(v);
+        }
+    };
+
+    template <>
+    struct last_impl<View> {
+        template <typename V>
+        static constexpr decltype(auto) apply(V const& v)
+        { return view_detail::get<V::indices::size() - 1>(v); }
+    };
+
+    template <>
+    struct drop_at_most_impl<View> {
+        template <typename V, typename N>
+        static constexpr auto apply(V const& v, N const&) {
+            constexpr std::size_t n = hana::value<N>();
+            constexpr std::size_t size = V::indices::size();
+            constexpr std::size_t from = n < size ? n : size;
+            return view_detail::select(v,
+                view_detail::offset<from>(std::make_index_sequence<size - from>{}));
+        }
+    };
+
+    template <>
+    struct drop_exactly_impl<View> {
+        template <typename V, typename N>
+        static constexpr auto apply(V const& v, N const&) {
+            constexpr std::size_t n = hana::value<N>();
+            constexpr std::size_t size = V::indices::size();
+            return view_detail::select(v,
+                view_detail::offset<n>(std::make_index_sequence<size - n>{}));
+        }
+    };
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_VIEW_HPP
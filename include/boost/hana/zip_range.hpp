@@ -0,0 +1,297 @@
+/*!
+@file
+Defines `boost::hana::zip_range`, `boost::hana::for_each_column` and
+`boost::hana::transform_columns`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_ZIP_RANGE_HPP
+#define BOOST_HANA_ZIP_RANGE_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/datatype.hpp>
+#include <boost/hana/core/models.hpp>
+#include <boost/hana/detail/closure.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+
+namespace boost { namespace hana {
+    //////////////////////////////////////////////////////////////////////////
+    // _zip_iterator
+    //////////////////////////////////////////////////////////////////////////
+    //! @ingroup group-details
+    //! Random access iterator over the rows of a `zip_range`.
+    //!
+    //! The iterator holds a pointer to the beginning of each column and a
+    //! single index, which is the only thing modified when the iterator is
+    //! moved. Dereferencing it returns a `_tuple` of references to the
+    //! elements of the current row, so it is a proxy iterator; the tuple
+    //! must not outlive the columns.
+    template <typename ...T>
+    struct _zip_iterator {
+        using value_type = _tuple<T&...>;
+        using reference = _tuple<T&...>;
+        using pointer = void;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category = std::random_access_iterator_tag;
+
+        detail::closure<T*...> columns;
+        std::size_t index;
+
+        template <std::size_t ...k>
+        reference row(std::size_t i, std::index_sequence<k...>) const
+        { return reference{detail::get<k>(columns)[i]...}; }
+
+        reference operator*() const
+        { return row(index, std::make_index_sequence<sizeof...(T)>{}); }
+
+        reference operator[](difference_type n) const {
+            return row(index + static_cast<std::size_t>(n),
+                       std::make_index_sequence<sizeof...(T)>{});
+        }
+
+        _zip_iterator& operator++() { ++index; return *this; }
+        _zip_iterator& operator--() { --index; return *this; }
+        _zip_iterator operator++(int) { _zip_iterator it = *this; ++index; return it; }
+        _zip_iterator operator--(int) { _zip_iterator it = *this; --index; return it; }
+
+        _zip_iterator& operator+=(difference_type n)
+        { index += static_cast<std::size_t>(n); return *this; }
+
+        _zip_iterator& operator-=(difference_type n)
+        { index -= static_cast<std::size_t>(n); return *this; }
+
+        friend _zip_iterator operator+(_zip_iterator it, difference_type n)
+        { return it += n; }
+
+        friend _zip_iterator operator+(difference_type n, _zip_iterator it)
+        { return it += n; }
+
+        friend _zip_iterator operator-(_zip_iterator it, difference_type n)
+        { return it -= n; }
+
+        friend difference_type operator-(_zip_iterator const& a, _zip_iterator const& b)
+        { return static_cast<difference_type>(a.index - b.index); }
+
+        friend bool operator==(_zip_iterator const& a, _zip_iterator const& b)
+        { return a.index == b.index; }
+
+        friend bool operator!=(_zip_iterator const& a, _zip_iterator const& b)
+        { return a.index != b.index; }
+
+        friend bool operator<(_zip_iterator const& a, _zip_iterator const& b)
+        { return a.index < b.index; }
+
+        friend bool operator>(_zip_iterator const& a, _zip_iterator const& b)
+        { return a.index > b.index; }
+
+        friend bool operator<=(_zip_iterator const& a, _zip_iterator const& b)
+        { return a.index <= b.index; }
+
+        friend bool operator>=(_zip_iterator const& a, _zip_iterator const& b)
+        { return a.index >= b.index; }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // _zip_range
+    //////////////////////////////////////////////////////////////////////////
+    template <typename ...T>
+    struct _zip_range {
+        using iterator = _zip_iterator<T...>;
+        using const_iterator = iterator;
+        using value_type = typename iterator::value_type;
+        using reference = typename iterator::reference;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+
+        detail::closure<T*...> columns;
+        std::size_t rows;
+
+        iterator begin() const { return {columns, 0}; }
+        iterator end() const { return {columns, rows}; }
+        std::size_t size() const { return rows; }
+        bool empty() const { return rows == 0; }
+
+        reference operator[](std::size_t i) const
+        { return begin()[static_cast<difference_type>(i)]; }
+    };
+
+    namespace zip_range_detail {
+        template <typename Column>
+        using element_t = typename std::remove_reference<
+            decltype(*std::declval<Column&>().data())
+        >::type;
+
+        struct make {
+            template <typename ...Column>
+            _zip_range<element_t<Column>...> operator()(Column& ...column) const {
+                std::size_t const sizes[] = {column.size()..., 0};
+                std::size_t rows = sizes[0];
+                for (std::size_t k = 1; k < sizeof...(Column); ++k)
+                    if (sizes[k] < rows)
+                        rows = sizes[k];
+                return {{column.data()...}, rows};
+            }
+        };
+
+        template <typename F, typename ...T, std::size_t ...k>
+        void for_each_column(_zip_range<T...> const& z, F& f,
+                             std::index_sequence<k...>)
+        {
+            using Swallow = int[];
+            (void)Swallow{0, ((void)f(
+                detail::get<k>(z.columns),
+                detail::get<k>(z.columns) + z.rows
+            ), 0)...};
+        }
+
+        template <typename F>
+        struct transform_column {
+            F& f;
+
+            template <typename X>
+            void operator()(X* first, X* last) const {
+                for (; first != last; ++first)
+                    *first = f(static_cast<X const&>(*first));
+            }
+        };
+    }
+
+    //! @ingroup group-datatypes
+    //! Returns a random access range over the rows of several contiguous
+    //! containers used as columns.
+    //!
+    //! Given a `Foldable` structure `columns` containing contiguous
+    //! containers `c1, ..., cn` (like `std::vector`s or `std::array`s)
+    //! whose elements are of type `T1, ..., Tn`, `zip_range(columns)`
+    //! returns a range whose `i`-th element is `_tuple<T1&, ..., Tn&>`
+    //! holding references to `c1[i], ..., cn[i]`. Hence, the elements of
+    //! the columns can be read and modified through the rows, and a row
+    //! can be used like any other `Tuple`. The range has as many rows as
+    //! the shortest column. If `columns` is `const`, or if it contains
+    //! `const` containers, the references are `const` too.
+    //!
+    //! The range only holds a pointer to the data of each column, and its
+    //! iterator only holds these pointers and a single index. Hence, a loop
+    //! over the range is exactly as simple as a loop indexing every column
+    //! by hand, which lets the compiler vectorize it when possible. The
+    //! range is invalidated by any operation invalidating the pointers to
+    //! the data of one of the columns, like inserting into a `std::vector`.
+    //!
+    //! @note
+    //! This is a range in the sense of the standard library, which can be
+    //! used with a range-based for loop and the standard algorithms that
+    //! do not require their iterators to return real references; it is not
+    //! a Hana data type. To process the columns one at a time instead of
+    //! the rows, which is usually friendlier to the cache, see
+    //! `for_each_column` and `transform_columns`.
+    //!
+    //!
+    //! @param columns
+    //! A `Foldable` structure containing the columns. The columns must be
+    //! lvalues with `data()` and `size()` member functions, and they must
+    //! outlive the returned range.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/zip_range.cpp zip_range
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    auto zip_range = [](auto& columns) {
+        return random-access range over the rows of the columns;
+    };
+#else
+    struct _zip_range_make {
+        template <typename Columns>
+        auto operator()(Columns& columns) const {
+        #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+            static_assert(_models<Foldable, typename datatype<Columns>::type>{},
+            "hana::zip_range(columns) requires columns to be Foldable");
+        #endif
+
+            return hana::unpack(columns, zip_range_detail::make{});
+        }
+    };
+
+    constexpr _zip_range_make zip_range{};
+#endif
+
+    //! @ingroup group-datatypes
+    //! Calls a function on each column of a `zip_range`, one column after
+    //! the other.
+    //!
+    //! Given a `zip_range` `z` over columns of types `T1, ..., Tn` and a
+    //! function `f`, `for_each_column(z, f)` calls `f(first, last)` for
+    //! each column, in order, where `[first, last)` is the range of
+    //! pointers `Tk*` to the elements of the `k`-th column belonging to a
+    //! row of `z`. This makes it possible to apply a kernel to a whole
+    //! column at once, which is more cache-friendly than processing the
+    //! columns row by row. Since the columns have different types, `f`
+    //! is usually a generic lambda.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/zip_range.cpp for_each_column
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    auto for_each_column = [](auto const& z, auto&& f) -> void {
+        f(first1, last1); ...; f(firstn, lastn);
+    };
+#else
+    struct _for_each_column {
+        template <typename ...T, typename F>
+        void operator()(_zip_range<T...> const& z, F&& f) const {
+            zip_range_detail::for_each_column(z, f,
+                std::make_index_sequence<sizeof...(T)>{});
+        }
+    };
+
+    constexpr _for_each_column for_each_column{};
+#endif
+
+    //! @ingroup group-datatypes
+    //! Replaces each element of the columns of a `zip_range` by the result
+    //! of applying a function to it, one column after the other.
+    //!
+    //! `transform_columns(z, f)` is equivalent to applying `f` to every
+    //! element of every row of `z` and assigning the result back to the
+    //! element, but the columns are traversed one after the other instead
+    //! of row by row. Each column is processed by a simple loop over
+    //! contiguous elements of a single type, which the compiler can
+    //! vectorize. `f` must be callable with an element of each column,
+    //! and its result must be assignable to that element; `f` is called
+    //! on the elements in order, column after column. The columns must
+    //! not be `const`.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/zip_range.cpp transform_columns
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    auto transform_columns = [](auto const& z, auto&& f) -> void {
+        for each column c of z: for each element x of c: x = f(x);
+    };
+#else
+    struct _transform_columns {
+        template <typename ...T, typename F>
+        void operator()(_zip_range<T...> const& z, F&& f) const {
+            zip_range_detail::transform_column<F> kernel{f};
+            zip_range_detail::for_each_column(z, kernel,
+                std::make_index_sequence<sizeof...(T)>{});
+        }
+    };
+
+    constexpr _transform_columns transform_columns{};
+#endif
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_ZIP_RANGE_HPP
@@ -0,0 +1,336 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/binary.hpp>
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/struct.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <vector>
+using namespace boost::hana;
+
+
+template <typename X>
+std::vector<char> binary(X const& x) {
+    std::vector<char> bytes;
+    to_binary(x, std::back_inserter(bytes));
+    BOOST_HANA_RUNTIME_CHECK(bytes.size() == binary_size(x));
+    return bytes;
+}
+
+// Reads the whole buffer into x, and returns whether it succeeded.
+template <typename X>
+bool read(std::vector<char> const& bytes, X& x) {
+    char const* end = from_binary(bytes.data(), bytes.data() + bytes.size(), x);
+    return end == bytes.data() + bytes.size();
+}
+
+template <typename X>
+X round_trip(X const& x) {
+    X y{};
+    BOOST_HANA_RUNTIME_CHECK(read(binary(x), y));
+    return y;
+}
+
+// Checks that every strict prefix of the representation of x is rejected.
+template <typename X>
+bool rejects_prefixes(X const& x) {
+    std::vector<char> const bytes = binary(x);
+    for (std::size_t n = 0; n != bytes.size(); ++n) {
+        // copy the prefix so that reading past its end can be caught by tools
+        std::vector<char> prefix(bytes.begin(), bytes.begin() + n);
+        X y{};
+        if (from_binary(prefix.data(), prefix.data() + n, y) != nullptr)
+            return false;
+    }
+    return true;
+}
+
+template <typename T>
+std::vector<char> bytes_of(T const& x) {
+    std::vector<char> bytes(sizeof(T));
+    std::memcpy(bytes.data(), &x, sizeof(T));
+    return bytes;
+}
+
+namespace ns {
+    enum class Color : std::uint8_t { red, green, blue };
+
+    struct Point {
+        BOOST_HANA_DEFINE_STRUCT(Point,
+            (int, x),
+            (int, y)
+        );
+
+        friend bool operator==(Point const& a, Point const& b)
+        { return a.x == b.x && a.y == b.y; }
+    };
+
+    // Has padding between `c` and `d`.
+    struct Padded {
+        BOOST_HANA_DEFINE_STRUCT(Padded,
+            (char, c),
+            (double, d),
+            (Color, color)
+        );
+    };
+
+    struct Empty {
+        BOOST_HANA_DEFINE_STRUCT(Empty);
+    };
+
+    struct Shape {
+        BOOST_HANA_DEFINE_STRUCT(Shape,
+            (std::string, name),
+            (std::vector<Point>, points),
+            (Point, origin),
+            (bool, closed),
+            (Empty, extra),
+            (std::array<std::string, 2>, tags),
+            (std::vector<std::string>, notes)
+        );
+    };
+
+    struct Adapted {
+        std::uint16_t id;
+        std::array<float, 3> position;
+        std::vector<Padded> parts;
+    };
+
+    // Members are listed in another order than they are laid out in.
+    struct Reordered {
+        int a, b, c;
+    };
+}
+
+BOOST_HANA_ADAPT_STRUCT(ns::Adapted,
+    (std::uint16_t, id),
+    (std::array<float, 3>, position),
+    (std::vector<ns::Padded>, parts)
+);
+
+BOOST_HANA_ADAPT_STRUCT(ns::Reordered,
+    (int, c),
+    (int, a),
+    (int, b)
+);
+
+
+int main() {
+    //////////////////////////////////////////////////////////////////////////
+    // Raw members
+    //////////////////////////////////////////////////////////////////////////
+    {
+        BOOST_HANA_RUNTIME_CHECK(binary(42) == bytes_of(42));
+        BOOST_HANA_RUNTIME_CHECK(binary(2.5) == bytes_of(2.5));
+        BOOST_HANA_RUNTIME_CHECK(binary(true) == bytes_of(true));
+        BOOST_HANA_RUNTIME_CHECK(binary(ns::Color::blue) == bytes_of(ns::Color::blue));
+
+        std::array<short, 3> xs{{1, 2, 3}};
+        BOOST_HANA_RUNTIME_CHECK(binary(xs) == bytes_of(xs));
+        BOOST_HANA_RUNTIME_CHECK(round_trip(xs) == xs);
+
+        BOOST_HANA_RUNTIME_CHECK(round_trip(std::numeric_limits<std::int64_t>::min())
+                                    == std::numeric_limits<std::int64_t>::min());
+        BOOST_HANA_RUNTIME_CHECK(round_trip(-0.25f) == -0.25f);
+        BOOST_HANA_RUNTIME_CHECK(round_trip(ns::Color::green) == ns::Color::green);
+
+        BOOST_HANA_RUNTIME_CHECK(rejects_prefixes(42));
+        BOOST_HANA_RUNTIME_CHECK(rejects_prefixes(xs));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Strings, and varint lengths
+    //////////////////////////////////////////////////////////////////////////
+    {
+        BOOST_HANA_RUNTIME_CHECK(binary(std::string{}) == std::vector<char>{0});
+        BOOST_HANA_RUNTIME_CHECK(binary(std::string{"abc"}) ==
+                                    (std::vector<char>{3, 'a', 'b', 'c'}));
+
+        std::string const s127(127, 'x'), s128(128, 'y'), s16384(16384, 'z');
+        BOOST_HANA_RUNTIME_CHECK(binary(s127).size() == 1 + 127);
+        BOOST_HANA_RUNTIME_CHECK(binary(s128).size() == 2 + 128);
+        BOOST_HANA_RUNTIME_CHECK(binary(s128)[0] == char(0x80));
+        BOOST_HANA_RUNTIME_CHECK(binary(s128)[1] == char(0x01));
+        BOOST_HANA_RUNTIME_CHECK(binary(s16384).size() == 3 + 16384);
+
+        BOOST_HANA_RUNTIME_CHECK(round_trip(std::string{}) == "");
+        BOOST_HANA_RUNTIME_CHECK(round_trip(std::string{"a\0b", 3}) == std::string("a\0b", 3));
+        BOOST_HANA_RUNTIME_CHECK(round_trip(s127) == s127);
+        BOOST_HANA_RUNTIME_CHECK(round_trip(s128) == s128);
+        BOOST_HANA_RUNTIME_CHECK(round_trip(s16384) == s16384);
+
+        BOOST_HANA_RUNTIME_CHECK(rejects_prefixes(std::string{"abc"}));
+        BOOST_HANA_RUNTIME_CHECK(rejects_prefixes(s128));
+
+        // a non-canonical varint is accepted
+        std::string s;
+        BOOST_HANA_RUNTIME_CHECK(read(std::vector<char>{char(0x81), 0, 'x'}, s));
+        BOOST_HANA_RUNTIME_CHECK(s == "x");
+
+        // lengths longer than the input, or too large varints, are rejected
+        std::vector<char> const too_long{5, 'a', 'b'};
+        BOOST_HANA_RUNTIME_CHECK(!read(too_long, s));
+        std::vector<char> overflow(10, char(0xFF));
+        overflow.push_back(1);
+        BOOST_HANA_RUNTIME_CHECK(!read(overflow, s));
+        std::vector<char> const huge{char(0xFF), char(0xFF), char(0xFF), char(0xFF),
+                                     char(0xFF), char(0xFF), char(0xFF), char(0xFF),
+                                     char(0xFF), 0x01};
+        BOOST_HANA_RUNTIME_CHECK(!read(huge, s));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Vectors
+    //////////////////////////////////////////////////////////////////////////
+    {
+        std::vector<int> const ints{1, -2, 3};
+        std::vector<char> expected{3};
+        for (int i : ints) {
+            std::vector<char> const bytes = bytes_of(i);
+            expected.insert(expected.end(), bytes.begin(), bytes.end());
+        }
+        BOOST_HANA_RUNTIME_CHECK(binary(ints) == expected);
+        BOOST_HANA_RUNTIME_CHECK(round_trip(ints) == ints);
+        BOOST_HANA_RUNTIME_CHECK(round_trip(std::vector<int>{}).empty());
+        BOOST_HANA_RUNTIME_CHECK(rejects_prefixes(ints));
+
+        std::vector<std::string> const strings{"a", "", "bcd"};
+        BOOST_HANA_RUNTIME_CHECK(round_trip(strings) == strings);
+        BOOST_HANA_RUNTIME_CHECK(rejects_prefixes(strings));
+
+        std::vector<ns::Point> const points{{1, 2}, {3, 4}};
+        BOOST_HANA_RUNTIME_CHECK(round_trip(points) == points);
+
+        // the packed bits of a std::vector<bool> are written one by one
+        std::vector<bool> const bools{true, false, false, true, true};
+        BOOST_HANA_RUNTIME_CHECK((binary(bools) == std::vector<char>{5, 1, 0, 0, 1, 1}));
+        BOOST_HANA_RUNTIME_CHECK(round_trip(bools) == bools);
+        BOOST_HANA_RUNTIME_CHECK(rejects_prefixes(bools));
+        std::vector<bool> b;
+        BOOST_HANA_RUNTIME_CHECK(!read(std::vector<char>{2, 1, 2}, b));
+
+        // the previous content of the vector is replaced
+        std::vector<int> xs{7, 8, 9, 10};
+        BOOST_HANA_RUNTIME_CHECK(read(binary(std::vector<int>{5}), xs));
+        BOOST_HANA_RUNTIME_CHECK(xs == std::vector<int>{5});
+
+        // a length larger than the input is rejected before allocating
+        std::vector<char> const huge{char(0xFF), char(0xFF), char(0xFF), char(0xFF),
+                                     char(0xFF), char(0xFF), char(0xFF), 0x7F};
+        BOOST_HANA_RUNTIME_CHECK(!read(huge, xs));
+        std::vector<ns::Point> ps;
+        BOOST_HANA_RUNTIME_CHECK(!read(huge, ps));
+
+        // elements represented with no bytes have a fixed length limit
+        std::vector<ns::Empty> es;
+        BOOST_HANA_RUNTIME_CHECK(!read(huge, es));
+        BOOST_HANA_RUNTIME_CHECK(round_trip(std::vector<ns::Empty>(3)).size() == 3);
+        BOOST_HANA_RUNTIME_CHECK(round_trip(std::vector<ns::Empty>(1 << 16)).size() == 1 << 16);
+        BOOST_HANA_RUNTIME_CHECK(!read(binary(std::vector<ns::Empty>((1 << 16) + 1)), es));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Tuples
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto const t = make_tuple(1, std::string{"ab"}, 2.5, std::vector<char>{'x'});
+        std::vector<char> expected = bytes_of(1);
+        expected.insert(expected.end(), {2, 'a', 'b'});
+        std::vector<char> const d = bytes_of(2.5);
+        expected.insert(expected.end(), d.begin(), d.end());
+        expected.insert(expected.end(), {1, 'x'});
+        BOOST_HANA_RUNTIME_CHECK(binary(t) == expected);
+
+        auto u = make_tuple(0, std::string{}, 0.0, std::vector<char>{});
+        BOOST_HANA_RUNTIME_CHECK(read(expected, u));
+        BOOST_HANA_RUNTIME_CHECK(u == t);
+        BOOST_HANA_RUNTIME_CHECK(rejects_prefixes(t));
+
+        BOOST_HANA_RUNTIME_CHECK(binary(make_tuple()).empty());
+        BOOST_HANA_RUNTIME_CHECK(binary(make_tuple(make_tuple(1, 2), 3)) ==
+                                 binary(make_tuple(1, 2, 3)));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Structs
+    //////////////////////////////////////////////////////////////////////////
+    {
+        // Members without padding are written like the whole object.
+        ns::Point const p{1, 2};
+        BOOST_HANA_RUNTIME_CHECK(binary(p) == bytes_of(p));
+        BOOST_HANA_RUNTIME_CHECK(round_trip(p) == p);
+        BOOST_HANA_RUNTIME_CHECK(rejects_prefixes(p));
+
+        // Padding is not written.
+        ns::Padded const padded{'a', 1.5, ns::Color::red};
+        BOOST_HANA_RUNTIME_CHECK(binary_size(padded) == 1 + sizeof(double) + 1);
+        BOOST_HANA_RUNTIME_CHECK(binary(padded) ==
+                                 binary(make_tuple('a', 1.5, ns::Color::red)));
+        ns::Padded const q = round_trip(padded);
+        BOOST_HANA_RUNTIME_CHECK(q.c == 'a' && q.d == 1.5 && q.color == ns::Color::red);
+
+        // Members are written in the order of the accessors.
+        ns::Reordered const r{1, 2, 3};
+        BOOST_HANA_RUNTIME_CHECK(binary(r) == binary(make_tuple(3, 1, 2)));
+        ns::Reordered const s = round_trip(r);
+        BOOST_HANA_RUNTIME_CHECK(s.a == 1 && s.b == 2 && s.c == 3);
+
+        BOOST_HANA_RUNTIME_CHECK(binary(ns::Empty{}).empty());
+        round_trip(ns::Empty{});
+
+        ns::Shape const shape{
+            "triangle", {{0, 0}, {1, 0}, {0, 1}}, {5, 6}, true, {},
+            {{"a", "bc"}}, {"first", "second"}
+        };
+        ns::Shape const t = round_trip(shape);
+        BOOST_HANA_RUNTIME_CHECK(t.name == shape.name);
+        BOOST_HANA_RUNTIME_CHECK(t.points == shape.points);
+        BOOST_HANA_RUNTIME_CHECK(t.origin == shape.origin);
+        BOOST_HANA_RUNTIME_CHECK(t.closed == shape.closed);
+        BOOST_HANA_RUNTIME_CHECK(t.tags == shape.tags);
+        BOOST_HANA_RUNTIME_CHECK(t.notes == shape.notes);
+        BOOST_HANA_RUNTIME_CHECK(rejects_prefixes(shape));
+
+        ns::Adapted const a{7, {{1.f, 2.f, 3.f}}, {{'x', 0.5, ns::Color::blue}}};
+        BOOST_HANA_RUNTIME_CHECK(binary_size(a) == 2 + 12 + 1 + 10);
+        ns::Adapted const b = round_trip(a);
+        BOOST_HANA_RUNTIME_CHECK(b.id == 7 && b.position == a.position);
+        BOOST_HANA_RUNTIME_CHECK(b.parts.size() == 1 && b.parts[0].c == 'x' &&
+                                 b.parts[0].d == 0.5 && b.parts[0].color == ns::Color::blue);
+        BOOST_HANA_RUNTIME_CHECK(rejects_prefixes(a));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Writing to a buffer and reading from the middle of a buffer
+    //////////////////////////////////////////////////////////////////////////
+    {
+        ns::Point const p{3, 4};
+        std::string const s = "abc";
+        char buffer[64];
+        char* end = to_binary(p, buffer);
+        BOOST_HANA_RUNTIME_CHECK(end == buffer + binary_size(p));
+        end = to_binary(s, end);
+        BOOST_HANA_RUNTIME_CHECK(end == buffer + binary_size(p) + binary_size(s));
+
+        ns::Point q{};
+        std::string t;
+        char const* next = from_binary(buffer, end, q);
+        BOOST_HANA_RUNTIME_CHECK(next == buffer + binary_size(p));
+        BOOST_HANA_RUNTIME_CHECK(q == p);
+        next = from_binary(next, end, t);
+        BOOST_HANA_RUNTIME_CHECK(next == end);
+        BOOST_HANA_RUNTIME_CHECK(t == s);
+    }
+}
@@ -0,0 +1,143 @@
+#!/usr/bin/env ruby
+#
+# Copyright Louis Dionne 2015
+# Distributed under the Boost Software License, Version 1.0.
+# (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+#
+#
+# This script checks the code generated for the kernels of the codegen
+# tests. It is used as follows:
+#
+#   check.rb <objdump> <object-or-archive> <source>...
+#
+# The object file (or the static library) is disassembled with `objdump`,
+# and the assertions found in the sources are checked against the code of
+# each function. An assertion is a comment of the form
+#
+#   // codegen: <function> <property> [<argument>]
+#
+# where `<function>` is the (unmangled, i.e. `extern "C"`) name of a
+# function and `<property>` is one of
+#
+#   max-instructions <n>
+#     The function has at most `n` instructions, not counting the return
+#     instruction and the padding.
+#
+#   as-cheap-as <other-function>
+#     The function has no more instructions and no more calls than
+#     `<other-function>`, which is usually written by hand without Hana.
+#     The instructions themselves are not compared, since the compiler
+#     is free to schedule equivalent code differently.
+#
+#   no-calls
+#     The function does not call (or jump to) any other function.
+#
+#   no-reference <regex>
+#     The function does not refer to any symbol matching `<regex>`, like
+#     `_Znwm` for `operator new`.
+#
+# The script prints the code of the functions whose assertions failed and
+# exits with a nonzero status if any assertion failed.
+
+require 'open3'
+
+
+Function = Struct.new(:name, :instructions, :relocations) do
+  RETURN = /\A(rep[a-z]*\s+)?ret[a-z]*\b/
+  PADDING = /\A(nop|xchg\s+%?ax,\s*%?ax|data16|cs nop|int3|ud2)\b/
+  CALL = /\A(call[a-z]*|bl|blr|blx|jalr?)\b/
+
+  def code
+    instructions.reject { |i| i =~ RETURN || i =~ PADDING }
+  end
+
+  # In object files, both calls and jumps to other functions (tail calls)
+  # are resolved through relocations, which catches the tail calls that
+  # would not be counted by looking at the call instructions only.
+  def calls
+    [instructions.count { |i| i =~ CALL },
+     relocations.count { |r| r =~ /\AR_\S*(PLT|CALL|JUMP)/ }].max
+  end
+end
+
+def disassemble(objdump, file)
+  out, err, status = Open3.capture3(objdump, "-d", "-r", "--no-show-raw-insn", file)
+  raise "#{objdump} failed on #{file}:\n#{err}" if not status.success?
+
+  functions = {}
+  current = nil
+  out.each_line do |line|
+    case line
+    when /\A[0-9a-f]+ <([^>]+)>:\s*\z/
+      current = functions[$1] = Function.new($1, [], [])
+    when /\A\s+[0-9a-f]+:\s+(R_\S+\s+\S+)/
+      current.relocations << $1 if current
+    when /\A\s+[0-9a-f]+:\t(.+?)\s*\z/
+      current.instructions << $1.gsub(/\s+/, " ") if current
+    end
+  end
+  functions
+end
+
+def assertions(sources)
+  sources.flat_map { |source|
+    File.readlines(source).each_with_index.map { |line, n|
+      next if line !~ %r{//\s*codegen:\s*(\S+)\s+(\S+)\s*(.*?)\s*\z}
+      { function: $1, property: $2, argument: $3, where: "#{source}:#{n + 1}" }
+    }.compact
+  }
+end
+
+def check(assertion, functions)
+  f = functions[assertion[:function]]
+  return "function `#{assertion[:function]}` was not found" if f.nil?
+
+  case assertion[:property]
+  when "max-instructions"
+    n = Integer(assertion[:argument])
+    return "#{f.code.size} instructions, expected at most #{n}" if f.code.size > n
+  when "as-cheap-as"
+    other = functions[assertion[:argument]]
+    return "function `#{assertion[:argument]}` was not found" if other.nil?
+    if f.code.size > other.code.size
+      return "#{f.code.size} instructions, but `#{other.name}` has #{other.code.size}"
+    end
+    if f.calls > other.calls
+      return "#{f.calls} calls, but `#{other.name}` has #{other.calls}"
+    end
+  when "no-calls"
+    return "#{f.calls} calls, expected none" if f.calls > 0
+  when "no-reference"
+    pattern = Regexp.new(assertion[:argument])
+    symbols = f.relocations.map { |r| r.split.last.sub(/[+-]0x\h+\z/, "") }
+    refs = symbols.select { |s| s =~ pattern }.uniq
+    return "refers to #{refs.join(', ')}" if not refs.empty?
+  else
+    return "unknown property `#{assertion[:property]}`"
+  end
+  nil
+end
+
+if __FILE__ == $0
+  objdump, file, *sources = ARGV
+  if objdump.nil? || file.nil? || sources.empty?
+    STDERR.puts "usage: #{$0} <objdump> <object-or-archive> <source>..."
+    exit 2
+  end
+
+  functions = disassemble(objdump, file)
+  all = assertions(sources)
+  failures = all.map { |a| [a, check(a, functions)] }.select { |_, error| error }
+
+  failures.each do |a, error|
+    puts "#{a[:where]}: #{a[:function]} #{a[:property]} #{a[:argument]}".strip + " failed: #{error}"
+    [a[:function], a[:property] == "as-cheap-as" ? a[:argument] : nil].compact.uniq.each do |name|
+      next if not functions.key?(name)
+      puts "  <#{name}>:"
+      functions[name].instructions.each { |i| puts "    #{i}" }
+      functions[name].relocations.each { |r| puts "    # #{r}" }
+    end
+  end
+  puts "#{all.size - failures.size} of #{all.size} codegen assertions passed"
+  exit(failures.empty? ? 0 : 1)
+end
@@ -0,0 +1,74 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/map.hpp>
+
+#include <boost/hana/pair.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/struct.hpp>
+#include <boost/hana/type.hpp>
+using namespace boost::hana;
+
+
+// The kernels below are compiled with optimizations and the code generated
+// for them is checked by `check.rb`, according to the `codegen:` comments.
+// Looking up a key in a Map or a Struct must be as cheap as accessing the
+// member of a plain struct.
+
+template <int i>
+struct key { };
+
+using map3 = decltype(make<Map>(
+    make<Pair>(type<key<0>>, int{}),
+    make<Pair>(type<key<1>>, int{}),
+    make<Pair>(type<key<2>>, int{})
+));
+
+struct struct3 {
+    int x0, x1, x2;
+};
+
+struct Person {
+    BOOST_HANA_DEFINE_STRUCT(Person,
+        (int, age),
+        (int, height),
+        (int, weight)
+    );
+};
+
+//////////////////////////////////////////////////////////////////////////////
+// at_key is a single load
+//////////////////////////////////////////////////////////////////////////////
+// codegen: hana_map_at_key max-instructions 1
+// codegen: hana_map_at_key as-cheap-as manual_at_key
+extern "C" int hana_map_at_key(map3 const& m) { return at_key(m, type<key<2>>); }
+
+// codegen: hana_struct_at_key max-instructions 1
+// codegen: hana_struct_at_key as-cheap-as manual_at_key
+extern "C" int hana_struct_at_key(Person const& p)
+{ return at_key(p, BOOST_HANA_STRING("weight")); }
+
+extern "C" int manual_at_key(struct3 const& s) { return s.x2; }
+
+//////////////////////////////////////////////////////////////////////////////
+// find and contains don't cost anything beyond the load of the value
+//////////////////////////////////////////////////////////////////////////////
+// codegen: hana_map_find max-instructions 1
+// codegen: hana_map_find as-cheap-as manual_at_key
+extern "C" int hana_map_find(map3 const& m) {
+    return *find(m, type<key<2>>) + (contains(m, type<key<3>>) ? 1 : 0);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// Folding the members of a Struct has no calls
+//////////////////////////////////////////////////////////////////////////////
+// codegen: hana_struct_fold_left no-calls
+// codegen: hana_struct_fold_left as-cheap-as manual_sum
+extern "C" int hana_struct_fold_left(Person const& p) {
+    return fold_left(members(p), 0, [](int sum, int x) { return sum + x; });
+}
+
+extern "C" int manual_sum(struct3 const& s) { return s.x0 + s.x1 + s.x2; }
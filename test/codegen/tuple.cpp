@@ -0,0 +1,123 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/tuple.hpp>
+
+#include <boost/hana/bool.hpp>
+#include <boost/hana/optional.hpp>
+
+#include <type_traits>
+using namespace boost::hana;
+
+
+// The kernels below are compiled with optimizations and the code generated
+// for them is checked by `check.rb`, according to the `codegen:` comments.
+// Each Hana kernel is compared with a kernel doing the same thing by hand
+// on a plain struct.
+
+using tuple8 = _tuple<int, int, int, int, int, int, int, int>;
+
+struct struct8 {
+    int x0, x1, x2, x3, x4, x5, x6, x7;
+};
+
+struct add {
+    constexpr int operator()(int x, int y) const { return x + y; }
+};
+
+struct twice {
+    constexpr int operator()(int x) const { return 2 * x; }
+};
+
+//////////////////////////////////////////////////////////////////////////////
+// at_c is a single load
+//////////////////////////////////////////////////////////////////////////////
+// codegen: hana_at_c max-instructions 1
+// codegen: hana_at_c as-cheap-as manual_at_c
+extern "C" int hana_at_c(tuple8 const& t) { return at_c<5>(t); }
+extern "C" int manual_at_c(struct8 const& t) { return t.x5; }
+
+//////////////////////////////////////////////////////////////////////////////
+// fold_left, for_each and unpack over a homogeneous tuple have no calls
+//////////////////////////////////////////////////////////////////////////////
+// codegen: hana_fold_left no-calls
+// codegen: hana_fold_left as-cheap-as manual_sum
+extern "C" int hana_fold_left(tuple8 const& t)
+{ return fold_left(t, 0, add{}); }
+
+// codegen: hana_for_each no-calls
+// codegen: hana_for_each as-cheap-as manual_sum
+extern "C" int hana_for_each(tuple8 const& t) {
+    int sum = 0;
+    for_each(t, [&](int x) { sum += x; });
+    return sum;
+}
+
+// codegen: hana_unpack no-calls
+// codegen: hana_unpack as-cheap-as manual_sum
+extern "C" int hana_unpack(tuple8 const& t) {
+    return unpack(t, [](auto ...x) {
+        int sum = 0;
+        using Swallow = int[];
+        (void)Swallow{0, (sum += x)...};
+        return sum;
+    });
+}
+
+extern "C" int manual_sum(struct8 const& t)
+{ return t.x0 + t.x1 + t.x2 + t.x3 + t.x4 + t.x5 + t.x6 + t.x7; }
+
+//////////////////////////////////////////////////////////////////////////////
+// transform is an element-wise loop
+//////////////////////////////////////////////////////////////////////////////
+// codegen: hana_transform no-calls
+// codegen: hana_transform as-cheap-as manual_transform
+extern "C" tuple8 hana_transform(tuple8 const& t)
+{ return transform(t, twice{}); }
+
+extern "C" struct8 manual_transform(struct8 const& t) {
+    twice f;
+    return {f(t.x0), f(t.x1), f(t.x2), f(t.x3),
+            f(t.x4), f(t.x5), f(t.x6), f(t.x7)};
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// make_tuple of PODs does not allocate
+//////////////////////////////////////////////////////////////////////////////
+// codegen: hana_make_tuple no-calls
+// codegen: hana_make_tuple no-reference ^_Zn[wa]
+// codegen: hana_make_tuple as-cheap-as manual_make_tuple
+extern "C" int hana_make_tuple(int a, char b, double c) {
+    auto t = make_tuple(a, b, c);
+    return at_c<0>(t) + at_c<1>(t) + static_cast<int>(at_c<2>(t));
+}
+
+extern "C" int manual_make_tuple(int a, char b, double c) {
+    struct { int a; char b; double c; } t{a, b, c};
+    return t.a + t.b + static_cast<int>(t.c);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// find_if with a compile-time predicate is a single load
+//////////////////////////////////////////////////////////////////////////////
+struct struct3 {
+    int a;
+    char b;
+    double c;
+};
+
+struct is_floating_point {
+    template <typename X>
+    constexpr auto operator()(X const&) const
+    { return bool_<std::is_floating_point<X>{}>; }
+};
+
+// codegen: hana_find_if max-instructions 1
+// codegen: hana_find_if as-cheap-as manual_find_if
+extern "C" double hana_find_if(_tuple<int, char, double> const& t)
+{ return *find_if(t, is_floating_point{}); }
+
+extern "C" double manual_find_if(struct3 const& t) { return t.c; }
@@ -0,0 +1,210 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/columnar.hpp>
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/soa_vector.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/struct.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+using namespace boost::hana;
+
+
+namespace v1 {
+    struct Trade {
+        BOOST_HANA_DEFINE_STRUCT(Trade,
+            (std::uint64_t, id),
+            (double, price),
+            (std::int32_t, quantity),
+            (char, side),
+            (bool, buy)
+        );
+    };
+}
+
+namespace v2 {
+    // Same names, but `quantity` has a different type.
+    struct Trade {
+        BOOST_HANA_DEFINE_STRUCT(Trade,
+            (std::uint64_t, id),
+            (double, price),
+            (std::int64_t, quantity),
+            (char, side),
+            (bool, buy)
+        );
+    };
+
+    // Same types, but a member is renamed.
+    struct Renamed {
+        BOOST_HANA_DEFINE_STRUCT(Renamed,
+            (std::uint64_t, id),
+            (double, cost),
+            (std::int32_t, quantity),
+            (char, side),
+            (bool, buy)
+        );
+    };
+}
+
+std::string temporary(char const* name) {
+    return std::string{"columnar."} + name + ".test";
+}
+
+template <typename Xs>
+void write(std::string const& path, Xs const& xs) {
+    std::ofstream out{path, std::ios::binary};
+    BOOST_HANA_RUNTIME_CHECK(write_columnar(out, xs).good());
+}
+
+
+int main() {
+    std::vector<v1::Trade> trades;
+    for (std::uint32_t i = 0; i != 1000; ++i) {
+        trades.push_back(v1::Trade{i, i * 0.25, static_cast<std::int32_t>(i % 7),
+                                   i % 2 ? 'b' : 's', i % 3 == 0});
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // layout_hash
+    //////////////////////////////////////////////////////////////////////////
+    {
+        static_assert(columnar_file<v1::Trade>::layout_hash ==
+                      columnar_file<v1::Trade>::layout_hash, "");
+        static_assert(columnar_file<v1::Trade>::layout_hash !=
+                      columnar_file<v2::Trade>::layout_hash, "");
+        static_assert(columnar_file<v1::Trade>::layout_hash !=
+                      columnar_file<v2::Renamed>::layout_hash, "");
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Round trip from a container and from a soa_vector
+    //////////////////////////////////////////////////////////////////////////
+    {
+        std::string const path = temporary("vector");
+        write(path, trades);
+
+        columnar_file<v1::Trade> file;
+        BOOST_HANA_RUNTIME_CHECK(file.open(path.c_str()) == columnar_status::ok);
+        BOOST_HANA_RUNTIME_CHECK(file.is_open());
+        BOOST_HANA_RUNTIME_CHECK(file.size() == 1000);
+
+        auto ids = file.column(BOOST_HANA_STRING("id"));
+        auto prices = file.column(BOOST_HANA_STRING("price"));
+        auto quantities = file.column(BOOST_HANA_STRING("quantity"));
+        auto sides = file.column(BOOST_HANA_STRING("side"));
+        auto buys = file.column(BOOST_HANA_STRING("buy"));
+        BOOST_HANA_RUNTIME_CHECK(ids.size() == 1000 && sides.size() == 1000);
+        for (std::size_t i = 0; i != 1000; ++i) {
+            BOOST_HANA_RUNTIME_CHECK(ids[i] == trades[i].id);
+            BOOST_HANA_RUNTIME_CHECK(prices[i] == trades[i].price);
+            BOOST_HANA_RUNTIME_CHECK(quantities[i] == trades[i].quantity);
+            BOOST_HANA_RUNTIME_CHECK(sides[i] == trades[i].side);
+            BOOST_HANA_RUNTIME_CHECK(buys[i] == trades[i].buy);
+        }
+
+        // the columns are aligned
+        BOOST_HANA_RUNTIME_CHECK(reinterpret_cast<std::uintptr_t>(prices.data()) % 64 == 0);
+        BOOST_HANA_RUNTIME_CHECK(reinterpret_cast<std::uintptr_t>(sides.data()) % 64 == 0);
+
+        // a soa_vector is written the same way
+        soa_vector<v1::Trade> soa;
+        for (auto const& trade : trades)
+            soa.push_back(trade);
+        std::string const soa_path = temporary("soa_vector");
+        write(soa_path, soa);
+
+        std::ifstream a{path, std::ios::binary}, b{soa_path, std::ios::binary};
+        std::string const bytes_a{std::istreambuf_iterator<char>{a}, {}};
+        std::string const bytes_b{std::istreambuf_iterator<char>{b}, {}};
+        BOOST_HANA_RUNTIME_CHECK(bytes_a == bytes_b);
+
+        // the names of the members are in the header
+        BOOST_HANA_RUNTIME_CHECK(bytes_a.find("id,price,quantity,side,buy") != std::string::npos);
+
+        // moving transfers the mapping
+        columnar_file<v1::Trade> moved{std::move(file)};
+        BOOST_HANA_RUNTIME_CHECK(!file.is_open());
+        BOOST_HANA_RUNTIME_CHECK(moved.column(BOOST_HANA_STRING("id"))[999] == 999);
+        moved.close();
+        BOOST_HANA_RUNTIME_CHECK(!moved.is_open());
+
+        std::remove(soa_path.c_str());
+        std::remove(path.c_str());
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Empty files
+    //////////////////////////////////////////////////////////////////////////
+    {
+        std::string const path = temporary("empty");
+        write(path, std::vector<v1::Trade>{});
+
+        columnar_file<v1::Trade> file;
+        BOOST_HANA_RUNTIME_CHECK(file.open(path.c_str()) == columnar_status::ok);
+        BOOST_HANA_RUNTIME_CHECK(file.size() == 0);
+        BOOST_HANA_RUNTIME_CHECK(file.column(BOOST_HANA_STRING("side")).empty());
+        std::remove(path.c_str());
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Invalid files are rejected
+    //////////////////////////////////////////////////////////////////////////
+    {
+        std::string const path = temporary("invalid");
+        write(path, trades);
+
+        columnar_file<v2::Trade> other;
+        BOOST_HANA_RUNTIME_CHECK(other.open(path.c_str()) == columnar_status::layout_mismatch);
+        BOOST_HANA_RUNTIME_CHECK(!other.is_open());
+
+        columnar_file<v2::Renamed> renamed;
+        BOOST_HANA_RUNTIME_CHECK(renamed.open(path.c_str()) == columnar_status::layout_mismatch);
+
+        columnar_file<v1::Trade> file;
+        BOOST_HANA_RUNTIME_CHECK(file.open("columnar.does_not_exist.test") ==
+                                 columnar_status::cannot_open);
+
+        // truncated
+        std::ifstream in{path, std::ios::binary};
+        std::string bytes{std::istreambuf_iterator<char>{in}, {}};
+        in.close();
+        {
+            std::ofstream out{path, std::ios::binary};
+            out.write(bytes.data(), static_cast<std::streamsize>(bytes.size() - 1));
+        }
+        BOOST_HANA_RUNTIME_CHECK(file.open(path.c_str()) == columnar_status::truncated);
+
+        // not a columnar file
+        {
+            std::ofstream out{path, std::ios::binary};
+            out << std::string(bytes.size(), 'x');
+        }
+        BOOST_HANA_RUNTIME_CHECK(file.open(path.c_str()) == columnar_status::bad_format);
+
+        {
+            std::ofstream out{path, std::ios::binary};
+            out << "short";
+        }
+        BOOST_HANA_RUNTIME_CHECK(file.open(path.c_str()) == columnar_status::bad_format);
+
+        // an empty file is not mapped, but it can be opened and closed
+        {
+            std::ofstream out{path, std::ios::binary};
+        }
+        BOOST_HANA_RUNTIME_CHECK(file.open(path.c_str()) == columnar_status::bad_format);
+        BOOST_HANA_RUNTIME_CHECK(!file.is_open());
+
+        std::remove(path.c_str());
+    }
+}
@@ -0,0 +1,202 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/map.hpp>
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/type.hpp>
+
+#include <test/counted.hpp>
+
+#include <utility>
+using namespace boost::hana;
+using test::budget;
+using test::count_copies;
+using test::counted;
+
+
+// The budgets below are for maps of 3 pairs, whose keys are types and whose
+// values count their copies and moves.
+
+template <int i>
+struct key { };
+
+template <int i>
+constexpr auto k = type<key<i>>;
+
+auto elements() {
+    return make<Map>(
+        make<Pair>(k<0>, counted<0>{0}),
+        make<Pair>(k<1>, counted<1>{1}),
+        make<Pair>(k<2>, counted<2>{2})
+    );
+}
+
+int main() {
+    auto const m = elements();
+    auto const p = make<Pair>(k<3>, counted<3>{3});
+
+    //////////////////////////////////////////////////////////////////////////
+    // Construction
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto p0 = make<Pair>(k<0>, counted<0>{0});
+        auto p1 = make<Pair>(k<1>, counted<1>{1});
+        auto p2 = make<Pair>(k<2>, counted<2>{2});
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = make<Map>(p0, p1, p2);
+            (void)r;
+        }) == budget{3, 0}));
+
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = make<Map>(std::move(p0), std::move(p1), std::move(p2));
+            (void)r;
+        }) == budget{0, 3}));
+    }
+    {
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = m;
+            (void)r;
+        }) == budget{3, 0}));
+
+        auto n = elements();
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = std::move(n);
+            (void)r;
+        }) == budget{0, 3}));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Searchable
+    //////////////////////////////////////////////////////////////////////////
+    {
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto&& r = at_key(m, k<1>); (void)r;
+        }) == budget{0, 0}));
+
+        auto n = elements();
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto&& r = at_key(std::move(n), k<1>); (void)r;
+        }) == budget{0, 0}));
+    }
+    {
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = find(m, k<1>);
+            (void)r;
+        }) == budget{1, 0}));
+
+        auto n = elements();
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = find(std::move(n), k<1>);
+            (void)r;
+        }) == budget{0, 1}));
+
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = find(m, k<3>);
+            (void)r;
+        }) == budget{0, 0}));
+    }
+    {
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            contains(m, k<1>);
+            contains(m, k<3>);
+            any_of(m, equal.to(k<1>));
+        }) == budget{0, 0}));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable
+    //////////////////////////////////////////////////////////////////////////
+    {
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            fold_left(m, 0, [](int s, auto const&) { return s; });
+            for_each(m, [](auto const&) { });
+            unpack(m, [](auto const& ...) { });
+        }) == budget{0, 0}));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Comparable
+    //////////////////////////////////////////////////////////////////////////
+    {
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            equal(m, m);
+        }) == budget{0, 0}));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // keys and values
+    //////////////////////////////////////////////////////////////////////////
+    {
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = keys(m);
+            (void)r;
+        }) == budget{0, 0}));
+
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = values(m);
+            (void)r;
+        }) == budget{3, 0}));
+
+        auto n = elements();
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = values(std::move(n));
+            (void)r;
+        }) == budget{0, 3}));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // insert
+    //////////////////////////////////////////////////////////////////////////
+    {
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = insert(m, p);
+            (void)r;
+        }) == budget{4, 0}));
+
+        auto n = elements();
+        auto q = p;
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = insert(std::move(n), std::move(q));
+            (void)r;
+        }) == budget{0, 4}));
+    }
+    {
+        auto existing = make<Pair>(k<1>, counted<1>{1});
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = insert(m, existing);
+            (void)r;
+        }) == budget{3, 0}));
+
+        auto n = elements();
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = insert(std::move(n), std::move(existing));
+            (void)r;
+        }) == budget{0, 3}));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // erase_key
+    //////////////////////////////////////////////////////////////////////////
+    {
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = erase_key(m, k<1>);
+            (void)r;
+        }) == budget{2, 0}));
+
+        auto n = elements();
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = erase_key(std::move(n), k<1>);
+            (void)r;
+        }) == budget{0, 2}));
+
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = erase_key(m, k<3>);
+            (void)r;
+        }) == budget{3, 0}));
+    }
+}
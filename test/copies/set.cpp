@@ -0,0 +1,155 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/set.hpp>
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <test/counted.hpp>
+
+#include <utility>
+using namespace boost::hana;
+using test::budget;
+using test::count_copies;
+using test::counted;
+
+
+// The budgets below are for sets of 3 elements.
+
+auto elements() {
+    return make<Set>(counted<0>{0}, counted<1>{1}, counted<2>{2});
+}
+
+int main() {
+    auto const s = elements();
+    counted<1> const one{1};
+    counted<3> const three{3};
+
+    //////////////////////////////////////////////////////////////////////////
+    // Construction
+    //////////////////////////////////////////////////////////////////////////
+    {
+        counted<0> a{0}; counted<1> b{1}; counted<2> c{2};
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = make<Set>(a, b, c);
+            (void)r;
+        }) == budget{3, 0}));
+
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = make<Set>(std::move(a), std::move(b), std::move(c));
+            (void)r;
+        }) == budget{0, 3}));
+    }
+    {
+        // Each distinct element is copied once, and the set built so far is
+        // moved into the next one when an element is inserted.
+        auto xs = make<Tuple>(counted<0>{0}, counted<1>{1}, counted<0>{0});
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = to<Set>(xs);
+            (void)r;
+        }) == budget{2, 3}));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Searchable
+    //////////////////////////////////////////////////////////////////////////
+    {
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = find(s, one);
+            (void)r;
+        }) == budget{1, 0}));
+
+        auto t = elements();
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = find(std::move(t), one);
+            (void)r;
+        }) == budget{0, 1}));
+
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = find(s, three);
+            (void)r;
+        }) == budget{0, 0}));
+    }
+    {
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            contains(s, one);
+            contains(s, three);
+        }) == budget{0, 0}));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable
+    //////////////////////////////////////////////////////////////////////////
+    {
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            fold_left(s, 0, [](int s, auto const&) { return s; });
+            for_each(s, [](auto const&) { });
+            unpack(s, [](auto const& ...) { });
+        }) == budget{0, 0}));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Comparable
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto t = make<Set>(counted<2>{2}, counted<0>{0}, counted<1>{1});
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            equal(s, s);
+            equal(s, t);
+        }) == budget{0, 0}));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // insert
+    //////////////////////////////////////////////////////////////////////////
+    {
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = insert(s, three);
+            (void)r;
+        }) == budget{4, 0}));
+
+        auto t = elements();
+        counted<3> x{3};
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = insert(std::move(t), std::move(x));
+            (void)r;
+        }) == budget{0, 4}));
+    }
+    {
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = insert(s, one);
+            (void)r;
+        }) == budget{3, 0}));
+
+        auto t = elements();
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = insert(std::move(t), one);
+            (void)r;
+        }) == budget{0, 3}));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // erase_key
+    //////////////////////////////////////////////////////////////////////////
+    {
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = erase_key(s, one);
+            (void)r;
+        }) == budget{2, 0}));
+
+        auto t = elements();
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = erase_key(std::move(t), one);
+            (void)r;
+        }) == budget{0, 2}));
+
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = erase_key(s, three);
+            (void)r;
+        }) == budget{3, 0}));
+    }
+}
@@ -0,0 +1,133 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/struct.hpp>
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <test/counted.hpp>
+
+#include <utility>
+using namespace boost::hana;
+using test::budget;
+using test::count_copies;
+using test::counted;
+
+
+// The budgets below are for a Struct with 3 members.
+
+struct Object {
+    BOOST_HANA_DEFINE_STRUCT(Object,
+        (counted<0>, a),
+        (counted<1>, b),
+        (counted<2>, c)
+    );
+};
+
+Object object() {
+    return {counted<0>{0}, counted<1>{1}, counted<2>{2}};
+}
+
+int main() {
+    Object const o = object();
+    auto b = BOOST_HANA_STRING("b");
+    auto z = BOOST_HANA_STRING("z");
+
+    //////////////////////////////////////////////////////////////////////////
+    // members and keys
+    //////////////////////////////////////////////////////////////////////////
+    {
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = members(o);
+            (void)r;
+        }) == budget{3, 0}));
+
+        Object p = object();
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = members(std::move(p));
+            (void)r;
+        }) == budget{0, 3}));
+    }
+    {
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = members_ref(o);
+            (void)r;
+        }) == budget{0, 0}));
+
+        // The members of an rvalue are moved, since referring to them
+        // would leave dangling references.
+        Object p = object();
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = members_ref(std::move(p));
+            (void)r;
+        }) == budget{0, 3}));
+    }
+    {
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = keys(o);
+            (void)r;
+        }) == budget{0, 0}));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Searchable
+    //////////////////////////////////////////////////////////////////////////
+    {
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto&& r = at_key(o, b); (void)r;
+        }) == budget{0, 0}));
+
+        Object p = object();
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto&& r = at_key(std::move(p), b); (void)r;
+        }) == budget{0, 0}));
+    }
+    {
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = find(o, b);
+            (void)r;
+        }) == budget{1, 0}));
+
+        Object p = object();
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = find(std::move(p), b);
+            (void)r;
+        }) == budget{0, 1}));
+
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = find(o, z);
+            (void)r;
+        }) == budget{0, 0}));
+    }
+    {
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            contains(o, b);
+            contains(o, z);
+        }) == budget{0, 0}));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable
+    //////////////////////////////////////////////////////////////////////////
+    {
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            fold_left(o, 0, [](int s, auto const&) { return s; });
+            for_each(o, [](auto const&) { });
+            unpack(o, [](auto const& ...) { });
+        }) == budget{0, 0}));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Comparable
+    //////////////////////////////////////////////////////////////////////////
+    {
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            equal(o, o);
+        }) == budget{0, 0}));
+    }
+}
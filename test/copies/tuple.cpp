@@ -0,0 +1,302 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/tuple.hpp>
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/bool.hpp>
+#include <boost/hana/integral_constant.hpp>
+
+#include <test/counted.hpp>
+
+#include <type_traits>
+#include <utility>
+using namespace boost::hana;
+using test::budget;
+using test::count_copies;
+using test::counted;
+
+
+// The budgets below are for tuples of 3 elements. Algorithms taking the
+// tuple by lvalue may only copy the elements they return, and algorithms
+// taking it by rvalue may only move them.
+
+template <int i>
+struct is {
+    template <typename X>
+    constexpr auto operator()(X const&) const
+    { return bool_<std::is_same<X, counted<i>>{}>; }
+};
+
+struct forward_ {
+    template <typename X>
+    constexpr X&& operator()(X&& x) const { return static_cast<X&&>(x); }
+};
+
+struct get_value {
+    template <typename X>
+    constexpr int operator()(X const& x) const { return x.value; }
+};
+
+auto elements() {
+    return make<Tuple>(counted<0>{0}, counted<1>{1}, counted<2>{2});
+}
+
+int main() {
+    auto const xs = elements();
+    counted<3> const x{3};
+
+    //////////////////////////////////////////////////////////////////////////
+    // Construction
+    //////////////////////////////////////////////////////////////////////////
+    {
+        counted<0> a{0}; counted<1> b{1}; counted<2> c{2};
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = make<Tuple>(a, b, c);
+            (void)r;
+        }) == budget{3, 0}));
+
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = make<Tuple>(std::move(a), std::move(b), std::move(c));
+            (void)r;
+        }) == budget{0, 3}));
+    }
+    {
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = xs;
+            (void)r;
+        }) == budget{3, 0}));
+
+        auto ys = elements();
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = std::move(ys);
+            (void)r;
+        }) == budget{0, 3}));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable
+    //////////////////////////////////////////////////////////////////////////
+    {
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            fold_left(xs, 0, [](int s, auto const& x) { return s + x.value; });
+        }) == budget{0, 0}));
+
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            fold_right(xs, 0, [](auto const& x, int s) { return s + x.value; });
+        }) == budget{0, 0}));
+
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            for_each(xs, [](auto const&) { });
+        }) == budget{0, 0}));
+
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            unpack(xs, [](auto const& ...) { });
+        }) == budget{0, 0}));
+
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            length(xs);
+        }) == budget{0, 0}));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Iterable
+    //////////////////////////////////////////////////////////////////////////
+    {
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto&& r = at_c<1>(xs); (void)r;
+            auto&& h = head(xs); (void)h;
+            auto&& l = last(xs); (void)l;
+        }) == budget{0, 0}));
+
+        auto ys = elements();
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto&& r = at_c<1>(std::move(ys)); (void)r;
+        }) == budget{0, 0}));
+    }
+    {
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = tail(xs);
+            (void)r;
+        }) == budget{2, 0}));
+
+        auto ys = elements();
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = tail(std::move(ys));
+            (void)r;
+        }) == budget{0, 2}));
+    }
+    {
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = drop(xs, int_<1>);
+            (void)r;
+        }) == budget{2, 0}));
+
+        auto ys = elements();
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = drop(std::move(ys), int_<1>);
+            (void)r;
+        }) == budget{0, 2}));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Functor
+    //////////////////////////////////////////////////////////////////////////
+    {
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = transform(xs, get_value{});
+            (void)r;
+        }) == budget{0, 0}));
+
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = transform(xs, forward_{});
+            (void)r;
+        }) == budget{3, 0}));
+
+        auto ys = elements();
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = transform(std::move(ys), forward_{});
+            (void)r;
+        }) == budget{0, 3}));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // MonadPlus
+    //////////////////////////////////////////////////////////////////////////
+    {
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = append(xs, x);
+            (void)r;
+        }) == budget{4, 0}));
+
+        auto ys = elements();
+        counted<3> y{3};
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = append(std::move(ys), std::move(y));
+            (void)r;
+        }) == budget{0, 4}));
+    }
+    {
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = prepend(xs, x);
+            (void)r;
+        }) == budget{4, 0}));
+
+        auto ys = elements();
+        counted<3> y{3};
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = prepend(std::move(ys), std::move(y));
+            (void)r;
+        }) == budget{0, 4}));
+    }
+    {
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = concat(xs, xs);
+            (void)r;
+        }) == budget{6, 0}));
+
+        auto ys = elements(), zs = elements();
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = concat(std::move(ys), std::move(zs));
+            (void)r;
+        }) == budget{0, 6}));
+    }
+    {
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = filter(xs, is<1>{});
+            (void)r;
+        }) == budget{1, 0}));
+
+        auto ys = elements();
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = filter(std::move(ys), is<1>{});
+            (void)r;
+        }) == budget{0, 1}));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Searchable
+    //////////////////////////////////////////////////////////////////////////
+    {
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = find_if(xs, is<1>{});
+            (void)r;
+        }) == budget{1, 0}));
+
+        auto ys = elements();
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = find_if(std::move(ys), is<1>{});
+            (void)r;
+        }) == budget{0, 1}));
+
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            any_of(xs, is<1>{});
+            all_of(xs, is<1>{});
+        }) == budget{0, 0}));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Comparable
+    //////////////////////////////////////////////////////////////////////////
+    {
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            equal(xs, xs);
+        }) == budget{0, 0}));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Sequence
+    //////////////////////////////////////////////////////////////////////////
+    {
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = reverse(xs);
+            (void)r;
+        }) == budget{3, 0}));
+
+        auto ys = elements();
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = reverse(std::move(ys));
+            (void)r;
+        }) == budget{0, 3}));
+    }
+    {
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = take(xs, int_<2>);
+            (void)r;
+        }) == budget{2, 0}));
+
+        auto ys = elements();
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = take(std::move(ys), int_<2>);
+            (void)r;
+        }) == budget{0, 2}));
+    }
+    {
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = remove_at(xs, int_<1>);
+            (void)r;
+        }) == budget{2, 0}));
+
+        auto ys = elements();
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = remove_at(std::move(ys), int_<1>);
+            (void)r;
+        }) == budget{0, 2}));
+    }
+    {
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = insert(xs, int_<1>, x);
+            (void)r;
+        }) == budget{4, 0}));
+
+        auto ys = elements();
+        counted<3> y{3};
+        BOOST_HANA_RUNTIME_CHECK((count_copies([&] {
+            auto r = insert(std::move(ys), int_<1>, std::move(y));
+            (void)r;
+        }) == budget{0, 4}));
+    }
+}
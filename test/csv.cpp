@@ -0,0 +1,246 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/csv.hpp>
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/soa_vector.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/struct.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+using namespace boost::hana;
+
+
+namespace ns {
+    struct Person {
+        BOOST_HANA_DEFINE_STRUCT(Person,
+            (std::string, name),
+            (int, age),
+            (double, height),
+            (bool, member),
+            (char, grade)
+        );
+    };
+
+    struct Sample {
+        BOOST_HANA_DEFINE_STRUCT(Sample,
+            (std::uint8_t, u8),
+            (std::int16_t, i16),
+            (std::int64_t, i64),
+            (std::uint64_t, u64),
+            (float, f)
+        );
+    };
+}
+
+template <typename Out>
+char const* parse(std::string const& csv, Out& out, csv_options options = csv_options{}) {
+    return from_csv(csv.data(), csv.data() + csv.size(), out, options);
+}
+
+template <typename T>
+bool fails(std::string const& csv) {
+    std::vector<T> out;
+    return parse(csv, out) == nullptr;
+}
+
+
+int main() {
+    //////////////////////////////////////////////////////////////////////////
+    // Basic parsing
+    //////////////////////////////////////////////////////////////////////////
+    {
+        std::string const csv =
+            "name,age,height,member,grade\n"
+            "John,30,1.80,true,A\n"
+            "Jane,25,1.65,0,B\n";
+        std::vector<ns::Person> people;
+        BOOST_HANA_RUNTIME_CHECK(parse(csv, people) == csv.data() + csv.size());
+        BOOST_HANA_RUNTIME_CHECK(people.size() == 2);
+        BOOST_HANA_RUNTIME_CHECK(people[0].name == "John");
+        BOOST_HANA_RUNTIME_CHECK(people[0].age == 30);
+        BOOST_HANA_RUNTIME_CHECK(people[0].height == 1.80);
+        BOOST_HANA_RUNTIME_CHECK(people[0].member);
+        BOOST_HANA_RUNTIME_CHECK(people[0].grade == 'A');
+        BOOST_HANA_RUNTIME_CHECK(people[1].name == "Jane");
+        BOOST_HANA_RUNTIME_CHECK(!people[1].member);
+        BOOST_HANA_RUNTIME_CHECK(people[1].grade == 'B');
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Columns are matched by name
+    //////////////////////////////////////////////////////////////////////////
+    {
+        // in any order, with unknown columns and missing members
+        std::string const csv =
+            "age,unknown,name\r\n"
+            "30,whatever,John\r\n"
+            "\r\n"
+            "40,,Kevin";
+        std::vector<ns::Person> people;
+        BOOST_HANA_RUNTIME_CHECK(parse(csv, people) != nullptr);
+        BOOST_HANA_RUNTIME_CHECK(people.size() == 2);
+        BOOST_HANA_RUNTIME_CHECK(people[0].name == "John" && people[0].age == 30);
+        BOOST_HANA_RUNTIME_CHECK(people[0].height == 0.0 && !people[0].member);
+        BOOST_HANA_RUNTIME_CHECK(people[1].name == "Kevin" && people[1].age == 40);
+
+        // empty fields leave the members value-initialized
+        std::string const empty = "name,age\nJohn,\n,3\n";
+        people.clear();
+        BOOST_HANA_RUNTIME_CHECK(parse(empty, people) != nullptr);
+        BOOST_HANA_RUNTIME_CHECK(people[0].age == 0 && people[1].name.empty());
+
+        // a byte order mark is skipped
+        std::string const bom = "\xEF\xBB\xBF" "age\n1\n";
+        people.clear();
+        BOOST_HANA_RUNTIME_CHECK(parse(bom, people) != nullptr);
+        BOOST_HANA_RUNTIME_CHECK(people.size() == 1 && people[0].age == 1);
+
+        // no header at all
+        people.clear();
+        BOOST_HANA_RUNTIME_CHECK(parse("", people) != nullptr);
+        BOOST_HANA_RUNTIME_CHECK(people.empty());
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Quoted fields
+    //////////////////////////////////////////////////////////////////////////
+    {
+        std::string const csv =
+            "\"name\",\"age\",grade\n"
+            "\"Doe, John\",\"30\",\"\"\"\"\n"
+            "\"say \"\"hi\"\"\n\",1,x\n";
+        std::vector<ns::Person> people;
+        BOOST_HANA_RUNTIME_CHECK(parse(csv, people) != nullptr);
+        BOOST_HANA_RUNTIME_CHECK(people.size() == 2);
+        BOOST_HANA_RUNTIME_CHECK(people[0].name == "Doe, John");
+        BOOST_HANA_RUNTIME_CHECK(people[0].age == 30);
+        BOOST_HANA_RUNTIME_CHECK(people[0].grade == '"');
+        BOOST_HANA_RUNTIME_CHECK(people[1].name == "say \"hi\"\n");
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // TSV
+    //////////////////////////////////////////////////////////////////////////
+    {
+        std::string const tsv = "name\tage\nJohn, Jr.\t30\n";
+        std::vector<ns::Person> people;
+        BOOST_HANA_RUNTIME_CHECK(parse(tsv, people, csv_options{'\t', 1}) != nullptr);
+        BOOST_HANA_RUNTIME_CHECK(people.size() == 1);
+        BOOST_HANA_RUNTIME_CHECK(people[0].name == "John, Jr." && people[0].age == 30);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Numbers
+    //////////////////////////////////////////////////////////////////////////
+    {
+        std::string const csv =
+            "u8,i16,i64,u64,f\n"
+            "255,-32768,-9223372036854775808,18446744073709551615,-1.5e3\n"
+            "+0,32767,9223372036854775807,0,0.25\n";
+        std::vector<ns::Sample> samples;
+        BOOST_HANA_RUNTIME_CHECK(parse(csv, samples) != nullptr);
+        BOOST_HANA_RUNTIME_CHECK(samples[0].u8 == 255);
+        BOOST_HANA_RUNTIME_CHECK(samples[0].i16 == -32768);
+        BOOST_HANA_RUNTIME_CHECK(samples[0].i64 == INT64_MIN);
+        BOOST_HANA_RUNTIME_CHECK(samples[0].u64 == UINT64_MAX);
+        BOOST_HANA_RUNTIME_CHECK(samples[0].f == -1500.0f);
+        BOOST_HANA_RUNTIME_CHECK(samples[1].u8 == 0);
+        BOOST_HANA_RUNTIME_CHECK(samples[1].i16 == 32767);
+        BOOST_HANA_RUNTIME_CHECK(samples[1].i64 == INT64_MAX);
+        BOOST_HANA_RUNTIME_CHECK(samples[1].f == 0.25f);
+
+        // out of range and invalid numbers
+        BOOST_HANA_RUNTIME_CHECK(fails<ns::Sample>("u8\n256\n"));
+        BOOST_HANA_RUNTIME_CHECK(fails<ns::Sample>("u8\n-1\n"));
+        BOOST_HANA_RUNTIME_CHECK(fails<ns::Sample>("i16\n32768\n"));
+        BOOST_HANA_RUNTIME_CHECK(fails<ns::Sample>("i16\n-32769\n"));
+        BOOST_HANA_RUNTIME_CHECK(fails<ns::Sample>("u64\n18446744073709551616\n"));
+        BOOST_HANA_RUNTIME_CHECK(fails<ns::Sample>("i64\n1x\n"));
+        BOOST_HANA_RUNTIME_CHECK(fails<ns::Sample>("i64\n-\n"));
+        BOOST_HANA_RUNTIME_CHECK(fails<ns::Sample>("f\n1.5x\n"));
+        BOOST_HANA_RUNTIME_CHECK(fails<ns::Sample>("f\n 1.5\n"));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Invalid data
+    //////////////////////////////////////////////////////////////////////////
+    {
+        BOOST_HANA_RUNTIME_CHECK(fails<ns::Person>("name,age\nJohn\n"));
+        BOOST_HANA_RUNTIME_CHECK(fails<ns::Person>("name,age\nJohn,30,extra\n"));
+        BOOST_HANA_RUNTIME_CHECK(fails<ns::Person>("name,age\n\"John,30\n"));
+        BOOST_HANA_RUNTIME_CHECK(fails<ns::Person>("name,age\n\"John\"x,30\n"));
+        BOOST_HANA_RUNTIME_CHECK(fails<ns::Person>("name,member\nJohn,yes\n"));
+        BOOST_HANA_RUNTIME_CHECK(fails<ns::Person>("name,grade\nJohn,AB\n"));
+        BOOST_HANA_RUNTIME_CHECK(fails<ns::Person>("\"name,age\n"));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Parallel parsing and soa_vector
+    //////////////////////////////////////////////////////////////////////////
+    {
+        std::string csv = "name,age,height\n";
+        for (int i = 0; i != 10000; ++i) {
+            csv += (i % 100 == 0 ? "\"multi\nline\"," : "n" + std::to_string(i) + ",")
+                 + std::to_string(i) + "," + std::to_string(i * 0.5) + "\n";
+        }
+
+        std::vector<ns::Person> sequential;
+        BOOST_HANA_RUNTIME_CHECK(parse(csv, sequential) != nullptr);
+        BOOST_HANA_RUNTIME_CHECK(sequential.size() == 10000);
+
+        for (std::size_t chunks : {0, 2, 7, 64, 100000}) {
+            std::vector<ns::Person> parallel;
+            BOOST_HANA_RUNTIME_CHECK(parse(csv, parallel, csv_options{',', chunks}) != nullptr);
+            BOOST_HANA_RUNTIME_CHECK(parallel.size() == 10000);
+            for (std::size_t i = 0; i != parallel.size(); ++i) {
+                BOOST_HANA_RUNTIME_CHECK(parallel[i].name == sequential[i].name);
+                BOOST_HANA_RUNTIME_CHECK(parallel[i].age == static_cast<int>(i));
+                BOOST_HANA_RUNTIME_CHECK(parallel[i].height == sequential[i].height);
+            }
+        }
+
+        soa_vector<ns::Person> soa;
+        BOOST_HANA_RUNTIME_CHECK(parse(csv, soa, csv_options{',', 4}) != nullptr);
+        BOOST_HANA_RUNTIME_CHECK(soa.size() == 10000);
+        BOOST_HANA_RUNTIME_CHECK(soa.column(BOOST_HANA_STRING("age"))[1234] == 1234);
+
+        // errors are detected in parallel too
+        std::vector<ns::Person> out;
+        csv += "John,notanumber,1\n";
+        BOOST_HANA_RUNTIME_CHECK(parse(csv, out, csv_options{',', 4}) == nullptr);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // read_csv
+    //////////////////////////////////////////////////////////////////////////
+    {
+        char const* path = "csv.read_csv.test";
+        {
+            std::ofstream out{path, std::ios::binary};
+            out << "name,age\nJohn,30\nJane,25\n";
+        }
+        std::vector<ns::Person> people;
+        BOOST_HANA_RUNTIME_CHECK(read_csv(path, people));
+        BOOST_HANA_RUNTIME_CHECK(people.size() == 2 && people[1].age == 25);
+
+        BOOST_HANA_RUNTIME_CHECK(!read_csv("csv.does_not_exist.test", people));
+
+        {
+            std::ofstream out{path, std::ios::binary};
+        }
+        people.clear();
+        BOOST_HANA_RUNTIME_CHECK(read_csv(path, people));
+        BOOST_HANA_RUNTIME_CHECK(people.empty());
+        std::remove(path);
+    }
+}
@@ -0,0 +1,23 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/detail/fast_and.hpp>
+using namespace boost::hana;
+
+
+static_assert(detail::fast_and<>::value, "");
+static_assert(detail::fast_and<true>::value, "");
+static_assert(!detail::fast_and<false>::value, "");
+
+static_assert(detail::fast_and<true, true>::value, "");
+static_assert(!detail::fast_and<true, false>::value, "");
+static_assert(!detail::fast_and<false, true>::value, "");
+static_assert(!detail::fast_and<false, false>::value, "");
+
+static_assert(detail::fast_and<true, true, true, true>::value, "");
+static_assert(!detail::fast_and<true, true, false, true>::value, "");
+
+int main() { }
@@ -0,0 +1,96 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/detail/key_dispatch.hpp>
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/string.hpp>
+
+#include <cstddef>
+#include <string>
+#include <utility>
+using namespace boost::hana;
+
+
+template <std::size_t i>
+using key = _string<'k', 'e', 'y', '_', char('0' + i / 10), char('0' + i % 10)>;
+
+template <std::size_t ...i>
+void check_many(std::index_sequence<i...>) {
+    using Dispatch = detail::key_dispatch<key<i>...>;
+    static_assert(Dispatch::size == sizeof...(i), "");
+    static_assert(Dispatch::max_length == 6, "");
+
+    for (std::size_t k = 0; k != sizeof...(i); ++k) {
+        std::string name = "key_";
+        name += char('0' + k / 10);
+        name += char('0' + k % 10);
+        BOOST_HANA_RUNTIME_CHECK(Dispatch::find(name.data(), name.size()) == k);
+
+        name += 'x';
+        BOOST_HANA_RUNTIME_CHECK(Dispatch::find(name.data(), name.size()) == Dispatch::size);
+        BOOST_HANA_RUNTIME_CHECK(Dispatch::find(name.data(), 5) == Dispatch::size);
+    }
+}
+
+int main() {
+    // no keys
+    {
+        using Dispatch = detail::key_dispatch<>;
+        static_assert(Dispatch::size == 0, "");
+        static_assert(Dispatch::max_length == 0, "");
+        BOOST_HANA_RUNTIME_CHECK(Dispatch::find("", 0) == 0);
+        BOOST_HANA_RUNTIME_CHECK(Dispatch::find("a", 1) == 0);
+    }
+
+    // keys sharing their length or their characters
+    {
+        using Dispatch = detail::key_dispatch<
+            _string<'a'>, _string<'a', 'b'>, _string<'b', 'a'>, _string<>,
+            _string<'a', 'b', 'c'>
+        >;
+        static_assert(Dispatch::size == 5, "");
+        static_assert(Dispatch::max_length == 3, "");
+        BOOST_HANA_RUNTIME_CHECK(Dispatch::find("a", 1) == 0);
+        BOOST_HANA_RUNTIME_CHECK(Dispatch::find("ab", 2) == 1);
+        BOOST_HANA_RUNTIME_CHECK(Dispatch::find("ba", 2) == 2);
+        BOOST_HANA_RUNTIME_CHECK(Dispatch::find("", 0) == 3);
+        BOOST_HANA_RUNTIME_CHECK(Dispatch::find("abc", 3) == 4);
+
+        BOOST_HANA_RUNTIME_CHECK(Dispatch::find("b", 1) == 5);
+        BOOST_HANA_RUNTIME_CHECK(Dispatch::find("aa", 2) == 5);
+        BOOST_HANA_RUNTIME_CHECK(Dispatch::find("abcd", 4) == 5);
+        BOOST_HANA_RUNTIME_CHECK(Dispatch::find("abcd", 3) == 4);
+    }
+
+    // keys longer than 16 characters differing only in the middle
+    {
+        auto k0 = BOOST_HANA_STRING("0123456789abcdefghij");
+        auto k1 = BOOST_HANA_STRING("01234567x9abcdefghij");
+        auto k2 = BOOST_HANA_STRING("0123456789abcdefghi");
+        auto k3 = BOOST_HANA_STRING("01234567");
+        using Dispatch = detail::key_dispatch<
+            decltype(k0), decltype(k1), decltype(k2), decltype(k3)
+        >;
+        static_assert(Dispatch::max_length == 20, "");
+        BOOST_HANA_RUNTIME_CHECK(Dispatch::find("0123456789abcdefghij", 20) == 0);
+        BOOST_HANA_RUNTIME_CHECK(Dispatch::find("01234567x9abcdefghij", 20) == 1);
+        BOOST_HANA_RUNTIME_CHECK(Dispatch::find("0123456789abcdefghi", 19) == 2);
+        BOOST_HANA_RUNTIME_CHECK(Dispatch::find("01234567", 8) == 3);
+
+        BOOST_HANA_RUNTIME_CHECK(Dispatch::find("0123456789abcdefghix", 20) == 4);
+        BOOST_HANA_RUNTIME_CHECK(Dispatch::find("012345678yabcdefghij", 20) == 4);
+        BOOST_HANA_RUNTIME_CHECK(Dispatch::find("x1234567", 8) == 4);
+    }
+
+    // many keys
+    {
+        check_many(std::make_index_sequence<1>{});
+        check_many(std::make_index_sequence<10>{});
+        check_many(std::make_index_sequence<100>{});
+        check_many(std::make_index_sequence<256>{});
+    }
+}
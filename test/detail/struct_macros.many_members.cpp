@@ -0,0 +1,225 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/struct.hpp>
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/core/models.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/string.hpp>
+
+#include <string>
+using namespace boost::hana;
+
+
+// The macros support up to 256 members.
+namespace ns {
+    struct Defined {
+        BOOST_HANA_DEFINE_STRUCT(Defined,
+            (int, m1), (int, m2), (int, m3), (int, m4), (int, m5), (int, m6),
+            (int, m7), (int, m8), (int, m9), (int, m10), (int, m11), (int, m12),
+            (int, m13), (int, m14), (int, m15), (int, m16), (int, m17), (int, m18),
+            (int, m19), (int, m20), (int, m21), (int, m22), (int, m23), (int, m24),
+            (int, m25), (int, m26), (int, m27), (int, m28), (int, m29), (int, m30),
+            (int, m31), (int, m32), (int, m33), (int, m34), (int, m35), (int, m36),
+            (int, m37), (int, m38), (int, m39), (int, m40), (int, m41), (int, m42),
+            (int, m43), (int, m44), (int, m45), (int, m46), (int, m47), (int, m48),
+            (int, m49), (int, m50), (int, m51), (int, m52), (int, m53), (int, m54),
+            (int, m55), (int, m56), (int, m57), (int, m58), (int, m59), (int, m60),
+            (int, m61), (int, m62), (int, m63), (int, m64), (int, m65), (int, m66),
+            (int, m67), (int, m68), (int, m69), (int, m70), (int, m71), (int, m72),
+            (int, m73), (int, m74), (int, m75), (int, m76), (int, m77), (int, m78),
+            (int, m79), (int, m80), (int, m81), (int, m82), (int, m83), (int, m84),
+            (int, m85), (int, m86), (int, m87), (int, m88), (int, m89), (int, m90),
+            (int, m91), (int, m92), (int, m93), (int, m94), (int, m95), (int, m96),
+            (int, m97), (int, m98), (int, m99), (int, m100), (int, m101), (int, m102),
+            (int, m103), (int, m104), (int, m105), (int, m106), (int, m107), (int, m108),
+            (int, m109), (int, m110), (int, m111), (int, m112), (int, m113), (int, m114),
+            (int, m115), (int, m116), (int, m117), (int, m118), (int, m119), (int, m120),
+            (int, m121), (int, m122), (int, m123), (int, m124), (int, m125), (int, m126),
+            (int, m127), (int, m128), (int, m129), (int, m130), (int, m131), (int, m132),
+            (int, m133), (int, m134), (int, m135), (int, m136), (int, m137), (int, m138),
+            (int, m139), (int, m140), (int, m141), (int, m142), (int, m143), (int, m144),
+            (int, m145), (int, m146), (int, m147), (int, m148), (int, m149), (int, m150),
+            (int, m151), (int, m152), (int, m153), (int, m154), (int, m155), (int, m156),
+            (int, m157), (int, m158), (int, m159), (int, m160), (int, m161), (int, m162),
+            (int, m163), (int, m164), (int, m165), (int, m166), (int, m167), (int, m168),
+            (int, m169), (int, m170), (int, m171), (int, m172), (int, m173), (int, m174),
+            (int, m175), (int, m176), (int, m177), (int, m178), (int, m179), (int, m180),
+            (int, m181), (int, m182), (int, m183), (int, m184), (int, m185), (int, m186),
+            (int, m187), (int, m188), (int, m189), (int, m190), (int, m191), (int, m192),
+            (int, m193), (int, m194), (int, m195), (int, m196), (int, m197), (int, m198),
+            (int, m199), (int, m200), (int, m201), (int, m202), (int, m203), (int, m204),
+            (int, m205), (int, m206), (int, m207), (int, m208), (int, m209), (int, m210),
+            (int, m211), (int, m212), (int, m213), (int, m214), (int, m215), (int, m216),
+            (int, m217), (int, m218), (int, m219), (int, m220), (int, m221), (int, m222),
+            (int, m223), (int, m224), (int, m225), (int, m226), (int, m227), (int, m228),
+            (int, m229), (int, m230), (int, m231), (int, m232), (int, m233), (int, m234),
+            (int, m235), (int, m236), (int, m237), (int, m238), (int, m239), (int, m240),
+            (int, m241), (int, m242), (int, m243), (int, m244), (int, m245), (int, m246),
+            (int, m247), (int, m248), (int, m249), (int, m250), (int, m251), (int, m252),
+            (int, m253), (int, m254), (int, m255), (int, m256)
+        );
+    };
+
+    struct Adapted {
+        int
+            m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12,
+            m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24,
+            m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36,
+            m37, m38, m39, m40, m41, m42, m43, m44, m45, m46, m47, m48,
+            m49, m50, m51, m52, m53, m54, m55, m56, m57, m58, m59, m60,
+            m61, m62, m63, m64, m65, m66, m67, m68, m69, m70, m71, m72,
+            m73, m74, m75, m76, m77, m78, m79, m80, m81, m82, m83, m84,
+            m85, m86, m87, m88, m89, m90, m91, m92, m93, m94, m95, m96,
+            m97, m98, m99, m100, m101, m102, m103, m104, m105, m106, m107, m108,
+            m109, m110, m111, m112, m113, m114, m115, m116, m117, m118, m119, m120,
+            m121, m122, m123, m124, m125, m126, m127, m128, m129, m130, m131, m132,
+            m133, m134, m135, m136, m137, m138, m139, m140, m141, m142, m143, m144,
+            m145, m146, m147, m148, m149, m150, m151, m152, m153, m154, m155, m156,
+            m157, m158, m159, m160, m161, m162, m163, m164, m165, m166, m167, m168,
+            m169, m170, m171, m172, m173, m174, m175, m176, m177, m178, m179, m180,
+            m181, m182, m183, m184, m185, m186, m187, m188, m189, m190, m191, m192,
+            m193, m194, m195, m196, m197, m198, m199, m200, m201, m202, m203, m204,
+            m205, m206, m207, m208, m209, m210, m211, m212, m213, m214, m215, m216,
+            m217, m218, m219, m220, m221, m222, m223, m224, m225, m226, m227, m228,
+            m229, m230, m231, m232, m233, m234, m235, m236, m237, m238, m239, m240,
+            m241, m242, m243, m244, m245, m246, m247, m248, m249, m250, m251, m252,
+            m253, m254, m255, m256;
+    };
+
+    // 255 members are expanded in blocks of 128, 64, ..., 2 and 1 members.
+    struct Partial : Adapted { };
+}
+
+BOOST_HANA_ADAPT_STRUCT(ns::Adapted,
+    (int, m1), (int, m2), (int, m3), (int, m4), (int, m5), (int, m6),
+    (int, m7), (int, m8), (int, m9), (int, m10), (int, m11), (int, m12),
+    (int, m13), (int, m14), (int, m15), (int, m16), (int, m17), (int, m18),
+    (int, m19), (int, m20), (int, m21), (int, m22), (int, m23), (int, m24),
+    (int, m25), (int, m26), (int, m27), (int, m28), (int, m29), (int, m30),
+    (int, m31), (int, m32), (int, m33), (int, m34), (int, m35), (int, m36),
+    (int, m37), (int, m38), (int, m39), (int, m40), (int, m41), (int, m42),
+    (int, m43), (int, m44), (int, m45), (int, m46), (int, m47), (int, m48),
+    (int, m49), (int, m50), (int, m51), (int, m52), (int, m53), (int, m54),
+    (int, m55), (int, m56), (int, m57), (int, m58), (int, m59), (int, m60),
+    (int, m61), (int, m62), (int, m63), (int, m64), (int, m65), (int, m66),
+    (int, m67), (int, m68), (int, m69), (int, m70), (int, m71), (int, m72),
+    (int, m73), (int, m74), (int, m75), (int, m76), (int, m77), (int, m78),
+    (int, m79), (int, m80), (int, m81), (int, m82), (int, m83), (int, m84),
+    (int, m85), (int, m86), (int, m87), (int, m88), (int, m89), (int, m90),
+    (int, m91), (int, m92), (int, m93), (int, m94), (int, m95), (int, m96),
+    (int, m97), (int, m98), (int, m99), (int, m100), (int, m101), (int, m102),
+    (int, m103), (int, m104), (int, m105), (int, m106), (int, m107), (int, m108),
+    (int, m109), (int, m110), (int, m111), (int, m112), (int, m113), (int, m114),
+    (int, m115), (int, m116), (int, m117), (int, m118), (int, m119), (int, m120),
+    (int, m121), (int, m122), (int, m123), (int, m124), (int, m125), (int, m126),
+    (int, m127), (int, m128), (int, m129), (int, m130), (int, m131), (int, m132),
+    (int, m133), (int, m134), (int, m135), (int, m136), (int, m137), (int, m138),
+    (int, m139), (int, m140), (int, m141), (int, m142), (int, m143), (int, m144),
+    (int, m145), (int, m146), (int, m147), (int, m148), (int, m149), (int, m150),
+    (int, m151), (int, m152), (int, m153), (int, m154), (int, m155), (int, m156),
+    (int, m157), (int, m158), (int, m159), (int, m160), (int, m161), (int, m162),
+    (int, m163), (int, m164), (int, m165), (int, m166), (int, m167), (int, m168),
+    (int, m169), (int, m170), (int, m171), (int, m172), (int, m173), (int, m174),
+    (int, m175), (int, m176), (int, m177), (int, m178), (int, m179), (int, m180),
+    (int, m181), (int, m182), (int, m183), (int, m184), (int, m185), (int, m186),
+    (int, m187), (int, m188), (int, m189), (int, m190), (int, m191), (int, m192),
+    (int, m193), (int, m194), (int, m195), (int, m196), (int, m197), (int, m198),
+    (int, m199), (int, m200), (int, m201), (int, m202), (int, m203), (int, m204),
+    (int, m205), (int, m206), (int, m207), (int, m208), (int, m209), (int, m210),
+    (int, m211), (int, m212), (int, m213), (int, m214), (int, m215), (int, m216),
+    (int, m217), (int, m218), (int, m219), (int, m220), (int, m221), (int, m222),
+    (int, m223), (int, m224), (int, m225), (int, m226), (int, m227), (int, m228),
+    (int, m229), (int, m230), (int, m231), (int, m232), (int, m233), (int, m234),
+    (int, m235), (int, m236), (int, m237), (int, m238), (int, m239), (int, m240),
+    (int, m241), (int, m242), (int, m243), (int, m244), (int, m245), (int, m246),
+    (int, m247), (int, m248), (int, m249), (int, m250), (int, m251), (int, m252),
+    (int, m253), (int, m254), (int, m255), (int, m256)
+);
+
+BOOST_HANA_ADAPT_STRUCT(ns::Partial,
+    (int, m1), (int, m2), (int, m3), (int, m4), (int, m5), (int, m6),
+    (int, m7), (int, m8), (int, m9), (int, m10), (int, m11), (int, m12),
+    (int, m13), (int, m14), (int, m15), (int, m16), (int, m17), (int, m18),
+    (int, m19), (int, m20), (int, m21), (int, m22), (int, m23), (int, m24),
+    (int, m25), (int, m26), (int, m27), (int, m28), (int, m29), (int, m30),
+    (int, m31), (int, m32), (int, m33), (int, m34), (int, m35), (int, m36),
+    (int, m37), (int, m38), (int, m39), (int, m40), (int, m41), (int, m42),
+    (int, m43), (int, m44), (int, m45), (int, m46), (int, m47), (int, m48),
+    (int, m49), (int, m50), (int, m51), (int, m52), (int, m53), (int, m54),
+    (int, m55), (int, m56), (int, m57), (int, m58), (int, m59), (int, m60),
+    (int, m61), (int, m62), (int, m63), (int, m64), (int, m65), (int, m66),
+    (int, m67), (int, m68), (int, m69), (int, m70), (int, m71), (int, m72),
+    (int, m73), (int, m74), (int, m75), (int, m76), (int, m77), (int, m78),
+    (int, m79), (int, m80), (int, m81), (int, m82), (int, m83), (int, m84),
+    (int, m85), (int, m86), (int, m87), (int, m88), (int, m89), (int, m90),
+    (int, m91), (int, m92), (int, m93), (int, m94), (int, m95), (int, m96),
+    (int, m97), (int, m98), (int, m99), (int, m100), (int, m101), (int, m102),
+    (int, m103), (int, m104), (int, m105), (int, m106), (int, m107), (int, m108),
+    (int, m109), (int, m110), (int, m111), (int, m112), (int, m113), (int, m114),
+    (int, m115), (int, m116), (int, m117), (int, m118), (int, m119), (int, m120),
+    (int, m121), (int, m122), (int, m123), (int, m124), (int, m125), (int, m126),
+    (int, m127), (int, m128), (int, m129), (int, m130), (int, m131), (int, m132),
+    (int, m133), (int, m134), (int, m135), (int, m136), (int, m137), (int, m138),
+    (int, m139), (int, m140), (int, m141), (int, m142), (int, m143), (int, m144),
+    (int, m145), (int, m146), (int, m147), (int, m148), (int, m149), (int, m150),
+    (int, m151), (int, m152), (int, m153), (int, m154), (int, m155), (int, m156),
+    (int, m157), (int, m158), (int, m159), (int, m160), (int, m161), (int, m162),
+    (int, m163), (int, m164), (int, m165), (int, m166), (int, m167), (int, m168),
+    (int, m169), (int, m170), (int, m171), (int, m172), (int, m173), (int, m174),
+    (int, m175), (int, m176), (int, m177), (int, m178), (int, m179), (int, m180),
+    (int, m181), (int, m182), (int, m183), (int, m184), (int, m185), (int, m186),
+    (int, m187), (int, m188), (int, m189), (int, m190), (int, m191), (int, m192),
+    (int, m193), (int, m194), (int, m195), (int, m196), (int, m197), (int, m198),
+    (int, m199), (int, m200), (int, m201), (int, m202), (int, m203), (int, m204),
+    (int, m205), (int, m206), (int, m207), (int, m208), (int, m209), (int, m210),
+    (int, m211), (int, m212), (int, m213), (int, m214), (int, m215), (int, m216),
+    (int, m217), (int, m218), (int, m219), (int, m220), (int, m221), (int, m222),
+    (int, m223), (int, m224), (int, m225), (int, m226), (int, m227), (int, m228),
+    (int, m229), (int, m230), (int, m231), (int, m232), (int, m233), (int, m234),
+    (int, m235), (int, m236), (int, m237), (int, m238), (int, m239), (int, m240),
+    (int, m241), (int, m242), (int, m243), (int, m244), (int, m245), (int, m246),
+    (int, m247), (int, m248), (int, m249), (int, m250), (int, m251), (int, m252),
+    (int, m253), (int, m254), (int, m255)
+);
+
+static_assert(_models<Struct, ns::Defined>{}, "");
+static_assert(_models<Struct, ns::Adapted>{}, "");
+
+template <typename S>
+void check() {
+    S s{};
+    s.m1 = 1;
+    s.m128 = 128;
+    s.m256 = 256;
+
+    BOOST_HANA_CONSTANT_CHECK(length(accessors<S>()) == boost::hana::size_t<256>);
+    BOOST_HANA_CONSTANT_CHECK(first(at_c<0>(accessors<S>())) == BOOST_HANA_STRING("m1"));
+    BOOST_HANA_CONSTANT_CHECK(first(at_c<255>(accessors<S>())) == BOOST_HANA_STRING("m256"));
+
+    BOOST_HANA_RUNTIME_CHECK(at_key(s, BOOST_HANA_STRING("m1")) == 1);
+    BOOST_HANA_RUNTIME_CHECK(at_key(s, BOOST_HANA_STRING("m128")) == 128);
+    BOOST_HANA_RUNTIME_CHECK(at_key(s, BOOST_HANA_STRING("m256")) == 256);
+    BOOST_HANA_RUNTIME_CHECK(second(at_c<127>(accessors<S>()))(s) == 128);
+}
+
+int main() {
+    check<ns::Defined>();
+    check<ns::Adapted>();
+
+    // every member gets the right name and the right index
+    ns::Partial p{};
+    int i = 0;
+    for_each(accessors<ns::Partial>(), [&](auto accessor) {
+        ++i;
+        second(accessor)(p) = i;
+        BOOST_HANA_RUNTIME_CHECK(to<char const*>(first(accessor)) == "m" + std::to_string(i));
+    });
+    BOOST_HANA_RUNTIME_CHECK(i == 255);
+    BOOST_HANA_RUNTIME_CHECK(p.m1 == 1 && p.m128 == 128 && p.m255 == 255 && p.m256 == 0);
+}
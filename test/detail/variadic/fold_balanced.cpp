@@ -0,0 +1,81 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/detail/variadic/fold_balanced.hpp>
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/monoid.hpp>
+
+#include <laws/base.hpp>
+
+#include <string>
+using namespace boost::hana;
+
+
+struct undefined { };
+
+template <int i>
+using x = test::ct_eq<i>;
+
+int main() {
+    using detail::variadic::fold_balanced;
+    test::_injection<0> f{};
+
+    BOOST_HANA_CONSTANT_CHECK(equal(
+        fold_balanced(undefined{}, x<1>{}),
+        x<1>{}
+    ));
+
+    BOOST_HANA_CONSTANT_CHECK(equal(
+        fold_balanced(f, x<1>{}, x<2>{}),
+        f(x<1>{}, x<2>{})
+    ));
+
+    BOOST_HANA_CONSTANT_CHECK(equal(
+        fold_balanced(f, x<1>{}, x<2>{}, x<3>{}),
+        f(x<1>{}, f(x<2>{}, x<3>{}))
+    ));
+
+    BOOST_HANA_CONSTANT_CHECK(equal(
+        fold_balanced(f, x<1>{}, x<2>{}, x<3>{}, x<4>{}),
+        f(f(x<1>{}, x<2>{}), f(x<3>{}, x<4>{}))
+    ));
+
+    BOOST_HANA_CONSTANT_CHECK(equal(
+        fold_balanced(f, x<1>{}, x<2>{}, x<3>{}, x<4>{}, x<5>{}),
+        f(f(x<1>{}, x<2>{}), f(x<3>{}, f(x<4>{}, x<5>{})))
+    ));
+
+    BOOST_HANA_CONSTANT_CHECK(equal(
+        fold_balanced(f, x<1>{}, x<2>{}, x<3>{}, x<4>{}, x<5>{}, x<6>{}),
+        f(f(x<1>{}, f(x<2>{}, x<3>{})), f(x<4>{}, f(x<5>{}, x<6>{})))
+    ));
+
+    BOOST_HANA_CONSTANT_CHECK(equal(
+        fold_balanced(f, x<1>{}, x<2>{}, x<3>{}, x<4>{},
+                         x<5>{}, x<6>{}, x<7>{}, x<8>{}),
+        f(f(f(x<1>{}, x<2>{}), f(x<3>{}, x<4>{})),
+          f(f(x<5>{}, x<6>{}), f(x<7>{}, x<8>{})))
+    ));
+
+    // make sure we can fold runtime values, including lvalues and
+    // non-trivial types
+    {
+        BOOST_HANA_CONSTEXPR_CHECK(
+            fold_balanced(boost::hana::plus, 1, 2, 3, 4, 5) == 15
+        );
+
+        auto plus = [](auto x, auto y) { return x + y; };
+
+        int i = 1, j = 2;
+        BOOST_HANA_RUNTIME_CHECK(fold_balanced(plus, i, j, 3) == 6);
+
+        std::string a = "a";
+        BOOST_HANA_RUNTIME_CHECK(
+            fold_balanced(plus, a, std::string{"b"}, std::string{"c"}) == "abc"
+        );
+    }
+}
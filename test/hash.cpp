@@ -0,0 +1,239 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/hash.hpp>
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/struct.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+using namespace boost::hana;
+
+
+namespace ns {
+    enum class Color : std::uint8_t { red, green, blue };
+
+    struct Point {
+        BOOST_HANA_DEFINE_STRUCT(Point,
+            (int, x),
+            (int, y)
+        );
+    };
+
+    // Has padding between `c` and `i`.
+    struct Padded {
+        BOOST_HANA_DEFINE_STRUCT(Padded,
+            (char, c),
+            (int, i)
+        );
+    };
+
+    struct Person {
+        BOOST_HANA_DEFINE_STRUCT(Person,
+            (std::string, name),
+            (int, age),
+            (double, height)
+        );
+    };
+
+    struct Nested {
+        BOOST_HANA_DEFINE_STRUCT(Nested,
+            (Point, p),
+            (std::array<std::int16_t, 2>, a),
+            (Color, c1),
+            (Color, c2),
+            (std::int16_t, s)
+        );
+    };
+
+    struct Adapted {
+        std::uint64_t id;
+        std::uint64_t version;
+    };
+
+    // Only one of the members is a member of the Struct.
+    struct Partial {
+        int key;
+        int cache;
+    };
+}
+
+BOOST_HANA_ADAPT_STRUCT(ns::Adapted,
+    (std::uint64_t, id),
+    (std::uint64_t, version)
+);
+
+BOOST_HANA_ADAPT_STRUCT(ns::Partial,
+    (int, key)
+);
+
+BOOST_HANA_SPECIALIZE_STD_HASH(ns::Point)
+BOOST_HANA_SPECIALIZE_STD_HASH(ns::Padded)
+BOOST_HANA_SPECIALIZE_STD_HASH(ns::Person)
+BOOST_HANA_SPECIALIZE_STD_HASH(ns::Partial)
+
+template <typename T>
+constexpr bool has_unique = hash_detail::has_unique_representation<T>{}();
+
+// Checks that hash values are well spread, by counting the distinct
+// values of their lowest and highest bits.
+template <typename F>
+void check_spread(F make) {
+    std::set<std::size_t> low, high;
+    for (int i = 0; i != 256; ++i) {
+        std::size_t const h = hash(make(i));
+        low.insert(h & 0xFF);
+        high.insert(h >> (8 * sizeof(std::size_t) - 8));
+    }
+    BOOST_HANA_RUNTIME_CHECK(low.size() > 128);
+    BOOST_HANA_RUNTIME_CHECK(high.size() > 128);
+}
+
+
+int main() {
+    //////////////////////////////////////////////////////////////////////////
+    // has_unique_representation
+    //////////////////////////////////////////////////////////////////////////
+    {
+        static_assert(has_unique<int>, "");
+        static_assert(has_unique<char>, "");
+        static_assert(has_unique<ns::Color>, "");
+        static_assert(has_unique<int*>, "");
+        static_assert(!has_unique<double>, "");
+        static_assert(!has_unique<std::string>, "");
+
+        static_assert(has_unique<int[3]>, "");
+        static_assert(has_unique<std::array<short, 3>>, "");
+        static_assert(!has_unique<std::array<float, 3>>, "");
+
+        static_assert(has_unique<ns::Point>, "");
+        static_assert(has_unique<ns::Adapted>, "");
+        static_assert(has_unique<ns::Nested>, "");
+        static_assert(!has_unique<ns::Padded>, "");
+        static_assert(!has_unique<ns::Person>, "");
+        static_assert(!has_unique<ns::Partial>, "");
+
+        static_assert(has_unique<_tuple<int, int>>, "");
+        static_assert(has_unique<_pair<int, unsigned>>, "");
+        static_assert(!has_unique<_tuple<int, double>>, "");
+        static_assert(!has_unique<_tuple<std::string>>, "");
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // hash
+    //////////////////////////////////////////////////////////////////////////
+    {
+        // objects hashed with std::hash
+        BOOST_HANA_RUNTIME_CHECK(hash(42) == std::hash<int>{}(42));
+        BOOST_HANA_RUNTIME_CHECK(hash(std::string{"abc"}) == std::hash<std::string>{}("abc"));
+        BOOST_HANA_RUNTIME_CHECK(hash(0.0) == hash(-0.0));
+
+        // equal objects have equal hashes
+        BOOST_HANA_RUNTIME_CHECK(hash(ns::Point{1, 2}) == hash(ns::Point{1, 2}));
+        BOOST_HANA_RUNTIME_CHECK(hash(ns::Point{1, 2}) != hash(ns::Point{2, 1}));
+        BOOST_HANA_RUNTIME_CHECK(hash(ns::Person{"John", 30, 1.80}) ==
+                                 hash(ns::Person{"John", 30, 1.80}));
+        BOOST_HANA_RUNTIME_CHECK(hash(ns::Person{"John", 30, 0.0}) ==
+                                 hash(ns::Person{"John", 30, -0.0}));
+        BOOST_HANA_RUNTIME_CHECK(hash(ns::Person{"John", 30, 1.80}) !=
+                                 hash(ns::Person{"John", 31, 1.80}));
+
+        // padding does not affect the hash
+        ns::Padded p1, p2;
+        std::memset(&p1, 0x00, sizeof(p1));
+        std::memset(&p2, 0xFF, sizeof(p2));
+        p1.c = p2.c = 'x';
+        p1.i = p2.i = 3;
+        BOOST_HANA_RUNTIME_CHECK(hash(p1) == hash(p2));
+
+        // members which are not part of the Struct do not affect the hash
+        BOOST_HANA_RUNTIME_CHECK(hash(ns::Partial{1, 2}) == hash(ns::Partial{1, 3}));
+
+        ns::Nested const n{{1, 2}, {{3, 4}}, ns::Color::red, ns::Color::blue, 5};
+        ns::Nested m = n;
+        BOOST_HANA_RUNTIME_CHECK(hash(n) == hash(m));
+        m.c2 = ns::Color::green;
+        BOOST_HANA_RUNTIME_CHECK(hash(n) != hash(m));
+
+        // Sequences, Pairs and std::arrays
+        BOOST_HANA_RUNTIME_CHECK(hash(make_tuple(1, 2)) == hash(make_tuple(1, 2)));
+        BOOST_HANA_RUNTIME_CHECK(hash(make_tuple(1, 2)) != hash(make_tuple(2, 1)));
+        BOOST_HANA_RUNTIME_CHECK(hash(make_tuple(1, std::string{"a"}, 2.5)) ==
+                                 hash(make_tuple(1, std::string{"a"}, 2.5)));
+        BOOST_HANA_RUNTIME_CHECK(hash(make_tuple(1, std::string{"a"})) !=
+                                 hash(make_tuple(1, std::string{"b"})));
+        BOOST_HANA_RUNTIME_CHECK(hash(make_pair(std::string{"a"}, 1)) ==
+                                 hash(make_pair(std::string{"a"}, 1)));
+        BOOST_HANA_RUNTIME_CHECK(hash(make_pair(1, 2)) != hash(make_pair(2, 1)));
+        BOOST_HANA_RUNTIME_CHECK(hash(std::array<std::string, 2>{{"a", "b"}}) !=
+                                 hash(std::array<std::string, 2>{{"b", "a"}}));
+        hash(make_tuple());
+
+        // hash values are well spread, even for small and similar objects
+        check_spread([](int i) { return ns::Point{i, 0}; });
+        check_spread([](int i) { return ns::Point{0, i}; });
+        check_spread([](int i) { return make_tuple(i, std::string{"x"}); });
+        check_spread([](int i) { return ns::Person{"x", 0, i * 0.5}; });
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // std::hash and std::equal_to
+    //////////////////////////////////////////////////////////////////////////
+    {
+        BOOST_HANA_RUNTIME_CHECK(std::hash<ns::Point>{}(ns::Point{1, 2}) ==
+                                 hash(ns::Point{1, 2}));
+        BOOST_HANA_RUNTIME_CHECK(std::hash<_tuple<int, char>>{}(make_tuple(1, 'a')) ==
+                                 hash(make_tuple(1, 'a')));
+        BOOST_HANA_RUNTIME_CHECK(std::hash<_pair<int, char>>{}(make_pair(1, 'a')) ==
+                                 hash(make_pair(1, 'a')));
+
+        std::equal_to<ns::Point> point_eq;
+        BOOST_HANA_RUNTIME_CHECK(point_eq(ns::Point{1, 2}, ns::Point{1, 2}));
+        BOOST_HANA_RUNTIME_CHECK(!point_eq(ns::Point{1, 2}, ns::Point{1, 3}));
+
+        std::equal_to<ns::Padded> padded_eq;
+        BOOST_HANA_RUNTIME_CHECK(padded_eq(ns::Padded{'a', 1}, ns::Padded{'a', 1}));
+        BOOST_HANA_RUNTIME_CHECK(!padded_eq(ns::Padded{'a', 1}, ns::Padded{'b', 1}));
+
+        std::equal_to<ns::Partial> partial_eq;
+        BOOST_HANA_RUNTIME_CHECK(partial_eq(ns::Partial{1, 2}, ns::Partial{1, 3}));
+
+        std::unordered_map<ns::Point, std::string> names;
+        names[ns::Point{0, 0}] = "origin";
+        names[ns::Point{1, 0}] = "east";
+        names[ns::Point{0, 0}] = "center";
+        BOOST_HANA_RUNTIME_CHECK(names.size() == 2);
+        BOOST_HANA_RUNTIME_CHECK(names.at(ns::Point{0, 0}) == "center");
+
+        std::unordered_set<ns::Person> people{
+            {"John", 30, 1.80}, {"Jane", 30, 1.80}, {"John", 30, 1.80}
+        };
+        BOOST_HANA_RUNTIME_CHECK(people.size() == 2);
+        BOOST_HANA_RUNTIME_CHECK(people.count(ns::Person{"Jane", 30, 1.80}) == 1);
+
+        std::unordered_set<_tuple<int, std::string>> tuples{
+            make_tuple(1, std::string{"a"}), make_tuple(1, std::string{"a"}),
+            make_tuple(2, std::string{"a"})
+        };
+        BOOST_HANA_RUNTIME_CHECK(tuples.size() == 2);
+
+        std::unordered_set<_pair<int, int>> pairs{
+            make_pair(1, 2), make_pair(2, 1), make_pair(1, 2)
+        };
+        BOOST_HANA_RUNTIME_CHECK(pairs.size() == 2);
+    }
+}
@@ -0,0 +1,105 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_TEST_TEST_COUNTED_HPP
+#define BOOST_HANA_TEST_TEST_COUNTED_HPP
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/bool.hpp>
+
+
+namespace boost { namespace hana {
+    namespace test {
+        //! The number of copies and moves made by some code, which is
+        //! compared with the exact number of copies and moves the code is
+        //! allowed to make.
+        struct budget {
+            int copies;
+            int moves;
+
+            friend bool operator==(budget const& x, budget const& y)
+            { return x.copies == y.copies && x.moves == y.moves; }
+
+            friend bool operator!=(budget const& x, budget const& y)
+            { return !(x == y); }
+        };
+
+        struct counts {
+            int copies;
+            int moves;
+            int alive;
+
+            static counts& global() {
+                static counts c{0, 0, 0};
+                return c;
+            }
+        };
+
+        //! An element which counts how many times it is constructed, copied,
+        //! moved and destroyed. Assignments count as copies and moves too.
+        //!
+        //! The elements with the same `i` are equal, and the elements with
+        //! different `i`s are not, which is known at compile-time. Hence,
+        //! they can be used as the keys of a `Map` or as the elements of
+        //! a `Set`.
+        template <int i = 0>
+        struct counted {
+            int value;
+
+            explicit counted(int v = 0) : value{v}
+            { ++counts::global().alive; }
+
+            counted(counted const& other) : value{other.value} {
+                ++counts::global().copies;
+                ++counts::global().alive;
+            }
+
+            counted(counted&& other) : value{other.value} {
+                ++counts::global().moves;
+                ++counts::global().alive;
+            }
+
+            counted& operator=(counted const& other) {
+                value = other.value;
+                ++counts::global().copies;
+                return *this;
+            }
+
+            counted& operator=(counted&& other) {
+                value = other.value;
+                ++counts::global().moves;
+                return *this;
+            }
+
+            ~counted() { --counts::global().alive; }
+
+            template <int j>
+            friend constexpr auto operator==(counted const&, counted<j> const&)
+            { return bool_<i == j>; }
+
+            template <int j>
+            friend constexpr auto operator!=(counted const&, counted<j> const&)
+            { return bool_<i != j>; }
+        };
+
+        //! Calls `f()` and returns the number of copies and moves of
+        //! `counted` elements it made, which can be compared with a `budget`.
+        //! Every element created by `f()` must also be destroyed by it, or
+        //! the test fails.
+        template <typename F>
+        budget count_copies(F f) {
+            counts& global = counts::global();
+            int const alive = global.alive;
+            global.copies = global.moves = 0;
+            f();
+            BOOST_HANA_RUNTIME_CHECK(global.alive == alive &&
+                "some elements were leaked or destroyed twice");
+            return {global.copies, global.moves};
+        }
+    }
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_TEST_TEST_COUNTED_HPP
@@ -0,0 +1,381 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/json.hpp>
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/struct.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <vector>
+using namespace boost::hana;
+
+
+template <typename X>
+std::string json(X const& x) {
+    std::string s;
+    to_json(x, std::back_inserter(s));
+    return s;
+}
+
+// Reads the whole string into x, and returns whether it succeeded.
+template <typename X>
+bool read(std::string const& s, X& x) {
+    char const* end = from_json(s.data(), s.data() + s.size(), x);
+    return end == s.data() + s.size();
+}
+
+template <typename X>
+X parse(std::string const& s) {
+    X x{};
+    BOOST_HANA_RUNTIME_CHECK(read(s, x));
+    return x;
+}
+
+template <typename X>
+bool fails(std::string const& s) {
+    X x{};
+    // copy the input so that reading past its end can be caught by tools
+    std::vector<char> buffer(s.begin(), s.end());
+    return from_json(buffer.data(), buffer.data() + buffer.size(), x) == nullptr;
+}
+
+namespace ns {
+    struct Point {
+        BOOST_HANA_DEFINE_STRUCT(Point,
+            (int, x),
+            (int, y)
+        );
+    };
+
+    struct Empty {
+        BOOST_HANA_DEFINE_STRUCT(Empty);
+    };
+
+    struct Shape {
+        BOOST_HANA_DEFINE_STRUCT(Shape,
+            (std::string, name),
+            (std::vector<Point>, points),
+            (bool, closed),
+            (Empty, extra)
+        );
+    };
+
+    struct Reading {
+        BOOST_HANA_DEFINE_STRUCT(Reading,
+            (int, a),
+            (double, ab),
+            (std::string, ba),
+            (std::vector<Point>, abc),
+            (bool, b)
+        );
+    };
+
+    struct Adapted {
+        double weight;
+        char const* label;
+    };
+}
+
+BOOST_HANA_ADAPT_STRUCT(ns::Adapted,
+    (double, weight),
+    (char const*, label)
+);
+
+
+int main() {
+    //////////////////////////////////////////////////////////////////////////
+    // Numbers, bool and nullptr
+    //////////////////////////////////////////////////////////////////////////
+    {
+        BOOST_HANA_RUNTIME_CHECK(json(0) == "0");
+        BOOST_HANA_RUNTIME_CHECK(json(42) == "42");
+        BOOST_HANA_RUNTIME_CHECK(json(-42) == "-42");
+        BOOST_HANA_RUNTIME_CHECK(json(std::numeric_limits<std::int64_t>::min())
+                                    == "-9223372036854775808");
+        BOOST_HANA_RUNTIME_CHECK(json(std::numeric_limits<std::uint64_t>::max())
+                                    == "18446744073709551615");
+        BOOST_HANA_RUNTIME_CHECK(json(static_cast<unsigned char>(255)) == "255");
+
+        BOOST_HANA_RUNTIME_CHECK(json(1.5) == "1.5");
+        BOOST_HANA_RUNTIME_CHECK(json(-0.25f) == "-0.25");
+        BOOST_HANA_RUNTIME_CHECK(json(0.1) == "0.10000000000000001");
+        BOOST_HANA_RUNTIME_CHECK(std::stod(json(0.1)) == 0.1);
+        BOOST_HANA_RUNTIME_CHECK(json(std::numeric_limits<double>::infinity()) == "null");
+        BOOST_HANA_RUNTIME_CHECK(json(std::numeric_limits<double>::quiet_NaN()) == "null");
+
+        BOOST_HANA_RUNTIME_CHECK(json(true) == "true");
+        BOOST_HANA_RUNTIME_CHECK(json(false) == "false");
+        BOOST_HANA_RUNTIME_CHECK(json(nullptr) == "null");
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Strings
+    //////////////////////////////////////////////////////////////////////////
+    {
+        BOOST_HANA_RUNTIME_CHECK(json(std::string{}) == R"("")");
+        BOOST_HANA_RUNTIME_CHECK(json(std::string{"abc"}) == R"("abc")");
+        BOOST_HANA_RUNTIME_CHECK(json("abc") == R"("abc")");
+        BOOST_HANA_RUNTIME_CHECK(json('x') == R"("x")");
+        BOOST_HANA_RUNTIME_CHECK(json(BOOST_HANA_STRING("abc")) == R"("abc")");
+
+        BOOST_HANA_RUNTIME_CHECK(json(std::string{"a\"b\\c"}) == R"("a\"b\\c")");
+        BOOST_HANA_RUNTIME_CHECK(json(std::string{"\b\f\n\r\t"}) == R"("\b\f\n\r\t")");
+        BOOST_HANA_RUNTIME_CHECK(json(std::string{"\x01x\x1f"}) == R"("\u0001x\u001f")");
+        BOOST_HANA_RUNTIME_CHECK(json(std::string{"caf\xc3\xa9"}) == "\"caf\xc3\xa9\"");
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Sequences and ranges
+    //////////////////////////////////////////////////////////////////////////
+    {
+        BOOST_HANA_RUNTIME_CHECK(json(make<Tuple>()) == "[]");
+        BOOST_HANA_RUNTIME_CHECK(json(make<Tuple>(1)) == "[1]");
+        BOOST_HANA_RUNTIME_CHECK(json(make<Tuple>(1, "two", 3.5, make<Tuple>(true)))
+                                    == R"([1,"two",3.5,[true]])");
+
+        BOOST_HANA_RUNTIME_CHECK(json(std::vector<int>{}) == "[]");
+        BOOST_HANA_RUNTIME_CHECK(json(std::vector<int>{1, 2, 3}) == "[1,2,3]");
+        BOOST_HANA_RUNTIME_CHECK(
+            json(std::vector<std::vector<std::string>>{{"a"}, {}, {"b", "c"}})
+                == R"([["a"],[],["b","c"]])"
+        );
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Structs
+    //////////////////////////////////////////////////////////////////////////
+    {
+        BOOST_HANA_RUNTIME_CHECK(json(ns::Point{1, -2}) == R"({"x":1,"y":-2})");
+        BOOST_HANA_RUNTIME_CHECK(json(ns::Empty{}) == "{}");
+        BOOST_HANA_RUNTIME_CHECK(json(ns::Adapted{0.5, "kg"})
+                                    == R"({"weight":0.5,"label":"kg"})");
+
+        ns::Shape shape{"tri", {{0, 0}, {1, 0}, {0, 1}}, true, {}};
+        BOOST_HANA_RUNTIME_CHECK(json(shape) ==
+            R"({"name":"tri","points":[{"x":0,"y":0},{"x":1,"y":0},{"x":0,"y":1}],)"
+            R"("closed":true,"extra":{}})"
+        );
+
+        BOOST_HANA_RUNTIME_CHECK(json(make<Tuple>(ns::Point{1, 2}, ns::Empty{}))
+                                    == R"([{"x":1,"y":2},{}])");
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Writing to a buffer returns the end of the output
+    //////////////////////////////////////////////////////////////////////////
+    {
+        char buffer[64];
+        char* end = to_json(ns::Point{10, 20}, buffer);
+        BOOST_HANA_RUNTIME_CHECK(std::string(buffer, end) == R"({"x":10,"y":20})");
+
+        end = to_json(ns::Point{3, 4}, end);
+        BOOST_HANA_RUNTIME_CHECK(
+            std::string(buffer, end) == R"({"x":10,"y":20}{"x":3,"y":4})"
+        );
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // from_json: numbers, bool and nullptr
+    //////////////////////////////////////////////////////////////////////////
+    {
+        BOOST_HANA_RUNTIME_CHECK(parse<int>("0") == 0);
+        BOOST_HANA_RUNTIME_CHECK(parse<int>("-42") == -42);
+        BOOST_HANA_RUNTIME_CHECK(parse<int>(" \t\r\n42") == 42);
+        BOOST_HANA_RUNTIME_CHECK(parse<std::int64_t>("-9223372036854775808")
+                                    == std::numeric_limits<std::int64_t>::min());
+        BOOST_HANA_RUNTIME_CHECK(parse<std::uint64_t>("18446744073709551615")
+                                    == std::numeric_limits<std::uint64_t>::max());
+        BOOST_HANA_RUNTIME_CHECK(parse<unsigned char>("255") == 255);
+        BOOST_HANA_RUNTIME_CHECK(fails<unsigned char>("256"));
+        BOOST_HANA_RUNTIME_CHECK(fails<unsigned>("-1"));
+        BOOST_HANA_RUNTIME_CHECK(fails<std::int64_t>("9223372036854775808"));
+        BOOST_HANA_RUNTIME_CHECK(fails<std::uint64_t>("18446744073709551616"));
+        BOOST_HANA_RUNTIME_CHECK(fails<int>("1.5"));
+        BOOST_HANA_RUNTIME_CHECK(fails<int>("1e3"));
+        BOOST_HANA_RUNTIME_CHECK(fails<int>("01"));
+        BOOST_HANA_RUNTIME_CHECK(fails<int>("-"));
+        BOOST_HANA_RUNTIME_CHECK(fails<int>(""));
+
+        BOOST_HANA_RUNTIME_CHECK(parse<double>("1.5") == 1.5);
+        BOOST_HANA_RUNTIME_CHECK(parse<double>("-0.25") == -0.25);
+        BOOST_HANA_RUNTIME_CHECK(parse<double>("0.1") == 0.1);
+        BOOST_HANA_RUNTIME_CHECK(parse<double>("12345e-3") == 12.345);
+        BOOST_HANA_RUNTIME_CHECK(parse<double>("1E+2") == 100.0);
+        BOOST_HANA_RUNTIME_CHECK(parse<double>("0.10000000000000001") == 0.1);
+        BOOST_HANA_RUNTIME_CHECK(parse<double>("2.2250738585072014e-308")
+                                    == std::numeric_limits<double>::min());
+        BOOST_HANA_RUNTIME_CHECK(parse<double>("1.7976931348623157e308")
+                                    == std::numeric_limits<double>::max());
+        BOOST_HANA_RUNTIME_CHECK(parse<double>(
+            "3.14159265358979323846264338327950288419716939937510582097494459"
+        ) == 3.141592653589793);
+        BOOST_HANA_RUNTIME_CHECK(parse<float>("0.1") == 0.1f);
+        BOOST_HANA_RUNTIME_CHECK(parse<float>("16777217") == 16777216.0f);
+        BOOST_HANA_RUNTIME_CHECK(std::isnan(parse<double>("null")));
+        BOOST_HANA_RUNTIME_CHECK(fails<double>("1."));
+        BOOST_HANA_RUNTIME_CHECK(fails<double>(".5"));
+        BOOST_HANA_RUNTIME_CHECK(fails<double>("1e"));
+        BOOST_HANA_RUNTIME_CHECK(fails<double>("nul"));
+
+        for (double x : {0.0, 1.0, -2.5, 1e-300, 123456.789, 6.02214076e23,
+                         std::numeric_limits<double>::denorm_min()})
+            BOOST_HANA_RUNTIME_CHECK(parse<double>(json(x)) == x);
+
+        BOOST_HANA_RUNTIME_CHECK(parse<bool>("true") == true);
+        BOOST_HANA_RUNTIME_CHECK(parse<bool>("false") == false);
+        BOOST_HANA_RUNTIME_CHECK(fails<bool>("tru"));
+        BOOST_HANA_RUNTIME_CHECK(fails<bool>("1"));
+        BOOST_HANA_RUNTIME_CHECK(parse<std::nullptr_t>("null") == nullptr);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // from_json: strings
+    //////////////////////////////////////////////////////////////////////////
+    {
+        BOOST_HANA_RUNTIME_CHECK(parse<std::string>(R"("")") == "");
+        BOOST_HANA_RUNTIME_CHECK(parse<std::string>(R"("abc")") == "abc");
+        BOOST_HANA_RUNTIME_CHECK(parse<std::string>(R"("a\"b\\c\/")") == "a\"b\\c/");
+        BOOST_HANA_RUNTIME_CHECK(parse<std::string>(R"("\b\f\n\r\t")") == "\b\f\n\r\t");
+        BOOST_HANA_RUNTIME_CHECK(parse<std::string>(R"("\u0041\u00e9\u20AC")")
+                                    == "A\xc3\xa9\xe2\x82\xac");
+        BOOST_HANA_RUNTIME_CHECK(parse<std::string>(R"("\ud83d\ude00")")
+                                    == "\xf0\x9f\x98\x80");
+        BOOST_HANA_RUNTIME_CHECK(fails<std::string>(R"("\ud83d")"));
+        BOOST_HANA_RUNTIME_CHECK(fails<std::string>(R"("\ude00")"));
+        BOOST_HANA_RUNTIME_CHECK(fails<std::string>(R"("\x")"));
+        BOOST_HANA_RUNTIME_CHECK(fails<std::string>(R"("\u12")"));
+        BOOST_HANA_RUNTIME_CHECK(fails<std::string>(R"("abc)"));
+        BOOST_HANA_RUNTIME_CHECK(fails<std::string>(R"("abc\")"));
+        BOOST_HANA_RUNTIME_CHECK(fails<std::string>("\"a\nb\""));
+        BOOST_HANA_RUNTIME_CHECK(fails<std::string>("abc"));
+
+        std::string const tricky{"a\"b\\c\x01\x1f\n caf\xc3\xa9"};
+        BOOST_HANA_RUNTIME_CHECK(parse<std::string>(json(tricky)) == tricky);
+
+        BOOST_HANA_RUNTIME_CHECK(parse<char>(R"("x")") == 'x');
+        BOOST_HANA_RUNTIME_CHECK(parse<char>(R"("\n")") == '\n');
+        BOOST_HANA_RUNTIME_CHECK(fails<char>(R"("")"));
+        BOOST_HANA_RUNTIME_CHECK(fails<char>(R"("xy")"));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // from_json: Sequences and containers
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto xs = make<Tuple>(0, std::string{}, 0.0, make<Tuple>(false));
+        BOOST_HANA_RUNTIME_CHECK(read(R"([1, "two", 3.5, [true]])", xs));
+        BOOST_HANA_RUNTIME_CHECK(xs == make<Tuple>(1, std::string{"two"}, 3.5, make<Tuple>(true)));
+        BOOST_HANA_RUNTIME_CHECK(!read(R"([1, "two", 3.5])", xs));
+        BOOST_HANA_RUNTIME_CHECK(!read(R"([1, "two", 3.5, [true], 5])", xs));
+
+        auto empty = make<Tuple>();
+        BOOST_HANA_RUNTIME_CHECK(read("[ ]", empty));
+        BOOST_HANA_RUNTIME_CHECK(!read("[1]", empty));
+
+        BOOST_HANA_RUNTIME_CHECK(parse<std::vector<int>>("[]").empty());
+        BOOST_HANA_RUNTIME_CHECK(parse<std::vector<int>>("[1, 2 ,3]") == std::vector<int>{1, 2, 3});
+        BOOST_HANA_RUNTIME_CHECK(
+            parse<std::vector<std::vector<std::string>>>(R"([["a"],[],["b","c"]])")
+                == (std::vector<std::vector<std::string>>{{"a"}, {}, {"b", "c"}})
+        );
+        BOOST_HANA_RUNTIME_CHECK(fails<std::vector<int>>("[1,]"));
+        BOOST_HANA_RUNTIME_CHECK(fails<std::vector<int>>("[1 2]"));
+        BOOST_HANA_RUNTIME_CHECK(fails<std::vector<int>>("[1"));
+
+        // the container is cleared first
+        std::vector<int> v{7, 8, 9};
+        BOOST_HANA_RUNTIME_CHECK(read("[1]", v));
+        BOOST_HANA_RUNTIME_CHECK(v == std::vector<int>{1});
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // from_json: Structs
+    //////////////////////////////////////////////////////////////////////////
+    {
+        ns::Point p = parse<ns::Point>(R"({"x":1,"y":-2})");
+        BOOST_HANA_RUNTIME_CHECK(p.x == 1 && p.y == -2);
+
+        // any order, with whitespace
+        p = parse<ns::Point>(" {\n  \"y\" : 3 ,\n  \"x\" : 4\n}");
+        BOOST_HANA_RUNTIME_CHECK(p.x == 4 && p.y == 3);
+
+        // missing members are left untouched
+        ns::Point q{5, 6};
+        BOOST_HANA_RUNTIME_CHECK(read(R"({"y":7})", q));
+        BOOST_HANA_RUNTIME_CHECK(q.x == 5 && q.y == 7);
+        BOOST_HANA_RUNTIME_CHECK(read("{}", q));
+        BOOST_HANA_RUNTIME_CHECK(q.x == 5 && q.y == 7);
+
+        // unknown keys are skipped, whatever their value
+        BOOST_HANA_RUNTIME_CHECK(read(
+            R"({"z":{"a":[1,{"b":"}"}],"c":null},"x":8,"xx":true,"":-1.5e3,"y":9})", q
+        ));
+        BOOST_HANA_RUNTIME_CHECK(q.x == 8 && q.y == 9);
+
+        // escaped keys are decoded
+        BOOST_HANA_RUNTIME_CHECK(read(R"({"\u0078":10,"\u0079\u0079":11})", q));
+        BOOST_HANA_RUNTIME_CHECK(q.x == 10 && q.y == 9);
+
+        // keys sharing lengths and characters
+        ns::Reading r = parse<ns::Reading>(
+            R"({"ba":"ba","ab":2.5,"b":true,"abc":[{"x":1,"y":2}],"a":1})"
+        );
+        BOOST_HANA_RUNTIME_CHECK(r.a == 1 && r.ab == 2.5 && r.ba == "ba" && r.b);
+        BOOST_HANA_RUNTIME_CHECK(r.abc.size() == 1 && r.abc[0].x == 1 && r.abc[0].y == 2);
+
+        ns::Empty e;
+        BOOST_HANA_RUNTIME_CHECK(read(R"({"a":1})", e));
+        BOOST_HANA_RUNTIME_CHECK(fails<ns::Point>(R"({"x":1,})"));
+        BOOST_HANA_RUNTIME_CHECK(fails<ns::Point>(R"({"x" 1})"));
+        BOOST_HANA_RUNTIME_CHECK(fails<ns::Point>(R"({"x":"1"})"));
+        BOOST_HANA_RUNTIME_CHECK(fails<ns::Point>(R"({"x":1)"));
+        BOOST_HANA_RUNTIME_CHECK(fails<ns::Point>(R"({x:1})"));
+        BOOST_HANA_RUNTIME_CHECK(fails<ns::Point>(R"({"z":[1,2})"));
+
+        // the nesting of skipped values is limited, instead of the stack
+        std::string nested = std::string(256, '[') + std::string(256, ']');
+        BOOST_HANA_RUNTIME_CHECK(read(R"({"z":)" + nested + R"(,"x":12})", q));
+        BOOST_HANA_RUNTIME_CHECK(q.x == 12);
+        nested = std::string(257, '[') + std::string(257, ']');
+        BOOST_HANA_RUNTIME_CHECK(fails<ns::Point>(R"({"z":)" + nested + "}"));
+        BOOST_HANA_RUNTIME_CHECK(fails<ns::Point>(R"({"z":)" + std::string(1000000, '[')));
+        BOOST_HANA_RUNTIME_CHECK(fails<ns::Point>("[1, 2]"));
+
+        // round trip
+        ns::Shape shape{"tri\n", {{0, 0}, {1, 0}, {0, 1}}, true, {}};
+        ns::Shape copy = parse<ns::Shape>(json(shape));
+        BOOST_HANA_RUNTIME_CHECK(json(copy) == json(shape));
+
+        ns::Reading reading{-3, 1e-10, "x", {{1, 2}, {3, 4}}, false};
+        ns::Reading reading_copy = parse<ns::Reading>(json(reading));
+        BOOST_HANA_RUNTIME_CHECK(json(reading_copy) == json(reading));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // from_json: reading stops after the value
+    //////////////////////////////////////////////////////////////////////////
+    {
+        std::string const input = R"({"x":1,"y":2} {"x":3,"y":4})";
+        char const* first = input.data();
+        char const* const last = input.data() + input.size();
+
+        ns::Point p;
+        first = from_json(first, last, p);
+        BOOST_HANA_RUNTIME_CHECK(first == input.data() + 13);
+        BOOST_HANA_RUNTIME_CHECK(p.x == 1 && p.y == 2);
+        first = from_json(first, last, p);
+        BOOST_HANA_RUNTIME_CHECK(first == last);
+        BOOST_HANA_RUNTIME_CHECK(p.x == 3 && p.y == 4);
+    }
+}
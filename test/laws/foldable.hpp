@@ -251,6 +251,64 @@ namespace boost { namespace hana { namespace test {
                 f(x<1>{}, f(x<2>{}, f(x<3>{}, z)))
             ));
 
+            //////////////////////////////////////////////////////////////////
+            // fold_balanced (with initial state)
+            //////////////////////////////////////////////////////////////////
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                fold_balanced(list(), z, undefined{}),
+                z
+            ));
+
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                fold_balanced(list(x<1>{}), z, f),
+                f(z, x<1>{})
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                fold_balanced(list(x<1>{}, x<2>{}), z, f),
+                f(z, f(x<1>{}, x<2>{}))
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                fold_balanced(list(x<1>{}, x<2>{}, x<3>{}), z, f),
+                f(f(z, x<1>{}), f(x<2>{}, x<3>{}))
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                fold_balanced(list(x<1>{}, x<2>{}, x<3>{}, x<4>{}), z, f),
+                f(f(z, x<1>{}), f(x<2>{}, f(x<3>{}, x<4>{})))
+            ));
+
+            BOOST_HANA_CONSTEXPR_CHECK(equal(
+                fold_balanced(list(1), z, f),
+                f(z, 1)
+            ));
+            BOOST_HANA_CONSTEXPR_CHECK(equal(
+                fold_balanced(list(1, '2'), z, f),
+                f(z, f(1, '2'))
+            ));
+            BOOST_HANA_CONSTEXPR_CHECK(equal(
+                fold_balanced(list(1, '2', 3.3), z, f),
+                f(f(z, 1), f('2', 3.3))
+            ));
+
+            //////////////////////////////////////////////////////////////////
+            // fold_balanced (without initial state)
+            //////////////////////////////////////////////////////////////////
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                fold_balanced(list(z), undefined{}),
+                z
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                fold_balanced(list(z, x<2>{}), f),
+                f(z, x<2>{})
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                fold_balanced(list(z, x<2>{}, x<3>{}), f),
+                f(z, f(x<2>{}, x<3>{}))
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                fold_balanced(list(z, x<2>{}, x<3>{}, x<4>{}), f),
+                f(f(z, x<2>{}), f(x<3>{}, x<4>{}))
+            ));
+
             //////////////////////////////////////////////////////////////////
             // monadic_fold_left (with initial state)
             //////////////////////////////////////////////////////////////////
@@ -0,0 +1,156 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/parallel.hpp>
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/functional/overload.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/range.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+using namespace boost::hana;
+
+
+struct counter {
+    std::atomic<int> calls{0};
+    counter() = default;
+    counter(counter const&) = delete;
+};
+
+struct move_only {
+    int value;
+    explicit move_only(int v) : value{v} { }
+    move_only(move_only&&) = default;
+    move_only(move_only const&) = delete;
+};
+
+int main() {
+    // parallel_for_each
+    {
+        // empty structure
+        parallel_for_each(make_tuple(), [](auto) {
+            BOOST_HANA_RUNTIME_CHECK(false);
+        });
+
+        // each element is visited exactly once, and without copies
+        for (std::size_t grain : {0, 1, 2, 3, 100}) {
+            counter a, b, c, d, e;
+            auto xs = make_tuple(&a, &b, &c, &d, &e);
+            parallel_for_each(xs, [](auto* c) { ++c->calls; }, grain);
+            BOOST_HANA_RUNTIME_CHECK(a.calls == 1 && b.calls == 1 &&
+                                     c.calls == 1 && d.calls == 1 &&
+                                     e.calls == 1);
+
+            counter& ra = a;
+            parallel_for_each(make_tuple(std::ref(ra), std::ref(b)),
+                [](auto c) { ++c.get().calls; }, grain);
+            BOOST_HANA_RUNTIME_CHECK(a.calls == 2 && b.calls == 2);
+        }
+
+        // heterogeneous elements are passed as-is
+        {
+            auto xs = make_tuple(1, std::string{"abc"}, 2.5);
+            std::atomic<int> ints{0}, strings{0}, doubles{0};
+            parallel_for_each(xs, overload(
+                [&](int const&) { ++ints; },
+                [&](std::string const&) { ++strings; },
+                [&](double const&) { ++doubles; }
+            ));
+            BOOST_HANA_RUNTIME_CHECK(ints == 1 && strings == 1 && doubles == 1);
+        }
+
+        // works on any Foldable
+        {
+            std::atomic<int> sum{0};
+            parallel_for_each(make_range(int_<0>, int_<10>), [&](auto i) {
+                sum += i;
+            });
+            BOOST_HANA_RUNTIME_CHECK(sum == 45);
+        }
+
+        // a lot of elements, and nested calls
+        {
+            std::atomic<int> sum{0};
+            auto xs = to<Tuple>(make_range(int_<0>, int_<40>));
+            parallel_for_each(xs, [&](auto i) {
+                parallel_for_each(make_tuple(i, i), [&](auto j) { sum += j; });
+            });
+            BOOST_HANA_RUNTIME_CHECK(sum == 2 * 780);
+        }
+
+        // exceptions are propagated to the caller
+        {
+            std::atomic<int> calls{0};
+            bool thrown = false;
+            try {
+                parallel_for_each(make_tuple(1, 2, 3, 4), [&](int i) {
+                    ++calls;
+                    if (i == 3)
+                        throw std::runtime_error{"3"};
+                });
+            } catch (std::runtime_error const& e) {
+                thrown = std::string{e.what()} == "3";
+            }
+            BOOST_HANA_RUNTIME_CHECK(thrown);
+            BOOST_HANA_RUNTIME_CHECK(calls == 4);
+        }
+    }
+
+    // parallel_transform
+    {
+        BOOST_HANA_CONSTANT_CHECK(
+            parallel_transform(make_tuple(), [](auto x) { return x; })
+                ==
+            make_tuple()
+        );
+
+        // results are returned in order
+        for (std::size_t grain : {1, 2, 5}) {
+            auto result = parallel_transform(make_tuple(1, '2', 3.5, std::string{"4"}),
+                [](auto x) { return make_tuple(x); }, grain);
+            BOOST_HANA_RUNTIME_CHECK(result == make_tuple(
+                make_tuple(1), make_tuple('2'), make_tuple(3.5),
+                make_tuple(std::string{"4"})
+            ));
+        }
+
+        // results don't need to be copyable or default-constructible
+        {
+            auto result = parallel_transform(make_tuple(1, 2, 3), [](int i) {
+                return move_only{i * 10};
+            });
+            static_assert(std::is_same<
+                decltype(result), _tuple<move_only, move_only, move_only>
+            >{}, "");
+            BOOST_HANA_RUNTIME_CHECK(at_c<0>(result).value == 10);
+            BOOST_HANA_RUNTIME_CHECK(at_c<1>(result).value == 20);
+            BOOST_HANA_RUNTIME_CHECK(at_c<2>(result).value == 30);
+        }
+
+        // the results computed so far are destroyed when a call throws
+        {
+            auto alive = std::make_shared<int>(0);
+            bool thrown = false;
+            try {
+                parallel_transform(make_tuple(1, 2, 3, 4), [&](int i) {
+                    if (i == 2)
+                        throw std::runtime_error{"2"};
+                    return alive;
+                });
+            } catch (std::runtime_error const&) {
+                thrown = true;
+            }
+            BOOST_HANA_RUNTIME_CHECK(thrown);
+            BOOST_HANA_RUNTIME_CHECK(alive.use_count() == 1);
+        }
+    }
+}
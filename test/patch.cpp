@@ -0,0 +1,268 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/patch.hpp>
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/binary.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/struct.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <vector>
+using namespace boost::hana;
+
+
+template <typename S>
+std::vector<char> patch(S const& a, S const& b) {
+    std::vector<char> bytes;
+    diff(a, b, std::back_inserter(bytes));
+    return bytes;
+}
+
+// Applies the whole patch to x, and returns whether it succeeded.
+template <typename S>
+bool patched(std::vector<char> const& bytes, S& x) {
+    char const* end = apply_patch(bytes.data(), bytes.data() + bytes.size(), x);
+    return end == bytes.data() + bytes.size();
+}
+
+namespace ns {
+    struct Point {
+        BOOST_HANA_DEFINE_STRUCT(Point,
+            (int, x),
+            (int, y)
+        );
+    };
+
+    // Mixes runs of raw members, padding, and members which are not raw.
+    struct Record {
+        BOOST_HANA_DEFINE_STRUCT(Record,
+            (std::int32_t, a),
+            (std::int32_t, b),
+            (std::int32_t, c),
+            (char, d),
+            (double, e),
+            (std::string, name),
+            (std::int16_t, f),
+            (std::int16_t, g),
+            (std::array<std::uint8_t, 3>, h),
+            (Point, point),
+            (std::vector<int>, values)
+        );
+
+        friend bool operator==(Record const& x, Record const& y) {
+            return x.a == y.a && x.b == y.b && x.c == y.c && x.d == y.d &&
+                   x.e == y.e && x.name == y.name && x.f == y.f &&
+                   x.g == y.g && x.h == y.h && equal(x.point, y.point) &&
+                   x.values == y.values;
+        }
+    };
+
+    struct Sixteen {
+        BOOST_HANA_DEFINE_STRUCT(Sixteen,
+            (char, m0), (char, m1), (char, m2), (char, m3),
+            (char, m4), (char, m5), (char, m6), (char, m7),
+            (char, m8), (char, m9), (char, m10), (char, m11),
+            (char, m12), (char, m13), (char, m14), (char, m15)
+        );
+    };
+
+    // A Struct whose members are not stored in it.
+    struct Computed {
+        int value;
+    };
+}
+
+namespace boost { namespace hana {
+    template <>
+    struct accessors_impl<ns::Computed> {
+        static BOOST_HANA_CONSTEXPR_LAMBDA auto apply() {
+            return make_tuple(
+                make_pair(BOOST_HANA_STRING("value"), [](auto&& c) -> decltype(auto) {
+                    return (c.value);
+                }),
+                make_pair(BOOST_HANA_STRING("twice"), [](auto&& c) {
+                    return c.value * 2;
+                })
+            );
+        }
+    };
+}}
+
+ns::Record record() {
+    return {1, 2, 3, 'x', 4.5, "name", 6, 7, {{8, 9, 10}}, {11, 12}, {13, 14}};
+}
+
+int main() {
+    // no change
+    {
+        ns::Record a = record();
+        std::vector<char> bytes = patch(a, a);
+        BOOST_HANA_RUNTIME_CHECK(bytes == std::vector<char>(2, 0));
+
+        ns::Record x = a;
+        BOOST_HANA_RUNTIME_CHECK(patched(bytes, x));
+        BOOST_HANA_RUNTIME_CHECK(x == a);
+    }
+
+    // the mask holds one bit per changed member, followed by the changed
+    // members of the second object
+    {
+        ns::Record a = record(), b = a;
+        b.b = 20;
+        b.name = "other";
+        b.point.y = 120;
+        std::vector<char> bytes = patch(a, b);
+
+        std::vector<char> expected{
+            (1 << 1) | (1 << 5),
+            1 << (9 - 8)
+        };
+        to_binary(b.b, std::back_inserter(expected));
+        to_binary(b.name, std::back_inserter(expected));
+        to_binary(b.point, std::back_inserter(expected));
+        BOOST_HANA_RUNTIME_CHECK(bytes == expected);
+
+        ns::Record x = a;
+        BOOST_HANA_RUNTIME_CHECK(patched(bytes, x));
+        BOOST_HANA_RUNTIME_CHECK(x == b);
+    }
+
+    // every single member is detected, whether it is in a run or not
+    {
+        ns::Record const a = record();
+        auto check = [&](auto change, std::size_t index) {
+            ns::Record b = a;
+            change(b);
+            std::vector<char> bytes = patch(a, b);
+            BOOST_HANA_RUNTIME_CHECK(bytes.size() > 2);
+            for (std::size_t i = 0; i != 11; ++i) {
+                bool const set = (bytes[i / 8] >> (i % 8)) & 1;
+                BOOST_HANA_RUNTIME_CHECK(set == (i == index));
+            }
+
+            ns::Record x = a;
+            BOOST_HANA_RUNTIME_CHECK(patched(bytes, x));
+            BOOST_HANA_RUNTIME_CHECK(x == b);
+        };
+        check([](ns::Record& r) { r.a = -1; }, 0);
+        check([](ns::Record& r) { r.b = -1; }, 1);
+        check([](ns::Record& r) { r.c = -1; }, 2);
+        check([](ns::Record& r) { r.d = 'y'; }, 3);
+        check([](ns::Record& r) { r.e = -1.5; }, 4);
+        check([](ns::Record& r) { r.name += "!"; }, 5);
+        check([](ns::Record& r) { r.f = -1; }, 6);
+        check([](ns::Record& r) { r.g = -1; }, 7);
+        check([](ns::Record& r) { r.h[2] = 0; }, 8);
+        check([](ns::Record& r) { r.point.x = -1; }, 9);
+        check([](ns::Record& r) { r.values.push_back(15); }, 10);
+    }
+
+    // every member changed
+    {
+        ns::Record a{}, b = record();
+        std::vector<char> bytes = patch(a, b);
+        std::vector<char> expected{char(0xFF), 0x07};
+        to_binary(b, std::back_inserter(expected));
+        BOOST_HANA_RUNTIME_CHECK(bytes == expected);
+
+        BOOST_HANA_RUNTIME_CHECK(patched(bytes, a));
+        BOOST_HANA_RUNTIME_CHECK(a == b);
+    }
+
+    // a patch can be applied to an object other than the original one
+    {
+        ns::Record a = record(), b = a, x = a;
+        b.c = 30;
+        x.a = 100;
+        x.c = 0;
+        BOOST_HANA_RUNTIME_CHECK(patched(patch(a, b), x));
+        BOOST_HANA_RUNTIME_CHECK(x.a == 100);
+        BOOST_HANA_RUNTIME_CHECK(x.c == 30);
+    }
+
+    // a whole number of bytes for the mask
+    {
+        ns::Sixteen a{}, b{};
+        b.m15 = 'z';
+        b.m3 = 'w';
+        std::vector<char> bytes = patch(a, b);
+        BOOST_HANA_RUNTIME_CHECK((bytes == std::vector<char>{1 << 3, char(1 << 7), 'w', 'z'}));
+
+        BOOST_HANA_RUNTIME_CHECK(patched(bytes, a));
+        BOOST_HANA_RUNTIME_CHECK(a.m3 == 'w' && a.m15 == 'z');
+    }
+
+    // members returned by value are compared, but can't be patched
+    {
+        ns::Computed a{1}, b{1};
+        BOOST_HANA_RUNTIME_CHECK((patch(a, b) == std::vector<char>{0}));
+        b.value = 2;
+        std::vector<char> bytes = patch(a, b);
+        BOOST_HANA_RUNTIME_CHECK(bytes.size() == 1 + 2 * sizeof(int));
+        BOOST_HANA_RUNTIME_CHECK(bytes[0] == 3);
+    }
+
+    // invalid patches are rejected
+    {
+        ns::Record a = record(), b = a;
+        b.name = "changed";
+        b.f = 60;
+        std::vector<char> const bytes = patch(a, b);
+
+        // every strict prefix
+        for (std::size_t n = 0; n != bytes.size(); ++n) {
+            std::vector<char> prefix(bytes.begin(), bytes.begin() + n);
+            ns::Record x = a;
+            BOOST_HANA_RUNTIME_CHECK(
+                apply_patch(prefix.data(), prefix.data() + n, x) == nullptr);
+        }
+
+        // bits set past the last member
+        std::vector<char> extra = bytes;
+        extra[1] = static_cast<char>(extra[1] | (1 << 3));
+        ns::Record x = a;
+        BOOST_HANA_RUNTIME_CHECK(
+            apply_patch(extra.data(), extra.data() + extra.size(), x) == nullptr);
+
+        // trailing bytes are left alone
+        std::vector<char> longer = bytes;
+        longer.push_back('#');
+        ns::Record y = a;
+        BOOST_HANA_RUNTIME_CHECK(
+            apply_patch(longer.data(), longer.data() + longer.size(), y)
+                == longer.data() + bytes.size());
+        BOOST_HANA_RUNTIME_CHECK(y == b);
+    }
+
+    // patches can be chained
+    {
+        ns::Record v0 = record(), v1 = v0, v2;
+        v1.e = 9.25;
+        v2 = v1;
+        v2.values.clear();
+        v2.a = 42;
+
+        std::vector<char> bytes = patch(v0, v1);
+        std::vector<char> next = patch(v1, v2);
+        bytes.insert(bytes.end(), next.begin(), next.end());
+
+        ns::Record x = v0;
+        char const* p = apply_patch(bytes.data(), bytes.data() + bytes.size(), x);
+        BOOST_HANA_RUNTIME_CHECK(p != nullptr);
+        BOOST_HANA_RUNTIME_CHECK(x == v1);
+        p = apply_patch(p, bytes.data() + bytes.size(), x);
+        BOOST_HANA_RUNTIME_CHECK(p == bytes.data() + bytes.size());
+        BOOST_HANA_RUNTIME_CHECK(x == v2);
+    }
+}
@@ -0,0 +1,111 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/pipeline.hpp>
+
+#include <boost/hana/assert.hpp>
+
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+using namespace boost::hana;
+
+
+struct move_only {
+    std::unique_ptr<int> value;
+    explicit move_only(int v) : value{new int{v}} { }
+};
+
+int main() {
+    // empty input
+    {
+        std::vector<int> in, out;
+        auto it = pipeline([](int x) { return x; })(in.begin(), in.end(),
+                                                    std::back_inserter(out));
+        (void)it;
+        BOOST_HANA_RUNTIME_CHECK(out.empty());
+    }
+
+    // results are produced in order, and the types of the intermediate
+    // elements are deduced from the stages
+    {
+        std::vector<int> in(1000);
+        std::iota(in.begin(), in.end(), 0);
+        std::vector<std::string> out;
+        auto p = pipeline(
+            [](int x) { return x * 2.5; },
+            [](double x) { return std::to_string(static_cast<long>(x)); },
+            [](std::string s) { return s + "!"; }
+        );
+
+        for (auto q : {p, p.with_buffer(1, 1), p.with_buffer(7, 3),
+                          p.with_buffer(16, 100)}) {
+            out.clear();
+            q(in.begin(), in.end(), std::back_inserter(out));
+            BOOST_HANA_RUNTIME_CHECK(out.size() == in.size());
+            for (std::size_t i = 0; i < in.size(); ++i)
+                BOOST_HANA_RUNTIME_CHECK(
+                    out[i] == std::to_string(static_cast<long>(in[i] * 2.5)) + "!"
+                );
+        }
+    }
+
+    // the returned iterator is past the last element written
+    {
+        int in[] = {1, 2, 3};
+        int out[3] = {0};
+        int* end = pipeline([](int x) { return x + 1; })(in, in + 3, out);
+        BOOST_HANA_RUNTIME_CHECK(end == out + 3);
+        BOOST_HANA_RUNTIME_CHECK(out[0] == 2 && out[1] == 3 && out[2] == 4);
+    }
+
+    // move-only intermediate elements, and stateful stages
+    {
+        std::vector<int> in(100, 1), out;
+        int calls = 0;
+        auto p = pipeline(
+            [](int x) { return move_only{x}; },
+            [n = 0](move_only m) mutable { return *m.value + n++; },
+            [&calls](int x) { ++calls; return x; }
+        );
+        p(in.begin(), in.end(), std::back_inserter(out));
+        BOOST_HANA_RUNTIME_CHECK(calls == 100);
+        for (int i = 0; i < 100; ++i)
+            BOOST_HANA_RUNTIME_CHECK(out[i] == i + 1);
+
+        // each run starts with a fresh copy of the stages
+        out.clear();
+        p(in.begin(), in.end(), std::back_inserter(out));
+        BOOST_HANA_RUNTIME_CHECK(out[0] == 1 && out[99] == 100);
+    }
+
+    // exceptions stop the pipeline and are propagated to the caller
+    {
+        std::vector<int> in(10000);
+        std::iota(in.begin(), in.end(), 0);
+        std::vector<int> out;
+        auto p = pipeline(
+            [](int x) { return std::make_shared<int>(x); },
+            [](std::shared_ptr<int> x) {
+                if (*x == 5000)
+                    throw std::runtime_error{"5000"};
+                return *x;
+            }
+        ).with_buffer(16, 4);
+
+        bool thrown = false;
+        try {
+            p(in.begin(), in.end(), std::back_inserter(out));
+        } catch (std::runtime_error const& e) {
+            thrown = std::string{e.what()} == "5000";
+        }
+        BOOST_HANA_RUNTIME_CHECK(thrown);
+        BOOST_HANA_RUNTIME_CHECK(out.size() == 5000);
+    }
+}
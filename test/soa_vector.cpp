@@ -0,0 +1,245 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/soa_vector.hpp>
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/searchable.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/struct.hpp>
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+using namespace boost::hana;
+
+
+namespace ns {
+    struct Point {
+        BOOST_HANA_DEFINE_STRUCT(Point,
+            (int, x),
+            (int, y)
+        );
+    };
+
+    struct Record {
+        int id;
+        std::string name;
+        double score;
+    };
+
+    // Throws when copied for the `n`th time.
+    int copies_left = -1;
+    struct throwing {
+        int value;
+        throwing(int v) : value{v} { }
+        throwing(throwing const& other) : value{other.value} {
+            if (copies_left-- == 0)
+                throw 0;
+        }
+        throwing& operator=(throwing const&) = default;
+    };
+
+    struct Fragile {
+        BOOST_HANA_DEFINE_STRUCT(Fragile,
+            (int, a),
+            (throwing, b)
+        );
+    };
+
+    struct Flagged {
+        BOOST_HANA_DEFINE_STRUCT(Flagged,
+            (int, id),
+            (bool, active)
+        );
+    };
+
+    struct Movable {
+        BOOST_HANA_DEFINE_STRUCT(Movable,
+            (std::unique_ptr<int>, p),
+            (int, i)
+        );
+    };
+}
+
+BOOST_HANA_ADAPT_STRUCT(ns::Record,
+    (int, id),
+    (std::string, name),
+    (double, score)
+);
+
+
+int main() {
+    //////////////////////////////////////////////////////////////////////////
+    // push_back, size and operator[]
+    //////////////////////////////////////////////////////////////////////////
+    {
+        soa_vector<ns::Record> v;
+        BOOST_HANA_RUNTIME_CHECK(v.empty());
+
+        v.push_back(ns::Record{1, "one", 1.5});
+        ns::Record const two{2, "two", 2.5};
+        v.push_back(two);
+        BOOST_HANA_RUNTIME_CHECK(v.size() == 2);
+        BOOST_HANA_RUNTIME_CHECK(!v.empty());
+
+        BOOST_HANA_RUNTIME_CHECK(at_key(v[0], BOOST_HANA_STRING("id")) == 1);
+        BOOST_HANA_RUNTIME_CHECK(at_key(v[0], BOOST_HANA_STRING("name")) == "one");
+        BOOST_HANA_RUNTIME_CHECK(at_key(v[1], BOOST_HANA_STRING("score")) == 2.5);
+
+        // the proxy refers to the elements of the columns
+        at_key(v[1], BOOST_HANA_STRING("name")) = "deux";
+        BOOST_HANA_RUNTIME_CHECK(v.column(BOOST_HANA_STRING("name"))[1] == "deux");
+        BOOST_HANA_RUNTIME_CHECK(&at_key(v[1], BOOST_HANA_STRING("id")) ==
+                                 &v.column(BOOST_HANA_STRING("id"))[1]);
+
+        // assigning an object to the proxy assigns all the members
+        v[0] = ns::Record{10, "ten", 10.5};
+        BOOST_HANA_RUNTIME_CHECK(at_key(v[0], BOOST_HANA_STRING("id")) == 10);
+        BOOST_HANA_RUNTIME_CHECK(at_key(v[0], BOOST_HANA_STRING("name")) == "ten");
+        BOOST_HANA_RUNTIME_CHECK(at_key(v[0], BOOST_HANA_STRING("score")) == 10.5);
+
+        // the proxy is a Struct
+        int sum = 0;
+        for_each(v[0], [&](auto const& member) {
+            sum += static_cast<int>(sizeof(second(member)) > 0);
+        });
+        BOOST_HANA_RUNTIME_CHECK(sum == 3);
+
+        // const access
+        soa_vector<ns::Record> const& cv = v;
+        auto id = BOOST_HANA_STRING("id");
+        static_assert(std::is_same<decltype(at_key(cv[0], id)), int const&>{}, "");
+        BOOST_HANA_RUNTIME_CHECK(at_key(cv[1], BOOST_HANA_STRING("id")) == 2);
+
+        v.pop_back();
+        BOOST_HANA_RUNTIME_CHECK(v.size() == 1);
+        v.clear();
+        BOOST_HANA_RUNTIME_CHECK(v.empty());
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // column
+    //////////////////////////////////////////////////////////////////////////
+    {
+        soa_vector<ns::Point> v;
+        v.reserve(100);
+        for (int i = 0; i != 100; ++i)
+            v.push_back(ns::Point{i, 2 * i});
+
+        auto xs = v.column(BOOST_HANA_STRING("x"));
+        auto ys = v.column(BOOST_HANA_STRING("y"));
+        BOOST_HANA_RUNTIME_CHECK(xs.size() == 100 && ys.size() == 100);
+
+        // the elements of a column are contiguous
+        BOOST_HANA_RUNTIME_CHECK(&xs[99] == xs.data() + 99);
+        BOOST_HANA_RUNTIME_CHECK(xs.end() - xs.begin() == 100);
+
+        int sum = 0;
+        for (int y : ys)
+            sum += y;
+        BOOST_HANA_RUNTIME_CHECK(sum == 9900);
+
+        for (int& x : xs)
+            x = -x;
+        BOOST_HANA_RUNTIME_CHECK(at_key(v[3], BOOST_HANA_STRING("x")) == -3);
+
+        soa_vector<ns::Point> const& cv = v;
+        auto x = BOOST_HANA_STRING("x");
+        static_assert(std::is_same<decltype(cv.column(x)[0]), int const&>{}, "");
+
+        v.resize(10);
+        BOOST_HANA_RUNTIME_CHECK(v.column(BOOST_HANA_STRING("y")).size() == 10);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // for_each_column
+    //////////////////////////////////////////////////////////////////////////
+    {
+        soa_vector<ns::Record> v;
+        v.push_back(ns::Record{1, "a", 0.5});
+        v.push_back(ns::Record{2, "b", 1.5});
+
+        std::vector<std::string> names;
+        std::size_t elements = 0;
+        v.for_each_column([&](auto key, auto column) {
+            names.push_back(to<char const*>(key));
+            elements += column.size();
+        });
+        BOOST_HANA_RUNTIME_CHECK((names == std::vector<std::string>{"id", "name", "score"}));
+        BOOST_HANA_RUNTIME_CHECK(elements == 6);
+
+        soa_vector<ns::Record> const& cv = v;
+        cv.for_each_column([](auto, auto column) {
+            static_assert(std::is_const<
+                std::remove_reference_t<decltype(column[0])>
+            >{}, "");
+        });
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // The columns stay consistent when copying a member throws
+    //////////////////////////////////////////////////////////////////////////
+    {
+        soa_vector<ns::Fragile> v;
+        v.push_back(ns::Fragile{1, 1});
+
+        ns::Fragile const f{2, 2};
+        ns::copies_left = 0;
+        bool thrown = false;
+        try { v.push_back(f); } catch (int) { thrown = true; }
+        BOOST_HANA_RUNTIME_CHECK(thrown);
+        BOOST_HANA_RUNTIME_CHECK(v.size() == 1);
+        BOOST_HANA_RUNTIME_CHECK(v.column(BOOST_HANA_STRING("a")).size() == 1);
+        BOOST_HANA_RUNTIME_CHECK(v.column(BOOST_HANA_STRING("b")).size() == 1);
+        ns::copies_left = -1;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // The column of a bool member holds contiguous bools
+    //////////////////////////////////////////////////////////////////////////
+    {
+        soa_vector<ns::Flagged> v;
+        for (int i = 0; i != 20; ++i)
+            v.push_back(ns::Flagged{i, i % 3 == 0});
+
+        auto active = v.column(BOOST_HANA_STRING("active"));
+        static_assert(std::is_same<decltype(active[0]), bool&>{}, "");
+        BOOST_HANA_RUNTIME_CHECK(active.size() == 20);
+        BOOST_HANA_RUNTIME_CHECK(&active[19] == active.data() + 19);
+        BOOST_HANA_RUNTIME_CHECK(active[3] && !active[4]);
+
+        active[4] = true;
+        BOOST_HANA_RUNTIME_CHECK(at_key(v[4], BOOST_HANA_STRING("active")));
+        v[5] = ns::Flagged{50, true};
+        BOOST_HANA_RUNTIME_CHECK(v.column(BOOST_HANA_STRING("active"))[5]);
+
+        std::size_t elements = 0;
+        v.for_each_column([&](auto, auto column) { elements += column.size(); });
+        BOOST_HANA_RUNTIME_CHECK(elements == 40);
+
+        soa_vector<ns::Flagged> const copy = v;
+        v.resize(30);
+        BOOST_HANA_RUNTIME_CHECK(!v.column(BOOST_HANA_STRING("active"))[29]);
+        v.pop_back();
+        BOOST_HANA_RUNTIME_CHECK(v.size() == 29);
+        BOOST_HANA_RUNTIME_CHECK(copy.size() == 20);
+        BOOST_HANA_RUNTIME_CHECK(copy.column(BOOST_HANA_STRING("active"))[4]);
+        auto key = BOOST_HANA_STRING("active");
+        static_assert(std::is_same<decltype(copy.column(key)[0]), bool const&>{}, "");
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Move-only members are moved in
+    //////////////////////////////////////////////////////////////////////////
+    {
+        soa_vector<ns::Movable> v;
+        v.push_back(ns::Movable{std::make_unique<int>(3), 4});
+        BOOST_HANA_RUNTIME_CHECK(*at_key(v[0], BOOST_HANA_STRING("p")) == 3);
+    }
+}
@@ -33,6 +33,18 @@ struct move_only {
     move_only(move_only&&) = default;
 };
 
+int copies = 0;
+struct counted {
+    int value;
+    counted(int v) : value{v} { }
+    counted(counted const& other) : value{other.value} { ++copies; }
+    counted(counted&&) = default;
+    friend bool operator==(counted const& a, counted const& b)
+    { return a.value == b.value; }
+    friend bool operator!=(counted const& a, counted const& b)
+    { return a.value != b.value; }
+};
+
 template <int N>
 struct MinimalStruct;
 
@@ -112,6 +124,69 @@ int main() {
         auto z2 = members(obj(move_only{}, move_only{})); (void)z2;
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    // members_ref
+    //////////////////////////////////////////////////////////////////////////
+    {
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            members_ref(obj()),
+            test::seq()
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            members_ref(obj(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{})),
+            test::seq(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{})
+        ));
+
+        // it refers to the members of lvalues
+        auto x = obj(counted{0}, counted{1});
+        copies = 0;
+        auto refs = members_ref(x);
+        BOOST_HANA_RUNTIME_CHECK(copies == 0);
+        BOOST_HANA_RUNTIME_CHECK(&at_c<0>(refs) == &at_c<0>(x.members));
+        BOOST_HANA_RUNTIME_CHECK(&at_c<1>(refs) == &at_c<1>(x.members));
+        at_c<1>(refs).value = 99;
+        BOOST_HANA_RUNTIME_CHECK(at_c<1>(x.members).value == 99);
+
+        auto const& cx = x;
+        BOOST_HANA_RUNTIME_CHECK(&at_c<0>(members_ref(cx)) == &at_c<0>(x.members));
+
+        // and moves the members of rvalues
+        auto z = members_ref(obj(move_only{}, move_only{})); (void)z;
+        copies = 0;
+        auto moved = members_ref(obj(counted{3}));
+        BOOST_HANA_RUNTIME_CHECK(copies == 0);
+        BOOST_HANA_RUNTIME_CHECK(at_c<0>(moved).value == 3);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Folding, searching and comparing never copy the members
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto x = obj(counted{0}, counted{1});
+        copies = 0;
+
+        int sum = 0;
+        for_each(x, [&](auto const& member) {
+            sum += second(member).value;
+        });
+        BOOST_HANA_RUNTIME_CHECK(sum == 1);
+
+        sum = fold_left(x, 0, [](int state, auto const& member) {
+            return state + second(member).value;
+        });
+        BOOST_HANA_RUNTIME_CHECK(sum == 1);
+
+        BOOST_HANA_RUNTIME_CHECK(&at_key(x, int_<1>) == &at_c<1>(x.members));
+        at_key(x, int_<0>).value = 5;
+        BOOST_HANA_RUNTIME_CHECK(at_c<0>(x.members).value == 5);
+
+        auto y = obj(counted{5}, counted{1});
+        copies = 0;
+        BOOST_HANA_RUNTIME_CHECK(equal(x, y));
+        BOOST_HANA_RUNTIME_CHECK(copies == 0);
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // keys
     //////////////////////////////////////////////////////////////////////////
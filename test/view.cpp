@@ -0,0 +1,200 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/view.hpp>
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/functional/always.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <laws/base.hpp>
+#include <laws/comparable.hpp>
+#include <laws/foldable.hpp>
+#include <laws/iterable.hpp>
+#include <laws/searchable.hpp>
+
+#include <type_traits>
+using namespace boost::hana;
+
+
+template <int i>
+using eq = test::ct_eq<i>;
+
+struct is_not_1 {
+    template <typename X>
+    constexpr auto operator()(X x) const
+    { return not_(equal(x, eq<1>{})); }
+};
+
+struct counted {
+    static int copies;
+    int value;
+    explicit counted(int v) : value{v} { }
+    counted(counted const& other) : value{other.value} { ++copies; }
+    counted(counted&& other) : value{other.value} { ++copies; }
+};
+
+int counted::copies = 0;
+
+
+int main() {
+    using boost::hana::size_t; // disambiguate with ::size_t on GCC
+
+    auto xs0 = make<Tuple>();
+    auto xs1 = make<Tuple>(eq<0>{});
+    auto xs2 = make<Tuple>(eq<0>{}, eq<1>{});
+    auto xs3 = make<Tuple>(eq<0>{}, eq<1>{}, eq<2>{});
+    auto xs5 = make<Tuple>(eq<0>{}, eq<1>{}, eq<2>{}, eq<3>{}, eq<4>{});
+    test::_injection<0> f{};
+
+    auto views = make<Tuple>(
+          view::reverse(xs0)
+        , view::reverse(xs1)
+        , view::transform(xs2, f)
+        , view::filter(xs3, is_not_1{})
+        , view::reverse(xs5)
+        , view::slice(view::reverse(xs5), size_t<1>, size_t<4>)
+        , view::filter(view::transform(xs5, f), always(true_))
+    );
+
+    //////////////////////////////////////////////////////////////////////////
+    // Creating views
+    //////////////////////////////////////////////////////////////////////////
+    {
+        // transform
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            to<Tuple>(view::transform(xs0, f)),
+            make<Tuple>()
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            to<Tuple>(view::transform(xs3, f)),
+            make<Tuple>(f(eq<0>{}), f(eq<1>{}), f(eq<2>{}))
+        ));
+
+        // filter
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            to<Tuple>(view::filter(xs0, is_not_1{})),
+            make<Tuple>()
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            to<Tuple>(view::filter(xs2, always(false_))),
+            make<Tuple>()
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            to<Tuple>(view::filter(xs3, is_not_1{})),
+            make<Tuple>(eq<0>{}, eq<2>{})
+        ));
+
+        // reverse
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            to<Tuple>(view::reverse(xs3)),
+            make<Tuple>(eq<2>{}, eq<1>{}, eq<0>{})
+        ));
+
+        // slice
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            to<Tuple>(view::slice(xs5, size_t<0>, size_t<0>)),
+            make<Tuple>()
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            to<Tuple>(view::slice(xs5, size_t<1>, size_t<3>)),
+            make<Tuple>(eq<1>{}, eq<2>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            to<Tuple>(view::slice(xs5, int_<0>, int_<5>)),
+            xs5
+        ));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Chains of views are flattened into a single view over the base
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto chain = view::slice(
+            view::filter(
+                view::reverse(view::transform(xs5, f)),
+                [=](auto x) { return not_(equal(x, f(eq<3>{}))); }
+            ),
+            size_t<1>, size_t<3>
+        );
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            to<Tuple>(chain),
+            make<Tuple>(f(eq<2>{}), f(eq<1>{}))
+        ));
+
+        using Base = std::remove_reference<decltype(chain.base)>::type;
+        static_assert(std::is_same<Base, decltype(xs5)>{}, "");
+        static_assert(std::is_same<
+            decltype(chain)::indices, std::index_sequence<2, 1>
+        >{}, "");
+        BOOST_HANA_RUNTIME_CHECK(&chain.base == &xs5);
+
+        // transforms compose
+        test::_injection<1> g{};
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            to<Tuple>(view::transform(view::transform(xs2, f), g)),
+            make<Tuple>(g(f(eq<0>{})), g(f(eq<1>{})))
+        ));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Views never copy the elements of their base
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto xs = make<Tuple>(counted{1}, counted{2}, counted{3}, counted{4});
+        counted::copies = 0;
+
+        auto v = view::filter(
+            view::reverse(xs),
+            [](auto const&) { return true_; }
+        );
+        int sum = 0;
+        for_each(v, [&](counted const& c) { sum += c.value; });
+        BOOST_HANA_RUNTIME_CHECK(sum == 10);
+
+        int first = fold_left(view::slice(v, size_t<1>, size_t<3>), 0,
+            [](int s, counted const& c) { return s * 10 + c.value; });
+        BOOST_HANA_RUNTIME_CHECK(first == 32);
+        BOOST_HANA_RUNTIME_CHECK(head(v).value == 4);
+        BOOST_HANA_RUNTIME_CHECK(v[size_t<3>].value == 1);
+        BOOST_HANA_RUNTIME_CHECK(counted::copies == 0);
+
+        // elements of a mutable base can be modified through a view
+        for_each(view::slice(xs, size_t<0>, size_t<2>), [](counted& c) {
+            c.value = 0;
+        });
+        BOOST_HANA_RUNTIME_CHECK(at_c<0>(xs).value == 0);
+        BOOST_HANA_RUNTIME_CHECK(at_c<1>(xs).value == 0);
+        BOOST_HANA_RUNTIME_CHECK(at_c<2>(xs).value == 3);
+        BOOST_HANA_RUNTIME_CHECK(counted::copies == 0);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // The transformation is only applied to the elements that are kept
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto xs = make<Tuple>(1, 2.2, 3, 4.4);
+        int calls = 0;
+        auto v = view::filter(
+            view::transform(xs, [&](auto x) { ++calls; return x * 2; }),
+            [](auto x) { return bool_<std::is_integral<decltype(x)>{}>; }
+        );
+        BOOST_HANA_RUNTIME_CHECK(calls == 0);
+        BOOST_HANA_RUNTIME_CHECK(to<Tuple>(v) == make<Tuple>(2, 6));
+        BOOST_HANA_RUNTIME_CHECK(calls == 2);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Comparable, Foldable, Iterable and Searchable
+    //////////////////////////////////////////////////////////////////////////
+    {
+        test::TestComparable<View>{views};
+        test::TestFoldable<View>{views};
+        test::TestIterable<View>{views};
+        test::TestSearchable<View>{views, make<Tuple>(eq<2>{}, eq<4>{})};
+    }
+}
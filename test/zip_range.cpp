@@ -0,0 +1,149 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/zip_range.hpp>
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <vector>
+using namespace boost::hana;
+
+
+int main() {
+    //////////////////////////////////////////////////////////////////////////
+    // Rows are tuples of references
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto columns = make<Tuple>(
+            std::vector<int>{1, 2, 3},
+            std::vector<std::string>{"a", "b", "c"},
+            std::array<double, 3>{{1.5, 2.5, 3.5}}
+        );
+        auto z = zip_range(columns);
+
+        static_assert(std::is_same<
+            decltype(*z.begin()), _tuple<int&, std::string&, double&>
+        >{}, "");
+        BOOST_HANA_RUNTIME_CHECK(z.size() == 3);
+        BOOST_HANA_RUNTIME_CHECK(!z.empty());
+
+        BOOST_HANA_RUNTIME_CHECK(&at_c<0>(z[1]) == &at_c<0>(columns)[1]);
+        BOOST_HANA_RUNTIME_CHECK(&at_c<1>(z[2]) == &at_c<1>(columns)[2]);
+        BOOST_HANA_RUNTIME_CHECK(&at_c<2>(z[0]) == &at_c<2>(columns)[0]);
+
+        // modify the columns through the rows
+        for (auto row : z) {
+            at_c<0>(row) *= 10;
+            at_c<1>(row) += "!";
+        }
+        BOOST_HANA_RUNTIME_CHECK(at_c<0>(columns) == std::vector<int>{10, 20, 30});
+        BOOST_HANA_RUNTIME_CHECK(
+            at_c<1>(columns) == std::vector<std::string>{"a!", "b!", "c!"}
+        );
+
+        // rows can be used like any tuple
+        BOOST_HANA_RUNTIME_CHECK(z[2] == make<Tuple>(30, std::string{"c!"}, 3.5));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // const columns yield const references
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto const columns = make<Tuple>(std::vector<int>{1, 2}, std::vector<char>{'x', 'y'});
+        auto z = zip_range(columns);
+        static_assert(std::is_same<
+            decltype(z[0]), _tuple<int const&, char const&>
+        >{}, "");
+        BOOST_HANA_RUNTIME_CHECK(z[1] == make<Tuple>(2, 'y'));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // The range has as many rows as the shortest column
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto columns = make<Tuple>(std::vector<int>{1, 2, 3}, std::vector<int>{4, 5});
+        BOOST_HANA_RUNTIME_CHECK(zip_range(columns).size() == 2);
+
+        auto empty = make<Tuple>(std::vector<int>{}, std::vector<int>{4, 5});
+        BOOST_HANA_RUNTIME_CHECK(zip_range(empty).empty());
+        BOOST_HANA_RUNTIME_CHECK(zip_range(empty).begin() == zip_range(empty).end());
+
+        auto none = make<Tuple>();
+        BOOST_HANA_RUNTIME_CHECK(zip_range(none).empty());
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Random access iterator
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto columns = make<Tuple>(std::vector<int>{0, 1, 2, 3, 4}, std::vector<long>{0, 10, 20, 30, 40});
+        auto z = zip_range(columns);
+        auto first = z.begin(), last = z.end();
+
+        BOOST_HANA_RUNTIME_CHECK(last - first == 5);
+        BOOST_HANA_RUNTIME_CHECK(std::distance(first, last) == 5);
+        BOOST_HANA_RUNTIME_CHECK(at_c<1>(first[3]) == 30);
+        BOOST_HANA_RUNTIME_CHECK(at_c<0>(*(first + 2)) == 2);
+        BOOST_HANA_RUNTIME_CHECK(at_c<0>(*(2 + first)) == 2);
+        BOOST_HANA_RUNTIME_CHECK(at_c<0>(*(last - 1)) == 4);
+        BOOST_HANA_RUNTIME_CHECK(first < last && last > first);
+        BOOST_HANA_RUNTIME_CHECK(first <= first && first >= first);
+
+        auto it = first;
+        BOOST_HANA_RUNTIME_CHECK(it++ == first);
+        BOOST_HANA_RUNTIME_CHECK(++it == first + 2);
+        BOOST_HANA_RUNTIME_CHECK(it-- == first + 2);
+        BOOST_HANA_RUNTIME_CHECK(--it == first);
+        it += 4;
+        it -= 1;
+        BOOST_HANA_RUNTIME_CHECK(it - first == 3);
+
+        auto found = std::find_if(first, last, [](auto row) {
+            return at_c<1>(row) == 20;
+        });
+        BOOST_HANA_RUNTIME_CHECK(found - first == 2);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Column-wise kernels
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto columns = make<Tuple>(
+            std::vector<int>{1, 2, 3, 4},
+            std::vector<double>{0.5, 1.5, 2.5},
+            std::vector<std::string>{"a", "b", "c"}
+        );
+        auto z = zip_range(columns);
+
+        std::vector<std::size_t> lengths;
+        for_each_column(z, [&](auto first, auto last) {
+            lengths.push_back(static_cast<std::size_t>(last - first));
+        });
+        BOOST_HANA_RUNTIME_CHECK(lengths == std::vector<std::size_t>{3, 3, 3});
+
+        transform_columns(z, [](auto const& x) { return x + x; });
+        BOOST_HANA_RUNTIME_CHECK(at_c<0>(columns) == std::vector<int>{2, 4, 6, 4});
+        BOOST_HANA_RUNTIME_CHECK(at_c<1>(columns) == std::vector<double>{1.0, 3.0, 5.0});
+        BOOST_HANA_RUNTIME_CHECK(
+            at_c<2>(columns) == std::vector<std::string>{"aa", "bb", "cc"}
+        );
+
+        // the columns are processed one after the other
+        std::string order;
+        for_each_column(z, [&](auto first, auto last) {
+            for (; first != last; ++first)
+                order += std::is_same<decltype(*first), int&>{} ? 'i' :
+                         std::is_same<decltype(*first), double&>{} ? 'd' : 's';
+        });
+        BOOST_HANA_RUNTIME_CHECK(order == "iiidddsss");
+    }
+}